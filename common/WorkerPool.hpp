@@ -0,0 +1,104 @@
+//// WorkerPool.hpp ////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the persistent worker thread pool
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace nexo {
+
+    /**
+     * @class WorkerPool
+     * @brief Fixed set of threads created once and reused by every parallel loop of the frame.
+     *
+     * run() hands each task index to its own thread, the calling thread taking the first one, so the
+     * tasks of a call all run at the same time and may wait on each other (through a std::barrier for
+     * instance). An exception thrown by a task is caught on its thread, the other tasks keep running,
+     * and the first exception is rethrown by run() once every task is done.
+     *
+     * Calls to run() are serialized. A task must not call run() on its own pool.
+     */
+    class WorkerPool {
+        public:
+            /**
+            * @param workerCount Number of threads created besides the calling thread.
+            */
+            explicit WorkerPool(unsigned int workerCount);
+            ~WorkerPool();
+
+            WorkerPool(const WorkerPool &) = delete;
+            WorkerPool &operator=(const WorkerPool &) = delete;
+
+            /**
+            * @brief Returns the pool shared by the engine systems, sized to the hardware threads.
+            */
+            static WorkerPool &getShared();
+
+            /**
+            * @brief Returns the number of tasks that can run at the same time, the calling thread included.
+            */
+            [[nodiscard]] std::size_t getThreadCount() const { return m_threads.size() + 1; }
+
+            /**
+            * @brief Runs task(index) for every index in [0, taskCount) and waits for all of them.
+            *
+            * @param taskCount Number of tasks, at most getThreadCount().
+            * @param task Callable taking the task index. It is only referenced, never copied.
+            * @throws Rethrows the first exception thrown by a task.
+            */
+            template<typename Fn>
+            void run(const std::size_t taskCount, Fn &&task)
+            {
+                runTasks(taskCount, [](void *context, const std::size_t index) {
+                    (*static_cast<std::remove_reference_t<Fn> *>(context))(index);
+                }, const_cast<void *>(static_cast<const void *>(std::addressof(task))));
+            }
+
+        private:
+            using TaskFunction = void (*)(void *context, std::size_t index);
+
+            void runTasks(std::size_t taskCount, TaskFunction function, void *context);
+            void execute(std::size_t index);
+            void workerLoop(std::size_t index);
+
+            std::vector<std::thread> m_threads;
+            std::mutex m_runMutex;
+
+            // Current job, guarded by m_mutex
+            std::mutex m_mutex;
+            std::condition_variable m_wake;
+            std::condition_variable m_done;
+            TaskFunction m_function = nullptr;
+            void *m_context = nullptr;
+            std::size_t m_taskCount = 0;
+            std::size_t m_remaining = 0;
+            std::uint64_t m_generation = 0;
+            std::exception_ptr m_error;
+            bool m_stopping = false;
+    };
+
+}
@@ -0,0 +1,484 @@
+//// AabbTree.cpp //////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the dynamic bounding volume hierarchy
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "AabbTree.hpp"
+#include "WorkerPool.hpp"
+
+#include <cassert>
+
+namespace nexo::math {
+
+    AabbTree::AabbTree(const float margin) : m_margin(margin)
+    {
+    }
+
+    Aabb AabbTree::fatten(const Aabb &box) const
+    {
+        return {box.min - glm::vec3(m_margin), box.max + glm::vec3(m_margin)};
+    }
+
+    int32_t AabbTree::allocateNode()
+    {
+        if (m_freeList == NULL_NODE) {
+            m_nodes.emplace_back();
+            return static_cast<int32_t>(m_nodes.size() - 1);
+        }
+        const int32_t node = m_freeList;
+        m_freeList = m_nodes[node].parent;
+        m_nodes[node] = Node{};
+        return node;
+    }
+
+    void AabbTree::freeNode(const int32_t node)
+    {
+        m_nodes[node] = Node{};
+        m_nodes[node].parent = m_freeList;
+        m_freeList = node;
+    }
+
+    int32_t AabbTree::allocateLeaf(const int32_t proxy)
+    {
+        const int32_t leaf = allocateNode();
+        m_nodes[leaf].box = fatten(m_proxies[proxy].bounds);
+        m_nodes[leaf].height = 0;
+        m_nodes[leaf].proxy = proxy;
+        m_proxies[proxy].node = leaf;
+        return leaf;
+    }
+
+    int32_t AabbTree::createProxy(const Aabb &box, const uint32_t userData)
+    {
+        int32_t proxy = m_freeProxies;
+        if (proxy == NULL_NODE) {
+            proxy = static_cast<int32_t>(m_proxies.size());
+            m_proxies.emplace_back();
+        } else
+            m_freeProxies = m_proxies[proxy].node;
+        m_proxies[proxy].bounds = box;
+        m_proxies[proxy].userData = userData;
+        insertLeaf(allocateLeaf(proxy));
+        ++m_proxyCount;
+        return proxy;
+    }
+
+    void AabbTree::destroyProxy(const int32_t proxy)
+    {
+        assert(proxy >= 0 && static_cast<size_t>(proxy) < m_proxies.size() && m_nodes[m_proxies[proxy].node].proxy == proxy);
+        const int32_t leaf = m_proxies[proxy].node;
+        removeLeaf(leaf);
+        freeNode(leaf);
+        m_proxies[proxy].node = m_freeProxies;
+        m_freeProxies = proxy;
+        --m_proxyCount;
+    }
+
+    bool AabbTree::moveProxy(const int32_t proxy, const Aabb &box)
+    {
+        m_proxies[proxy].bounds = box;
+        const int32_t leaf = m_proxies[proxy].node;
+        const Aabb &fat = m_nodes[leaf].box;
+        if (fat.min.x <= box.min.x && fat.min.y <= box.min.y && fat.min.z <= box.min.z &&
+            fat.max.x >= box.max.x && fat.max.y >= box.max.y && fat.max.z >= box.max.z)
+            return false;
+
+        removeLeaf(leaf);
+        m_nodes[leaf].box = fatten(box);
+        insertLeaf(leaf);
+        return true;
+    }
+
+    void AabbTree::setProxyBounds(const int32_t proxy, const Aabb &box)
+    {
+        m_proxies[proxy].bounds = box;
+        m_nodes[m_proxies[proxy].node].box = fatten(box);
+    }
+
+    void AabbTree::insertLeaf(const int32_t leaf)
+    {
+        m_depthFirstLayout = false;
+        if (m_root == NULL_NODE) {
+            m_root = leaf;
+            m_nodes[leaf].parent = NULL_NODE;
+            return;
+        }
+
+        // Descend towards the sibling with the lowest surface area cost
+        const Aabb leafBox = m_nodes[leaf].box;
+        int32_t index = m_root;
+        while (!m_nodes[index].isLeaf()) {
+            const Node &node = m_nodes[index];
+            const float area = surfaceArea(node.box);
+            const float combinedArea = surfaceArea(merge(node.box, leafBox));
+
+            // Cost of making a new parent for this node and the leaf, and minimum cost pushed down to the children
+            const float cost = 2.0f * combinedArea;
+            const float inheritanceCost = 2.0f * (combinedArea - area);
+
+            const auto childCost = [&](const int32_t child) {
+                const Aabb merged = merge(m_nodes[child].box, leafBox);
+                if (m_nodes[child].isLeaf())
+                    return surfaceArea(merged) + inheritanceCost;
+                return surfaceArea(merged) - surfaceArea(m_nodes[child].box) + inheritanceCost;
+            };
+            const float cost1 = childCost(node.child1);
+            const float cost2 = childCost(node.child2);
+            if (cost < cost1 && cost < cost2)
+                break;
+            index = cost1 < cost2 ? node.child1 : node.child2;
+        }
+
+        const int32_t sibling = index;
+        const int32_t oldParent = m_nodes[sibling].parent;
+        const int32_t newParent = allocateNode();
+        m_nodes[newParent].parent = oldParent;
+        m_nodes[newParent].box = merge(leafBox, m_nodes[sibling].box);
+        m_nodes[newParent].height = m_nodes[sibling].height + 1;
+        m_nodes[newParent].child1 = sibling;
+        m_nodes[newParent].child2 = leaf;
+        m_nodes[sibling].parent = newParent;
+        m_nodes[leaf].parent = newParent;
+
+        if (oldParent == NULL_NODE)
+            m_root = newParent;
+        else if (m_nodes[oldParent].child1 == sibling)
+            m_nodes[oldParent].child1 = newParent;
+        else
+            m_nodes[oldParent].child2 = newParent;
+
+        refitAncestors(m_nodes[leaf].parent);
+    }
+
+    void AabbTree::removeLeaf(const int32_t leaf)
+    {
+        m_depthFirstLayout = false;
+        if (leaf == m_root) {
+            m_root = NULL_NODE;
+            return;
+        }
+
+        const int32_t parent = m_nodes[leaf].parent;
+        const int32_t grandParent = m_nodes[parent].parent;
+        const int32_t sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+        if (grandParent == NULL_NODE) {
+            m_root = sibling;
+            m_nodes[sibling].parent = NULL_NODE;
+        } else {
+            if (m_nodes[grandParent].child1 == parent)
+                m_nodes[grandParent].child1 = sibling;
+            else
+                m_nodes[grandParent].child2 = sibling;
+            m_nodes[sibling].parent = grandParent;
+            refitAncestors(grandParent);
+        }
+        freeNode(parent);
+        m_nodes[leaf].parent = NULL_NODE;
+    }
+
+    void AabbTree::refitAncestors(int32_t node)
+    {
+        while (node != NULL_NODE) {
+            node = balance(node);
+            Node &current = m_nodes[node];
+            current.box = merge(m_nodes[current.child1].box, m_nodes[current.child2].box);
+            current.height = 1 + std::max(m_nodes[current.child1].height, m_nodes[current.child2].height);
+            node = current.parent;
+        }
+    }
+
+    // Rotates the higher grandchild up when the subtree of a node is unbalanced, returns the node now at its place
+    int32_t AabbTree::balance(const int32_t a)
+    {
+        Node &nodeA = m_nodes[a];
+        if (nodeA.isLeaf() || nodeA.height < 2)
+            return a;
+
+        const int32_t b = nodeA.child1;
+        const int32_t c = nodeA.child2;
+        const int32_t heightDelta = m_nodes[c].height - m_nodes[b].height;
+        if (heightDelta >= -1 && heightDelta <= 1)
+            return a;
+
+        // Promote the higher child: up is the child moving in place of a, down is its sibling
+        const int32_t up = heightDelta > 1 ? c : b;
+        const int32_t down = heightDelta > 1 ? b : c;
+        Node &nodeUp = m_nodes[up];
+        const int32_t upChild1 = nodeUp.child1;
+        const int32_t upChild2 = nodeUp.child2;
+
+        // a becomes a child of up
+        nodeUp.child1 = a;
+        nodeUp.parent = nodeA.parent;
+        nodeA.parent = up;
+        if (nodeUp.parent == NULL_NODE)
+            m_root = up;
+        else if (m_nodes[nodeUp.parent].child1 == a)
+            m_nodes[nodeUp.parent].child1 = up;
+        else
+            m_nodes[nodeUp.parent].child2 = up;
+
+        // The higher grandchild stays under up, the other one takes the place of up under a
+        const bool firstIsHigher = m_nodes[upChild1].height > m_nodes[upChild2].height;
+        const int32_t kept = firstIsHigher ? upChild1 : upChild2;
+        const int32_t moved = firstIsHigher ? upChild2 : upChild1;
+        nodeUp.child2 = kept;
+        if (heightDelta > 1)
+            nodeA.child2 = moved;
+        else
+            nodeA.child1 = moved;
+        m_nodes[moved].parent = a;
+
+        nodeA.box = merge(m_nodes[down].box, m_nodes[moved].box);
+        nodeA.height = 1 + std::max(m_nodes[down].height, m_nodes[moved].height);
+        nodeUp.box = merge(nodeA.box, m_nodes[kept].box);
+        nodeUp.height = 1 + std::max(nodeA.height, m_nodes[kept].height);
+        return up;
+    }
+
+    Aabb AabbTree::refitSubtree(const int32_t node)
+    {
+        Node &current = m_nodes[node];
+        if (current.isLeaf())
+            return current.box;
+        current.box = merge(refitSubtree(current.child1), refitSubtree(current.child2));
+        return current.box;
+    }
+
+    void AabbTree::refitRange(const int32_t first, const int32_t last)
+    {
+        for (int32_t index = last; index >= first; --index) {
+            Node &node = m_nodes[index];
+            if (!node.isLeaf())
+                node.box = merge(m_nodes[node.child1].box, m_nodes[node.child2].box);
+        }
+    }
+
+    void AabbTree::refit(const unsigned int maxThreads)
+    {
+        if (m_root == NULL_NODE)
+            return;
+        WorkerPool &pool = WorkerPool::getShared();
+        const auto threadCount = static_cast<unsigned int>(std::min<size_t>(maxThreads, pool.getThreadCount()));
+        if (threadCount <= 1 || m_proxyCount < 4096) {
+            if (m_depthFirstLayout)
+                refitRange(0, static_cast<int32_t>(m_nodes.size()) - 1);
+            else
+                refitSubtree(m_root);
+            return;
+        }
+
+        // Split the top of the tree into enough independent subtrees to keep every thread busy
+        std::vector<int32_t> top;
+        std::vector<int32_t> subtrees = {m_root};
+        const size_t targetSubtrees = static_cast<size_t>(threadCount) * 8;
+        while (subtrees.size() < targetSubtrees) {
+            std::vector<int32_t> next;
+            next.reserve(subtrees.size() * 2);
+            for (const int32_t node : subtrees) {
+                if (m_nodes[node].isLeaf()) {
+                    next.push_back(node);
+                    continue;
+                }
+                top.push_back(node);
+                next.push_back(m_nodes[node].child1);
+                next.push_back(m_nodes[node].child2);
+            }
+            if (next.size() == subtrees.size())
+                break;
+            subtrees = std::move(next);
+        }
+
+        // In depth first order a subtree spans its root up to the next top node or subtree root
+        std::vector<int32_t> subtreeEnds;
+        if (m_depthFirstLayout) {
+            std::vector<int32_t> boundaries = top;
+            boundaries.insert(boundaries.end(), subtrees.begin(), subtrees.end());
+            std::ranges::sort(boundaries);
+            subtreeEnds.reserve(subtrees.size());
+            for (const int32_t root : subtrees) {
+                const auto next = std::ranges::upper_bound(boundaries, root);
+                subtreeEnds.push_back(next == boundaries.end() ? static_cast<int32_t>(m_nodes.size()) : *next);
+            }
+        }
+
+        pool.run(threadCount, [this, &subtrees, &subtreeEnds, threadCount](const size_t worker) {
+            for (size_t i = worker; i < subtrees.size(); i += threadCount) {
+                if (subtreeEnds.empty())
+                    refitSubtree(subtrees[i]);
+                else
+                    refitRange(subtrees[i], subtreeEnds[i] - 1);
+            }
+        });
+
+        // Parents were recorded before their children, walk them backwards
+        for (auto it = top.rbegin(); it != top.rend(); ++it) {
+            Node &node = m_nodes[*it];
+            node.box = merge(m_nodes[node.child1].box, m_nodes[node.child2].box);
+        }
+    }
+
+    int32_t AabbTree::buildSah(const std::span<int32_t> proxies, const std::span<glm::vec3> centroids)
+    {
+        if (proxies.size() == 1)
+            return allocateLeaf(proxies[0]);
+
+        Aabb centroidBounds{centroids[0], centroids[0]};
+        for (const auto &centroid : centroids)
+            centroidBounds = merge(centroidBounds, Aabb{centroid, centroid});
+        const glm::vec3 extent = centroidBounds.max - centroidBounds.min;
+        int axis = 0;
+        if (extent.y > extent[axis])
+            axis = 1;
+        if (extent.z > extent[axis])
+            axis = 2;
+
+        size_t split = proxies.size() / 2;
+        if (extent[axis] > 0.0f) {
+            // Bin the centroids and pick the plane minimizing the surface area heuristic
+            constexpr int binCount = 16;
+            struct Bin {
+                Aabb box{glm::vec3(std::numeric_limits<float>::max()), glm::vec3(std::numeric_limits<float>::lowest())};
+                size_t count = 0;
+            };
+            std::array<Bin, binCount> bins{};
+            const float scale = binCount / extent[axis];
+            const auto binOf = [&](const glm::vec3 &centroid) {
+                return std::min(binCount - 1, static_cast<int>((centroid[axis] - centroidBounds.min[axis]) * scale));
+            };
+            for (size_t i = 0; i < proxies.size(); ++i) {
+                Bin &bin = bins[binOf(centroids[i])];
+                bin.box = merge(bin.box, m_proxies[proxies[i]].bounds);
+                ++bin.count;
+            }
+
+            std::array<float, binCount - 1> leftCost{};
+            Aabb accumulated = bins[0].box;
+            size_t accumulatedCount = 0;
+            for (int i = 0; i < binCount - 1; ++i) {
+                accumulated = i == 0 ? bins[0].box : merge(accumulated, bins[i].box);
+                accumulatedCount += bins[i].count;
+                leftCost[i] = accumulatedCount ? surfaceArea(accumulated) * static_cast<float>(accumulatedCount) : 0.0f;
+            }
+            float bestCost = std::numeric_limits<float>::max();
+            int bestPlane = -1;
+            accumulated = bins[binCount - 1].box;
+            accumulatedCount = 0;
+            for (int i = binCount - 1; i > 0; --i) {
+                accumulated = i == binCount - 1 ? bins[i].box : merge(accumulated, bins[i].box);
+                accumulatedCount += bins[i].count;
+                if (!accumulatedCount || accumulatedCount == proxies.size())
+                    continue;
+                const float cost = leftCost[i - 1] + surfaceArea(accumulated) * static_cast<float>(accumulatedCount);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestPlane = i;
+                }
+            }
+
+            if (bestPlane > 0) {
+                size_t left = 0;
+                for (size_t i = 0; i < proxies.size(); ++i) {
+                    if (binOf(centroids[i]) < bestPlane) {
+                        std::swap(proxies[i], proxies[left]);
+                        std::swap(centroids[i], centroids[left]);
+                        ++left;
+                    }
+                }
+                split = left;
+            }
+        }
+        if (split == 0 || split == proxies.size())
+            split = proxies.size() / 2;
+
+        // Parents are allocated before their children, which gives the depth first layout
+        const int32_t node = allocateNode();
+        const int32_t child1 = buildSah(proxies.first(split), centroids.first(split));
+        const int32_t child2 = buildSah(proxies.subspan(split), centroids.subspan(split));
+        Node &current = m_nodes[node];
+        current.child1 = child1;
+        current.child2 = child2;
+        current.box = merge(m_nodes[child1].box, m_nodes[child2].box);
+        current.height = 1 + std::max(m_nodes[child1].height, m_nodes[child2].height);
+        m_nodes[child1].parent = node;
+        m_nodes[child2].parent = node;
+        return node;
+    }
+
+    void AabbTree::rebuild()
+    {
+        if (m_root == NULL_NODE)
+            return;
+
+        // Proxies keep their ids, every node is recreated
+        std::vector<int32_t> proxies;
+        std::vector<glm::vec3> centroids;
+        proxies.reserve(m_proxyCount);
+        centroids.reserve(m_proxyCount);
+        for (const Node &node : m_nodes) {
+            if (node.height == 0) {
+                proxies.push_back(node.proxy);
+                centroids.push_back((m_proxies[node.proxy].bounds.min + m_proxies[node.proxy].bounds.max) * 0.5f);
+            }
+        }
+        m_nodes.clear();
+        m_nodes.reserve(proxies.size() * 2 - 1);
+        m_freeList = NULL_NODE;
+        m_root = buildSah(proxies, centroids);
+        m_nodes[m_root].parent = NULL_NODE;
+        m_depthFirstLayout = true;
+    }
+
+    void AabbTree::clear()
+    {
+        m_nodes.clear();
+        m_proxies.clear();
+        m_root = NULL_NODE;
+        m_freeList = NULL_NODE;
+        m_freeProxies = NULL_NODE;
+        m_proxyCount = 0;
+        m_depthFirstLayout = false;
+    }
+
+    float AabbTree::getAreaRatio() const
+    {
+        if (m_root == NULL_NODE)
+            return 0.0f;
+        const float rootArea = surfaceArea(m_nodes[m_root].box);
+        if (rootArea <= 0.0f)
+            return 0.0f;
+        float totalArea = 0.0f;
+        for (const Node &node : m_nodes) {
+            if (node.height > 0)
+                totalArea += surfaceArea(node.box);
+        }
+        return totalArea / rootArea;
+    }
+
+    AabbTree::RayHit AabbTree::rayCast(const Ray &ray) const
+    {
+        return rayCast(ray, [](int32_t, const float entry) { return entry; });
+    }
+
+    void AabbTree::rayCastBatch(const std::span<const Ray> rays, const std::span<RayHit> hits) const
+    {
+        for (size_t i = 0; i < rays.size(); ++i)
+            hits[i] = rayCast(rays[i]);
+    }
+}
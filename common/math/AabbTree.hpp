@@ -0,0 +1,411 @@
+//// AabbTree.hpp //////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the dynamic bounding volume hierarchy
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "Frustum.hpp"
+
+namespace nexo::math {
+
+    struct Ray {
+        glm::vec3 origin{0.0f};
+        glm::vec3 direction{0.0f, 0.0f, -1.0f};
+        float maxDistance = std::numeric_limits<float>::max();
+    };
+
+    struct Sphere {
+        glm::vec3 center{0.0f};
+        float radius = 0.0f;
+    };
+
+    /**
+     * @brief Distance along the ray at which it enters the box.
+     * @return The entry distance, or a negative value if the ray misses the box within its length.
+     */
+    inline float intersectRayAabb(const glm::vec3 &origin, const glm::vec3 &inverseDirection, const float maxDistance, const Aabb &box)
+    {
+        float entry = 0.0f;
+        float exit = maxDistance;
+        for (int axis = 0; axis < 3; ++axis) {
+            float near = (box.min[axis] - origin[axis]) * inverseDirection[axis];
+            float far = (box.max[axis] - origin[axis]) * inverseDirection[axis];
+            if (near > far)
+                std::swap(near, far);
+            // NaN comparisons are false, a ray parallel to a slab it starts inside of keeps its range
+            entry = near > entry ? near : entry;
+            exit = far < exit ? far : exit;
+            if (entry > exit)
+                return -1.0f;
+        }
+        return entry;
+    }
+
+    inline bool overlaps(const Aabb &a, const Aabb &b)
+    {
+        return a.min.x <= b.max.x && a.max.x >= b.min.x &&
+               a.min.y <= b.max.y && a.max.y >= b.min.y &&
+               a.min.z <= b.max.z && a.max.z >= b.min.z;
+    }
+
+    inline bool overlaps(const Sphere &sphere, const Aabb &box)
+    {
+        float distanceSquared = 0.0f;
+        for (int axis = 0; axis < 3; ++axis) {
+            const float closest = std::clamp(sphere.center[axis], box.min[axis], box.max[axis]);
+            const float delta = sphere.center[axis] - closest;
+            distanceSquared += delta * delta;
+        }
+        return distanceSquared <= sphere.radius * sphere.radius;
+    }
+
+    inline float surfaceArea(const Aabb &box)
+    {
+        const glm::vec3 size = box.max - box.min;
+        return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    inline Aabb merge(const Aabb &a, const Aabb &b)
+    {
+        return {glm::min(a.min, b.min), glm::max(a.max, b.max)};
+    }
+
+    /**
+     * @class AabbTree
+     *
+     * @brief Dynamic bounding volume hierarchy over axis aligned boxes.
+     *
+     * Each proxy is a leaf holding its exact bounds and a fattened copy used by the hierarchy, so small
+     * movements do not restructure the tree. Leaves are inserted next to the sibling minimizing the
+     * surface area cost and the tree is kept balanced with rotations. Proxy ids are separate from the node
+     * indices and stay valid until the proxy is destroyed, including across rebuild().
+     *
+     * Two update paths are available:
+     *  - moveProxy() reinserts a leaf when it leaves its fat bounds, cheap when few proxies move.
+     *  - setProxyBounds() followed by refit() keeps the topology and only recomputes the internal boxes,
+     *    refit() can split the work across threads when most proxies move every frame.
+     * rebuild() recreates the whole hierarchy with a binned SAH build, used for static or freshly loaded sets.
+     * It also lays the nodes out in depth first order, so refits walk the node array linearly until the
+     * next insertion or removal.
+     */
+    class AabbTree {
+        public:
+            static constexpr int32_t NULL_NODE = -1;
+
+            struct RayHit {
+                int32_t proxy = NULL_NODE;
+                uint32_t userData = 0;
+                float distance = std::numeric_limits<float>::max();
+            };
+
+            explicit AabbTree(float margin = 0.1f);
+
+            int32_t createProxy(const Aabb &box, uint32_t userData);
+            void destroyProxy(int32_t proxy);
+
+            /**
+             * @brief Updates the bounds of a proxy, reinserting it only if it left its fat bounds.
+             * @return True if the proxy was reinserted.
+             */
+            bool moveProxy(int32_t proxy, const Aabb &box);
+
+            /**
+             * @brief Updates the bounds of a proxy without touching the hierarchy.
+             *
+             * The ancestors are not updated, refit() must be called before the next query.
+             */
+            void setProxyBounds(int32_t proxy, const Aabb &box);
+
+            /**
+             * @brief Recomputes the bounds of every internal node from the leaves.
+             * @param maxThreads Maximum number of threads sharing the work, subtrees are refit independently
+             *                   on the shared WorkerPool.
+             */
+            void refit(unsigned int maxThreads = 1);
+
+            // Rebuilds the hierarchy from the current leaves with a binned surface area heuristic
+            void rebuild();
+
+            void clear();
+
+            [[nodiscard]] uint32_t getUserData(const int32_t proxy) const { return m_proxies[proxy].userData; }
+            [[nodiscard]] const Aabb &getBounds(const int32_t proxy) const { return m_proxies[proxy].bounds; }
+            [[nodiscard]] const Aabb &getFatBounds(const int32_t proxy) const { return m_nodes[m_proxies[proxy].node].box; }
+            [[nodiscard]] size_t getProxyCount() const { return m_proxyCount; }
+            [[nodiscard]] int32_t getHeight() const { return m_root == NULL_NODE ? 0 : m_nodes[m_root].height; }
+            // Sum of the internal node areas over the root area, lower means faster queries
+            [[nodiscard]] float getAreaRatio() const;
+
+            /**
+             * @brief Reports every proxy whose fat bounds overlap the box.
+             * @param callback Called with the proxy id, returns false to stop the query.
+             */
+            template<typename Callback>
+            void queryAabb(const Aabb &box, Callback &&callback) const
+            {
+                traverse([&](const Aabb &nodeBox) { return overlaps(box, nodeBox); }, callback);
+            }
+
+            template<typename Callback>
+            void querySphere(const Sphere &sphere, Callback &&callback) const
+            {
+                traverse([&](const Aabb &nodeBox) { return overlaps(sphere, nodeBox); }, callback);
+            }
+
+            template<typename Callback>
+            void queryFrustum(const Frustum &frustum, Callback &&callback) const
+            {
+                traverse([&](const Aabb &nodeBox) { return isAabbVisible(frustum, nodeBox); }, callback);
+            }
+
+            /**
+             * @brief Runs several box queries in one traversal, each node is loaded once for all of them.
+             * @param callback Called with the query index and the proxy id.
+             */
+            template<typename Callback>
+            void queryAabbBatch(std::span<const Aabb> boxes, Callback &&callback) const
+            {
+                traverseBatch(boxes.size(), [&](const size_t query, const Aabb &nodeBox) { return overlaps(boxes[query], nodeBox); }, callback);
+            }
+
+            template<typename Callback>
+            void querySphereBatch(std::span<const Sphere> spheres, Callback &&callback) const
+            {
+                traverseBatch(spheres.size(), [&](const size_t query, const Aabb &nodeBox) { return overlaps(spheres[query], nodeBox); }, callback);
+            }
+
+            template<typename Callback>
+            void queryFrustumBatch(std::span<const Frustum> frustums, Callback &&callback) const
+            {
+                traverseBatch(frustums.size(), [&](const size_t query, const Aabb &nodeBox) { return isAabbVisible(frustums[query], nodeBox); }, callback);
+            }
+
+            /**
+             * @brief Finds the closest proxy hit by the ray, nearer nodes are visited first.
+             *
+             * @param ray The ray, its direction does not need to be normalized.
+             * @param hitTest Called with the proxy id and the distance at which the ray enters its exact bounds,
+             *                returns the distance of the actual hit or a negative value to ignore the proxy.
+             */
+            template<typename HitTest>
+            RayHit rayCast(const Ray &ray, HitTest &&hitTest) const;
+
+            // Closest proxy whose exact bounds are hit by the ray
+            [[nodiscard]] RayHit rayCast(const Ray &ray) const;
+            void rayCastBatch(std::span<const Ray> rays, std::span<RayHit> hits) const;
+
+        private:
+            struct Node {
+                // Fat bounds for the leaves
+                Aabb box;
+                int32_t parent = NULL_NODE;
+                int32_t child1 = NULL_NODE;
+                int32_t child2 = NULL_NODE;
+                // 0 for leaves, -1 for free nodes
+                int32_t height = -1;
+                int32_t proxy = NULL_NODE;
+
+                [[nodiscard]] bool isLeaf() const { return child1 == NULL_NODE; }
+            };
+
+            struct Proxy {
+                Aabb bounds;
+                // Leaf of the proxy, next free proxy for destroyed ones
+                int32_t node = NULL_NODE;
+                uint32_t userData = 0;
+            };
+
+            // Fixed stack used by the traversals, falls back to the heap for very deep trees
+            class TraversalStack {
+                public:
+                    void push(const int32_t node)
+                    {
+                        if (m_size < m_inline.size())
+                            m_inline[m_size] = node;
+                        else
+                            m_overflow.push_back(node);
+                        ++m_size;
+                    }
+
+                    int32_t pop()
+                    {
+                        --m_size;
+                        if (m_size < m_inline.size())
+                            return m_inline[m_size];
+                        const int32_t node = m_overflow.back();
+                        m_overflow.pop_back();
+                        return node;
+                    }
+
+                    [[nodiscard]] bool empty() const { return m_size == 0; }
+
+                private:
+                    std::array<int32_t, 128> m_inline{};
+                    std::vector<int32_t> m_overflow;
+                    size_t m_size = 0;
+            };
+
+            int32_t allocateNode();
+            void freeNode(int32_t node);
+            int32_t allocateLeaf(int32_t proxy);
+            void insertLeaf(int32_t leaf);
+            void removeLeaf(int32_t leaf);
+            int32_t balance(int32_t node);
+            void refitAncestors(int32_t node);
+            Aabb refitSubtree(int32_t node);
+            void refitRange(int32_t first, int32_t last);
+            int32_t buildSah(std::span<int32_t> proxies, std::span<glm::vec3> centroids);
+            [[nodiscard]] Aabb fatten(const Aabb &box) const;
+
+            template<typename Overlaps, typename Callback>
+            void traverse(Overlaps &&nodeOverlaps, Callback &&callback) const
+            {
+                if (m_root == NULL_NODE)
+                    return;
+                TraversalStack stack;
+                stack.push(m_root);
+                while (!stack.empty()) {
+                    const Node &node = m_nodes[stack.pop()];
+                    if (!nodeOverlaps(node.box))
+                        continue;
+                    if (node.isLeaf()) {
+                        if (!callback(node.proxy))
+                            return;
+                    } else {
+                        stack.push(node.child1);
+                        stack.push(node.child2);
+                    }
+                }
+            }
+
+            // Traverses the tree once for up to 64 queries at a time, tracking the queries still active per node
+            template<typename Overlaps, typename Callback>
+            void traverseBatch(const size_t queryCount, Overlaps &&nodeOverlaps, Callback &&callback) const
+            {
+                if (m_root == NULL_NODE)
+                    return;
+                std::vector<std::pair<int32_t, uint64_t>> stack;
+                for (size_t first = 0; first < queryCount; first += 64) {
+                    const size_t count = std::min<size_t>(64, queryCount - first);
+                    stack.clear();
+                    stack.emplace_back(m_root, count == 64 ? ~uint64_t{0} : (uint64_t{1} << count) - 1);
+                    while (!stack.empty()) {
+                        const auto [nodeId, activeQueries] = stack.back();
+                        stack.pop_back();
+                        const Node &node = m_nodes[nodeId];
+                        uint64_t overlapping = 0;
+                        for (uint64_t bits = activeQueries; bits; bits &= bits - 1) {
+                            const auto query = static_cast<size_t>(std::countr_zero(bits));
+                            if (nodeOverlaps(first + query, node.box))
+                                overlapping |= uint64_t{1} << query;
+                        }
+                        if (!overlapping)
+                            continue;
+                        if (node.isLeaf()) {
+                            for (uint64_t bits = overlapping; bits; bits &= bits - 1)
+                                callback(first + static_cast<size_t>(std::countr_zero(bits)), node.proxy);
+                        } else {
+                            stack.emplace_back(node.child1, overlapping);
+                            stack.emplace_back(node.child2, overlapping);
+                        }
+                    }
+                }
+            }
+
+            std::vector<Node> m_nodes;
+            std::vector<Proxy> m_proxies;
+            int32_t m_root = NULL_NODE;
+            int32_t m_freeList = NULL_NODE;
+            int32_t m_freeProxies = NULL_NODE;
+            size_t m_proxyCount = 0;
+            // Set by rebuild(), children are stored after their parent until the topology changes
+            bool m_depthFirstLayout = false;
+            float m_margin;
+    };
+
+    template<typename HitTest>
+    AabbTree::RayHit AabbTree::rayCast(const Ray &ray, HitTest &&hitTest) const
+    {
+        RayHit hit;
+        hit.distance = ray.maxDistance;
+        if (m_root == NULL_NODE)
+            return hit;
+
+        const glm::vec3 inverseDirection = 1.0f / ray.direction;
+        if (intersectRayAabb(ray.origin, inverseDirection, hit.distance, m_nodes[m_root].box) < 0.0f)
+            return hit;
+
+        // Nodes are pushed with their entry distance, skipped once a closer hit is known
+        std::array<std::pair<int32_t, float>, 128> inlineStack;
+        std::vector<std::pair<int32_t, float>> overflow;
+        size_t size = 0;
+        const auto push = [&](const int32_t node, const float distance) {
+            if (size < inlineStack.size())
+                inlineStack[size] = {node, distance};
+            else
+                overflow.emplace_back(node, distance);
+            ++size;
+        };
+        push(m_root, 0.0f);
+        while (size) {
+            --size;
+            std::pair<int32_t, float> entry;
+            if (size < inlineStack.size())
+                entry = inlineStack[size];
+            else {
+                entry = overflow.back();
+                overflow.pop_back();
+            }
+            if (entry.second > hit.distance)
+                continue;
+            const Node &node = m_nodes[entry.first];
+            if (node.isLeaf()) {
+                const float tightEntry = intersectRayAabb(ray.origin, inverseDirection, hit.distance, m_proxies[node.proxy].bounds);
+                if (tightEntry < 0.0f)
+                    continue;
+                if (const float distance = hitTest(node.proxy, tightEntry); distance >= 0.0f && distance <= hit.distance) {
+                    hit.proxy = node.proxy;
+                    hit.userData = m_proxies[node.proxy].userData;
+                    hit.distance = distance;
+                }
+                continue;
+            }
+            // Visit the nearest child first so farther subtrees get pruned by the closest hit
+            const float distance1 = intersectRayAabb(ray.origin, inverseDirection, hit.distance, m_nodes[node.child1].box);
+            const float distance2 = intersectRayAabb(ray.origin, inverseDirection, hit.distance, m_nodes[node.child2].box);
+            const bool firstIsNearest = distance2 < 0.0f || (distance1 >= 0.0f && distance1 <= distance2);
+            const auto [nearest, nearestDistance] = firstIsNearest ? std::pair(node.child1, distance1) : std::pair(node.child2, distance2);
+            const auto [farthest, farthestDistance] = firstIsNearest ? std::pair(node.child2, distance2) : std::pair(node.child1, distance1);
+            if (farthestDistance >= 0.0f)
+                push(farthest, farthestDistance);
+            if (nearestDistance >= 0.0f)
+                push(nearest, nearestDistance);
+        }
+        return hit;
+    }
+}
@@ -0,0 +1,137 @@
+//// Frustum.cpp ///////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the bounding box and frustum culling utils
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "Frustum.hpp"
+
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64)
+    #define NX_FRUSTUM_SSE
+    #include <xmmintrin.h>
+#endif
+
+namespace nexo::math {
+
+    Aabb transformAabb(const Aabb &box, const glm::mat4 &transform)
+    {
+        const glm::vec3 center = (box.min + box.max) * 0.5f;
+        const glm::vec3 extents = (box.max - box.min) * 0.5f;
+
+        glm::vec3 worldCenter(transform[3]);
+        glm::vec3 worldExtents(0.0f);
+        for (int column = 0; column < 3; ++column) {
+            for (int row = 0; row < 3; ++row) {
+                worldCenter[row] += transform[column][row] * center[column];
+                worldExtents[row] += std::abs(transform[column][row]) * extents[column];
+            }
+        }
+        return {worldCenter - worldExtents, worldCenter + worldExtents};
+    }
+
+    Frustum extractFrustum(const glm::mat4 &viewProjection)
+    {
+        const auto row = [&](const int index) {
+            return glm::vec4(viewProjection[0][index], viewProjection[1][index], viewProjection[2][index], viewProjection[3][index]);
+        };
+        const glm::vec4 x = row(0);
+        const glm::vec4 y = row(1);
+        const glm::vec4 z = row(2);
+        const glm::vec4 w = row(3);
+
+        Frustum frustum;
+        frustum.planes = {w + x, w - x, w + y, w - y, w + z, w - z};
+        for (auto &plane : frustum.planes) {
+            const float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+            if (length > 0.0f)
+                plane /= length;
+        }
+        return frustum;
+    }
+
+    bool isAabbVisible(const Frustum &frustum, const Aabb &box)
+    {
+        const glm::vec3 center = (box.min + box.max) * 0.5f;
+        const glm::vec3 extents = (box.max - box.min) * 0.5f;
+        for (const auto &plane : frustum.planes) {
+            const float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+            const float radius = std::abs(plane.x) * extents.x + std::abs(plane.y) * extents.y + std::abs(plane.z) * extents.z;
+            if (distance + radius < 0.0f)
+                return false;
+        }
+        return true;
+    }
+
+    size_t cullAabbs(const Frustum &frustum, const std::span<const Aabb> boxes, const std::span<uint8_t> visible)
+    {
+        size_t visibleCount = 0;
+#ifdef NX_FRUSTUM_SSE
+        // Planes laid out as structure of arrays, padded to 8 with planes every box passes
+        alignas(16) float nx[8] = {}, ny[8] = {}, nz[8] = {}, d[8] = {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+        for (size_t i = 0; i < frustum.planes.size(); ++i) {
+            nx[i] = frustum.planes[i].x;
+            ny[i] = frustum.planes[i].y;
+            nz[i] = frustum.planes[i].z;
+            d[i] = frustum.planes[i].w;
+        }
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        __m128 planeX[2], planeY[2], planeZ[2], planeD[2], absX[2], absY[2], absZ[2];
+        for (int batch = 0; batch < 2; ++batch) {
+            planeX[batch] = _mm_load_ps(nx + batch * 4);
+            planeY[batch] = _mm_load_ps(ny + batch * 4);
+            planeZ[batch] = _mm_load_ps(nz + batch * 4);
+            planeD[batch] = _mm_load_ps(d + batch * 4);
+            absX[batch] = _mm_andnot_ps(signMask, planeX[batch]);
+            absY[batch] = _mm_andnot_ps(signMask, planeY[batch]);
+            absZ[batch] = _mm_andnot_ps(signMask, planeZ[batch]);
+        }
+
+        const __m128 half = _mm_set1_ps(0.5f);
+        const __m128 zero = _mm_setzero_ps();
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            const Aabb &box = boxes[i];
+            const __m128 cx = _mm_mul_ps(_mm_set1_ps(box.min.x + box.max.x), half);
+            const __m128 cy = _mm_mul_ps(_mm_set1_ps(box.min.y + box.max.y), half);
+            const __m128 cz = _mm_mul_ps(_mm_set1_ps(box.min.z + box.max.z), half);
+            const __m128 ex = _mm_mul_ps(_mm_set1_ps(box.max.x - box.min.x), half);
+            const __m128 ey = _mm_mul_ps(_mm_set1_ps(box.max.y - box.min.y), half);
+            const __m128 ez = _mm_mul_ps(_mm_set1_ps(box.max.z - box.min.z), half);
+
+            int outside = 0;
+            for (int batch = 0; batch < 2; ++batch) {
+                __m128 distance = _mm_add_ps(_mm_mul_ps(planeX[batch], cx), planeD[batch]);
+                distance = _mm_add_ps(distance, _mm_mul_ps(planeY[batch], cy));
+                distance = _mm_add_ps(distance, _mm_mul_ps(planeZ[batch], cz));
+                __m128 radius = _mm_mul_ps(absX[batch], ex);
+                radius = _mm_add_ps(radius, _mm_mul_ps(absY[batch], ey));
+                radius = _mm_add_ps(radius, _mm_mul_ps(absZ[batch], ez));
+                outside |= _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(distance, radius), zero));
+            }
+            visible[i] = outside ? 0 : 1;
+            visibleCount += visible[i];
+        }
+#else
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            visible[i] = isAabbVisible(frustum, boxes[i]) ? 1 : 0;
+            visibleCount += visible[i];
+        }
+#endif
+        return visibleCount;
+    }
+}
@@ -17,6 +17,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "src/Editor.hpp"
+#include "Nexo.hpp"
 #include "src/DocumentWindows/ConsoleWindow/ConsoleWindow.hpp"
 #include "src/DocumentWindows/EditorScene/EditorScene.hpp"
 #include "src/DocumentWindows/SceneTreeWindow/SceneTreeWindow.hpp"
@@ -26,6 +27,9 @@
 #include "src/DocumentWindows/PrimitiveWindow/PrimitiveWindow.hpp"
 #include "src/DocumentWindows/GameWindow/GameWindow.hpp"
 
+#include <algorithm>
+#include <span>
+#include <string_view>
 #include <thread>
 #include <loguru.hpp>
 #include <core/exceptions/Exceptions.hpp>
@@ -37,6 +41,10 @@ int main(int argc, char **argv)
 try {
     loguru::init(argc, argv);
     loguru::g_stderr_verbosity = loguru::Verbosity_3;
+    // Offscreen context on the GLFW null platform, for CI and benchmarks on machines without a display
+    if (std::ranges::any_of(std::span(argv, static_cast<size_t>(argc)),
+                            [](const char *argument) { return std::string_view(argument) == "--headless"; }))
+        nexo::getApp().setHeadless(true);
     nexo::editor::Editor &editor = nexo::editor::Editor::getInstance();
 
     editor.registerWindow<nexo::editor::EditorScene>(
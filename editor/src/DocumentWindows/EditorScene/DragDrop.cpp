@@ -52,24 +52,13 @@ namespace nexo::editor {
         }
     }
 
-    void EditorScene::handleDropTexture(const AssetDragDropPayload &payload) const
+    void EditorScene::handleDropTexture(const AssetDragDropPayload &payload, const int entityId) const
     {
         const auto textureRef = assets::AssetCatalog::getInstance().getAsset(payload.id);
         if (!textureRef)
             return;
         if (const auto texture = textureRef.as<assets::Texture>(); texture)
         {
-            auto [mx, my] = ImGui::GetMousePos();
-            mx -= m_viewportBounds[0].x;
-            my -= m_viewportBounds[0].y;
-
-            // Flip the y-coordinate to match opengl texture format
-            my = m_contentSize.y - my;
-
-            // Check if mouse is inside viewport
-            if (!(mx >= 0 && my >= 0 && mx < m_contentSize.x && my < m_contentSize.y))
-                return;
-            const int entityId = sampleEntityTexture(mx, my);
             if (entityId == -1) {
                 auto& sceneManager = Application::getInstance().getSceneManager();
                 components::Material material;
@@ -102,24 +91,13 @@ namespace nexo::editor {
         }
     }
 
-    void EditorScene::handleDropMaterial(const AssetDragDropPayload &payload) const
+    void EditorScene::handleDropMaterial(const AssetDragDropPayload &payload, const int entityId) const
     {
         const auto materialRef = assets::AssetCatalog::getInstance().getAsset(payload.id);
         if (!materialRef)
             return;
         if (const auto material = materialRef.as<assets::Material>(); material)
         {
-            auto [mx, my] = ImGui::GetMousePos();
-            mx -= m_viewportBounds[0].x;
-            my -= m_viewportBounds[0].y;
-
-            // Flip the y-coordinate to match opengl texture format
-            my = m_contentSize.y - my;
-
-            // Check if mouse is inside viewport
-            if (!(mx >= 0 && my >= 0 && mx < m_contentSize.x && my < m_contentSize.y))
-                return;
-            const int entityId = sampleEntityTexture(mx, my);
             if (entityId == -1)
                 return;
             const auto matComponent = Application::m_coordinator->tryGetComponent<components::MaterialComponent>(entityId);
@@ -137,17 +115,12 @@ namespace nexo::editor {
             if (const ImGuiPayload* assetPayload = ImGui::AcceptDragDropPayload("ASSET_DRAG", ImGuiDragDropFlags_AcceptBeforeDelivery))
             {
                 IM_ASSERT(assetPayload->DataSize == sizeof(AssetDragDropPayload));
-                auto [mx, my] = ImGui::GetMousePos();
-                mx -= m_viewportBounds[0].x;
-                my -= m_viewportBounds[0].y;
-
-                // Flip the y-coordinate to match opengl texture format
-                my = m_contentSize.y - my;
-
-                // Check if mouse is inside viewport
-                if (!(mx >= 0 && my >= 0 && mx < m_contentSize.x && my < m_contentSize.y))
+                const auto position = getViewportPosition(ImGui::GetMousePos());
+                if (!position)
                     return;
-                const int entityId = sampleEntityTexture(mx, my);
+                // The hovered entity comes from the readback of a previous frame, the GPU is never waited on
+                requestEntitySample(position->x, position->y);
+                const int entityId = m_sampledEntity;
                 if (entityId != -1 && static_cast<ecs::Entity>(entityId) != m_entityHovered)
                 {
                     m_entityHovered = static_cast<ecs::Entity>(entityId);
@@ -173,10 +146,10 @@ namespace nexo::editor {
                         handleDropModel(payload);
                         break;
                     case assets::AssetType::TEXTURE:
-                        handleDropTexture(payload);
+                        handleDropTexture(payload, entityId);
                         break;
                     case assets::AssetType::MATERIAL:
-                        handleDropMaterial(payload);
+                        handleDropMaterial(payload, entityId);
                         break;
                     default:
                         break;
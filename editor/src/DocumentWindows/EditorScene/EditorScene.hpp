@@ -17,6 +17,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <cstdint>
+#include <optional>
+#include <span>
 #include <imgui.h>
 #include <ImGuizmo.h>
 
@@ -107,9 +110,23 @@ namespace nexo::editor
         float m_angleSnap = 90.0f;
         bool m_snapToGrid = false;
         bool m_wireframeEnabled = false;
+        bool m_showRenderStats = false;
 
         ecs::Entity m_entityHovered = ecs::INVALID_ENTITY;
 
+        struct PendingSelection {
+            uint64_t requestId = 0;
+            bool isShiftPressed = false;
+            bool isCtrlPressed = false;
+        };
+        // Entity under the mouse in the latest completed single pixel readback, -1 when none
+        int m_sampledEntity = -1;
+        // Camera whose render target the pending readbacks were requested on
+        int m_sampleCamera = -1;
+        PendingSelection m_pendingSelection;
+        bool m_isBoxSelecting = false;
+        ImVec2 m_boxSelectionStart;
+
         int m_sceneId = -1;
         std::string m_sceneUuid;
         int m_activeCamera = -1;
@@ -305,15 +322,44 @@ namespace nexo::editor
          */
         void renderView();
         void renderNoActiveCamera() const;
+
+        /**
+         * @brief Renders the render statistics overlay below the toolbar.
+         *
+         * Lists the cost of every pass of the last frame per camera, as collected by the
+         * render profiler, and lets the user record a Chrome trace of the following frames.
+         */
+        void renderStatsOverlay() const;
         void renderPrimitiveCreationPopup(const Primitives& primitive) const;
         void renderNewEntityPopup();
 
         void handleSelection();
+        void handleBoxSelection();
         void handleDropTarget();
         void handleDropModel(const AssetDragDropPayload &payload) const;
-        void handleDropTexture(const AssetDragDropPayload &payload) const;
-        void handleDropMaterial(const AssetDragDropPayload &payload) const;
-        int sampleEntityTexture(float mx, float my) const;
+        void handleDropTexture(const AssetDragDropPayload &payload, int entityId) const;
+        void handleDropMaterial(const AssetDragDropPayload &payload, int entityId) const;
+
+        /**
+         * @brief Converts a screen position to framebuffer coordinates of the viewport.
+         * @return The position with its y-coordinate flipped, or std::nullopt if it is outside the viewport.
+         */
+        [[nodiscard]] std::optional<ImVec2> getViewportPosition(const ImVec2 &screenPosition) const;
+
+        /**
+         * @brief Queues an asynchronous readback of the entity id attachment of the active camera.
+         *
+         * Picking never waits for the GPU: the ids are read back with the next resolveEntitySamples().
+         * @return The request id, or 0 if the readback could not be queued.
+         */
+        uint64_t requestEntitySample(float mx, float my, int width = 1, int height = 1);
+
+        /**
+         * @brief Collects the completed readbacks, updating the hovered entity and applying pending selections.
+         */
+        void resolveEntitySamples();
+        void requestSelection(const ImVec2 &min, const ImVec2 &max);
+        void applyBoxSelection(std::span<const int> entityIds, bool isShiftPressed, bool isCtrlPressed);
         static ecs::Entity findRootParent(ecs::Entity entityId);
         void selectEntityHierarchy(ecs::Entity entityId, bool isCtrlPressed);
         void selectModelChildren(const std::vector<ecs::Entity>& children, bool isCtrlPressed);
@@ -106,7 +106,7 @@ namespace nexo::editor {
         const glm::mat4 localMatrix = calculateWorldMatrix(transform->get());
 
         // Update world matrix
-        transform->get().worldMatrix = parentWorldMatrix * localMatrix;
+        transform->get().setWorldMatrix(parentWorldMatrix * localMatrix);
     }
 
     static void updateEntityWorldMatrixRecursive(const ecs::Entity entity)
@@ -141,7 +141,7 @@ namespace nexo::editor {
         );
 
         transform.quat = glm::normalize(transform.quat);
-        transform.worldMatrix = worldMatrix;
+        transform.setWorldMatrix(worldMatrix);
     }
 
     float* EditorScene::getSnapSettingsForOperation(const ImGuizmo::OPERATION operation)
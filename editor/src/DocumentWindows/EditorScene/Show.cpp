@@ -25,6 +25,8 @@
 #include "utils/EditorProps.hpp"
 #include "context/actions/EntityActions.hpp"
 #include "context/ActionManager.hpp"
+#include "renderer/Renderer3D.hpp"
+#include "renderer/RenderProfiler.hpp"
 #include <imgui_internal.h>
 
 namespace nexo::editor
@@ -39,6 +41,122 @@ namespace nexo::editor
         ImGui::Text("No active camera");
     }
 
+    void EditorScene::renderStatsOverlay() const
+    {
+        auto &profiler = renderer::NxRenderProfiler::get();
+        const auto &frameStats = renderer::NxRenderer3D::get().getStats();
+
+        ImVec2 overlayPos = m_windowPos;
+        const ImVec2 contentMin = ImGui::GetWindowContentRegionMin();
+        overlayPos.x += contentMin.x + 10.0f;
+        overlayPos.y += contentMin.y + 80.0f;
+        ImGui::SetCursorScreenPos(overlayPos);
+
+        ImGui::PushStyleColor(ImGuiCol_ChildBg, ImVec4(0.1f, 0.1f, 0.1f, 0.8f));
+        ImGui::BeginChild("##RenderStatsOverlay", ImVec2(0, 0),
+                          ImGuiChildFlags_AutoResizeX | ImGuiChildFlags_AutoResizeY,
+                          ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoMove |
+                          ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoSavedSettings);
+
+        const auto &counters = frameStats.frameCounters;
+        ImGui::Text("Frame: %.2f ms cpu", profiler.getFrameCpuMs());
+        ImGui::Text("Draws: %llu  Instances: %llu  Triangles: %llu",
+                    static_cast<unsigned long long>(counters.drawCalls),
+                    static_cast<unsigned long long>(counters.instances),
+                    static_cast<unsigned long long>(counters.triangles));
+        ImGui::Text("State changes: %llu (%llu avoided)  Texture binds: %llu  Uploads: %.1f KB",
+                    static_cast<unsigned long long>(counters.stateChanges),
+                    static_cast<unsigned long long>(frameStats.redundantStateChangesAvoided),
+                    static_cast<unsigned long long>(counters.textureBinds),
+                    static_cast<double>(counters.uploadedBytes) / 1024.0);
+
+        constexpr ImGuiTableFlags tableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV |
+                                               ImGuiTableFlags_SizingFixedFit;
+        if (ImGui::BeginTable("##RenderStatsCameras", 8, tableFlags))
+        {
+            for (const char *column : {"Camera", "CPU ms", "GPU ms", "Draws", "Triangles", "States", "Tex binds",
+                                       "Uploads KB"})
+                ImGui::TableSetupColumn(column);
+            ImGui::TableHeadersRow();
+            for (const auto &camera : profiler.getCameraStats())
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", camera.camera);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", camera.cpuMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", camera.gpuMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(camera.counters.drawCalls));
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(camera.counters.triangles));
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(camera.counters.stateChanges));
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(camera.counters.textureBinds));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", static_cast<double>(camera.counters.uploadedBytes) / 1024.0);
+            }
+            ImGui::EndTable();
+        }
+
+        if (ImGui::BeginTable("##RenderStatsPasses", 10, tableFlags))
+        {
+            for (const char *column : {"Camera", "Pass", "CPU ms", "GPU ms", "Draws", "Instances", "Triangles",
+                                       "States", "Tex binds", "Uploads KB"})
+                ImGui::TableSetupColumn(column);
+            ImGui::TableHeadersRow();
+            for (const auto &pass : profiler.getPassStats())
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", pass.camera);
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(pass.pass.c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", pass.cpuMs);
+                ImGui::TableNextColumn();
+                if (pass.gpuMs)
+                    ImGui::Text("%.3f", *pass.gpuMs);
+                else
+                    ImGui::TextDisabled("-");
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(pass.counters.drawCalls));
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(pass.counters.instances));
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(pass.counters.triangles));
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(pass.counters.stateChanges));
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(pass.counters.textureBinds));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", static_cast<double>(pass.counters.uploadedBytes) / 1024.0);
+            }
+            ImGui::EndTable();
+        }
+
+        if (profiler.isTracing())
+        {
+            if (ImGui::Button(ICON_FA_STOP " Stop trace"))
+                profiler.stopTrace();
+        }
+        else if (ImGui::Button(ICON_FA_CIRCLE " Record trace"))
+        {
+            try {
+                profiler.startTrace("render_trace.json");
+            } catch (const nexo::Exception &e) {
+                LOG_EXCEPTION(e);
+            }
+        }
+        if (ImGui::IsItemHovered())
+            ImGui::SetTooltip("Writes the passes of every frame to render_trace.json, open it in chrome://tracing or Perfetto");
+
+        ImGui::EndChild();
+        ImGui::PopStyleColor();
+    }
+
     void EditorScene::renderNewEntityPopup()
     {
         auto& app = Application::getInstance();
@@ -159,6 +277,14 @@ namespace nexo::editor
         const ImVec2 viewportMax = ImGui::GetItemRectMax();
         m_viewportBounds[0] = viewportMin;
         m_viewportBounds[1] = viewportMax;
+
+        if (m_isBoxSelecting) {
+            ImDrawList *drawList = ImGui::GetWindowDrawList();
+            drawList->PushClipRect(viewportMin, viewportMax, true);
+            drawList->AddRectFilled(m_boxSelectionStart, ImGui::GetMousePos(), IM_COL32(66, 150, 250, 40));
+            drawList->AddRect(m_boxSelectionStart, ImGui::GetMousePos(), IM_COL32(66, 150, 250, 200));
+            drawList->PopClipRect();
+        }
     }
 
     void EditorScene::show()
@@ -229,6 +355,8 @@ namespace nexo::editor
                 renderView();
                 renderGizmo();
                 renderToolbar();
+                if (m_showRenderStats)
+                    renderStatsOverlay();
             }
 
             if (m_popupManager.showPopup("Add new entity popup"))
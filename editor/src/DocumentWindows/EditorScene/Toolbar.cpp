@@ -530,6 +530,15 @@ namespace nexo::editor {
 
         ImGui::SameLine();
 
+        // -------- Render statistics button --------
+        if (renderToolbarButton("render_stats", ICON_FA_TACHOMETER, "Show / Hide render statistics",
+                                m_showRenderStats ? m_selectedGradient : m_buttonGradient))
+        {
+            m_showRenderStats = !m_showRenderStats;
+        }
+
+        ImGui::SameLine();
+
         auto& app = getApp();
         const bool isPlaying = app.getGameState() == nexo::GameState::PLAY_MODE;
         
@@ -17,6 +17,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "EditorScene.hpp"
+
+#include <algorithm>
+
 #include "Types.hpp"
 #include "components/Transform.hpp"
 #include "context/Selector.hpp"
@@ -24,15 +27,31 @@
 #include "components/Parent.hpp"
 
 namespace nexo::editor {
-    int EditorScene::sampleEntityTexture(const float mx, const float my) const
+    uint64_t EditorScene::requestEntitySample(const float mx, const float my, const int width, const int height)
     {
         const auto &coord = Application::m_coordinator;
         const auto &cameraComponent = coord->getComponent<components::CameraComponent>(static_cast<ecs::Entity>(m_activeCamera));
+        if (!cameraComponent.m_renderTarget)
+            return 0;
+        m_sampleCamera = m_activeCamera;
+        return cameraComponent.m_renderTarget->requestPixelRegion(1, static_cast<int>(mx), static_cast<int>(my), width, height);
+    }
 
-        cameraComponent.m_renderTarget->bind();
-        const int entityId = cameraComponent.m_renderTarget->getPixel<int>(1, static_cast<int>(mx), static_cast<int>(my));
-        cameraComponent.m_renderTarget->unbind();
-        return entityId;
+    void EditorScene::resolveEntitySamples()
+    {
+        const auto &coord = Application::m_coordinator;
+        const auto &cameraComponent = coord->getComponent<components::CameraComponent>(static_cast<ecs::Entity>(m_activeCamera));
+        if (!cameraComponent.m_renderTarget)
+            return;
+
+        while (const auto region = cameraComponent.m_renderTarget->pollPixelRegion()) {
+            const bool isCurrentCamera = m_sampleCamera == m_activeCamera;
+            if (isCurrentCamera && region->requestId == m_pendingSelection.requestId) {
+                m_pendingSelection.requestId = 0;
+                applyBoxSelection(region->pixels, m_pendingSelection.isShiftPressed, m_pendingSelection.isCtrlPressed);
+            } else if (isCurrentCamera && region->pixels.size() == 1)
+                m_sampledEntity = region->pixels.front();
+        }
     }
 
     static SelectionType getSelectionType(const int entityId)
@@ -151,26 +170,38 @@ namespace nexo::editor {
         }
     }
 
-    void EditorScene::handleSelection()
+    std::optional<ImVec2> EditorScene::getViewportPosition(const ImVec2 &screenPosition) const
     {
-        auto [mx, my] = ImGui::GetMousePos();
-        mx -= m_viewportBounds[0].x;
-        my -= m_viewportBounds[0].y;
-
+        const float mx = screenPosition.x - m_viewportBounds[0].x;
         // Flip the y-coordinate to match opengl texture format
-        my = m_contentSize.y - my;
+        const float my = m_contentSize.y - (screenPosition.y - m_viewportBounds[0].y);
 
-        // Check if mouse is inside viewport
+        // Check if the position is inside viewport
         if (!(mx >= 0 && my >= 0 && mx < m_contentSize.x && my < m_contentSize.y))
-            return;
-        const int entityId = sampleEntityTexture(mx, my);
+            return std::nullopt;
+        return ImVec2(mx, my);
+    }
 
+    void EditorScene::requestSelection(const ImVec2 &min, const ImVec2 &max)
+    {
         // Check for multi-selection key modifiers
-        const bool isShiftPressed = ImGui::IsKeyDown(ImGuiKey_LeftShift) || ImGui::IsKeyDown(ImGuiKey_RightShift);
-        const bool isCtrlPressed = ImGui::IsKeyDown(ImGuiKey_LeftCtrl) || ImGui::IsKeyDown(ImGuiKey_RightCtrl);
+        m_pendingSelection.isShiftPressed = ImGui::IsKeyDown(ImGuiKey_LeftShift) || ImGui::IsKeyDown(ImGuiKey_RightShift);
+        m_pendingSelection.isCtrlPressed = ImGui::IsKeyDown(ImGuiKey_LeftCtrl) || ImGui::IsKeyDown(ImGuiKey_RightCtrl);
+        // Resolved on a later frame by resolveEntitySamples(), once the GPU reached the readback
+        m_pendingSelection.requestId = requestEntitySample(min.x, min.y,
+            std::max(1, static_cast<int>(max.x - min.x)), std::max(1, static_cast<int>(max.y - min.y)));
+    }
+
+    void EditorScene::applyBoxSelection(const std::span<const int> entityIds, const bool isShiftPressed, const bool isCtrlPressed)
+    {
         auto &selector = Selector::get();
+        std::vector<int> uniqueIds(entityIds.begin(), entityIds.end());
+        std::ranges::sort(uniqueIds);
+        const auto [first, last] = std::ranges::unique(uniqueIds);
+        uniqueIds.erase(first, last);
+        std::erase(uniqueIds, -1);
 
-        if (entityId == -1) {
+        if (uniqueIds.empty()) {
             // Clicked on empty space - clear selection unless shift/ctrl is held
             if (!isShiftPressed && !isCtrlPressed) {
                 selector.clearSelection();
@@ -179,7 +210,57 @@ namespace nexo::editor {
             return;
         }
 
-        updateSelection(entityId, isShiftPressed, isCtrlPressed);
+        if (uniqueIds.size() == 1) {
+            updateSelection(uniqueIds.front(), isShiftPressed, isCtrlPressed);
+            return;
+        }
+        // Several entities replace the selection as a whole, then get added one by one
+        if (!isShiftPressed && !isCtrlPressed)
+            selector.clearSelection();
+        for (const int entityId : uniqueIds)
+            updateSelection(entityId, true, isCtrlPressed);
+    }
+
+    void EditorScene::handleSelection()
+    {
+        const auto position = getViewportPosition(ImGui::GetMousePos());
+        if (!position)
+            return;
+        requestSelection(*position, *position);
+    }
+
+    void EditorScene::handleBoxSelection()
+    {
+        const bool isAltPressed = ImGui::IsKeyDown(ImGuiKey_LeftAlt) || ImGui::IsKeyDown(ImGuiKey_RightAlt);
+        if (!m_isBoxSelecting) {
+            if (!isAltPressed || !ImGui::IsMouseClicked(ImGuiMouseButton_Left) || ImGuizmo::IsOver() || !m_focused)
+                return;
+            if (!getViewportPosition(ImGui::GetMousePos()))
+                return;
+            m_isBoxSelecting = true;
+            m_boxSelectionStart = ImGui::GetMousePos();
+        }
+
+        // Keep the editor camera from orbiting while the box is dragged with the left button
+        const auto &coord = Application::m_coordinator;
+        if (const auto controller = coord->tryGetComponent<components::PerspectiveCameraController>(m_activeCamera))
+            controller->get().wasMouseReleased = true;
+
+        if (!ImGui::IsMouseReleased(ImGuiMouseButton_Left))
+            return;
+        m_isBoxSelecting = false;
+
+        // Clamp both corners to the viewport, then order them in framebuffer space
+        const auto clampToViewport = [this](const ImVec2 &screen) {
+            return ImVec2(std::clamp(screen.x, m_viewportBounds[0].x, m_viewportBounds[0].x + m_contentSize.x - 1.0f),
+                          std::clamp(screen.y, m_viewportBounds[0].y, m_viewportBounds[0].y + m_contentSize.y - 1.0f));
+        };
+        const auto start = getViewportPosition(clampToViewport(m_boxSelectionStart));
+        const auto end = getViewportPosition(clampToViewport(ImGui::GetMousePos()));
+        if (!start || !end)
+            return;
+        requestSelection(ImVec2(std::min(start->x, end->x), std::min(start->y, end->y)),
+                         ImVec2(std::max(start->x, end->x) + 1.0f, std::max(start->y, end->y) + 1.0f));
     }
 
     void EditorScene::update()
@@ -193,11 +274,13 @@ namespace nexo::editor {
         sceneInfo.isChildWindow = true;
         sceneInfo.viewportBounds[0] = glm::vec2{m_viewportBounds[0].x, m_viewportBounds[0].y};
         sceneInfo.viewportBounds[1] = glm::vec2{m_viewportBounds[1].x, m_viewportBounds[1].y};
+        resolveEntitySamples();
+        handleBoxSelection();
         runEngine(sceneInfo);
 
 
-        // Handle mouse clicks for selection
-        if (ImGui::IsMouseClicked(ImGuiMouseButton_Left) && !ImGuizmo::IsUsing() && m_focused)
+        // Handle mouse clicks for selection, alt starts a box selection instead
+        if (ImGui::IsMouseClicked(ImGuiMouseButton_Left) && !ImGuizmo::IsUsing() && m_focused && !m_isBoxSelecting)
             handleSelection();
     }
 }
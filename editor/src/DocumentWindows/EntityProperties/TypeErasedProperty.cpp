@@ -23,6 +23,8 @@
 #include "ImNexo/Components.hpp"
 #include "ImNexo/Elements.hpp"
 
+#include <vector>
+
 namespace nexo::editor {
 
     void showField(const ecs::Field& field, void *data)
@@ -95,7 +97,15 @@ namespace nexo::editor {
 
         const auto& coordinator = Application::m_coordinator;
 
-        const auto componentData = static_cast<uint8_t *>(coordinator->tryGetComponentById(m_componentType, entity));
+        auto componentData = static_cast<uint8_t *>(coordinator->tryGetComponentById(m_componentType, entity));
+        // Components stored as a struct of arrays are not contiguous, edit a copy and write it back
+        std::vector<uint8_t> componentCopy;
+        const auto componentArray = coordinator->getTypeErasedComponentArray(m_componentType);
+        if (!componentData && componentArray && componentArray->hasComponent(entity)) {
+            componentCopy.resize(componentArray->getComponentSize());
+            componentArray->readComponent(entity, componentCopy.data());
+            componentData = componentCopy.data();
+        }
         if (!componentData) {
             ImGui::Text("Entity %d does not have component type %d", entity, m_componentType);
             return;
@@ -113,6 +123,9 @@ namespace nexo::editor {
             ImGui::TreePop();
         }
 
+        if (!componentCopy.empty())
+            componentArray->writeComponent(entity, componentCopy.data());
+
 
     }
 
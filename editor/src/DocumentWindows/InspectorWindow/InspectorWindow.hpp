@@ -22,6 +22,7 @@
 #include "core/scene/SceneManager.hpp"
 
 #include <unordered_map>
+#include <any>
 
 namespace nexo::editor {
 
@@ -130,8 +130,8 @@ namespace nexo::editor {
                 if (parentComp.has_value())
                 {
                     auto parentTransform = coordinator.tryGetComponent<components::TransformComponent>(parentComp->get().parent);
-                    if (parentTransform.has_value())
-                        parentTransform->get().removeChild(payload.entity);
+                    if (parentTransform.has_value() && parentTransform->get().removeChild(payload.entity))
+                        coordinator.markHierarchyChanged();
 
                     coordinator.removeComponent<components::ParentComponent>(payload.entity);
                 }
@@ -186,7 +186,8 @@ namespace nexo::editor {
                 oldParent = oldParentComp->get().parent;
 
                 if (auto oldPT = coordinator.tryGetComponent<components::TransformComponent>(oldParent)) {
-                    oldPT->get().removeChild(childEntity);
+                    if (oldPT->get().removeChild(childEntity))
+                        coordinator.markHierarchyChanged();
                     if (oldPT->get().children.empty() && coordinator.entityHasComponent<components::RootComponent>(oldParent))
                         coordinator.removeComponent<components::RootComponent>(oldParent);
                 }
@@ -200,7 +201,8 @@ namespace nexo::editor {
             if (!coordinator.entityHasComponent<components::TransformComponent>(parentEntity))
                 coordinator.addComponent(parentEntity, components::TransformComponent{});
             auto& pt = coordinator.getComponent<components::TransformComponent>(parentEntity);
-            pt.addChild(childEntity);
+            if (pt.addChild(childEntity))
+                coordinator.markHierarchyChanged();
 
             if (!coordinator.entityHasComponent<components::ParentComponent>(parentEntity) &&
                 !coordinator.entityHasComponent<components::RootComponent>(parentEntity))
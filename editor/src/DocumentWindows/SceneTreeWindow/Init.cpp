@@ -17,12 +17,35 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "SceneTreeWindow.hpp"
+#include "components/Name.hpp"
+#include "components/StaticMesh.hpp"
 
 namespace nexo::editor {
 
     void SceneTreeWindow::setup()
     {
         setupShortcuts();
+
+        const auto &coordinator = Application::m_coordinator;
+        m_ambientLightQuery = coordinator->registerCachedQuery<components::AmbientLightComponent, components::SceneTag>();
+        m_directionalLightQuery = coordinator->registerCachedQuery<components::DirectionalLightComponent, components::SceneTag>();
+        m_pointLightQuery = coordinator->registerCachedQuery<components::PointLightComponent, components::SceneTag>();
+        m_spotLightQuery = coordinator->registerCachedQuery<components::SpotLightComponent, components::SceneTag>();
+        m_cameraQuery = coordinator->registerCachedQuery<
+            components::CameraComponent,
+            components::SceneTag,
+            ecs::Exclude<components::EditorCameraTag>>();
+        m_rootEntityQuery = coordinator->registerCachedQuery<
+            components::RootComponent,
+            components::TransformComponent,
+            components::SceneTag>();
+        m_standaloneEntityQuery = coordinator->registerCachedQuery<
+            components::StaticMeshComponent,
+            components::TransformComponent,
+            components::SceneTag,
+            ecs::Exclude<components::ParentComponent>,
+            ecs::Exclude<components::RootComponent>>();
+        m_namedEntityQuery = coordinator->registerCachedQuery<components::NameComponent>();
     }
 
 }
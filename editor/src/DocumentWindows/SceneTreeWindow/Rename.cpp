@@ -40,6 +40,9 @@ namespace nexo::editor {
                              ImGuiInputTextFlags_EnterReturnsTrue | ImGuiInputTextFlags_AutoSelectAll))
         {
             obj.uiName = ObjectTypeToIcon.at(obj.type) + std::string(buffer);
+            // The tree is not rebuilt every frame, the cached label keeps the new name
+            if (const auto it = m_entityLabels.find(obj.data.entity); obj.type == SelectionType::ENTITY && it != m_entityLabels.end())
+                it->second.uiName = obj.uiName;
             auto &selector = Selector::get();
             selector.setUiHandle(obj.uuid, obj.uiName);
             if (obj.type == SelectionType::SCENE)
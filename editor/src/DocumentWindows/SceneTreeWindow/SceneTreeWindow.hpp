@@ -30,6 +30,7 @@
 #include <utility>
 #include <imgui.h>
 #include <map>
+#include <algorithm>
 
 namespace nexo::editor
 {
@@ -101,7 +102,9 @@ namespace nexo::editor
             using ADocumentWindow::ADocumentWindow;
             ~SceneTreeWindow() override = default;
 
-        // No-op method in this class
+        /**
+         * @brief Registers the shortcuts and the cached entity queries backing the scene tree.
+         */
         void setup() override;
 
         // No-op method in this class
@@ -118,50 +121,69 @@ namespace nexo::editor
         void show() override;
 
         /**
-         * @brief Rebuilds the scene tree GUI by clearing old nodes and repopulating it with current scene data.
+         * @brief Updates the scene tree GUI from the cached entity queries.
          *
-         * This function resets the root node and light counters, retrieves the list of open scenes from the
-         * SceneViewManager via the window registry, and creates a new scene node for each open scene.
-         * It then generates child nodes for ambient, directional, point, and spot lights, as well as cameras
-         * and generic entities using a templated generateNodes method. Finally, it appends these nodes as children
-         * to the root node, effectively updating the scene tree display.
+         * When the set of open scenes changes, the whole tree is rebuilt from the current content of the
+         * queries. Otherwise only the entities that entered or left the light and camera queries since the
+         * last frame are inserted or removed, so existing nodes keep their state. The entity hierarchy is
+         * only regenerated when the root, standalone or named entity queries changed, or when the
+         * transform hierarchy revision moved since parenting is not tracked by component signatures.
          */
         void update() override;
 
-            void generateHierarchicalNodes(std::map<scene::SceneId, SceneObject> &scenes);
+            void generateHierarchicalNodes();
             void buildChildNodesForEntity(
                 ecs::Entity parentEntity,
                 SceneObject& parentNode,
                 std::unordered_set<ecs::Entity>& processedEntities);
-            static SceneObject createEntityNode(scene::SceneId sceneId, WindowId uiId, ecs::Entity entity) ;
+            SceneObject createEntityNode(scene::SceneId sceneId, WindowId uiId, ecs::Entity entity);
 
         private:
 	        SceneObject root_;    ///< Root node of the scene tree.
 	        unsigned int m_nbDirLights = 0;   ///< Counter for directional lights.
 	        unsigned int m_nbPointLights = 0; ///< Counter for point lights.
 	        unsigned int m_nbSpotLights = 0;  ///< Counter for spot lights.
+	        std::map<scene::SceneId, std::string> m_displayedScenes; ///< Scenes currently present in the tree.
+	        std::shared_ptr<ecs::CachedQuery> m_ambientLightQuery;     ///< Ambient lights of any scene.
+	        std::shared_ptr<ecs::CachedQuery> m_directionalLightQuery; ///< Directional lights of any scene.
+	        std::shared_ptr<ecs::CachedQuery> m_pointLightQuery;       ///< Point lights of any scene.
+	        std::shared_ptr<ecs::CachedQuery> m_spotLightQuery;        ///< Spot lights of any scene.
+	        std::shared_ptr<ecs::CachedQuery> m_cameraQuery;           ///< Scene cameras, editor cameras excluded.
+	        std::shared_ptr<ecs::CachedQuery> m_rootEntityQuery;       ///< Roots of the entity hierarchies.
+	        std::shared_ptr<ecs::CachedQuery> m_standaloneEntityQuery; ///< Meshes without parent nor root.
+	        std::shared_ptr<ecs::CachedQuery> m_namedEntityQuery;      ///< Entities whose label comes from a name.
+	        uint64_t m_hierarchyRevision = 0; ///< Transform hierarchy revision the entity nodes were built from.
+
+	        /**
+	         * @brief Label of an entity node, cached while the entity keeps the same UUID.
+	         */
+	        struct EntityLabel {
+	            std::string uiName;
+	            std::string uuid;
+	        };
+	        std::unordered_map<ecs::Entity, EntityLabel> m_entityLabels; ///< Labels of the entities in the tree.
+	        std::unordered_map<ecs::Entity, EntityLabel> m_previousEntityLabels; ///< Labels reused during a rebuild.
 	        std::optional<std::pair<SelectionType, std::string>> m_renameTarget; ///< Target for renaming.
 	        std::string m_renameBuffer; ///< Buffer for rename input.
 	        PopupManager m_popupManager; ///< Manages context and creation popups.
 	        ecs::Entity m_pendingPhysicsEntity = 0; ///< Entity waiting for physics component addition.
 
         /**
-         * @brief Generates nodes for all entities matching the specified components.
+         * @brief Generates nodes for all entities currently matched by a cached query.
          *
-         * This template function iterates over all entities with the given components,
-         * creates a SceneObject node using the provided nodeCreator function, and adds it
-         * to the corresponding scene node.
+         * This template function iterates over the entities of the query, creates a SceneObject node
+         * using the provided nodeCreator function, and adds it to the corresponding scene node.
+         * The pending changes of the query are consumed since the nodes reflect its whole content.
          *
-         * @tparam Components Component types to filter by.
          * @tparam NodeCreator Type of the node creator function.
+         * @param query The cached query, its entities must own a SceneTag.
          * @param scenes Map of scene IDs to their SceneObject nodes.
          * @param nodeCreator Function that creates a SceneObject given a scene ID, UI window ID, and entity.
          */
-        template <typename... Components, typename NodeCreator>
-        static void generateNodes(std::map<scene::SceneId, SceneObject>& scenes, NodeCreator nodeCreator)
+        template <typename NodeCreator>
+        static void generateNodes(ecs::CachedQuery &query, std::map<scene::SceneId, SceneObject>& scenes, NodeCreator nodeCreator)
         {
-            const std::vector<ecs::Entity> entities = Application::m_coordinator->getAllEntitiesWith<Components...>();
-            for (const ecs::Entity entity : entities)
+            for (const ecs::Entity entity : query.entities())
             {
                 const auto& sceneTag = Application::m_coordinator->getComponent<components::SceneTag>(entity);
                 if (auto it = scenes.find(sceneTag.id); it != scenes.end())
@@ -171,8 +193,61 @@ namespace nexo::editor
                     it->second.children.push_back(newNode);
                 }
             }
+            query.clearChanges();
         }
 
+        /**
+         * @brief Applies the changes of a cached query since the last frame to the scene tree.
+         *
+         * Nodes of the given type whose entity left the query are removed, then a node is created for
+         * each entity that entered it and inserted before the entity hierarchy of its scene.
+         *
+         * @tparam NodeCreator Type of the node creator function.
+         * @param query The cached query, its entities must own a SceneTag.
+         * @param type The selection type of the nodes generated for this query.
+         * @param nodeCreator Function that creates a SceneObject given a scene ID, UI window ID, and entity.
+         */
+        template <typename NodeCreator>
+        void applyQueryChanges(ecs::CachedQuery &query, const SelectionType type, NodeCreator nodeCreator)
+        {
+            if (!query.hasChanges())
+                return;
+            for (const ecs::Entity entity : query.removed())
+            {
+                for (auto &sceneNode : root_.children)
+                    std::erase_if(sceneNode.children, [entity, type](const SceneObject &node) {
+                        return node.type == type && node.data.entity == entity;
+                    });
+            }
+            for (const ecs::Entity entity : query.added())
+            {
+                const auto& sceneTag = Application::m_coordinator->getComponent<components::SceneTag>(entity);
+                SceneObject *sceneNode = findSceneNode(sceneTag.id);
+                if (!sceneNode)
+                    continue;
+                SceneObject newNode = nodeCreator(sceneNode->data.sceneProperties.sceneId,
+                                                  sceneNode->data.sceneProperties.windowId, entity);
+                const auto firstEntityNode = std::ranges::find(sceneNode->children, SelectionType::ENTITY, &SceneObject::type);
+                sceneNode->children.insert(firstEntityNode, std::move(newNode));
+            }
+            query.clearChanges();
+        }
+
+        /**
+         * @brief Finds the node of a scene in the tree.
+         *
+         * @param sceneId The identifier of the scene.
+         * @return A pointer to the scene node, or nullptr if the scene is not displayed.
+         */
+        SceneObject *findSceneNode(scene::SceneId sceneId);
+
+        /**
+         * @brief Rebuilds every scene node and its light and camera nodes from scratch.
+         *
+         * @param sceneNodes The freshly created scene nodes, indexed by scene ID.
+         */
+        void rebuildSceneNodes(std::map<scene::SceneId, SceneObject> &sceneNodes);
+
             /**
             * @brief Creates a new scene node for the scene tree.
             *
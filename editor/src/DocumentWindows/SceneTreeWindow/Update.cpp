@@ -23,51 +23,37 @@
 
 namespace nexo::editor {
 
-    void SceneTreeWindow::generateHierarchicalNodes(std::map<scene::SceneId, SceneObject> &scenes)
+    void SceneTreeWindow::generateHierarchicalNodes()
     {
-        // Find all root entities
-        const std::vector<ecs::Entity> rootEntities = Application::m_coordinator->getAllEntitiesWith<
-            components::RootComponent,
-            components::TransformComponent,
-            components::SceneTag>();
+        // The entity nodes are regenerated while the light and camera nodes are kept
+        for (auto &sceneNode : root_.children)
+            std::erase_if(sceneNode.children, [](const SceneObject &node) {
+                return node.type == SelectionType::ENTITY;
+            });
+        // Labels of the entities still in the tree are carried over, the others are dropped
+        m_previousEntityLabels.clear();
+        std::swap(m_previousEntityLabels, m_entityLabels);
 
         // Set to track entities that have been processed
         std::unordered_set<ecs::Entity> processedEntities;
 
-        // Process each root entity
-        for (const ecs::Entity rootEntity : rootEntities) {
-            const auto& sceneTag = Application::m_coordinator->getComponent<components::SceneTag>(rootEntity);
-            if (auto it = scenes.find(sceneTag.id); it != scenes.end()) {
-                SceneObject rootNode = createEntityNode(it->second.data.sceneProperties.sceneId,
-                                                      it->second.data.sceneProperties.windowId,
-                                                      rootEntity);
-                processedEntities.insert(rootEntity);
-                buildChildNodesForEntity(rootEntity, rootNode, processedEntities);
-                it->second.children.push_back(rootNode);
-            }
-        }
-
-        // Find standalone entities (those with no parent but without RootComponent)
-        const std::vector<ecs::Entity> standaloneEntities = Application::m_coordinator->getAllEntitiesWith<
-            components::StaticMeshComponent,
-            components::TransformComponent,
-            components::SceneTag,
-            ecs::Exclude<components::ParentComponent>,
-            ecs::Exclude<components::RootComponent>>();
-
-        for (const ecs::Entity entity : standaloneEntities) {
-            if (processedEntities.contains(entity))
-                continue; // Skip if already processed
-
-            const auto& sceneTag = Application::m_coordinator->getComponent<components::SceneTag>(entity);
-            if (auto it = scenes.find(sceneTag.id); it != scenes.end()) {
-                SceneObject entityNode = createEntityNode(it->second.data.sceneProperties.sceneId,
-                                                       it->second.data.sceneProperties.windowId,
-                                                       entity);
-                processedEntities.insert(entity);
-                buildChildNodesForEntity(entity, entityNode, processedEntities);
-                it->second.children.push_back(entityNode);
+        // Process each root entity, then standalone entities (those with no parent but without RootComponent)
+        for (const auto &query : {m_rootEntityQuery, m_standaloneEntityQuery}) {
+            for (const ecs::Entity entity : query->entities()) {
+                if (processedEntities.contains(entity))
+                    continue; // Skip if already processed
+
+                const auto& sceneTag = Application::m_coordinator->getComponent<components::SceneTag>(entity);
+                if (SceneObject *sceneNode = findSceneNode(sceneTag.id)) {
+                    SceneObject entityNode = createEntityNode(sceneNode->data.sceneProperties.sceneId,
+                                                            sceneNode->data.sceneProperties.windowId,
+                                                            entity);
+                    processedEntities.insert(entity);
+                    buildChildNodesForEntity(entity, entityNode, processedEntities);
+                    sceneNode->children.push_back(std::move(entityNode));
+                }
             }
+            query->clearChanges();
         }
     }
 
@@ -101,6 +87,18 @@ namespace nexo::editor {
         const SceneProperties scene{sceneId, uiId};
         const EntityProperties data{scene, entity};
 
+        // A destroyed entity ID can be reused, the UUID tells whether the cached label is still valid
+        static const std::string noUuid;
+        const auto uuidComponent = Application::m_coordinator->tryGetComponent<components::UuidComponent>(entity);
+        const std::string &currentUuid = uuidComponent ? uuidComponent->get().uuid : noUuid;
+        if (const auto it = m_previousEntityLabels.find(entity);
+            it != m_previousEntityLabels.end() && it->second.uuid == currentUuid) {
+            const auto &label = m_entityLabels.insert_or_assign(entity, std::move(it->second)).first->second;
+            SceneObject node(label.uiName, {}, SelectionType::ENTITY, data);
+            node.uuid = label.uuid;
+            return node;
+        }
+
         std::string name;
 
         // If it is a mesh node/mesh, get the name component
@@ -124,12 +122,6 @@ namespace nexo::editor {
             name = std::format("Entity {}", entity);
         }
 
-        std::string uuid;
-        if (Application::m_coordinator->entityHasComponent<components::UuidComponent>(entity)) {
-            const auto& uuidComponent = Application::m_coordinator->getComponent<components::UuidComponent>(entity);
-            uuid = uuidComponent.uuid;
-        }
-
         // Create UI name with appropriate icon
         std::string uiName;
         if (Application::m_coordinator->entityHasComponent<components::RootComponent>(entity)) {
@@ -141,68 +133,118 @@ namespace nexo::editor {
         }
 
         SceneObject node(uiName, {}, SelectionType::ENTITY, data);
-        node.uuid = uuid;
+        node.uuid = currentUuid;
+        m_entityLabels.insert_or_assign(entity, EntityLabel{std::move(uiName), currentUuid});
 
         return node;
     }
 
 
-    void SceneTreeWindow::update()
+    SceneObject *SceneTreeWindow::findSceneNode(const scene::SceneId sceneId)
+    {
+        const auto it = std::ranges::find_if(root_.children, [sceneId](const SceneObject &node) {
+            return node.data.sceneProperties.sceneId == sceneId;
+        });
+        return it != root_.children.end() ? &*it : nullptr;
+    }
+
+    void SceneTreeWindow::rebuildSceneNodes(std::map<scene::SceneId, SceneObject> &sceneNodes)
     {
-        root_.uiName = "Scene Tree";
-        root_.data.entity = ecs::INVALID_ENTITY;
-        root_.type = SelectionType::NONE;
-        root_.children.clear();
         m_nbPointLights = 0;
         m_nbDirLights = 0;
         m_nbSpotLights = 0;
 
-        if (m_resetExpandState) {
-            m_forceExpandAll = false;
-            m_forceCollapseAll = false;
-            m_resetExpandState = false;
-        }
-
-        // Retrieves the scenes that are displayed on the GUI
-        const auto &scenes = m_windowRegistry.getWindows<EditorScene>();
-        std::map<scene::SceneId, SceneObject> sceneNodes;
-        for (const auto &scene : scenes)
-        {
-            sceneNodes[scene->getSceneId()] = newSceneNode(scene->getWindowName(), scene->getSceneId(), windowId);
-        }
-
-        generateNodes<components::AmbientLightComponent, components::SceneTag>(
+        generateNodes(*m_ambientLightQuery,
             sceneNodes,
             [](const scene::SceneId sceneId, const WindowId uiId, const ecs::Entity entity) {
                 return newAmbientLightNode(sceneId, uiId, entity);
             });
-        generateNodes<components::DirectionalLightComponent, components::SceneTag>(
+        generateNodes(*m_directionalLightQuery,
             sceneNodes,
             [this](const scene::SceneId sceneId, const WindowId uiId, const ecs::Entity entity) {
                 return newDirectionalLightNode(sceneId, uiId, entity);
             });
-        generateNodes<components::PointLightComponent, components::SceneTag>(
+        generateNodes(*m_pointLightQuery,
             sceneNodes,
             [this](const scene::SceneId sceneId, const WindowId uiId, const ecs::Entity entity) {
                 return newPointLightNode(sceneId, uiId, entity);
             });
-        generateNodes<components::SpotLightComponent, components::SceneTag>(
+        generateNodes(*m_spotLightQuery,
             sceneNodes,
             [this](const scene::SceneId sceneId, const WindowId uiId, const ecs::Entity entity) {
                 return newSpotLightNode(sceneId, uiId, entity);
             });
-
-        generateNodes<components::CameraComponent, components::SceneTag, ecs::Exclude<components::EditorCameraTag>>(
+        generateNodes(*m_cameraQuery,
             sceneNodes,
             [](const scene::SceneId sceneId, const WindowId uiId, const ecs::Entity entity) {
                 return newCameraNode(sceneId, uiId, entity);
             });
 
-        generateHierarchicalNodes(sceneNodes);
+        root_.children.clear();
+        for (auto &sceneNode : sceneNodes | std::views::values)
+            root_.children.push_back(std::move(sceneNode));
+    }
+
+    void SceneTreeWindow::update()
+    {
+        root_.uiName = "Scene Tree";
+        root_.data.entity = ecs::INVALID_ENTITY;
+        root_.type = SelectionType::NONE;
+
+        if (m_resetExpandState) {
+            m_forceExpandAll = false;
+            m_forceCollapseAll = false;
+            m_resetExpandState = false;
+        }
+
+        // Retrieves the scenes that are displayed on the GUI
+        const auto &scenes = m_windowRegistry.getWindows<EditorScene>();
+        std::map<scene::SceneId, std::string> displayedScenes;
+        for (const auto &scene : scenes)
+            displayedScenes[scene->getSceneId()] = scene->getWindowName();
+
+        const bool scenesChanged = displayedScenes != m_displayedScenes;
+        if (scenesChanged) {
+            std::map<scene::SceneId, SceneObject> sceneNodes;
+            for (const auto &[sceneId, windowName] : displayedScenes)
+                sceneNodes[sceneId] = newSceneNode(windowName, sceneId, windowId);
+            rebuildSceneNodes(sceneNodes);
+            m_displayedScenes = std::move(displayedScenes);
+        } else {
+            applyQueryChanges(*m_ambientLightQuery, SelectionType::AMBIENT_LIGHT,
+                [](const scene::SceneId sceneId, const WindowId uiId, const ecs::Entity entity) {
+                    return newAmbientLightNode(sceneId, uiId, entity);
+                });
+            applyQueryChanges(*m_directionalLightQuery, SelectionType::DIR_LIGHT,
+                [this](const scene::SceneId sceneId, const WindowId uiId, const ecs::Entity entity) {
+                    return newDirectionalLightNode(sceneId, uiId, entity);
+                });
+            applyQueryChanges(*m_pointLightQuery, SelectionType::POINT_LIGHT,
+                [this](const scene::SceneId sceneId, const WindowId uiId, const ecs::Entity entity) {
+                    return newPointLightNode(sceneId, uiId, entity);
+                });
+            applyQueryChanges(*m_spotLightQuery, SelectionType::SPOT_LIGHT,
+                [this](const scene::SceneId sceneId, const WindowId uiId, const ecs::Entity entity) {
+                    return newSpotLightNode(sceneId, uiId, entity);
+                });
+            applyQueryChanges(*m_cameraQuery, SelectionType::CAMERA,
+                [](const scene::SceneId sceneId, const WindowId uiId, const ecs::Entity entity) {
+                    return newCameraNode(sceneId, uiId, entity);
+                });
+        }
 
-        for (const auto &sceneNode: sceneNodes | std::views::values)
-        {
-            root_.children.push_back(sceneNode);
+        // Renamed or unnamed entities get a new label
+        const bool namesChanged = m_namedEntityQuery->hasChanges();
+        for (const auto &changes : {m_namedEntityQuery->removed(), m_namedEntityQuery->added()})
+            for (const ecs::Entity entity : changes)
+                m_entityLabels.erase(entity);
+        m_namedEntityQuery->clearChanges();
+
+        const uint64_t hierarchyRevision = Application::m_coordinator->getHierarchyRevision();
+        if (scenesChanged || namesChanged || hierarchyRevision != m_hierarchyRevision ||
+            m_rootEntityQuery->hasChanges() || m_standaloneEntityQuery->hasChanges()) {
+            m_hierarchyRevision = hierarchyRevision;
+            generateHierarchicalNodes();
         }
     }
 }
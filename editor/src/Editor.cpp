@@ -28,6 +28,7 @@
 #include "IconsFontAwesome.h"
 #include "ImNexo/Elements.hpp"
 #include "context/ActionManager.hpp"
+#include "renderer/Renderer3D.hpp"
 #include "DocumentWindows/TestWindow/TestWindow.hpp"
 
 #include <imgui_internal.h>
@@ -48,6 +49,8 @@ namespace nexo::editor {
         LOG(NEXO_INFO, "Closing editor");
         LOG(NEXO_INFO, "All windows destroyed");
         m_windowRegistry.shutdown();
+        // Releases the renderer resources while the graphics context still exists
+        renderer::NxRenderer3D::get().shutdown();
         ImGuiBackend::shutdown();
     }
 
@@ -17,10 +17,17 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "EntityActions.hpp"
-#include "ComponentRestoreFactory.hpp"
 
 namespace nexo::editor {
 
+    void ComponentRestoreAction::undo()
+    {
+        const auto &coordinator = Application::m_coordinator;
+        m_memento.restore([&](const void *component) {
+            coordinator->addComponent(m_entity, m_componentType, component);
+        });
+    }
+
     void EntityCreationAction::redo()
     {
         const auto &coordinator = Application::m_coordinator;
@@ -33,35 +40,30 @@ namespace nexo::editor {
     void EntityCreationAction::undo()
     {
         const auto &coordinator = Application::m_coordinator;
-        const std::vector<std::any>& componentsTypeIndex = coordinator->getAllComponents(m_entityId);
-        for (const auto &typeIndex : componentsTypeIndex) {
-            if (!coordinator->supportsMementoPattern(typeIndex))
-                continue;
-            m_componentRestoreActions.push_back(ComponentRestoreFactory::createRestoreComponent(m_entityId, typeIndex));
-        }
+        coordinator->forEachComponent(m_entityId, [&](const ecs::ComponentType type, const ecs::ComponentVTable &vtable, const void *component) {
+            if (!vtable.supportsMemento())
+                return;
+            m_componentRestoreActions.push_back(std::make_unique<ComponentRestoreAction>(m_entityId, type, vtable, component));
+        });
         coordinator->destroyEntity(m_entityId);
     }
 
     EntityDeletionAction::EntityDeletionAction(const ecs::Entity entityId) : m_entityId(entityId)
     {
         const auto &coordinator = Application::m_coordinator;
-        const std::vector<std::any>& componentsTypeIndex = coordinator->getAllComponents(m_entityId);
-        for (const auto &typeIndex : componentsTypeIndex) {
-             if (!coordinator->supportsMementoPattern(typeIndex))
-                continue;
-            auto typeId = std::type_index(typeIndex.type());
-            if (typeId == typeid(components::ParentComponent)) {
-                auto parentOpt = coordinator->tryGetComponent<components::ParentComponent>(entityId);
-                if (parentOpt.has_value()) {
-                    ecs::Entity oldParent = parentOpt->get().parent;
-                    m_componentRestoreActions.push_back(
-                        std::make_unique<EntityParentChangeAction>(entityId, oldParent, ecs::INVALID_ENTITY)
-                    );
-                }
-                continue;
-            }
-            m_componentRestoreActions.push_back(ComponentRestoreFactory::createRestoreComponent(entityId, typeIndex));
-        }
+        const ecs::ComponentType parentType = coordinator->getComponentType<components::ParentComponent>();
+        coordinator->forEachComponent(m_entityId, [&](const ecs::ComponentType type, const ecs::ComponentVTable &vtable, const void *component) {
+            if (!vtable.supportsMemento())
+                return;
+            if (type == parentType) {
+                const ecs::Entity oldParent = static_cast<const components::ParentComponent *>(component)->parent;
+                m_componentRestoreActions.push_back(
+                    std::make_unique<EntityParentChangeAction>(entityId, oldParent, ecs::INVALID_ENTITY)
+                );
+                return;
+            }
+            m_componentRestoreActions.push_back(std::make_unique<ComponentRestoreAction>(entityId, type, vtable, component));
+        });
     }
 
     void EntityDeletionAction::redo()
@@ -72,9 +74,8 @@ namespace nexo::editor {
         if (parentOpt.has_value()) {
             ecs::Entity oldParent = parentOpt->get().parent;
             auto parentTransformOpt = coordinator->tryGetComponent<components::TransformComponent>(oldParent);
-            if (parentTransformOpt.has_value()) {
-                parentTransformOpt->get().removeChild(m_entityId);
-            }
+            if (parentTransformOpt.has_value() && parentTransformOpt->get().removeChild(m_entityId))
+                coordinator->markHierarchyChanged();
         }
         coordinator->destroyEntity(m_entityId);
     }
@@ -93,9 +94,8 @@ namespace nexo::editor {
         // Handle old parent
         if (m_oldParent != ecs::INVALID_ENTITY) {
             const auto oldParentTransform = coordinator.tryGetComponent<components::TransformComponent>(m_oldParent);
-            if (oldParentTransform.has_value()) {
-                oldParentTransform->get().removeChild(m_entity);
-            }
+            if (oldParentTransform.has_value() && oldParentTransform->get().removeChild(m_entity))
+                coordinator.markHierarchyChanged();
         }
 
         // Handle new parent
@@ -114,9 +114,8 @@ namespace nexo::editor {
                 coordinator.addComponent(m_newParent, components::TransformComponent{});
                 newParentTransform = coordinator.tryGetComponent<components::TransformComponent>(m_newParent);
             }
-            if (newParentTransform.has_value()) {
-                newParentTransform->get().addChild(m_entity);
-            }
+            if (newParentTransform.has_value() && newParentTransform->get().addChild(m_entity))
+                coordinator.markHierarchyChanged();
         } else {
             // Remove parent component (make it a root entity)
             const auto parentComp = coordinator.tryGetComponent<components::ParentComponent>(m_entity);
@@ -133,9 +132,8 @@ namespace nexo::editor {
         // Handle new parent (undo by removing from it)
         if (m_newParent != ecs::INVALID_ENTITY) {
             const auto newParentTransform = coordinator.tryGetComponent<components::TransformComponent>(m_newParent);
-            if (newParentTransform.has_value()) {
-                newParentTransform->get().removeChild(m_entity);
-            }
+            if (newParentTransform.has_value() && newParentTransform->get().removeChild(m_entity))
+                coordinator.markHierarchyChanged();
         }
 
         // Handle old parent (restore to it)
@@ -154,9 +152,8 @@ namespace nexo::editor {
                 coordinator.addComponent(m_oldParent, components::TransformComponent{});
                 oldParentTransform = coordinator.tryGetComponent<components::TransformComponent>(m_oldParent);
             }
-            if (oldParentTransform.has_value()) {
-                oldParentTransform->get().addChild(m_entity);
-            }
+            if (oldParentTransform.has_value() && oldParentTransform->get().addChild(m_entity))
+                coordinator.markHierarchyChanged();
         } else {
             // Remove parent component (restore to root entity)
             const auto parentComp = coordinator.tryGetComponent<components::ParentComponent>(m_entity);
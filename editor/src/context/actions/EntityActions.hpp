@@ -23,21 +23,17 @@
 
 namespace nexo::editor {
 
-    template<typename ComponentType>
+    /**
+    * Snapshots a component through its vtable so it can be re-added once the entity is recreated
+    * Works for any component type supporting the memento pattern, without knowing it at compile time
+    */
     class ComponentRestoreAction final : public Action {
         public:
-            explicit ComponentRestoreAction(const ecs::Entity entity) : m_entity(entity)
-            {
-                ComponentType &target = Application::m_coordinator->getComponent<ComponentType>(m_entity);
-                m_memento = target.save();
-            };
+            ComponentRestoreAction(const ecs::Entity entity, const ecs::ComponentType componentType,
+                                   const ecs::ComponentVTable &vtable, const void *component)
+                : m_entity(entity), m_componentType(componentType), m_memento(vtable, component) {}
 
-            void undo() override
-            {
-                ComponentType target;
-                target.restore(m_memento);
-                Application::m_coordinator->addComponent(m_entity, target);
-            }
+            void undo() override;
 
             void redo() override
             {
@@ -46,7 +42,8 @@ namespace nexo::editor {
 
         private:
             ecs::Entity m_entity;
-            typename ComponentType::Memento m_memento;
+            ecs::ComponentType m_componentType;
+            ecs::ComponentMemento m_memento;
     };
 
     template<typename ComponentType>
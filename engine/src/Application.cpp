@@ -42,16 +42,21 @@
 #include "exceptions/Exceptions.hpp"
 #include "renderer/RendererExceptions.hpp"
 #include "renderer/Renderer.hpp"
+#include "renderer/RenderProfiler.hpp"
 #include "scripting/native/Scripting.hpp"
 #include "systems/CameraSystem.hpp"
 #include "systems/RenderBillboardSystem.hpp"
 #include "systems/RenderCommandSystem.hpp"
 #include "systems/TransformHierarchySystem.hpp"
 #include "systems/TransformMatrixSystem.hpp"
+#include "systems/SpatialIndexSystem.hpp"
 #include "systems/ScriptingSystem.hpp"
 #include "systems/lights/DirectionalLightsSystem.hpp"
 #include "systems/lights/PointLightsSystem.hpp"
 
+#include <cstdlib>
+#include <string_view>
+
 std::unique_ptr<nexo::Application> nexo::Application::_instance = nullptr;
 std::shared_ptr<nexo::ecs::Coordinator> nexo::Application::m_coordinator = nullptr;
 
@@ -81,27 +86,16 @@ namespace nexo {
         m_coordinator->registerComponent<components::TransformComponent>();
         m_coordinator->registerComponent<components::RootComponent>();
         m_coordinator->registerComponent<components::RenderComponent>();
-        m_coordinator->setRestoreComponent<components::RenderComponent>();
         m_coordinator->registerComponent<components::SceneTag>();
-        m_coordinator->setRestoreComponent<components::SceneTag>();
         m_coordinator->registerComponent<components::CameraComponent>();
-        m_coordinator->setRestoreComponent<components::CameraComponent>();
         m_coordinator->registerComponent<components::AmbientLightComponent>();
-        m_coordinator->setRestoreComponent<components::AmbientLightComponent>();
         m_coordinator->registerComponent<components::PointLightComponent>();
-        m_coordinator->setRestoreComponent<components::PointLightComponent>();
         m_coordinator->registerComponent<components::DirectionalLightComponent>();
-        m_coordinator->setRestoreComponent<components::DirectionalLightComponent>();
         m_coordinator->registerComponent<components::SpotLightComponent>();
-        m_coordinator->setRestoreComponent<components::SpotLightComponent>();
         m_coordinator->registerComponent<components::UuidComponent>();
-        m_coordinator->setRestoreComponent<components::UuidComponent>();
         m_coordinator->registerComponent<components::PerspectiveCameraController>();
-        m_coordinator->setRestoreComponent<components::PerspectiveCameraController>();
         m_coordinator->registerComponent<components::PerspectiveCameraTarget>();
-        m_coordinator->setRestoreComponent<components::PerspectiveCameraTarget>();
         m_coordinator->registerComponent<components::EditorCameraTag>();
-        m_coordinator->setRestoreComponent<components::EditorCameraTag>();
         m_coordinator->registerComponent<components::SelectedTag>();
         m_coordinator->registerComponent<components::StaticMeshComponent>();
         m_coordinator->registerComponent<components::ParentComponent>();
@@ -219,6 +213,7 @@ namespace nexo {
         m_renderBillboardSystem = m_coordinator->registerGroupSystem<system::RenderBillboardSystem>();
         m_transformHierarchySystem = m_coordinator->registerGroupSystem<system::TransformHierarchySystem>();
         m_transformMatrixSystem = m_coordinator->registerQuerySystem<system::TransformMatrixSystem>();
+        m_spatialIndexSystem = m_coordinator->registerQuerySystem<system::SpatialIndexSystem>();
         m_physicsSystem = m_coordinator->registerQuerySystem<system::PhysicsSystem>();
         m_physicsSystem->init();
 
@@ -244,6 +239,9 @@ namespace nexo {
     Application::Application()
     {
         m_window = renderer::NxWindow::create();
+        // Lets CI and benchmark scripts run any executable of the engine without a display
+        if (const char *headless = std::getenv("NEXO_HEADLESS"); headless && *headless && std::string_view(headless) != "0")
+            m_window->setHeadless(true);
         m_eventManager = std::make_shared<event::EventManager>();
         registerAllDebugListeners();
         registerSignalListeners();
@@ -253,7 +251,7 @@ namespace nexo {
 
         m_coordinator = std::make_shared<ecs::Coordinator>();
 
-        ecs::System::coord = m_coordinator;
+        ecs::System::currentWorld() = m_coordinator;
 
         LOG(NEXO_DEV, "Application created");
     }
@@ -290,6 +288,8 @@ namespace nexo {
 #endif
 
         renderer::NxRenderer::init();
+        // The context is current from here, the pipelines can measure their passes on the GPU
+        renderer::NxRenderProfiler::get().setGpuTimingEnabled(true);
 
         m_coordinator->init();
         registerEcsComponents();
@@ -306,6 +306,7 @@ namespace nexo {
         m_worldState.time.deltaTime = time - m_worldState.time.totalTime;
         m_worldState.time.totalTime = time;
         m_worldState.stats.frameCount += 1;
+        renderer::NxRenderer3D::get().beginFrame();
     }
 
     void Application::run(const SceneInfo &sceneInfo)
@@ -329,15 +330,13 @@ namespace nexo {
 			{
                 m_transformMatrixSystem->update();
                 m_transformHierarchySystem->update();
+                m_spatialIndexSystem->update();
 				m_cameraContextSystem->update();
 				m_lightSystem->update();
 				m_renderCommandSystem->update();
 				m_renderBillboardSystem->update();
 				for (auto &camera : renderContext.cameras)
-				    camera.pipeline.execute();
-				// We have to unbind after the whole pipeline since multiple passes can use the same textures
-				// but we cant bind everything beforehand since a resize can be triggered and invalidate the whole state
-                renderer::NxRenderer3D::get().unbindTextures();
+				    camera.pipeline->execute();
                 
                 if (isInPlayMode()) {
                     m_physicsSystem->update();
@@ -360,6 +359,7 @@ namespace nexo {
 
     void Application::endFrame()
     {
+        renderer::NxRenderer3D::get().endFrame();
     	m_eventManager->clearEvents();
     }
 
@@ -398,7 +398,8 @@ namespace nexo {
         auto parentTransform = m_coordinator->tryGetComponent<components::TransformComponent>(parentEntity);
         if (parentTransform) {
             // Remove this entity from parent's children vector
-            parentTransform->get().removeChild(entity);
+            if (parentTransform->get().removeChild(entity))
+                m_coordinator->markHierarchyChanged();
         }
     }
 
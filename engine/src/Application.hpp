@@ -42,6 +42,7 @@
 #include "systems/TransformHierarchySystem.hpp"
 #include "systems/TransformMatrixSystem.hpp"
 #include "systems/PhysicsSystem.hpp"
+#include "systems/SpatialIndexSystem.hpp"
 
 #define NEXO_PROFILE(name) nexo::Timer timer##__LINE__(name, [&](ProfileResult profileResult) {m_profileResults.push_back(profileResult); })
 
@@ -84,11 +85,27 @@ namespace nexo {
 
             void init();
 
+            /**
+             * @brief Runs the application without a display, must be called before init().
+             *
+             * The window becomes an offscreen EGL or OSMesa context, so the whole frame loop (systems,
+             * pipelines and passes) runs on GPU-less machines with a software rasterizer such as
+             * llvmpipe. Nothing is presented, scenes should render to their framebuffers.
+             *
+             * The application also starts headless when the NEXO_HEADLESS environment variable is set to
+             * anything but "0", and the editor when it is given the --headless flag.
+             *
+             * @param enabled True to run headless.
+             */
+            void setHeadless(bool enabled) const { m_window->setHeadless(enabled); }
+            [[nodiscard]] bool isHeadless() const { return m_window->isHeadless(); }
+
             /**
              * @brief Begins a new frame by updating the timestep.
              *
              * Calculates the time elapsed since the last frame using glfwGetTime()
-             * and updates the current timestep. Also updates the last frame time.
+             * and updates the current timestep. Also updates the last frame time, and moves
+             * the renderer streaming rings to the region of the new frame.
              */
             void beginFrame();
 
@@ -123,7 +140,8 @@ namespace nexo {
              * @brief Ends the current frame by clearing processed events.
              *
              * Clears all the events that have been dispatched during the frame,
-             * preparing the EventManager for the next frame.
+             * preparing the EventManager for the next frame, and fences the data the
+             * renderer streamed during the frame.
              */
             void endFrame();
 
@@ -204,6 +222,18 @@ namespace nexo {
                 return m_physicsSystem;
             }
 
+            std::shared_ptr<system::SpatialIndexSystem> getSpatialIndexSystem() const {
+                return m_spatialIndexSystem;
+            }
+
+            std::shared_ptr<system::CameraContextSystem> getCameraContextSystem() const {
+                return m_cameraContextSystem;
+            }
+
+            std::shared_ptr<system::RenderCommandSystem> getRenderCommandSystem() const {
+                return m_renderCommandSystem;
+            }
+
             /**
              * @brief Deletes an existing entity.
              *
@@ -288,6 +318,7 @@ namespace nexo {
             std::shared_ptr<system::LightSystem> m_lightSystem;
             std::shared_ptr<system::TransformMatrixSystem> m_transformMatrixSystem;
             std::shared_ptr<system::TransformHierarchySystem> m_transformHierarchySystem;
+            std::shared_ptr<system::SpatialIndexSystem> m_spatialIndexSystem;
             std::shared_ptr<system::PerspectiveCameraControllerSystem> m_perspectiveCameraControllerSystem;
             std::shared_ptr<system::PerspectiveCameraTargetSystem> m_perspectiveCameraTargetSystem;
             std::shared_ptr<system::ScriptingSystem> m_scriptingSystem;
@@ -40,6 +40,10 @@
 
 namespace nexo
 {
+    // Bounds of the procedural primitives in mesh space, the cube spans [-0.5, 0.5] and the others [-1, 1]
+    static constexpr math::Aabb cubeBounds{glm::vec3(-0.5f), glm::vec3(0.5f)};
+    static constexpr math::Aabb unitPrimitiveBounds{glm::vec3(-1.0f), glm::vec3(1.0f)};
+
     ecs::Entity EntityFactory3D::createCube(glm::vec3 pos, glm::vec3 size, glm::vec3 rotation, glm::vec4 color)
     {
         components::TransformComponent transform{};
@@ -49,6 +53,7 @@ namespace nexo
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getCubeVAO();
+        mesh.localBounds = cubeBounds;
 
         auto material = std::make_unique<components::Material>();
         material->albedoColor = color;
@@ -84,6 +89,7 @@ namespace nexo
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getCubeVAO();
+        mesh.localBounds = cubeBounds;
 
         const auto materialRef = assets::AssetCatalog::getInstance().createAsset<assets::Material>(
             assets::AssetLocation("_internal::CubeMat@_internal"),
@@ -178,6 +184,7 @@ namespace nexo
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getTetrahedronVAO();
+        mesh.localBounds = unitPrimitiveBounds;
 
         auto material = std::make_unique<components::Material>();
         material->albedoColor = color;
@@ -209,6 +216,7 @@ namespace nexo
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getTetrahedronVAO();
+        mesh.localBounds = unitPrimitiveBounds;
 
         const auto materialRef = assets::AssetCatalog::getInstance().createAsset<assets::Material>(
             assets::AssetLocation("_internal::TetrahedronMat@_internal"),
@@ -236,6 +244,7 @@ namespace nexo
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getPyramidVAO();
+        mesh.localBounds = unitPrimitiveBounds;
 
         auto material = std::make_unique<components::Material>();
         material->albedoColor = color;
@@ -266,6 +275,7 @@ namespace nexo
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getPyramidVAO();
+        mesh.localBounds = unitPrimitiveBounds;
 
         const auto materialRef = assets::AssetCatalog::getInstance().createAsset<assets::Material>(
             assets::AssetLocation("_internal::PyramidMat@_internal"),
@@ -294,6 +304,7 @@ namespace nexo
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getCylinderVAO(nbSegment);
+        mesh.localBounds = unitPrimitiveBounds;
 
         auto material = std::make_unique<components::Material>();
         material->albedoColor = color;
@@ -324,6 +335,7 @@ namespace nexo
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getCylinderVAO(nbSegment);
+        mesh.localBounds = unitPrimitiveBounds;
 
         const auto materialRef = assets::AssetCatalog::getInstance().createAsset<assets::Material>(
             assets::AssetLocation("_internal::CylinderMat@_internal"),
@@ -352,6 +364,7 @@ namespace nexo
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getSphereVAO(nbSubdivision);
+        mesh.localBounds = unitPrimitiveBounds;
 
         auto material = std::make_unique<components::Material>();
         material->albedoColor = color;
@@ -382,6 +395,7 @@ namespace nexo
 
         components::StaticMeshComponent mesh;
         mesh.vao = renderer::NxRenderer3D::getSphereVAO(nbSubdivision);
+        mesh.localBounds = unitPrimitiveBounds;
 
         const auto materialRef = assets::AssetCatalog::getInstance().createAsset<assets::Material>(
             assets::AssetLocation("_internal::SphereMat@_internal"),
@@ -465,8 +479,8 @@ namespace nexo
 
         auto parentTransform = Application::m_coordinator->tryGetComponent<
             components::TransformComponent>(parentEntity);
-        if (parentTransform)
-            parentTransform->get().children.push_back(nodeEntity);
+        if (parentTransform && parentTransform->get().addChild(nodeEntity))
+            Application::m_coordinator->markHierarchyChanged();
 
 
         if (!node.name.empty())
@@ -493,6 +507,8 @@ namespace nexo
 
             components::StaticMeshComponent staticMesh;
             staticMesh.vao = mesh.vao;
+            staticMesh.arenaMesh = mesh.arenaMesh;
+            staticMesh.localBounds = mesh.localBounds;
 
             components::RenderComponent renderComponent;
             renderComponent.isRendered = true;
@@ -522,8 +538,8 @@ namespace nexo
 
             auto nodeTransform = Application::m_coordinator->tryGetComponent<
                 components::TransformComponent>(nodeEntity);
-            if (nodeTransform)
-                nodeTransform->get().children.push_back(meshEntity);
+            if (nodeTransform && nodeTransform->get().addChild(meshEntity))
+                Application::m_coordinator->markHierarchyChanged();
         }
 
         for (const auto& childNode : node.children)
@@ -18,18 +18,23 @@
 
 #pragma once
 
+#include "MeshArena.hpp"
 #include "VertexArray.hpp"
 #include "assets/Asset.hpp"
 #include "assets/Assets/Material/Material.hpp"
+#include "math/Frustum.hpp"
 
 namespace nexo::assets {
 
     struct Mesh {
         std::string name;
         std::shared_ptr<renderer::NxVertexArray> vao;
+        // Geometry stored in the shared mesh arena, set instead of vao for imported meshes
+        std::shared_ptr<renderer::NxArenaMesh> arenaMesh;
         AssetRef<Material> material;
 
         glm::vec3 localCenter = {0.0f, 0.0f, 0.0f};
+        math::Aabb localBounds;
     };
 
     struct MeshNode {
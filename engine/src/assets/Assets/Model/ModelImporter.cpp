@@ -361,17 +361,6 @@ namespace nexo::assets {
 
     Mesh ModelImporter::processMesh(const AssetImporterContext& ctx, aiMesh* mesh, [[maybe_unused]] const aiScene* scene) const
     {
-        std::shared_ptr<renderer::NxVertexArray> vao = renderer::createVertexArray();
-        auto vertexBuffer = renderer::createVertexBuffer(mesh->mNumVertices * sizeof(renderer::NxVertex));
-        const renderer::NxBufferLayout cubeVertexBufferLayout = {
-            {renderer::NxShaderDataType::FLOAT3, "aPos"},
-            {renderer::NxShaderDataType::FLOAT2, "aTexCoord"},
-            {renderer::NxShaderDataType::FLOAT3, "aNormal"},
-            {renderer::NxShaderDataType::FLOAT3, "aTangent"},
-            {renderer::NxShaderDataType::FLOAT3, "aBiTangent"},
-            {renderer::NxShaderDataType::INT, "aEntityID"}
-        };
-        vertexBuffer->setLayout(cubeVertexBufferLayout);
         std::vector<renderer::NxVertex> vertices;
         std::vector<unsigned int> indices;
         vertices.reserve(mesh->mNumVertices);
@@ -413,12 +402,11 @@ namespace nexo::assets {
             indices.insert(indices.end(), face.mIndices, face.mIndices + face.mNumIndices);
         }
 
-        vertexBuffer->setData(vertices.data(), static_cast<unsigned int>(vertices.size() * sizeof(renderer::NxVertex)));
-        vao->addVertexBuffer(vertexBuffer);
-
-        std::shared_ptr<renderer::NxIndexBuffer> indexBuffer = renderer::createIndexBuffer();
-        indexBuffer->setData(indices.data(), static_cast<unsigned int>(indices.size()));
-        vao->setIndexBuffer(indexBuffer);
+        std::shared_ptr<renderer::NxArenaMesh> arenaMesh = nullptr;
+        if (!vertices.empty() && !indices.empty())
+            arenaMesh = renderer::NxRenderer3D::getMeshArena()->add(vertices, indices);
+        else
+            LOG(NEXO_WARN, "ModelImporter: Model {}: Mesh {} has no geometry.", std::quoted(ctx.location.getFullLocation()), std::quoted(mesh->mName.C_Str()));
 
         AssetRef<Material> materialComponent = nullptr;
         if (mesh->mMaterialIndex < m_materials.size()) {
@@ -431,7 +419,7 @@ namespace nexo::assets {
         }
 
         LOG(NEXO_INFO, "Loaded mesh {}", mesh->mName.C_Str());
-        return {mesh->mName.C_Str(), vao, materialComponent, centerLocal};
+        return {mesh->mName.C_Str(), nullptr, arenaMesh, materialComponent, centerLocal, {minBB, maxBB}};
     }
 
     glm::mat4 ModelImporter::convertAssimpMatrixToGLM(const aiMatrix4x4& matrix)
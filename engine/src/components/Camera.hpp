@@ -182,12 +182,14 @@ namespace nexo::components {
      *
      * Includes the view-projection matrix, camera position, clear color,
      * and the render target used for rendering.
+     *
+     * The pipeline is the one of the camera component, so the storage it keeps between frames is reused.
      */
     struct CameraContext {
         glm::mat4 viewProjectionMatrix;                      ///< Combined view and projection matrix.
         glm::vec3 cameraPosition;                            ///< The position of the camera.
         glm::vec4 clearColor;                                ///< Clear color used for rendering.
         std::shared_ptr<renderer::NxFramebuffer> renderTarget; ///< The render target framebuffer.
-        renderer::RenderPipeline pipeline;
+        renderer::RenderPipeline *pipeline;                  ///< Pipeline of the camera component, valid until the render context is reset.
     };
 }
@@ -22,9 +22,10 @@
 #include <array>
 
 #include "ecs/Definitions.hpp"
+#include "renderer/SceneLights.hpp"
 
-constexpr unsigned int MAX_POINT_LIGHTS = 10;
-constexpr unsigned int MAX_SPOT_LIGHTS = 10;
+constexpr unsigned int MAX_POINT_LIGHTS = nexo::renderer::NX_MAX_POINT_LIGHTS;
+constexpr unsigned int MAX_SPOT_LIGHTS = nexo::renderer::NX_MAX_SPOT_LIGHTS;
 
 namespace nexo::components {
 
@@ -150,5 +151,7 @@ namespace nexo::components {
         std::array<ecs::Entity, MAX_SPOT_LIGHTS> spotLights;
         unsigned int spotLightCount = 0;
         DirectionalLightComponent dirLight;
+        /// Set once the lights above were uploaded to the scene lights buffer for the current frame
+        bool uploaded = false;
     };
 }
@@ -21,6 +21,7 @@
 
 #include "assets/AssetRef.hpp"
 #include "assets/Assets/Texture/Texture.hpp"
+#include "renderer/ShaderVariants.hpp"
 
 namespace nexo::components {
 
@@ -42,5 +43,7 @@ namespace nexo::components {
         assets::AssetRef<assets::Texture> emissiveMap = nullptr;
 
         std::string shader = "Phong";
+        // Variant `shader` resolves to, looked up on first draw; reset it when changing `shader`
+        renderer::NxShaderHandle shaderHandle;
     };
 }
@@ -65,6 +65,7 @@ namespace nexo::components {
             sceneLights.pointLightCount = 0;
             sceneLights.spotLightCount = 0;
             sceneLights.dirLight = DirectionalLightComponent{};
+            sceneLights.uploaded = false;
         }
     };
 }
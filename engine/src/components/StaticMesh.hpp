@@ -18,27 +18,39 @@
 #pragma once
 
 #include "renderer/Attributes.hpp"
+#include "renderer/MeshArena.hpp"
+#include "math/Frustum.hpp"
+
+#include <optional>
 #include "renderer/VertexArray.hpp"
 
 namespace nexo::components {
 
     struct StaticMeshComponent {
         std::shared_ptr<renderer::NxVertexArray> vao;
+        // Set for meshes stored in the shared mesh arena, in which case vao is unused
+        std::shared_ptr<renderer::NxArenaMesh> arenaMesh;
+        // Bounds of the vertices in mesh space, meshes without bounds are never culled
+        std::optional<math::Aabb> localBounds;
 
         renderer::RequiredAttributes meshAttributes;
 
         struct Memento {
             std::shared_ptr<renderer::NxVertexArray> vao;
+            std::shared_ptr<renderer::NxArenaMesh> arenaMesh;
+            std::optional<math::Aabb> localBounds;
         };
 
         void restore(const Memento &memento)
         {
             vao = memento.vao;
+            arenaMesh = memento.arenaMesh;
+            localBounds = memento.localBounds;
         }
 
         [[nodiscard]] Memento save() const
         {
-            return {vao};
+            return {vao, arenaMesh, localBounds};
         }
     };
 
@@ -36,15 +36,24 @@ namespace nexo::components {
         return {pos, quat, size, localMatrix, localCenter, children};
     }
 
-    void TransformComponent::addChild(const ecs::Entity childEntity)
+    bool TransformComponent::addChild(const ecs::Entity childEntity)
     {
         if (std::ranges::find(children, childEntity) != children.end())
-            return;
+            return false;
         children.push_back(childEntity);
+        return true;
     }
 
-    void TransformComponent::removeChild(const ecs::Entity childEntity)
+    bool TransformComponent::removeChild(const ecs::Entity childEntity)
     {
-        children.erase(std::ranges::remove(children, childEntity).begin(), children.end());
+        return std::erase(children, childEntity) != 0;
+    }
+
+    void TransformComponent::setWorldMatrix(const glm::mat4 &matrix)
+    {
+        if (worldMatrix == matrix)
+            return;
+        worldMatrix = matrix;
+        ++worldRevision;
     }
 }
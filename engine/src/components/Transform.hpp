@@ -21,6 +21,7 @@
 
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
+#include <cstdint>
 #include <vector>
 
 namespace nexo::components {
@@ -40,8 +41,22 @@ namespace nexo::components {
         void restore(const Memento &memento);
         [[nodiscard]] Memento save() const;
 
-        void addChild(ecs::Entity childEntity);
-        void removeChild(ecs::Entity childEntity);
+        /**
+         * @brief Adds a child entity, returning false when it already was a child.
+         *
+         * Callers report a change to the world through Coordinator::markHierarchyChanged.
+         */
+        [[nodiscard]] bool addChild(ecs::Entity childEntity);
+
+        /**
+         * @brief Removes a child entity, returning false when it was not a child.
+         */
+        [[nodiscard]] bool removeChild(ecs::Entity childEntity);
+
+        /**
+         * @brief Sets the world matrix, increasing worldRevision when it changes.
+         */
+        void setWorldMatrix(const glm::mat4 &matrix);
 
         glm::vec3 pos;
         glm::vec3 size = glm::vec3(1.0f);
@@ -53,5 +68,9 @@ namespace nexo::components {
         glm::vec3 localCenter = {0.0f, 0.0f, 0.0f};
 
         std::vector<ecs::Entity> children{};
+
+        /// Increased by setWorldMatrix() on each change, consumers compare it to skip the transforms that did not move.
+        /// Kept last, the managed Transform mirrors the layout of the members before children
+        uint32_t worldRevision = 0;
     };
 }
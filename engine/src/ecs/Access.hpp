@@ -19,6 +19,7 @@
 
 #include <tuple>
 #include <type_traits>
+#include <utility>
 
 namespace nexo::ecs {
     /**
@@ -71,6 +72,40 @@ namespace nexo::ecs {
         static constexpr AccessType accessType = AccessType::Write;
     };
 
+    /**
+     * @brief Marks a component type that must not be present on matching entities
+     *
+     * @tparam T The excluded component type
+     */
+    template <typename T>
+    struct Exclude {
+        using type = T;
+    };
+
+    // Check if type is an Exclude specialization
+    template <typename T>
+    struct is_exclude : std::false_type {};
+
+    template <typename T>
+    struct is_exclude<Exclude<T>> : std::true_type {};
+
+    template <typename T>
+    inline constexpr bool is_exclude_v = is_exclude<T>::value;
+
+    // Extract the actual type from Exclude<T>
+    template <typename T>
+    struct extract_type {
+        using type = T;
+    };
+
+    template <typename T>
+    struct extract_type<Exclude<T>> {
+        using type = T;
+    };
+
+    template <typename T>
+    using extract_type_t = typename extract_type<T>::type;
+
     /**
      * @brief Type wrapper for owned components in a group system
      *
@@ -84,11 +119,16 @@ namespace nexo::ecs {
     /**
      * @brief Type wrapper for non-owned components in a group system
      *
-     * @tparam Components Component access types (Read<T> or Write<T>)
+     * Exclude<T> entries are not accessible, they filter out the entities owning T from the group.
+     *
+     * @tparam Components Component access types (Read<T> or Write<T>) or Exclude<T>
      */
     template<typename... Components>
     struct NonOwned {
-        using ComponentTypes = std::tuple<Components...>;
+        using ComponentTypes = decltype(std::tuple_cat(std::declval<
+            std::conditional_t<is_exclude_v<Components>, std::tuple<>, std::tuple<Components>>>()...));
+        using ExcludedTypes = decltype(std::tuple_cat(std::declval<
+            std::conditional_t<is_exclude_v<Components>, std::tuple<extract_type_t<Components>>, std::tuple<>>>()...));
     };
 
     /**
@@ -0,0 +1,118 @@
+//// CachedQuery.hpp ///////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the cached query, an incrementally maintained
+//               entity set with added/removed deltas
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <span>
+
+#include "Definitions.hpp"
+#include "System.hpp"
+
+namespace nexo::ecs {
+
+    /**
+     * @class CachedQuery
+     *
+     * @brief Persistent query whose matching entity set is kept up to date from signature changes.
+     *
+     * Unlike Coordinator::getAllEntitiesWith, which scans every living entity on each call, a cached
+     * query is registered once and then updated by the SystemManager every time an entity signature
+     * changes. On top of the current matching set, it records which entities started or stopped
+     * matching since the last call to clearChanges(), so consumers can update in O(changes).
+     *
+     * An entity that stops matching and matches again before the changes are read shows up in both
+     * removed() and added(). Consumers should therefore process removed() before added().
+     *
+     * @note Only signature changes are observed, modifying a component's value is not a change.
+     */
+    class CachedQuery {
+        public:
+            CachedQuery(Signature required, Signature excluded)
+                : m_required(required), m_excluded(excluded) {}
+
+            /**
+             * @brief Checks if a signature matches the query
+             *
+             * @param signature The entity signature to test
+             * @return true if the signature has all required components and none of the excluded ones
+             */
+            [[nodiscard]] bool matches(const Signature signature) const
+            {
+                return (signature & m_required) == m_required && (signature & m_excluded).none();
+            }
+
+            /**
+             * @brief Gets all the entities currently matching the query
+             */
+            [[nodiscard]] const SparseSet &entities() const { return m_entities; }
+
+            /**
+             * @brief Gets the entities that started matching since the last clearChanges()
+             */
+            [[nodiscard]] std::span<const Entity> added() const { return m_added.getDense(); }
+
+            /**
+             * @brief Gets the entities that stopped matching since the last clearChanges()
+             */
+            [[nodiscard]] std::span<const Entity> removed() const { return m_removed.getDense(); }
+
+            /**
+             * @brief Checks if the matching set changed since the last clearChanges()
+             */
+            [[nodiscard]] bool hasChanges() const { return !m_added.empty() || !m_removed.empty(); }
+
+            /**
+             * @brief Marks the current deltas as read
+             */
+            void clearChanges();
+
+            [[nodiscard]] const Signature &getRequiredSignature() const { return m_required; }
+            [[nodiscard]] const Signature &getExcludedSignature() const { return m_excluded; }
+
+            /**
+             * @brief Updates the query after an entity signature changed
+             *
+             * @param entity The entity whose signature changed
+             * @param oldSignature The signature before the change
+             * @param newSignature The signature after the change
+             */
+            void entitySignatureChanged(Entity entity, Signature oldSignature, Signature newSignature);
+
+            /**
+             * @brief Updates the query after an entity has been destroyed
+             *
+             * @param entity The destroyed entity
+             * @param signature The signature of the entity before its destruction
+             */
+            void entityDestroyed(Entity entity, Signature signature);
+
+        private:
+            void onMatch(Entity entity);
+            void onUnmatch(Entity entity);
+
+            Signature m_required;
+            Signature m_excluded;
+
+            SparseSet m_entities;
+            SparseSet m_added;
+            SparseSet m_removed;
+    };
+
+}
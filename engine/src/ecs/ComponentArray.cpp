@@ -18,17 +18,88 @@
 
 #include "ComponentArray.hpp"
 
+#include <bit>
+#include <limits>
+#include <utility>
+
 namespace nexo::ecs {
 
-    TypeErasedComponentArray::TypeErasedComponentArray(const size_t componentSize, const size_t initialCapacity): m_componentSize(componentSize), m_capacity(initialCapacity)
+    namespace {
+        constexpr size_t NO_COLUMN = std::numeric_limits<size_t>::max();
+        // Columns start on a cache line so they can be streamed with aligned vector loads
+        constexpr size_t COLUMN_ALIGNMENT = 64;
+
+        constexpr size_t alignUp(const size_t value, const size_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        /**
+         * @brief Resolves the alignment of a component, 0 meaning the natural alignment of its size
+         */
+        size_t resolveAlignment(const size_t componentSize, const size_t alignment)
+        {
+            if (alignment != 0)
+                return alignment;
+            return std::min(size_t{1} << std::countr_zero(componentSize), alignof(std::max_align_t));
+        }
+
+        bool isStoredField(const Field& field)
+        {
+            return field.size > 0 && field.type != FieldType::Blank && field.type != FieldType::Section;
+        }
+    }
+
+    TypeErasedComponentArray::TypeErasedComponentArray(const size_t componentSize, const size_t initialCapacity, const size_t alignment)
+        : m_componentData(nullptr, AlignedDeleter{}),
+          m_layout(ComponentLayout::ArrayOfStructs),
+          m_componentSize(componentSize), m_capacity(initialCapacity)
     {
         if (componentSize == 0) {
             throw std::invalid_argument("Component size cannot be zero");
         }
+        m_alignment = resolveAlignment(componentSize, alignment);
+        if (!std::has_single_bit(m_alignment)) {
+            throw std::invalid_argument("Component alignment must be a power of two");
+        }
 
+        m_componentData.get_deleter().alignment = std::align_val_t{std::max(m_alignment, COLUMN_ALIGNMENT)};
+        m_columns.push_back({0, m_componentSize, alignUp(m_componentSize, m_alignment), 0});
         m_sparse.resize(m_capacity, INVALID_ENTITY);
         m_dense.reserve(m_capacity);
-        m_componentData.reserve(m_capacity * m_componentSize);
+        reallocate(m_capacity);
+    }
+
+    TypeErasedComponentArray::TypeErasedComponentArray(const size_t componentSize, const std::span<const Field> fields,
+                                                       const size_t initialCapacity, const size_t alignment)
+        : m_componentData(nullptr, AlignedDeleter{}),
+          m_layout(ComponentLayout::StructOfArrays),
+          m_componentSize(componentSize), m_capacity(initialCapacity)
+    {
+        if (componentSize == 0) {
+            throw std::invalid_argument("Component size cannot be zero");
+        }
+        m_alignment = resolveAlignment(componentSize, alignment);
+        if (!std::has_single_bit(m_alignment)) {
+            throw std::invalid_argument("Component alignment must be a power of two");
+        }
+
+        m_componentData.get_deleter().alignment = std::align_val_t{std::max(m_alignment, COLUMN_ALIGNMENT)};
+        m_fields.assign(fields.begin(), fields.end());
+        m_fieldColumns.resize(fields.size(), NO_COLUMN);
+        for (size_t i = 0; i < fields.size(); ++i) {
+            const Field& field = fields[i];
+            if (!isStoredField(field))
+                continue;
+            if (field.offset + field.size > componentSize)
+                throw std::invalid_argument("Field " + field.name + " does not fit in the component");
+            m_fieldColumns[i] = m_columns.size();
+            m_columns.push_back({field.offset, field.size, field.size, 0});
+        }
+
+        m_sparse.resize(m_capacity, INVALID_ENTITY);
+        m_dense.reserve(m_capacity);
+        reallocate(m_capacity);
     }
 
     void TypeErasedComponentArray::insert(const Entity entity, const void* componentData)
@@ -36,7 +107,23 @@ namespace nexo::ecs {
         insertRaw(entity, componentData);
     }
 
-    void TypeErasedComponentArray::insertRaw(Entity entity, const void* componentData)
+    void TypeErasedComponentArray::insertRaw(const Entity entity, const void* componentData)
+    {
+        if (insertComponent(entity, componentData))
+            ++m_size;
+    }
+
+    void TypeErasedComponentArray::insertRawBatch(const std::span<const Entity> entities, const void* componentsData)
+    {
+        reserve(m_size + entities.size());
+        const auto *data = static_cast<const std::byte *>(componentsData);
+        for (size_t i = 0; i < entities.size(); ++i) {
+            if (insertComponent(entities[i], data + i * m_componentSize))
+                ++m_size;
+        }
+    }
+
+    bool TypeErasedComponentArray::insertComponent(const Entity entity, const void* componentData)
     {
         if (entity >= MAX_ENTITIES)
             THROW_EXCEPTION(OutOfRange, entity);
@@ -45,27 +132,33 @@ namespace nexo::ecs {
 
         if (hasComponent(entity)) {
             LOG(NEXO_WARN, "Entity {} already has component", entity);
-            return;
+            return false;
         }
 
         const size_t newIndex = m_size;
-        m_sparse[entity]      = newIndex;
-        m_dense.push_back(entity);
+        if (newIndex >= m_dataCapacity)
+            reserve(std::max(m_dataCapacity * 2, newIndex + 1));
 
-        // Resize component data vector if needed
-        const size_t requiredSize = (m_size + 1) * m_componentSize;
-        if (m_componentData.size() < requiredSize) {
-            m_componentData.resize(requiredSize);
-        }
+        m_sparse[entity] = newIndex;
+        m_dense.push_back(entity);
+        storeComponent(newIndex, componentData);
+        return true;
+    }
 
-        // Copy component data
-        std::memcpy(m_componentData.data() + newIndex * m_componentSize,
-                    componentData, m_componentSize);
+    void TypeErasedComponentArray::remove(const Entity entity)
+    {
+        removeComponent(entity);
+        shrinkIfNeeded();
+    }
 
-        ++m_size;
+    void TypeErasedComponentArray::removeBatch(const std::span<const Entity> entities)
+    {
+        for (const Entity entity : entities)
+            removeComponent(entity);
+        shrinkIfNeeded();
     }
 
-    void TypeErasedComponentArray::remove(const Entity entity)
+    void TypeErasedComponentArray::removeComponent(const Entity entity)
     {
         if (!hasComponent(entity))
             THROW_EXCEPTION(ComponentNotFound, entity);
@@ -96,8 +189,6 @@ namespace nexo::ecs {
         m_sparse[entity] = INVALID_ENTITY;
         m_dense.pop_back();
         --m_size;
-
-        shrinkIfNeeded();
     }
 
     bool TypeErasedComponentArray::hasComponent(const Entity entity) const
@@ -116,8 +207,10 @@ namespace nexo::ecs {
         if (!hasComponent(sourceEntity))
             THROW_EXCEPTION(ComponentNotFound, sourceEntity);
 
-        const void* sourceData = getRawComponent(sourceEntity);
-        insert(destEntity, sourceData);
+        // The source may move if the storage grows, and may not be contiguous, copy it first
+        std::vector<std::byte> component(m_componentSize);
+        readComponent(sourceEntity, component.data());
+        insert(destEntity, component.data());
     }
 
     size_t TypeErasedComponentArray::getComponentSize() const
@@ -132,26 +225,30 @@ namespace nexo::ecs {
 
     void* TypeErasedComponentArray::getRawComponent(const Entity entity)
     {
-        if (!hasComponent(entity))
+        if (!hasComponent(entity) || m_layout != ComponentLayout::ArrayOfStructs)
             return nullptr;
-        return m_componentData.data() + m_sparse[entity] * m_componentSize;
+        return columnData(m_columns.front(), m_sparse[entity]);
     }
 
     const void* TypeErasedComponentArray::getRawComponent(const Entity entity) const
     {
-        if (!hasComponent(entity))
+        if (!hasComponent(entity) || m_layout != ComponentLayout::ArrayOfStructs)
             return nullptr;
-        return m_componentData.data() + m_sparse[entity] * m_componentSize;
+        return columnData(m_columns.front(), m_sparse[entity]);
     }
 
     void* TypeErasedComponentArray::getRawData()
     {
-        return m_componentData.data();
+        if (m_layout != ComponentLayout::ArrayOfStructs)
+            return nullptr;
+        return m_componentData.get();
     }
 
     const void* TypeErasedComponentArray::getRawData() const
     {
-        return m_componentData.data();
+        if (m_layout != ComponentLayout::ArrayOfStructs)
+            return nullptr;
+        return m_componentData.get();
     }
 
     std::span<const Entity> TypeErasedComponentArray::entities() const
@@ -159,6 +256,98 @@ namespace nexo::ecs {
         return {m_dense.data(), m_size};
     }
 
+    std::shared_ptr<IComponentArray> TypeErasedComponentArray::createEmpty() const
+    {
+        if (m_layout == ComponentLayout::StructOfArrays)
+            return std::make_shared<TypeErasedComponentArray>(m_componentSize, m_fields, m_capacity, m_alignment);
+        return std::make_shared<TypeErasedComponentArray>(m_componentSize, m_capacity, m_alignment);
+    }
+
+    void TypeErasedComponentArray::moveAllTo(IComponentArray &destination, const std::span<const Entity> entityMapping)
+    {
+        auto *target = dynamic_cast<TypeErasedComponentArray *>(&destination);
+        if (!target || target->m_componentSize != m_componentSize)
+            THROW_EXCEPTION(InternalError, "Cannot move type-erased components into an array of another size");
+
+        target->reserve(target->m_size + m_size);
+        std::vector<std::byte> component(m_componentSize);
+        for (size_t i = 0; i < m_size; ++i) {
+            loadComponent(i, component.data());
+            target->insertRaw(entityMapping[m_dense[i]], component.data());
+        }
+    }
+
+    std::span<std::byte> TypeErasedComponentArray::getRawRange(const size_t first, const size_t count)
+    {
+        const auto range = std::as_const(*this).getRawRange(first, count);
+        return {const_cast<std::byte *>(range.data()), range.size()};
+    }
+
+    std::span<const std::byte> TypeErasedComponentArray::getRawRange(const size_t first, const size_t count) const
+    {
+        if (m_layout != ComponentLayout::ArrayOfStructs)
+            THROW_EXCEPTION(InternalError, "Raw ranges are not available for components stored as a struct of arrays");
+        if (first > m_size || count > m_size - first)
+            THROW_EXCEPTION(OutOfRange, first + count);
+        const Column& column = m_columns.front();
+        return {columnData(column, first), count * column.stride};
+    }
+
+    std::span<std::byte> TypeErasedComponentArray::getFieldData(const size_t fieldIndex)
+    {
+        const auto field = std::as_const(*this).getFieldData(fieldIndex);
+        return {const_cast<std::byte *>(field.data()), field.size()};
+    }
+
+    std::span<const std::byte> TypeErasedComponentArray::getFieldData(const size_t fieldIndex) const
+    {
+        if (m_layout != ComponentLayout::StructOfArrays)
+            THROW_EXCEPTION(InternalError, "Field columns are only available for components stored as a struct of arrays");
+        if (fieldIndex >= m_fieldColumns.size())
+            THROW_EXCEPTION(OutOfRange, fieldIndex);
+        if (m_fieldColumns[fieldIndex] == NO_COLUMN)
+            return {};
+        const Column& column = m_columns[m_fieldColumns[fieldIndex]];
+        return {columnData(column, 0), m_size * column.stride};
+    }
+
+    void TypeErasedComponentArray::readComponent(const Entity entity, void* dst) const
+    {
+        if (!hasComponent(entity))
+            THROW_EXCEPTION(ComponentNotFound, entity);
+        loadComponent(m_sparse[entity], dst);
+    }
+
+    void TypeErasedComponentArray::writeComponent(const Entity entity, const void* src)
+    {
+        if (!hasComponent(entity))
+            THROW_EXCEPTION(ComponentNotFound, entity);
+        storeComponent(m_sparse[entity], src);
+    }
+
+    size_t TypeErasedComponentArray::getStride() const
+    {
+        return m_layout == ComponentLayout::ArrayOfStructs ? m_columns.front().stride : m_componentSize;
+    }
+
+    size_t TypeErasedComponentArray::getAlignment() const
+    {
+        return m_alignment;
+    }
+
+    ComponentLayout TypeErasedComponentArray::getLayout() const
+    {
+        return m_layout;
+    }
+
+    void TypeErasedComponentArray::reserve(const size_t capacity)
+    {
+        if (capacity <= m_dataCapacity)
+            return;
+        m_dense.reserve(capacity);
+        reallocate(capacity);
+    }
+
     Entity TypeErasedComponentArray::getEntityAtIndex(const size_t index) const
     {
         if (index >= m_size)
@@ -209,7 +398,10 @@ namespace nexo::ecs {
 
     size_t TypeErasedComponentArray::memoryUsage() const
     {
-        return m_componentData.capacity()
+        size_t dataSize = 0;
+        for (const Column& column : m_columns)
+            dataSize = alignUp(dataSize, std::max(m_alignment, COLUMN_ALIGNMENT)) + column.stride * m_dataCapacity;
+        return dataSize
                + sizeof(size_t) * m_sparse.capacity()
                + sizeof(Entity) * m_dense.capacity();
     }
@@ -226,32 +418,68 @@ namespace nexo::ecs {
         }
     }
 
+    void TypeErasedComponentArray::reallocate(const size_t capacity)
+    {
+        // Every column starts on an aligned boundary, so each column (and each component in
+        // array of structs layout) can be handed out as an aligned block
+        const auto bufferAlignment = m_componentData.get_deleter().alignment;
+        std::vector<size_t> offsets(m_columns.size());
+        size_t totalSize = 0;
+        for (size_t i = 0; i < m_columns.size(); ++i) {
+            offsets[i] = alignUp(totalSize, static_cast<size_t>(bufferAlignment));
+            totalSize = offsets[i] + m_columns[i].stride * capacity;
+        }
+
+        std::unique_ptr<std::byte[], AlignedDeleter> newData(
+            totalSize ? static_cast<std::byte *>(::operator new[](totalSize, bufferAlignment)) : nullptr,
+            m_componentData.get_deleter());
+        for (size_t i = 0; i < m_columns.size(); ++i) {
+            Column& column = m_columns[i];
+            if (m_size)
+                std::memcpy(newData.get() + offsets[i], columnData(column, 0), m_size * column.stride);
+            column.bufferOffset = offsets[i];
+        }
+        m_componentData = std::move(newData);
+        m_dataCapacity = capacity;
+    }
+
+    std::byte* TypeErasedComponentArray::columnData(const Column& column, const size_t index) const
+    {
+        return m_componentData.get() + column.bufferOffset + index * column.stride;
+    }
+
+    void TypeErasedComponentArray::storeComponent(const size_t index, const void* componentData)
+    {
+        const auto *component = static_cast<const std::byte *>(componentData);
+        for (const Column& column : m_columns)
+            std::memcpy(columnData(column, index), component + column.componentOffset, column.size);
+    }
+
+    void TypeErasedComponentArray::loadComponent(const size_t index, void* componentData) const
+    {
+        auto *component = static_cast<std::byte *>(componentData);
+        for (const Column& column : m_columns)
+            std::memcpy(component + column.componentOffset, columnData(column, index), column.size);
+    }
+
     void TypeErasedComponentArray::swapComponents(const size_t index1, const size_t index2)
     {
         if (index1 == index2) return;
 
-        std::byte* data1 = m_componentData.data() + index1 * m_componentSize;
-        std::byte* data2 = m_componentData.data() + index2 * m_componentSize;
-
-        // Use a temporary buffer for swapping
-        std::vector<std::byte> temp(m_componentSize);
-        std::memcpy(temp.data(), data1, m_componentSize);
-        std::memcpy(data1, data2, m_componentSize);
-        std::memcpy(data2, temp.data(), m_componentSize);
+        for (const Column& column : m_columns) {
+            std::byte* data1 = columnData(column, index1);
+            std::swap_ranges(data1, data1 + column.size, columnData(column, index2));
+        }
     }
 
     void TypeErasedComponentArray::shrinkIfNeeded()
     {
-        if (m_size < m_componentData.capacity() / 4 && m_componentData.capacity() > m_capacity * m_componentSize * 2) {
-            size_t newCapacity = std::max(m_size * 2, m_capacity) * m_componentSize;
-            if (newCapacity < m_capacity * m_componentSize)
-                newCapacity = m_capacity * m_componentSize;
+        if (m_size < m_dataCapacity / 4 && m_dataCapacity > m_capacity * 2) {
+            const size_t newCapacity = std::max(m_size * 2, m_capacity);
 
-            m_componentData.shrink_to_fit();
+            reallocate(newCapacity);
             m_dense.shrink_to_fit();
-
-            m_componentData.reserve(newCapacity);
-            m_dense.reserve(newCapacity / m_componentSize);
+            m_dense.reserve(newCapacity);
         }
     }
 
@@ -21,7 +21,11 @@
 #include "ECSExceptions.hpp"
 #include "Exception.hpp"
 #include "Logger.hpp"
+#include "TypeErasedComponent/Field.hpp"
 
+#include <cstddef>
+#include <memory>
+#include <string>
 #include <vector>
 #include <span>
 #include <algorithm>
@@ -120,6 +124,54 @@ namespace nexo::ecs {
          */
         virtual void remove(Entity entity) = 0;
 
+        /**
+         * @brief Inserts raw components for several entities at once.
+         *
+         * The default implementation inserts the components one by one, arrays able to
+         * reserve their storage upfront should override it.
+         *
+         * @param entities The entities to add the component to
+         * @param componentsData Pointer to entities.size() components laid out contiguously,
+         *                       each getComponentSize() bytes long
+         */
+        virtual void insertRawBatch(const std::span<const Entity> entities, const void *componentsData)
+        {
+            const auto *data = static_cast<const std::byte *>(componentsData);
+            const size_t componentSize = getComponentSize();
+            for (size_t i = 0; i < entities.size(); ++i)
+                insertRaw(entities[i], data + i * componentSize);
+        }
+
+        /**
+         * @brief Removes the components of several entities at once.
+         *
+         * @param entities The entities to remove the component from
+         * @throws ComponentNotFound if one of the entities doesn't have the component
+         */
+        virtual void removeBatch(const std::span<const Entity> entities)
+        {
+            for (const Entity entity : entities)
+                remove(entity);
+        }
+
+        /**
+         * @brief Creates an empty array storing the same component type, with the same layout
+         * @return The new component array
+         */
+        [[nodiscard]] virtual std::shared_ptr<IComponentArray> createEmpty() const = 0;
+
+        /**
+         * @brief Moves every component of this array into another array of the same component type
+         *
+         * Used to merge worlds, components are moved in dense order and keyed in the destination
+         * by their remapped entity. This array keeps its entities, with moved-from components.
+         *
+         * @param destination Array of the same component type, typically created by createEmpty()
+         * @param entityMapping Maps an entity of this array to the entity of the destination array
+         * @throws InternalError if the destination stores another component type
+         */
+        virtual void moveAllTo(IComponentArray &destination, std::span<const Entity> entityMapping) = 0;
+
         /**
          * @brief Gets a span of all entities with this component
          * @return Span of entity IDs
@@ -173,6 +225,23 @@ namespace nexo::ecs {
             return sizeof(T);
         }
 
+        [[nodiscard]] std::shared_ptr<IComponentArray> createEmpty() const override
+        {
+            return std::make_shared<ComponentArray>();
+        }
+
+        void moveAllTo(IComponentArray &destination, const std::span<const Entity> entityMapping) override
+        {
+            auto *target = dynamic_cast<ComponentArray *>(&destination);
+            if (!target)
+                THROW_EXCEPTION(InternalError, std::string("Cannot move components into an array of another type than ") + typeid(T).name());
+
+            target->m_dense.reserve(target->m_size + m_size);
+            target->m_componentArray.reserve(target->m_size + m_size);
+            for (size_t i = 0; i < m_size; ++i)
+                target->insert(entityMapping[m_dense[i]], std::move(m_componentArray[i]));
+        }
+
         [[nodiscard]] void* getRawComponent(Entity entity) override
         {
             if (!hasComponent(entity))
@@ -222,7 +291,7 @@ namespace nexo::ecs {
             const size_t newIndex = m_size;
             m_sparse[entity] = newIndex;
             m_dense.push_back(entity);
-            m_componentArray.push_back(component);
+            m_componentArray.push_back(std::move(component));
 
             ++m_size;
         }
@@ -253,15 +322,15 @@ namespace nexo::ecs {
             m_sparse[entity] = newIndex;
             m_dense.push_back(entity);
 
-            // allocate new component in the array
-            m_componentArray.emplace_back();
-            // copy the raw data into the new component, if it is trivially copyable, use memcpy, otherwise use placement new
+            // copy the raw data into the new component, if it is trivially copyable, use memcpy,
+            // otherwise the data must point to a live T and is copy-constructed
             if constexpr (std::is_trivially_copyable_v<T>) {
+                m_componentArray.emplace_back();
                 std::memcpy(&m_componentArray[newIndex], componentData, sizeof(T));
-                ++m_size;
             } else {
-                THROW_EXCEPTION(InternalError, "Component type is not trivially copyable, raw insertion is not supported");
+                m_componentArray.push_back(*static_cast<const T *>(componentData));
             }
+            ++m_size;
         }
 
         /**
@@ -442,20 +511,8 @@ namespace nexo::ecs {
          */
         void addToGroup(const Entity entity)
         {
-            if (!hasComponent(entity))
-                THROW_EXCEPTION(ComponentNotFound, entity);
-
-            size_t index = m_sparse[entity];
-            if (index < m_groupSize)
-                return;
-            // Swap with the element at the group boundary.
-            if (index != m_groupSize) {
-                std::swap(m_componentArray[index], m_componentArray[m_groupSize]);
-                std::swap(m_dense[index], m_dense[m_groupSize]);
-                m_sparse[m_dense[index]] = index;
-                m_sparse[m_dense[m_groupSize]] = m_groupSize;
-            }
-            ++m_groupSize;
+            if (swapIntoGroup(entity, m_groupSize))
+                ++m_groupSize;
         }
 
         /**
@@ -470,20 +527,55 @@ namespace nexo::ecs {
          * @pre The entity must have the component
          */
         void removeFromGroup(const Entity entity)
+        {
+            if (swapOutOfGroup(entity, m_groupSize))
+                --m_groupSize;
+        }
+
+        /**
+         * @brief Swaps the component for the given entity to the boundary of a group region.
+         *
+         * Owning groups track the size of their region themselves, which lets nested groups
+         * share the same array: the region of a more restrictive group is a prefix of the
+         * region of the groups containing it. Growing the region is left to the caller.
+         *
+         * @param entity The entity to move into the region
+         * @param groupSize The current size of the region
+         * @return true if the entity has been moved at index groupSize, false if it already was in the region
+         * @throws ComponentNotFoundException if the entity doesn't have the component
+         */
+        bool swapIntoGroup(const Entity entity, const size_t groupSize)
         {
             if (!hasComponent(entity))
                 THROW_EXCEPTION(ComponentNotFound, entity);
 
-            size_t index = m_sparse[entity];
-            if (index >= m_groupSize)
-                return;
-            --m_groupSize;
-            if (index != m_groupSize) {
-                std::swap(m_componentArray[index], m_componentArray[m_groupSize]);
-                std::swap(m_dense[index], m_dense[m_groupSize]);
-                m_sparse[m_dense[index]] = index;
-                m_sparse[m_dense[m_groupSize]] = m_groupSize;
-            }
+            const size_t index = m_sparse[entity];
+            if (index < groupSize)
+                return false;
+            swapAt(index, groupSize);
+            return true;
+        }
+
+        /**
+         * @brief Swaps the component for the given entity to the last slot of a group region.
+         *
+         * Counterpart of swapIntoGroup(), shrinking the region is left to the caller.
+         *
+         * @param entity The entity to move out of the region
+         * @param groupSize The current size of the region
+         * @return true if the entity has been moved at index groupSize - 1, false if it was not in the region
+         * @throws ComponentNotFoundException if the entity doesn't have the component
+         */
+        bool swapOutOfGroup(const Entity entity, const size_t groupSize)
+        {
+            if (!hasComponent(entity))
+                THROW_EXCEPTION(ComponentNotFound, entity);
+
+            const size_t index = m_sparse[entity];
+            if (index >= groupSize)
+                return false;
+            swapAt(index, groupSize - 1);
+            return true;
         }
 
         /**
@@ -589,6 +681,22 @@ namespace nexo::ecs {
         // The first m_groupSize entries in m_dense/m_componentArray are considered "grouped".
         size_t m_groupSize = 0;
 
+        /**
+         * @brief Swaps two slots of the dense arrays and updates the sparse mapping
+         *
+         * @param a First index
+         * @param b Second index
+         */
+        void swapAt(const size_t a, const size_t b)
+        {
+            if (a == b)
+                return;
+            std::swap(m_componentArray[a], m_componentArray[b]);
+            std::swap(m_dense[a], m_dense[b]);
+            m_sparse[m_dense[a]] = a;
+            m_sparse[m_dense[b]] = b;
+        }
+
         /**
          * @brief Ensures m_sparse is large enough to index 'entity'
          *
@@ -638,22 +746,57 @@ namespace nexo::ecs {
     #pragma warning(disable: 4324) // disable msvc warning for added padding bytes because of alignas(64)
 #endif
 
-        /**
+    /**
+     * @brief Memory layout of a TypeErasedComponentArray
+     */
+    enum class ComponentLayout : uint8_t {
+        ArrayOfStructs, ///< Components are stored one after the other
+        StructOfArrays  ///< Each field of the component is stored in its own contiguous column
+    };
+
+    /**
      * @class TypeErasedComponentArray
      * @brief A type-erased component array that can store components of any size.
      *
      * This class allows you to create component arrays at runtime without knowing
      * the component type at compile time. You only need to specify the size of
-     * each component.
+     * each component, and optionally its alignment.
+     *
+     * Components can either be stored as an array of structs (the default), where each
+     * component starts on an aligned boundary, or as a struct of arrays built from the
+     * component's field descriptions. In the latter case every field lives in its own
+     * cache-line aligned column, so scripted systems can process one field of all
+     * components as a single contiguous block.
      */
     class alignas(64) TypeErasedComponentArray final : public IComponentArray {
     public:
         /**
-         * @brief Constructs a new type-erased component array
+         * @brief Constructs a new type-erased component array stored as an array of structs
+         * @param componentSize Size of each component in bytes
+         * @param initialCapacity Initial capacity for the array
+         * @param alignment Alignment of each component, must be a power of two. 0 uses the
+         *                  largest power of two dividing the size, up to alignof(std::max_align_t)
+         * @throws std::invalid_argument if the size is zero or the alignment is not a power of two
+         */
+        explicit TypeErasedComponentArray(size_t componentSize, size_t initialCapacity = 1024, size_t alignment = 0);
+
+        /**
+         * @brief Constructs a new type-erased component array stored as a struct of arrays
+         *
+         * One column is created per field with a non-zero size, fields used only for the UI
+         * (blank or section fields) are ignored. Bytes of the component not covered by any
+         * field are not stored.
+         *
          * @param componentSize Size of each component in bytes
+         * @param fields The field descriptions of the component
          * @param initialCapacity Initial capacity for the array
+         * @param alignment Alignment of the component, must be a power of two. 0 uses the
+         *                  largest power of two dividing the size, up to alignof(std::max_align_t)
+         * @throws std::invalid_argument if the size is zero, the alignment is not a power of two
+         *         or a field does not fit in the component
          */
-        explicit TypeErasedComponentArray(size_t componentSize, size_t initialCapacity = 1024);
+        TypeErasedComponentArray(size_t componentSize, std::span<const Field> fields,
+                                 size_t initialCapacity = 1024, size_t alignment = 0);
 
         /**
          * @brief Inserts a new component for the given entity
@@ -674,12 +817,27 @@ namespace nexo::ecs {
          */
         void insertRaw(Entity entity, const void* componentData) override;
 
+        /**
+         * @brief Inserts components for several entities, growing the storage only once
+         * @param entities The entities to add the component to
+         * @param componentsData Pointer to entities.size() components of getComponentSize() bytes each
+         * @throws OutOfRange if one of the entity IDs exceeds MAX_ENTITIES
+         */
+        void insertRawBatch(std::span<const Entity> entities, const void* componentsData) override;
+
         /**
          * @brief Removes the component for the given entity
          * @param entity The entity to remove the component from
          */
         void remove(Entity entity) override;
 
+        /**
+         * @brief Removes the components of several entities, shrinking the storage only once
+         * @param entities The entities to remove the component from
+         * @throws ComponentNotFound if one of the entities doesn't have the component
+         */
+        void removeBatch(std::span<const Entity> entities) override;
+
         [[nodiscard]] bool hasComponent(Entity entity) const override;
 
         void entityDestroyed(Entity entity) override;
@@ -690,16 +848,90 @@ namespace nexo::ecs {
 
         [[nodiscard]] size_t size() const override;
 
+        /**
+         * @brief Gets raw pointer to component data for an entity
+         * @param entity The entity to get the component from
+         * @return Raw pointer to component data, or nullptr if not found or if the array is
+         *         stored as a struct of arrays (use readComponent/writeComponent instead)
+         */
         [[nodiscard]] void* getRawComponent(Entity entity) override;
 
         [[nodiscard]] const void* getRawComponent(Entity entity) const override;
 
+        /**
+         * @brief Gets raw pointer to all component data
+         * @return Raw pointer to the first component, or nullptr if the array is stored
+         *         as a struct of arrays (use getFieldData instead)
+         */
         [[nodiscard]] void* getRawData() override;
 
         [[nodiscard]] const void* getRawData() const override;
 
         [[nodiscard]] std::span<const Entity> entities() const override;
 
+        [[nodiscard]] std::shared_ptr<IComponentArray> createEmpty() const override;
+
+        void moveAllTo(IComponentArray &destination, std::span<const Entity> entityMapping) override;
+
+        /**
+         * @brief Gets the raw bytes of a range of components in dense order
+         *
+         * Components are getStride() bytes apart, the entity of the i-th component is entities()[first + i].
+         *
+         * @param first Dense index of the first component
+         * @param count Number of components
+         * @return Span over count * getStride() bytes
+         * @throws OutOfRange if the range exceeds the number of components
+         * @throws InternalError if the array is stored as a struct of arrays
+         */
+        [[nodiscard]] std::span<std::byte> getRawRange(size_t first, size_t count);
+
+        [[nodiscard]] std::span<const std::byte> getRawRange(size_t first, size_t count) const;
+
+        /**
+         * @brief Gets the column of a field, in dense order
+         *
+         * @param fieldIndex Index of the field in the description the array was created with
+         * @return Span over size() * field size bytes, empty if the field is not stored
+         *         (e.g. a section field)
+         * @throws OutOfRange if the field index is out of range
+         * @throws InternalError if the array is stored as an array of structs
+         */
+        [[nodiscard]] std::span<std::byte> getFieldData(size_t fieldIndex);
+
+        [[nodiscard]] std::span<const std::byte> getFieldData(size_t fieldIndex) const;
+
+        /**
+         * @brief Copies the component of an entity into a contiguous buffer, whatever the layout
+         * @param entity The entity to read the component from
+         * @param dst Destination buffer of at least getComponentSize() bytes
+         * @throws ComponentNotFound if the entity doesn't have the component
+         */
+        void readComponent(Entity entity, void* dst) const;
+
+        /**
+         * @brief Overwrites the component of an entity from a contiguous buffer, whatever the layout
+         * @param entity The entity to write the component of
+         * @param src Source buffer of at least getComponentSize() bytes
+         * @throws ComponentNotFound if the entity doesn't have the component
+         */
+        void writeComponent(Entity entity, const void* src);
+
+        /**
+         * @brief Gets the distance in bytes between two consecutive components in array of structs layout
+         */
+        [[nodiscard]] size_t getStride() const;
+
+        [[nodiscard]] size_t getAlignment() const;
+
+        [[nodiscard]] ComponentLayout getLayout() const;
+
+        /**
+         * @brief Ensures the array can hold at least capacity components without reallocating
+         * @param capacity The number of components to reserve storage for
+         */
+        void reserve(size_t capacity);
+
         /**
          * @brief Gets the entity at the given index in the dense array
          * @param index The index to look up
@@ -732,14 +964,41 @@ namespace nexo::ecs {
         [[nodiscard]] size_t memoryUsage() const;
 
     private:
-        // Component data storage
-        std::vector<std::byte> m_componentData;
+        /**
+         * @brief A contiguous run of bytes of each component
+         *
+         * An array of structs has a single column covering the whole component, a struct of
+         * arrays has one column per stored field.
+         */
+        struct Column {
+            size_t componentOffset; ///< Offset of the bytes in the component
+            size_t size;            ///< Number of bytes copied from the component
+            size_t stride;          ///< Distance between two elements of the column
+            size_t bufferOffset;    ///< Offset of the column in the storage buffer
+        };
+
+        struct AlignedDeleter {
+            std::align_val_t alignment{alignof(std::max_align_t)};
+            void operator()(std::byte* ptr) const { ::operator delete[](ptr, alignment); }
+        };
+
+        // Component data storage, columns are laid out one after the other
+        std::unique_ptr<std::byte[], AlignedDeleter> m_componentData;
+        // Number of components the storage can hold
+        size_t m_dataCapacity = 0;
+        std::vector<Column> m_columns;
+        // Maps a field index to its column, SIZE_MAX if the field is not stored
+        std::vector<size_t> m_fieldColumns;
+        // Field descriptions the struct of arrays layout was built from
+        std::vector<Field> m_fields;
+        ComponentLayout m_layout;
         // Sparse mapping: maps entity ID to index in the dense arrays
         std::vector<size_t> m_sparse;
         // Dense storage for entity IDs
         std::vector<Entity> m_dense;
         // Size of each component in bytes
         size_t m_componentSize;
+        size_t m_alignment;
         // Initial capacity
         size_t m_capacity;
         // Current number of active components
@@ -749,6 +1008,18 @@ namespace nexo::ecs {
 
         void ensureSparseCapacity(Entity entity);
 
+        void reallocate(size_t capacity);
+
+        [[nodiscard]] std::byte* columnData(const Column& column, size_t index) const;
+
+        void storeComponent(size_t index, const void* componentData);
+
+        void loadComponent(size_t index, void* componentData) const;
+
+        bool insertComponent(Entity entity, const void* componentData);
+
+        void removeComponent(Entity entity);
+
         void swapComponents(size_t index1, size_t index2);
 
         void shrinkIfNeeded();
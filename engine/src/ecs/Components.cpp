@@ -22,8 +22,9 @@ namespace nexo::ecs {
 
     void ComponentManager::entityDestroyed(const Entity entity, const Signature &entitySignature)
     {
-        for (const auto &group: m_groupRegistry | std::views::values) {
-            if ((entitySignature & group->allSignature()) == group->allSignature())
+        // Nested groups must release the entity before the groups containing them
+        for (const auto &group: std::views::reverse(m_groups)) {
+            if (group->matches(entitySignature))
                 group->removeFromGroup(entity);
         }
         for (const auto& componentArray : m_componentArrays) {
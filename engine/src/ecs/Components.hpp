@@ -30,6 +30,8 @@
 #include <set>
 #include <sstream>
 #include <ranges>
+#include <algorithm>
+#include <tuple>
 
 #include "ECSExceptions.hpp"
 #include "Definitions.hpp"
@@ -65,6 +67,28 @@ namespace nexo::ecs {
 		return {};
 	}
 
+	/**
+	 * @brief Helper template to tag excluded component types
+	 *
+	 * Entities owning any of these components are filtered out of the group.
+	 *
+	 * @tparam Excluded The excluded component types
+	 */
+	template<typename... Excluded>
+	struct exclude_t { };
+
+	/**
+	 * @brief Creates a type tag for specifying excluded components
+	 *
+	 * @tparam Excluded The excluded component types
+	 * @return A tag object of exclude_t<Excluded...>
+	 */
+	template<typename... Excluded>
+	exclude_t<Excluded...> exclude()
+	{
+		return {};
+	}
+
 	/**
 	 * @brief Type alias for a tuple of owned component arrays
 	 *
@@ -105,13 +129,34 @@ namespace nexo::ecs {
 	struct GroupKey {
 		Signature ownedSignature;     ///< Bits set for components owned by the group
 		Signature nonOwnedSignature;  ///< Bits set for components used but not owned by the group
+		Signature excludedSignature;  ///< Bits set for components that entities of the group must not have
 
 		/**
 		 * @brief Equality comparison operator
 		 */
 		bool operator==(const GroupKey& other) const {
 			return ownedSignature == other.ownedSignature &&
-				   nonOwnedSignature == other.nonOwnedSignature;
+				   nonOwnedSignature == other.nonOwnedSignature &&
+				   excludedSignature == other.excludedSignature;
+		}
+
+		/**
+		 * @brief Checks if a group with this key is nested in a group with another key
+		 *
+		 * A nested group owns, requires and excludes at least every component of the outer group,
+		 * so its entities are a subset of the outer group's and its region can live in a prefix
+		 * of the outer group's region in the shared component arrays.
+		 *
+		 * @param outer Key of the potentially containing group
+		 * @return true if this key is strictly more restrictive than outer
+		 */
+		[[nodiscard]] bool isNestedIn(const GroupKey& outer) const {
+			const Signature allSignature = ownedSignature | nonOwnedSignature;
+			const Signature outerAllSignature = outer.ownedSignature | outer.nonOwnedSignature;
+			return !(*this == outer) &&
+				   (ownedSignature & outer.ownedSignature) == outer.ownedSignature &&
+				   (allSignature & outerAllSignature) == outerAllSignature &&
+				   (excludedSignature & outer.excludedSignature) == outer.excludedSignature;
 		}
 
 		/**
@@ -148,6 +193,19 @@ namespace nexo::ecs {
 				}
 			}
 
+			ss << "}, Excluded: {";
+			first = true;
+
+			// Add excluded component IDs
+			for (ComponentType i = 0; i < MAX_COMPONENT_TYPE; ++i) {
+				if (excludedSignature.test(i)) {
+					if (!first)
+						ss << ", ";
+					ss << "Component#" << i;
+					first = false;
+				}
+			}
+
 			ss << "}";
 			return ss.str();
 		}
@@ -167,7 +225,8 @@ namespace std {
 		{
 			const size_t h1 = std::hash<nexo::ecs::Signature>()(key.ownedSignature);
 			const size_t h2 = std::hash<nexo::ecs::Signature>()(key.nonOwnedSignature);
-			return h1 ^ (h2 << 1);
+			const size_t h3 = std::hash<nexo::ecs::Signature>()(key.excludedSignature);
+			return h1 ^ (h2 << 1) ^ (h3 << 2);
 		}
 	};
 }
@@ -240,13 +299,33 @@ namespace nexo::ecs {
 		        m_componentArrays[typeID] = std::make_shared<ComponentArray<T>>();
 		    }
 
-	        ComponentType registerComponent(const size_t componentSize, const size_t initialCapacity = 1024)
+	        ComponentType registerComponent(const size_t componentSize, const size_t initialCapacity = 1024, const size_t alignment = 0)
+		    {
+		        const ComponentType typeID = generateComponentTypeID();
+		        assert(typeID < m_componentArrays.size() && "Component type ID exceeds component array size");
+
+		        assert(m_componentArrays[typeID] == nullptr && "TypeErasedComponent already registered, should really not happen");
+		        m_componentArrays[typeID] = std::make_shared<TypeErasedComponentArray>(componentSize, initialCapacity, alignment);
+		        return typeID;
+		    }
+
+		    /**
+		     * @brief Registers a type-erased component stored as a struct of arrays
+		     *
+		     * @param componentSize Size of the component in bytes
+		     * @param fields Field descriptions of the component, one column is created per stored field
+		     * @param initialCapacity Initial capacity of the component array
+		     * @param alignment Alignment of the component, 0 for the natural alignment of its size
+		     * @return The new component type ID
+		     */
+	        ComponentType registerComponent(const size_t componentSize, const std::span<const Field> fields,
+	                                        const size_t initialCapacity = 1024, const size_t alignment = 0)
 		    {
 		        const ComponentType typeID = generateComponentTypeID();
 		        assert(typeID < m_componentArrays.size() && "Component type ID exceeds component array size");
 
 		        assert(m_componentArrays[typeID] == nullptr && "TypeErasedComponent already registered, should really not happen");
-		        m_componentArrays[typeID] = std::make_shared<TypeErasedComponentArray>(componentSize, initialCapacity);
+		        m_componentArrays[typeID] = std::make_shared<TypeErasedComponentArray>(componentSize, fields, initialCapacity, alignment);
 		        return typeID;
 		    }
 
@@ -272,7 +351,7 @@ namespace nexo::ecs {
 		     * @brief Adds a component to an entity
 		     *
 		     * Adds the component to the appropriate component array and
-		     * updates any groups that match the entity's new signature.
+		     * updates the groups whose membership changed with the entity's new signature.
 		     *
 		     * @tparam T The component type
 		     * @param entity The entity to add the component to
@@ -284,14 +363,7 @@ namespace nexo::ecs {
 		    void addComponent(Entity entity, T component, const Signature oldSignature, const Signature newSignature)
 			{
 		        getComponentArray<T>()->insert(entity, std::move(component));
-
-				for (const auto& group : std::ranges::views::values(m_groupRegistry)) {
-				    // Check if entity qualifies now but did not qualify before.
-                    if (((oldSignature & group->allSignature()) != group->allSignature()) &&
-                            ((newSignature & group->allSignature()) == group->allSignature())) {
-		    			group->addToGroup(entity);
-					}
-				}
+		        updateGroups(entity, oldSignature, newSignature);
 		    }
 
 	        /**
@@ -313,14 +385,44 @@ namespace nexo::ecs {
 	        void addComponent(const Entity entity, const ComponentType componentType, const void *componentData, const Signature oldSignature, const Signature newSignature)
 		    {
 		        getComponentArray(componentType)->insertRaw(entity, componentData);
+		        updateGroups(entity, oldSignature, newSignature);
+		    }
 
-		        for (const auto& group : std::ranges::views::values(m_groupRegistry)) {
-		            // Check if entity qualifies now but did not qualify before.
-		            if (((oldSignature & group->allSignature()) != group->allSignature()) &&
-                            ((newSignature & group->allSignature()) == group->allSignature())) {
-		                group->addToGroup(entity);
-                    }
-		        }
+	        /**
+	         * @brief Adds the same component type to several entities using type ID
+	         *
+	         * The components are inserted in a single batch, then the groups of each entity are updated.
+	         *
+	         * @param entities The entities to add the component to
+	         * @param componentType The type ID of the component to add
+	         * @param componentsData Pointer to entities.size() contiguous components
+	         * @param oldSignatures The signatures of the entities before adding the component
+	         * @param newSignatures The signatures of the entities after adding the component
+	         */
+	        void addComponents(const std::span<const Entity> entities, const ComponentType componentType, const void *componentsData,
+	                           const std::span<const Signature> oldSignatures, const std::span<const Signature> newSignatures)
+		    {
+		        getComponentArray(componentType)->insertRawBatch(entities, componentsData);
+		        for (size_t i = 0; i < entities.size(); ++i)
+		            updateGroups(entities[i], oldSignatures[i], newSignatures[i]);
+		    }
+
+	        /**
+	         * @brief Removes the same component type from several entities using type ID
+	         *
+	         * @param entities The entities to remove the component from
+	         * @param componentType The type ID of the component to remove
+	         * @param previousSignatures The signatures of the entities before removal
+	         * @param newSignatures The signatures of the entities after removal
+	         */
+	        void removeComponents(const std::span<const Entity> entities, const ComponentType componentType,
+	                              const std::span<const Signature> previousSignatures, const std::span<const Signature> newSignatures)
+		    {
+		        for (size_t i = 0; i < entities.size(); ++i)
+		            removeFromGroups(entities[i], previousSignatures[i], newSignatures[i]);
+		        getComponentArray(componentType)->removeBatch(entities);
+		        for (size_t i = 0; i < entities.size(); ++i)
+		            addToGroups(entities[i], previousSignatures[i], newSignatures[i]);
 		    }
 
 	        /**
@@ -338,23 +440,18 @@ namespace nexo::ecs {
              */
 	        void removeComponent(const Entity entity, const ComponentType componentType, const Signature previousSignature, const Signature newSignature)
 		    {
-		        for (const auto& group : std::ranges::views::values(m_groupRegistry))
-		        {
-		            if (((previousSignature & group->allSignature()) == group->allSignature()) &&
-                        ((newSignature & group->allSignature()) != group->allSignature()))
-		            {
-		                group->removeFromGroup(entity);
-		            }
-		        }
+		        removeFromGroups(entity, previousSignature, newSignature);
 		        getComponentArray(componentType)->remove(entity);
+		        addToGroups(entity, previousSignature, newSignature);
 		    }
 
 
 		    /**
 		     * @brief Removes a component from an entity
 		     *
-		     * Removes the entity from any groups that required the component
-		     * and then removes the component from its array.
+		     * Removes the entity from any groups that required the component,
+		     * removes the component from its array and then adds the entity to
+		     * the groups that excluded the component.
 		     *
 		     * @tparam T The component type
 		     * @param entity The entity to remove the component from
@@ -364,15 +461,9 @@ namespace nexo::ecs {
             template<typename T>
             void removeComponent(Entity entity, const Signature previousSignature, const Signature newSignature)
             {
-                for (const auto& group : std::ranges::views::values(m_groupRegistry))
-                {
-                    // If the entity no longer qualifies but did before, remove it.
-                    if (((previousSignature & group->allSignature()) == group->allSignature()) &&
-                    ((newSignature & group->allSignature()) != group->allSignature())) {
-                        group->removeFromGroup(entity);
-                    }
-                }
+                removeFromGroups(entity, previousSignature, newSignature);
                 getComponentArray<T>()->remove(entity);
+                addToGroups(entity, previousSignature, newSignature);
             }
 
 		    /**
@@ -394,15 +485,9 @@ namespace nexo::ecs {
 		        if (!componentArray->hasComponent(entity))
 		            return false;
 
-				for (const auto& group : std::ranges::views::values(m_groupRegistry))
-				{
-				    // If the entity no longer qualifies but did before, remove it.
-                    if (((previousSignature & group->allSignature()) == group->allSignature()) &&
-                    ((newSignature & group->allSignature()) != group->allSignature())) {
-                        group->removeFromGroup(entity);
-                    }
-				}
+		        removeFromGroups(entity, previousSignature, newSignature);
 		        componentArray->remove(entity);
+		        addToGroups(entity, previousSignature, newSignature);
 		        return true;
 		    }
 
@@ -441,14 +526,7 @@ namespace nexo::ecs {
 			) {
 			    const auto& componentArray = m_componentArrays[componentType];
 				componentArray->duplicateComponent(sourceEntity, destEntity);
-
-				for (const auto& group : std::ranges::views::values(m_groupRegistry)) {
-				    // Check if entity qualifies now but did not qualify before.
-                    if (((oldSignature & group->allSignature()) != group->allSignature()) &&
-                            ((newSignature & group->allSignature()) == group->allSignature())) {
-		    			group->addToGroup(destEntity);
-					}
-				}
+				updateGroups(destEntity, oldSignature, newSignature);
 			}
 
 	        /**
@@ -467,6 +545,72 @@ namespace nexo::ecs {
 		        return componentArray;
 		    }
 
+		    /**
+		     * @brief Registers every component type of another manager that is missing in this one
+		     *
+		     * The new arrays are empty and share the layout of the other manager's arrays, which
+		     * lets a world built elsewhere (e.g. on a loading thread) be merged into this one.
+		     *
+		     * @param other The manager to copy the component registrations from
+		     */
+		    void registerComponentsFrom(const ComponentManager &other)
+		    {
+		        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+		            if (!m_componentArrays[type] && other.m_componentArrays[type])
+		                m_componentArrays[type] = other.m_componentArrays[type]->createEmpty();
+		        }
+		    }
+
+		    /**
+		     * @brief Moves every component of another manager into this one
+		     *
+		     * Groups are not updated, the caller must call updateGroups for each moved entity
+		     * once all of its components are in place.
+		     *
+		     * @param source The manager to move the components from
+		     * @param entityMapping Maps each entity of the source manager to its entity in this manager
+		     * @throws ComponentNotRegistered if a component type of the source is not registered here
+		     */
+		    void moveComponentsFrom(ComponentManager &source, const std::span<const Entity> entityMapping)
+		    {
+		        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+		            const auto &sourceArray = source.m_componentArrays[type];
+		            if (!sourceArray || sourceArray->size() == 0)
+		                continue;
+		            if (!m_componentArrays[type])
+		                THROW_EXCEPTION(ComponentNotRegistered);
+		            sourceArray->moveAllTo(*m_componentArrays[type], entityMapping);
+		        }
+		    }
+
+		    /**
+		     * @brief Updates the group memberships of an entity once its components are in place
+		     *
+		     * Groups the entity left are updated from the most to the least restrictive one,
+		     * then groups it joined from the least to the most restrictive one.
+		     *
+		     * @param entity The entity whose signature changed
+		     * @param oldSignature The entity's previous signature
+		     * @param newSignature The entity's new signature
+		     */
+			void updateGroups(const Entity entity, const Signature& oldSignature, const Signature& newSignature) const
+			{
+			    removeFromGroups(entity, oldSignature, newSignature);
+			    addToGroups(entity, oldSignature, newSignature);
+			}
+
+		    /**
+		     * @brief Gets the array of a component type registered at runtime
+		     *
+		     * @param typeID The component type ID
+		     * @return Shared pointer to the type-erased array, or nullptr if the type was registered statically
+		     * @throws ComponentNotRegistered if the component type is not registered
+		     */
+		    [[nodiscard]] std::shared_ptr<TypeErasedComponentArray> getTypeErasedComponentArray(const ComponentType typeID) const
+		    {
+		        return std::dynamic_pointer_cast<TypeErasedComponentArray>(getComponentArray(typeID));
+		    }
+
 		    /**
 		     * @brief Gets the component array for a specific component type
 		     *
@@ -545,61 +689,94 @@ namespace nexo::ecs {
 			 * a specific combination of components, or returns an existing one.
 			 * Components specified in the template parameter pack are "owned" (internal to the group),
 			 * while those in the nonOwned parameter are "non-owned" (externally referenced).
+			 * Entities having any of the components of the excluded parameter are left out.
+			 *
+			 * Several groups can own the same component only if they are nested, i.e. one of
+			 * them owns, requires and excludes at least every component of the other.
 			 *
 			 * @tparam Owned Component types that are owned by the group
 			 * @param nonOwned A get_t<...> tag specifying non-owned component types
+			 * @param excluded An exclude_t<...> tag specifying excluded component types
 			 * @return A shared pointer to the group (either existing or newly created)
 			 * @throws ComponentNotRegistered if any component type is not registered
 			 * @throws OverlappingGroupsException if the new group would have overlapping owned
-			 *         components with an existing group
+			 *         components with an existing group it is not nested with
 			 */
 			template<typename... Owned>
-			auto registerGroup(const auto& nonOwned)
+			auto registerGroup(const auto& nonOwned, const auto& excluded)
 			{
-			    const GroupKey newGroupKey = generateGroupKey<Owned...>(nonOwned);
+			    const GroupKey newGroupKey = generateGroupKey<Owned...>(nonOwned, excluded);
+			    using OwnedTuple = std::tuple<std::shared_ptr<ComponentArray<Owned>>...>;
+			    using NonOwnedTuple = decltype(getNonOwnedTuple(nonOwned));
 
 			    // Check if this exact group already exists
 			    auto it = m_groupRegistry.find(newGroupKey);
-			    if (it != m_groupRegistry.end()) {
-			        using OwnedTuple = std::tuple<std::shared_ptr<ComponentArray<Owned>>...>;
-			        using NonOwnedTuple = decltype(getNonOwnedTuple(nonOwned));
+			    if (it != m_groupRegistry.end())
 			        return std::static_pointer_cast<Group<OwnedTuple, NonOwnedTuple>>(it->second);
-			    }
 
 			    // Check for conflicts with existing groups
-				for (const auto& existingKey : std::ranges::views::keys(m_groupRegistry)) {
-					if (hasCommonOwnedComponents(existingKey, newGroupKey)) {
-						for (ComponentType i = 0; i < MAX_COMPONENT_TYPE; i++) {
-							if (existingKey.ownedSignature.test(i) && newGroupKey.ownedSignature.test(i)) {
-								THROW_EXCEPTION(OverlappingGroupsException,
-												existingKey.toString(),
-												newGroupKey.toString(),
-												i);
-							}
+				std::vector<std::shared_ptr<IGroup>> outerGroups;
+				bool nestsExistingGroup = false;
+				for (const auto& [existingKey, existingGroup] : m_groupRegistry) {
+					if (!hasCommonOwnedComponents(existingKey, newGroupKey))
+						continue;
+					if (newGroupKey.isNestedIn(existingKey)) {
+						outerGroups.push_back(existingGroup);
+						continue;
+					}
+					if (existingKey.isNestedIn(newGroupKey)) {
+						nestsExistingGroup = true;
+						continue;
+					}
+					for (ComponentType i = 0; i < MAX_COMPONENT_TYPE; i++) {
+						if (existingKey.ownedSignature.test(i) && newGroupKey.ownedSignature.test(i)) {
+							THROW_EXCEPTION(OverlappingGroupsException,
+											existingKey.toString(),
+											newGroupKey.toString(),
+											i);
 						}
 					}
 				}
 
-			    auto group = createNewGroup<Owned...>(nonOwned);
+			    auto group = createNewGroup<Owned...>(nonOwned, newGroupKey.excludedSignature);
+			    for (const auto& outerGroup : outerGroups)
+			        outerGroup->markAsNesting();
+			    if (nestsExistingGroup)
+			        group->markAsNesting();
 			    m_groupRegistry[newGroupKey] = group;
+			    insertGroupByRestrictiveness(group);
 			    return group;
 			}
 
+			/**
+			 * @brief Creates or retrieves a group without excluded components
+			 *
+			 * @tparam Owned Component types that are owned by the group
+			 * @param nonOwned A get_t<...> tag specifying non-owned component types
+			 * @return A shared pointer to the group (either existing or newly created)
+			 */
+			template<typename... Owned>
+			auto registerGroup(const auto& nonOwned)
+			{
+			    return registerGroup<Owned...>(nonOwned, exclude<>());
+			}
+
 			/**
 			 * @brief Retrieves an existing group for specific component combinations
 			 *
 			 * Gets a previously registered group that matches the specified
-			 * owned and non-owned component types.
+			 * owned, non-owned and excluded component types.
 			 *
 			 * @tparam Owned Component types that are owned by the group
 			 * @param nonOwned A get_t<...> tag specifying non-owned component types
+			 * @param excluded An exclude_t<...> tag specifying excluded component types
 			 * @return A shared pointer to the existing group
-			 * @throws std::runtime_error if the group doesn't exist
+			 * @throws GroupNotFound if the group doesn't exist
 			 */
 			template<typename... Owned>
-			auto getGroup(const auto& nonOwned)
+			auto getGroup(const auto& nonOwned, const auto& excluded)
 			{
-				const GroupKey groupKey = generateGroupKey<Owned...>(nonOwned);
+				const GroupKey groupKey = generateGroupKey<Owned...>(nonOwned, excluded);
 
 				const auto it = m_groupRegistry.find(groupKey);
 			    if (it == m_groupRegistry.end())
@@ -610,6 +787,20 @@ namespace nexo::ecs {
 			    return std::static_pointer_cast<Group<OwnedTuple, NonOwnedTuple>>(it->second);
 			}
 
+			/**
+			 * @brief Retrieves an existing group without excluded components
+			 *
+			 * @tparam Owned Component types that are owned by the group
+			 * @param nonOwned A get_t<...> tag specifying non-owned component types
+			 * @return A shared pointer to the existing group
+			 * @throws GroupNotFound if the group doesn't exist
+			 */
+			template<typename... Owned>
+			auto getGroup(const auto& nonOwned)
+			{
+				return getGroup<Owned...>(nonOwned, exclude<>());
+			}
+
             /**
              * @brief Checks if two groups share any common owned components
              *
@@ -641,6 +832,67 @@ namespace nexo::ecs {
 			 */
 			std::unordered_map<GroupKey, std::shared_ptr<IGroup>> m_groupRegistry;
 
+			/**
+			 * @brief Registered groups ordered from the least to the most restrictive
+			 *
+			 * Nested groups must receive an entity after the groups containing them and
+			 * release it before them, so membership updates walk this list in order.
+			 */
+			std::vector<std::shared_ptr<IGroup>> m_groups;
+
+			/**
+			 * @brief Inserts a group in m_groups, after every group it is nested in
+			 *
+			 * A nested group owns, requires and excludes more components than the groups containing it,
+			 * so ordering the groups by these counts puts every group after the ones it is nested in.
+			 *
+			 * @param group The group to insert
+			 */
+			void insertGroupByRestrictiveness(std::shared_ptr<IGroup> group)
+			{
+			    const auto restrictiveness = [](const std::shared_ptr<IGroup>& g) {
+			        return std::tuple{g->ownedSignature().count(), g->allSignature().count(), g->excludedSignature().count()};
+			    };
+			    const auto position = std::ranges::upper_bound(m_groups, restrictiveness(group), {}, restrictiveness);
+			    m_groups.insert(position, std::move(group));
+			}
+
+			/**
+			 * @brief Removes an entity from the groups it no longer belongs to
+			 *
+			 * Walks the groups from the most to the least restrictive one so nested groups
+			 * release the entity first.
+			 *
+			 * @param entity The entity whose signature changed
+			 * @param oldSignature The entity's previous signature
+			 * @param newSignature The entity's new signature
+			 */
+			void removeFromGroups(const Entity entity, const Signature& oldSignature, const Signature& newSignature) const
+			{
+			    for (const auto& group : std::views::reverse(m_groups)) {
+			        if (group->matches(oldSignature) && !group->matches(newSignature))
+			            group->removeFromGroup(entity);
+			    }
+			}
+
+			/**
+			 * @brief Adds an entity to the groups it now belongs to
+			 *
+			 * Walks the groups from the least to the most restrictive one so the containing
+			 * groups receive the entity first.
+			 *
+			 * @param entity The entity whose signature changed
+			 * @param oldSignature The entity's previous signature
+			 * @param newSignature The entity's new signature
+			 */
+			void addToGroups(const Entity entity, const Signature& oldSignature, const Signature& newSignature) const
+			{
+			    for (const auto& group : m_groups) {
+			        if (!group->matches(oldSignature) && group->matches(newSignature))
+			            group->addToGroup(entity);
+			    }
+			}
+
 			/**
 			 * @brief Helper function to get the tuple of non-owned component arrays
 			 *
@@ -656,12 +908,16 @@ namespace nexo::ecs {
 			/**
 			 * @brief Creates a new group for the specified component types
 			 *
+			 * The entities already matching the group are added to it in the order of the
+			 * first owned array, which keeps the regions of the groups nested in it untouched.
+			 *
 			 * @tparam Owned Component types owned by the group
 			 * @param nonOwned Tag for non-owned component types
+			 * @param excludedSignature Signature of the excluded component types
 			 * @return Shared pointer to the new group
 			 */
 			template<typename... Owned>
-			auto createNewGroup(const auto& nonOwned)
+			auto createNewGroup(const auto& nonOwned, const Signature& excludedSignature)
 			{
 			    auto nonOwnedArrays = getNonOwnedTuple(nonOwned);
 
@@ -669,13 +925,11 @@ namespace nexo::ecs {
 			    using OwnedTuple = std::tuple<std::shared_ptr<ComponentArray<Owned>>...>;
 			    using NonOwnedTuple = decltype(nonOwnedArrays);
 
+			    auto group = std::make_shared<Group<OwnedTuple, NonOwnedTuple>>(ownedArrays, nonOwnedArrays, excludedSignature);
+
 			    // Find entities that should be in this group
 			    auto driver = std::get<0>(ownedArrays);
-			    const std::size_t minSize = std::apply([](auto&&... arrays) -> std::size_t {
-			        return std::min({ static_cast<std::size_t>(arrays->size())... });
-			    }, ownedArrays);
-
-			    for (std::size_t i = 0; i < minSize; ++i) {
+			    for (std::size_t i = 0; i < driver->size(); ++i) {
 			        Entity e = driver->getEntityAtIndex(i);
 			        bool valid = true;
 
@@ -689,27 +943,31 @@ namespace nexo::ecs {
             			valid = (valid && ... && arrays->hasComponent(e));
 			        }, nonOwnedArrays);
 
-			        if (valid) {
-			            std::apply([&](auto&&... arrays) {
-			                ((arrays->addToGroup(e)), ...);
-			            }, ownedArrays);
+			        // Check in excluded arrays
+			        for (ComponentType type = 0; valid && type < MAX_COMPONENT_TYPE; ++type) {
+			            if (excludedSignature.test(type) && m_componentArrays[type] && m_componentArrays[type]->hasComponent(e))
+			                valid = false;
 			        }
+
+			        if (valid)
+			            group->addToGroup(e);
 			    }
 
-			    return std::make_shared<Group<OwnedTuple, NonOwnedTuple>>(ownedArrays, nonOwnedArrays);
+			    return group;
 			}
 
 			/**
 			 * @brief Generates a unique key for a group based on its component types
 			 *
-			 * Creates a GroupKey with separate signatures for owned and non-owned components.
+			 * Creates a GroupKey with separate signatures for owned, non-owned and excluded components.
 			 *
 			 * @tparam Owned Component types owned by the group
 			 * @param nonOwned Tag for non-owned component types
+			 * @param excluded Tag for excluded component types
 			 * @return GroupKey uniquely identifying this group type combination
 			 */
 			template<typename... Owned>
-			GroupKey generateGroupKey(const auto& nonOwned)
+			GroupKey generateGroupKey(const auto& nonOwned, const auto& excluded)
 			{
 			    GroupKey key;
 
@@ -719,6 +977,9 @@ namespace nexo::ecs {
 			    // Set bits for non-owned components
 			    setNonOwnedBits(key.nonOwnedSignature, nonOwned);
 
+			    // Set bits for excluded components
+			    setExcludedBits(key.excludedSignature, excluded);
+
 			    return key;
 			}
 
@@ -734,5 +995,18 @@ namespace nexo::ecs {
 			{
 			    ((signature.set(getComponentTypeID<NonOwning>())), ...);
 			}
+
+			/**
+			 * @brief Sets bits in the excluded signature for each excluded component
+			 *
+			 * @tparam Excluded Excluded component types
+			 * @param signature The signature to modify
+			 * @param excluded The excluded components tag
+			 */
+			template<typename... Excluded>
+			static void setExcludedBits(Signature& signature, const exclude_t<Excluded...>&)
+			{
+			    ((signature.set(getComponentTypeID<Excluded>())), ...);
+			}
 	};
 }
@@ -18,7 +18,8 @@
 
 #include "Coordinator.hpp"
 
-std::shared_ptr<nexo::ecs::Coordinator> nexo::ecs::System::coord = nullptr;
+#include <algorithm>
+#include <cassert>
 
 namespace nexo::ecs {
 
@@ -29,18 +30,80 @@ namespace nexo::ecs {
         m_systemManager = std::make_shared<SystemManager>();
         m_singletonComponentManager = std::make_shared<SingletonComponentManager>();
 
-        System::coord = std::shared_ptr<Coordinator>(this, [](const Coordinator*) {});
+        if (auto world = weak_from_this().lock())
+            System::currentWorld() = std::move(world);
 
         LOG(NEXO_DEV, "ecs: Coordinator initialized");
     }
 
+    void Coordinator::registerComponentsFrom(const Coordinator &world)
+    {
+        m_componentManager->registerComponentsFrom(*world.m_componentManager);
+        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+            if (!m_componentVTables[type])
+                m_componentVTables[type] = world.m_componentVTables[type];
+        }
+        for (const auto &[type, description] : world.m_componentDescriptions)
+            m_componentDescriptions.try_emplace(type, description);
+    }
+
+    std::vector<Entity> Coordinator::mergeWorld(Coordinator &source)
+    {
+        assert(isAccessibleFromCurrentThread() && source.isAccessibleFromCurrentThread()
+               && "Worlds can only be merged from their owning thread");
+        if (&source == this)
+            THROW_EXCEPTION(InternalError, "Cannot merge a world into itself");
+
+        const std::span<const Entity> living = source.m_entityManager->getLivingEntities();
+        const std::vector<Entity> sourceEntities(living.begin(), living.end());
+        if (sourceEntities.empty())
+            return {};
+
+        std::vector<Entity> mapping(*std::ranges::max_element(sourceEntities) + 1, INVALID_ENTITY);
+        try {
+            for (const Entity entity : sourceEntities)
+                mapping[entity] = m_entityManager->createEntity();
+
+            registerComponentsFrom(source);
+            m_componentManager->moveComponentsFrom(*source.m_componentManager, mapping);
+        } catch (...) {
+            // Nothing is visible to groups and systems yet, dropping the new entities restores this world
+            for (const Entity merged : mapping) {
+                if (merged == INVALID_ENTITY)
+                    continue;
+                m_componentManager->entityDestroyed(merged, Signature{});
+                m_entityManager->destroyEntity(merged);
+            }
+            throw;
+        }
+
+        for (const Entity entity : sourceEntities) {
+            const Entity merged = mapping[entity];
+            const Signature signature = source.m_entityManager->getSignature(entity);
+            m_entityManager->setSignature(merged, signature);
+            m_componentManager->updateGroups(merged, Signature{}, signature);
+            m_systemManager->entitySignatureChanged(merged, Signature{}, signature);
+        }
+
+        // The moved-from components are released with their entities
+        for (const Entity entity : sourceEntities)
+            source.destroyEntity(entity);
+        // The merged entities bring their parenting along
+        markHierarchyChanged();
+
+        LOG(NEXO_DEV, "ecs: Merged {} entities into world", sourceEntities.size());
+        return mapping;
+    }
+
     Entity Coordinator::createEntity() const
     {
+        assert(isAccessibleFromCurrentThread() && "Entities can only be created from the world's owning thread");
         return m_entityManager->createEntity();
     }
 
     void Coordinator::destroyEntity(const Entity entity) const
     {
+        assert(isAccessibleFromCurrentThread() && "Entities can only be destroyed from the world's owning thread");
         const Signature signature = m_entityManager->getSignature(entity);
         m_entityManager->destroyEntity(entity);
         m_componentManager->entityDestroyed(entity, signature);
@@ -71,37 +134,20 @@ namespace nexo::ecs {
 
         for (const auto& type : types)
         {
-            typeIndices.push_back(m_typeIDtoTypeIndex.at(type));
+            if (const ComponentVTable *vtable = m_componentVTables[type])
+                typeIndices.emplace_back(*vtable->typeInfo);
         }
 
         return typeIndices;
     }
 
-    std::vector<std::any> Coordinator::getAllComponents(const Entity entity)
-    {
-        std::vector<std::any> components;
-
-        // Get the entity's signature which already tells us which components it has
-        Signature signature = m_entityManager->getSignature(entity);
-
-        // Iterate only through components that the entity actually has
-        for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
-            if (signature.test(type) && m_typeIDtoTypeIndex.contains(type)) {
-                const auto& typeIndex = m_typeIDtoTypeIndex.at(type);
-                components.emplace_back(m_getComponentFunctions[typeIndex](entity));
-            }
-        }
-
-        return components;
-    }
-
     Entity Coordinator::duplicateEntity(const Entity sourceEntity) const
     {
         const Entity newEntity = createEntity();
         const Signature signature = m_entityManager->getSignature(sourceEntity);
         Signature destSignature = m_entityManager->getSignature(newEntity);
         for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
-            if (signature.test(type) && m_typeIDtoTypeIndex.contains(type)) {
+            if (signature.test(type) && m_componentVTables[type] != nullptr) {
                 const Signature previousSignature = destSignature;
                 destSignature.set(type, true);
                 m_componentManager->duplicateComponent(type, sourceEntity, newEntity, previousSignature, destSignature);
@@ -111,35 +157,4 @@ namespace nexo::ecs {
         m_systemManager->entitySignatureChanged(newEntity, Signature{}, destSignature);
         return newEntity;
     }
-
-    bool Coordinator::supportsMementoPattern(const std::any& component) const
-    {
-        const auto typeId = std::type_index(component.type());
-        const auto it = m_supportsMementoPattern.find(typeId);
-        return (it != m_supportsMementoPattern.end()) && it->second;
-    }
-
-    std::any Coordinator::saveComponent(const std::any& component) const
-    {
-        const auto typeId = std::type_index(component.type());
-        const auto it = m_saveComponentFunctions.find(typeId);
-        if (it != m_saveComponentFunctions.end())
-            return it->second(component);
-        return {};
-    }
-
-    std::any Coordinator::restoreComponent(const std::any& memento, const std::type_index& componentType) const
-    {
-        const auto it = m_restoreComponentFunctions.find(componentType);
-        if (it != m_restoreComponentFunctions.end())
-            return it->second(memento);
-        return {};
-    }
-
-    void Coordinator::addComponentAny(const Entity entity, const std::type_index& typeIndex, const std::any& component)
-    {
-        const auto it = m_addComponentFunctions.find(typeIndex);
-        if (it != m_addComponentFunctions.end())
-            it->second(entity, component);
-    }
 }
@@ -19,94 +19,24 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cassert>
 #include <memory>
-#include <any>
+#include <thread>
+#include <vector>
 
 #include "Components.hpp"
+#include "Access.hpp"
+#include "CachedQuery.hpp"
 #include "System.hpp"
 #include "SingletonComponent.hpp"
 #include "Entity.hpp"
 #include "Logger.hpp"
 #include "TypeErasedComponent/ComponentDescription.hpp"
+#include "TypeErasedComponent/ComponentVTable.hpp"
 
 namespace nexo::ecs {
 
-    template <typename T>
-    struct Exclude {
-        using type = T;
-    };
-
-    // Check if type is an Exclude specialization
-    template <typename T>
-    struct is_exclude : std::false_type {};
-
-    template <typename T>
-    struct is_exclude<Exclude<T>> : std::true_type {};
-
-    template <typename T>
-    inline constexpr bool is_exclude_v = is_exclude<T>::value;
-
-    // Extract the actual type from Exclude<T>
-    template <typename T>
-    struct extract_type {
-        using type = T;
-    };
-
-    template <typename T>
-    struct extract_type<Exclude<T>> {
-        using type = T;
-    };
-
-    template <typename T>
-    using extract_type_t = typename extract_type<T>::type;
-
-    // Check if T has a nested Memento type
-    template<typename T, typename = void>
-    struct has_memento_type : std::false_type {};
-
-    template<typename T>
-    struct has_memento_type<T, std::void_t<typename T::Memento>> : std::true_type {};
-
-    // Check if T has a save() method that returns Memento
-    template<typename T, typename = void>
-    struct has_save_method : std::false_type {};
-
-    template<typename T>
-    struct has_save_method<T,
-        std::void_t<decltype(std::declval<const T&>().save())>>
-        : std::is_same<decltype(std::declval<const T&>().save()), typename T::Memento> {};
-
-    // Check if T::Memento has a restore() method that returns T
-    template<typename T, typename = void>
-    struct has_restore_method : std::false_type {};
-
-    template<typename T>
-    struct has_restore_method<T,
-        std::void_t<decltype(std::declval<T&>().restore(std::declval<const typename T::Memento&>()))>>
-        : std::is_same<decltype(std::declval<T&>().restore(std::declval<const typename T::Memento&>())), void> {};
-
-    // Combined check for full memento pattern support
-    template<typename T>
-    struct supports_memento_pattern :
-        std::conjunction<
-            has_memento_type<T>,
-            has_save_method<T>,
-            has_restore_method<T>
-        > {};
-
-    template<typename T>
-    inline constexpr bool has_memento_type_v = has_memento_type<T>::value;
-
-    template<typename T>
-    inline constexpr bool has_save_method_v = has_save_method<T>::value;
-
-    template<typename T>
-    inline constexpr bool has_restore_method_v = has_restore_method<T>::value;
-
-    template<typename T>
-    inline constexpr bool supports_memento_pattern_v = supports_memento_pattern<T>::value;
-
-
     /**
      * @class Coordinator
      *
@@ -115,16 +45,69 @@ namespace nexo::ecs {
      * The Coordinator class ties together the functionalities of the EntityManager,
      * ComponentManager, and SystemManager to facilitate the creation, management,
      * and interaction of entities, components, and systems within the ECS framework.
+     *
+     * Each coordinator is an independent world. Systems registered through a coordinator are
+     * bound to it, and a world built on another thread can be merged into a live one with mergeWorld().
+     * Registering systems requires the coordinator to be owned by a std::shared_ptr, the systems
+     * share that ownership.
      */
-    class Coordinator {
+    class Coordinator : public std::enable_shared_from_this<Coordinator> {
         public:
             /**
             * @brief Initializes the Coordinator, creating instances of EntityManager,
             * ComponentManager, SystemManager, EventManager, SingletonComponentManager
             * and SceneManager.
+            *
+            * When owned by a std::shared_ptr, the coordinator becomes the current world of the calling thread.
             */
             void init();
 
+            /**
+            * @brief Registers every component type of another world that is missing in this one.
+            *
+            * Typically called on a freshly initialized world before filling it on a loading thread,
+            * so that it can later be merged into the other world.
+            *
+            * @param world The world to copy the component registrations from.
+            */
+            void registerComponentsFrom(const Coordinator &world);
+
+            /**
+            * @brief Moves every entity of another world into this one.
+            *
+            * Entities are recreated in this world with their components moved in bulk, one component
+            * type at a time, then groups, systems and cached queries of this world are updated.
+            * The source world is left empty but usable. Singleton components are not merged.
+            *
+            * If a component can not be moved, the entities created in this world are destroyed before
+            * the exception is rethrown and this world is left as it was. The source world keeps its
+            * entities, but the components already moved out of it are left in a moved-from state.
+            *
+            * @param source The world to merge, must not be used by another thread during the merge.
+            * @return Maps each entity of the source world (by ID) to its new entity, INVALID_ENTITY for unused IDs.
+            * @throws ComponentNotRegistered if a component type used in the source world cannot be registered here.
+            * @throws TooManyEntities if this world cannot hold the merged entities.
+            */
+            std::vector<Entity> mergeWorld(Coordinator &source);
+
+            /**
+            * @brief Restricts structural changes of this world to a single thread.
+            *
+            * In debug builds, creating or destroying entities, or adding or removing components,
+            * from another thread triggers an assertion.
+            *
+            * @param thread The owning thread, a default constructed id lifts the restriction.
+            */
+            void setThreadAffinity(const std::thread::id thread) { m_ownerThread = thread; }
+
+            /**
+            * @brief Checks whether the calling thread may modify this world.
+            */
+            [[nodiscard]] bool isAccessibleFromCurrentThread() const
+            {
+                return m_ownerThread == std::thread::id{} || m_ownerThread == std::this_thread::get_id();
+            }
+
             /**
             * @brief Creates a new entity.
             *
@@ -147,41 +130,7 @@ namespace nexo::ecs {
             {
                 m_componentManager->registerComponent<T>();
 
-                m_getComponentFunctions[typeid(T)] = [this](const Entity entity) -> std::any {
-                    return this->getComponent<T>(entity);
-                };
-
-                m_getComponentPointers[typeid(T)] = [this](const Entity entity) -> std::any {
-                    auto opt = this->tryGetComponent<T>(entity);
-                    if (!opt.has_value())
-                        return {};
-                    T* ptr = &opt.value().get();
-                    return std::any(static_cast<void*>(ptr));
-                };
-                m_typeIDtoTypeIndex.emplace(getComponentType<T>(), typeid(T));
-
-                m_addComponentFunctions[typeid(T)] = [this](const Entity entity, const std::any& componentAny) {
-                    T component = std::any_cast<T>(componentAny);
-                    this->addComponent<T>(entity, component);
-                };
-
-                if constexpr (supports_memento_pattern_v<T>) {
-                    m_supportsMementoPattern.emplace(typeid(T), true);
-
-                    m_saveComponentFunctions[typeid(T)] = [](const std::any& componentAny) -> std::any {
-                        const T& component = std::any_cast<const T&>(componentAny);
-                        return std::any(component.save());
-                    };
-
-                    m_restoreComponentFunctions[typeid(T)] = [](const std::any& mementoAny) -> std::any {
-                        const typename T::Memento& memento = std::any_cast<const typename T::Memento&>(mementoAny);
-                        T component{};
-                        component.restore(memento);
-                        return std::any(std::move(component));
-                    };
-                } else {
-                    m_supportsMementoPattern.emplace(typeid(T), false);
-                }
+                m_componentVTables[getComponentType<T>()] = &ecs::getComponentVTable<T>();
             }
 
             void addComponentDescription(const ComponentType componentType, const ComponentDescription& description)
@@ -189,12 +138,27 @@ namespace nexo::ecs {
                 m_componentDescriptions[componentType] = std::make_shared<ComponentDescription>(description);
             }
 
-            ComponentType registerComponent(const size_t componentSize, const size_t initialCapacity = 1024)
+            ComponentType registerComponent(const size_t componentSize, const size_t initialCapacity = 1024, const size_t alignment = 0)
             {
-                const auto typeID = m_componentManager->registerComponent(componentSize, initialCapacity);
+                const auto typeID = m_componentManager->registerComponent(componentSize, initialCapacity, alignment);
                 return typeID;
             }
 
+            /**
+            * @brief Registers a component type at runtime, stored as a struct of arrays.
+            *
+            * @param componentSize Size of the component in bytes
+            * @param fields Field descriptions of the component, each stored field gets its own column
+            * @param initialCapacity Initial capacity of the component array
+            * @param alignment Alignment of the component, 0 for the natural alignment of its size
+            * @return The new component type ID
+            */
+            ComponentType registerComponent(const size_t componentSize, const std::span<const Field> fields,
+                                            const size_t initialCapacity = 1024, const size_t alignment = 0)
+            {
+                return m_componentManager->registerComponent(componentSize, fields, initialCapacity, alignment);
+            }
+
             /**
              * @brief Registers a new singleton component
              *
@@ -216,6 +180,7 @@ namespace nexo::ecs {
             template <typename T>
             void addComponent(const Entity entity, T component)
             {
+                assert(isAccessibleFromCurrentThread() && "Components can only be added from the world's owning thread");
                 Signature signature = m_entityManager->getSignature(entity);
                 const Signature oldSignature = signature;
                 signature.set(m_componentManager->getComponentType<T>(), true);
@@ -240,6 +205,7 @@ namespace nexo::ecs {
              */
             void addComponent(const Entity entity, const ComponentType componentType, const void *componentData) const
             {
+                assert(isAccessibleFromCurrentThread() && "Components can only be added from the world's owning thread");
                 Signature signature = m_entityManager->getSignature(entity);
                 const Signature oldSignature = signature;
                 signature.set(componentType, true);
@@ -250,6 +216,65 @@ namespace nexo::ecs {
                 m_systemManager->entitySignatureChanged(entity, oldSignature, signature);
             }
 
+            /**
+             * @brief Adds the same component type to several entities at once, updates their signatures, and notifies systems.
+             *
+             * @param entities - The IDs of the entities.
+             * @param componentType - The ID of the component type to add.
+             * @param componentsData - Pointer to entities.size() components laid out contiguously.
+             */
+            void addComponents(const std::span<const Entity> entities, const ComponentType componentType, const void *componentsData) const
+            {
+                assert(isAccessibleFromCurrentThread() && "Components can only be added from the world's owning thread");
+                std::vector<Signature> oldSignatures(entities.size());
+                std::vector<Signature> newSignatures(entities.size());
+                for (size_t i = 0; i < entities.size(); ++i) {
+                    oldSignatures[i] = m_entityManager->getSignature(entities[i]);
+                    newSignatures[i] = oldSignatures[i];
+                    newSignatures[i].set(componentType, true);
+                }
+                m_componentManager->addComponents(entities, componentType, componentsData, oldSignatures, newSignatures);
+
+                for (size_t i = 0; i < entities.size(); ++i) {
+                    m_entityManager->setSignature(entities[i], newSignatures[i]);
+                    m_systemManager->entitySignatureChanged(entities[i], oldSignatures[i], newSignatures[i]);
+                }
+            }
+
+            /**
+             * @brief Removes the same component type from several entities at once, updates their signatures, and notifies systems.
+             *
+             * @param entities - The IDs of the entities, each must have the component and appear only once.
+             * @param componentType - The ID of the component type to remove.
+             *
+             * @throws ComponentNotFound if an entity does not have the component, before anything is changed.
+             * @throws DuplicateEntity if an entity appears several times, before anything is changed.
+             */
+            void removeComponents(const std::span<const Entity> entities, const ComponentType componentType) const
+            {
+                assert(isAccessibleFromCurrentThread() && "Components can only be removed from the world's owning thread");
+                std::vector<Signature> oldSignatures(entities.size());
+                std::vector<Signature> newSignatures(entities.size());
+                for (size_t i = 0; i < entities.size(); ++i) {
+                    oldSignatures[i] = m_entityManager->getSignature(entities[i]);
+                    if (!oldSignatures[i].test(componentType))
+                        THROW_EXCEPTION(ComponentNotFound, entities[i]);
+                    newSignatures[i] = oldSignatures[i];
+                    newSignatures[i].set(componentType, false);
+                }
+                // A duplicate passes the check above but no longer has the component when it is reached again
+                std::vector<Entity> sortedEntities(entities.begin(), entities.end());
+                std::ranges::sort(sortedEntities);
+                if (const auto duplicate = std::ranges::adjacent_find(sortedEntities); duplicate != sortedEntities.end())
+                    THROW_EXCEPTION(DuplicateEntity, *duplicate);
+                m_componentManager->removeComponents(entities, componentType, oldSignatures, newSignatures);
+
+                for (size_t i = 0; i < entities.size(); ++i) {
+                    m_entityManager->setSignature(entities[i], newSignatures[i]);
+                    m_systemManager->entitySignatureChanged(entities[i], oldSignatures[i], newSignatures[i]);
+                }
+            }
+
             /**
              * @brief Removes a component from an entity using ComponentType, updates its signature, and notifies systems.
              *
@@ -258,6 +283,7 @@ namespace nexo::ecs {
              */
             void removeComponent(const Entity entity, const ComponentType componentType)
             {
+                assert(isAccessibleFromCurrentThread() && "Components can only be removed from the world's owning thread");
                 Signature signature = m_entityManager->getSignature(entity);
                 const Signature oldSignature = signature;
 
@@ -281,6 +307,7 @@ namespace nexo::ecs {
             template<typename T>
             void removeComponent(const Entity entity) const
             {
+                assert(isAccessibleFromCurrentThread() && "Components can only be removed from the world's owning thread");
                 Signature signature = m_entityManager->getSignature(entity);
                 const Signature oldSignature = signature;
                 signature.set(m_componentManager->getComponentType<T>(), false);
@@ -303,6 +330,7 @@ namespace nexo::ecs {
             template<typename T>
             void tryRemoveComponent(const Entity entity) const
             {
+                assert(isAccessibleFromCurrentThread() && "Components can only be removed from the world's owning thread");
                 Signature signature = m_entityManager->getSignature(entity);
                 Signature oldSignature = signature;
                 signature.set(m_componentManager->getComponentType<T>(), false);
@@ -367,12 +395,27 @@ namespace nexo::ecs {
                 return m_componentManager->tryGetComponent(entity, componentType);
             }
 
-            const std::unordered_map<ComponentType, std::type_index>& getTypeIdToTypeIndex() const {
-                return m_typeIDtoTypeIndex;
+            /**
+             * @brief Retrieves the array of a component type registered at runtime.
+             *
+             * @param componentType The type ID of the component.
+             * @return The type-erased array, or nullptr if the type was registered statically.
+             */
+            [[nodiscard]] std::shared_ptr<TypeErasedComponentArray> getTypeErasedComponentArray(const ComponentType componentType) const
+            {
+                return m_componentManager->getTypeErasedComponentArray(componentType);
             }
 
-            const std::unordered_map<std::type_index, std::function<void(Entity, const std::any&)>>& getAddComponentFunctions() const {
-                return m_addComponentFunctions;
+            /**
+             * @brief Retrieves the vtable registered for a component type.
+             *
+             * @param componentType The type ID of the component.
+             * @return The static vtable of the component type, or nullptr if the type was registered
+             *         without a static type (e.g. scripted components).
+             */
+            [[nodiscard]] const ComponentVTable *getComponentVTable(const ComponentType componentType) const
+            {
+                return m_componentVTables[componentType];
             }
 
             Signature getSignature(const Entity entity) const {
@@ -414,12 +457,22 @@ namespace nexo::ecs {
             std::vector<std::type_index> getAllComponentTypeIndices(Entity entity) const;
 
             /**
-             * @brief Retrieves all components associated with an entity.
+             * @brief Visits every statically typed component of an entity without copying it.
              *
+             * @tparam Func Callable taking (ComponentType, const ComponentVTable &, void *component)
              * @param entity The target entity identifier.
-             * @return std::vector<std::pair<std::type_index, std::any>> A vector of pairs, each containing a component type and its instance.
+             * @param func The visitor, called once per component in component type order.
              */
-            std::vector<std::any> getAllComponents(Entity entity);
+            template<typename Func>
+            void forEachComponent(const Entity entity, Func &&func) const
+            {
+                const Signature signature = m_entityManager->getSignature(entity);
+                for (ComponentType type = 0; type < MAX_COMPONENT_TYPE; ++type) {
+                    if (!signature.test(type) || m_componentVTables[type] == nullptr)
+                        continue;
+                    func(type, *m_componentVTables[type], m_componentManager->tryGetComponent(entity, type));
+                }
+            }
 
             /**
             * @brief Retrieves all entities that have the specified components.
@@ -490,6 +543,7 @@ namespace nexo::ecs {
             */
             template <typename T, typename... Args>
             std::shared_ptr<T> registerQuerySystem(Args&&... args) {
+                const WorldScope scope(shared_from_this());
                 auto newQuerySystem =  m_systemManager->registerQuerySystem<T>(std::forward<Args>(args)...);
                 std::span<const Entity> livingEntities = m_entityManager->getLivingEntities();
                 const Signature querySystemSignature = newQuerySystem->getSignature();
@@ -502,6 +556,31 @@ namespace nexo::ecs {
                 return newQuerySystem;
             }
 
+            /**
+             * @brief Registers a persistent query kept up to date from entity signature changes
+             *
+             * Components wrapped in Exclude<T> must not be present on matching entities.
+             * Entities already matching at registration time are reported as added on the first read.
+             *
+             * @tparam Components The component types to filter by, optionally wrapped in Exclude<T>
+             * @return std::shared_ptr<CachedQuery> The query, updated as long as it is owned by the caller
+             */
+            template<typename... Components>
+            std::shared_ptr<CachedQuery> registerCachedQuery()
+            {
+                Signature requiredSignature;
+                Signature excludeSignature;
+                (processComponentSignature<Components>(requiredSignature, excludeSignature), ...);
+                // Entities without components never trigger a signature change, they could not be tracked
+                assert(requiredSignature.any() && "A cached query needs at least one required component");
+
+                auto query = std::make_shared<CachedQuery>(requiredSignature, excludeSignature);
+                for (const Entity entity : m_entityManager->getLivingEntities())
+                    query->entitySignatureChanged(entity, Signature{}, m_entityManager->getSignature(entity));
+                m_systemManager->registerCachedQuery(query);
+                return query;
+            }
+
             /**
             * @brief Registers a new group system
             *
@@ -511,6 +590,7 @@ namespace nexo::ecs {
             */
             template <typename T, typename... Args>
             std::shared_ptr<T> registerGroupSystem(Args&&... args) {
+                const WorldScope scope(shared_from_this());
                 return m_systemManager->registerGroupSystem<T>(std::forward<Args>(args)...);
             }
 
@@ -527,6 +607,20 @@ namespace nexo::ecs {
 				return m_componentManager->registerGroup<Owned...>(nonOwned);
 			}
 
+            /**
+             * @brief Creates or retrieves a group filtering out entities with some components
+             *
+             * @tparam Owned Component types that are owned by the group
+             * @param nonOwned A get_t<...> tag specifying non-owned component types
+             * @param excluded An exclude_t<...> tag specifying excluded component types
+             * @return A shared pointer to the group (either existing or newly created)
+             */
+            template<typename... Owned>
+		    auto registerGroup(const auto & nonOwned, const auto & excluded)
+			{
+				return m_componentManager->registerGroup<Owned...>(nonOwned, excluded);
+			}
+
 			/**
 			* @brief Retrieves an existing group for specific component combinations
 			*
@@ -540,6 +634,20 @@ namespace nexo::ecs {
 				return m_componentManager->getGroup<Owned...>(nonOwned);
 			}
 
+			/**
+			* @brief Retrieves an existing group filtering out entities with some components
+			*
+			* @tparam Owned Component types that are owned by the group
+			* @param nonOwned A get_t<...> tag specifying non-owned component types
+			* @param excluded An exclude_t<...> tag specifying excluded component types
+			* @return A shared pointer to the existing group
+			*/
+			template<typename... Owned>
+			auto getGroup(const auto& nonOwned, const auto& excluded)
+			{
+				return m_componentManager->getGroup<Owned...>(nonOwned, excluded);
+			}
+
             /**
             * @brief Sets the signature for a system, defining which entities it will process.
             *
@@ -580,19 +688,6 @@ namespace nexo::ecs {
                 return signature.test(componentType);
             }
 
-            template<typename T>
-            void setRestoreComponent() {
-                m_restoreComponentFunctions[typeid(T)] = [](const std::any&) -> std::any {
-                    return std::any(T{});
-                };
-            }
-
-
-            bool supportsMementoPattern(const std::any& component) const;
-            std::any saveComponent(const std::any& component) const;
-            std::any restoreComponent(const std::any& memento, const std::type_index& componentType) const;
-            void addComponentAny(Entity entity, const std::type_index& typeIndex, const std::any& component);
-
             Entity duplicateEntity(Entity sourceEntity) const;
 
             /**
@@ -624,6 +719,19 @@ namespace nexo::ecs {
 
         void updateSystemEntities() const;
 
+            /**
+             * @brief Records that the parenting of this world's entities changed.
+             *
+             * Parenting lives inside components rather than in the signatures, so the code
+             * editing it reports the change here for the hierarchy views to rebuild.
+             */
+            void markHierarchyChanged() { ++m_hierarchyRevision; }
+
+            /**
+             * @brief Returns a counter increased by each markHierarchyChanged call on this world.
+             */
+            [[nodiscard]] uint64_t getHierarchyRevision() const { return m_hierarchyRevision; }
+
         private:
             template<typename Component>
             void processComponentSignature(Signature& required, Signature& excluded) const {
@@ -637,18 +745,15 @@ namespace nexo::ecs {
                 }
             }
 
+            std::thread::id m_ownerThread{};
+            uint64_t m_hierarchyRevision = 0;
+
             std::shared_ptr<ComponentManager> m_componentManager;
             std::shared_ptr<EntityManager> m_entityManager;
             std::shared_ptr<SystemManager> m_systemManager;
             std::shared_ptr<SingletonComponentManager> m_singletonComponentManager;
 
-            std::unordered_map<ComponentType, std::type_index> m_typeIDtoTypeIndex;
-            std::unordered_map<std::type_index, bool> m_supportsMementoPattern;
-            std::unordered_map<std::type_index, std::function<std::any(const std::any&)>> m_saveComponentFunctions;
-            std::unordered_map<std::type_index, std::function<std::any(const std::any&)>> m_restoreComponentFunctions;
-            std::unordered_map<std::type_index, std::function<void(Entity, const std::any&)>> m_addComponentFunctions;
-            std::unordered_map<std::type_index, std::function<std::any(Entity)>> m_getComponentFunctions;
-            std::unordered_map<std::type_index, std::function<std::any(Entity)>> m_getComponentPointers;
+            std::array<const ComponentVTable *, MAX_COMPONENT_TYPE> m_componentVTables{};
 
             std::unordered_map<ComponentType, std::shared_ptr<ComponentDescription>> m_componentDescriptions;
     };
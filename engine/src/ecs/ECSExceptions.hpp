@@ -39,6 +39,13 @@ namespace nexo::ecs {
                 : Exception(std::format("Component not found for: {}", entity), loc) {}
     };
 
+    class DuplicateEntity final : public Exception {
+        public:
+            explicit DuplicateEntity(const Entity entity,
+                                     const std::source_location loc = std::source_location::current())
+                : Exception(std::format("Entity {} appears several times in the same batch", entity), loc) {}
+    };
+
     class OverlappingGroupsException final : public Exception {
         public:
             explicit OverlappingGroupsException(const std::string& existingGroup,
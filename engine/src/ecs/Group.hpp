@@ -50,6 +50,40 @@ namespace nexo::ecs {
 		     * @return const Signature& Combined signature.
 		     */
 		    [[nodiscard]] virtual const Signature& allSignature() const = 0;
+		    /**
+		     * @brief Returns the signature of the components owned by the group.
+		     *
+		     * @return const Signature& Owned signature.
+		     */
+		    [[nodiscard]] virtual const Signature& ownedSignature() const = 0;
+		    /**
+		     * @brief Returns the signature of the components an entity must not have to be in the group.
+		     *
+		     * @return const Signature& Excluded signature.
+		     */
+		    [[nodiscard]] virtual const Signature& excludedSignature() const = 0;
+		    /**
+		     * @brief Checks whether an entity with the given signature belongs to the group.
+		     *
+		     * @param signature Signature of the entity.
+		     * @return true If all the group components are present and none of the excluded ones.
+		     */
+		    [[nodiscard]] bool matches(const Signature& signature) const
+		    {
+		        return (signature & allSignature()) == allSignature() && (signature & excludedSignature()).none();
+		    }
+		    /**
+		     * @brief Flags the group as containing a more restrictive group that owns some of its components.
+		     *
+		     * The nested group lives in a prefix of this group's region, so this group can no longer be reordered.
+		     */
+		    void markAsNesting() { m_nesting = true; }
+		    /**
+		     * @brief Checks if a more restrictive group is nested in this one.
+		     *
+		     * @return true If the group can not be sorted nor partitioned.
+		     */
+		    [[nodiscard]] bool isNesting() const { return m_nesting; }
 		    /**
 		     * @brief Adds an entity to the group.
 		     *
@@ -62,6 +96,9 @@ namespace nexo::ecs {
 		     * @param e Entity to remove.
 		     */
 		    virtual void removeFromGroup(Entity e) = 0;
+
+		private:
+		    bool m_nesting = false;
 	};
 
 	/**
@@ -141,6 +178,12 @@ namespace nexo::ecs {
 	 *   - OwnedTuple: std::tuple<Owned...>
 	 *   - NonOwnedTuple: std::tuple<NonOwning...>
 	 *
+	 * Entities owning one of the excluded components are kept out of the group.
+	 *
+	 * The group tracks the size of its region in the owned arrays itself, so several groups can
+	 * own the same component as long as they are nested: the region of the most restrictive one
+	 * is then a prefix of the region of the others.
+	 *
 	 * @tparam OwnedTuple Tuple of pointers (or smart pointers) to owned component arrays.
 	 * @tparam NonOwnedTuple Tuple of pointers to non‑owned component arrays.
 	 */
@@ -153,14 +196,16 @@ namespace nexo::ecs {
 			 * @tparam NonOwning Variadic template parameters for non‑owned components.
 			 * @param ownedArrays Tuple of pointers to owned component arrays.
 			 * @param nonOwnedArrays Tuple of pointers to non‑owned component arrays.
+			 * @param excludedSignature Components that entities of the group must not have.
 			 *
 			 * The constructor computes the owned and non‑owned signatures and their combination.
 			 */
 			template<typename... NonOwning>
 	            requires (std::tuple_size_v<OwnedTuple> > 0) // Ensure at least one owned component for Group
-			Group(OwnedTuple ownedArrays, NonOwnedTuple nonOwnedArrays)
+			Group(OwnedTuple ownedArrays, NonOwnedTuple nonOwnedArrays, const Signature excludedSignature = {})
 			    : m_ownedArrays(std::move(ownedArrays))
 			    , m_nonOwnedArrays(std::move(nonOwnedArrays))
+			    , m_excludedSignature(excludedSignature)
 			{
 				m_ownedSignature = std::apply([]([[maybe_unused]] auto&&... arrays) {
 				    Signature signature;
@@ -188,11 +233,7 @@ namespace nexo::ecs {
 			 */
 			[[nodiscard]] std::size_t size() const
 			{
-			    auto firstArray = std::get<0>(m_ownedArrays);
-			    if (!firstArray) {
-			        THROW_EXCEPTION(InternalError, "Component array is null");
-			    }
-			    return firstArray->groupSize();
+			    return m_size;
 			}
 
 		    /**
@@ -208,7 +249,14 @@ namespace nexo::ecs {
 		     *
 		     * @return const Signature& Owned signature.
 		     */
-		    [[nodiscard]] const Signature& ownedSignature() const { return m_ownedSignature; }
+		    [[nodiscard]] const Signature& ownedSignature() const override { return m_ownedSignature; }
+
+		    /**
+		     * @brief Returns the signature of the excluded components.
+		     *
+		     * @return const Signature& Excluded signature.
+		     */
+		    [[nodiscard]] const Signature& excludedSignature() const override { return m_excludedSignature; }
 
 		    /**
 		     * @brief Returns the overall signature for both owned and non‑owned components.
@@ -337,7 +385,7 @@ namespace nexo::ecs {
 				if (!firstArray)
 					THROW_EXCEPTION(InternalError, "Component array is null");
 
-				for (std::size_t i = 0; i < firstArray->groupSize(); ++i) {
+				for (std::size_t i = 0; i < m_size; ++i) {
 					Entity e = firstArray->getEntityAtIndex(i);
 					callFunc(func, e,
 						std::make_index_sequence<std::tuple_size_v<OwnedTuple>>{},
@@ -360,10 +408,10 @@ namespace nexo::ecs {
 				if (!firstArray)
 					THROW_EXCEPTION(InternalError, "Component array is null");
 
-				if (startIndex >= firstArray->groupSize())
+				if (startIndex >= m_size)
 					return; // Nothing to iterate
 
-				const size_t endIndex = std::min(startIndex + count, firstArray->groupSize());
+				const size_t endIndex = std::min(startIndex + count, m_size);
 
 				for (size_t i = startIndex; i < endIndex; i++) {
 					Entity e = firstArray->getEntityAtIndex(i);
@@ -376,15 +424,17 @@ namespace nexo::ecs {
 		    /**
 		     * @brief Adds an entity to the group.
 		     *
-		     * This method calls addToGroup(e) on every owned component array.
+		     * The entity is swapped to the end of the group region in every owned component array.
 		     *
 		     * @param e Entity to add.
 		     */
 		    void addToGroup(Entity e) override
 		    {
-				std::apply([e](auto&&... arrays) {
-					((arrays->addToGroup(e)), ...);
+				const bool added = std::apply([this, e](auto&&... arrays) {
+					return (false | ... | arrays->swapIntoGroup(e, m_size));
 				}, m_ownedArrays);
+				if (added)
+					++m_size;
 
 				m_sortingInvalidated = true;
 				invalidatePartitions();
@@ -393,15 +443,18 @@ namespace nexo::ecs {
 		    /**
 		     * @brief Removes an entity from the group.
 		     *
-		     * This method calls removeFromGroup(e) on every owned component array.
+		     * The entity is swapped to the last slot of the group region in every owned component array,
+		     * which then shrinks by one.
 		     *
 		     * @param e Entity to remove.
 		     */
 		    void removeFromGroup(Entity e) override
 		    {
-				std::apply([e](auto&&... arrays) {
-					((arrays->removeFromGroup(e)), ...);
+				const bool removed = std::apply([this, e](auto&&... arrays) {
+					return (false | ... | arrays->swapOutOfGroup(e, m_size));
 				}, m_ownedArrays);
+				if (removed)
+					--m_size;
 
 				m_sortingInvalidated = true;
 				invalidatePartitions();
@@ -418,7 +471,7 @@ namespace nexo::ecs {
 			[[nodiscard]] std::span<const Entity> entities() const
 			{
 				const std::span<const Entity> entities = std::get<0>(m_ownedArrays)->entities();
-				return entities.subspan(0, std::get<0>(m_ownedArrays)->groupSize());
+				return entities.subspan(0, m_size);
 			}
 
 			/**
@@ -437,7 +490,7 @@ namespace nexo::ecs {
 					if (!compArray)
 						THROW_EXCEPTION(InternalError, "Component array is null");
 
-					return compArray->getAllComponents().subspan(0, compArray->groupSize());
+					return compArray->getAllComponents().subspan(0, m_size);
 				} else if constexpr (tuple_contains_component_v<T, NonOwnedTuple>)
 					return getNonOwnedImpl<T>();         // internal lookup in non‑owned tuple
 				else
@@ -460,7 +513,7 @@ namespace nexo::ecs {
 					if (!compArray)
 						THROW_EXCEPTION(InternalError, "Component array is null");
 
-					return compArray->getAllComponents().subspan(0, compArray->groupSize());
+					return compArray->getAllComponents().subspan(0, m_size);
 				} else if constexpr (tuple_contains_component_v<T, NonOwnedTuple>)
 					return getNonOwnedImpl<T>();         // internal lookup in non‑owned tuple
 				else
@@ -519,7 +572,7 @@ namespace nexo::ecs {
 					THROW_EXCEPTION(InternalError, "Component array is null");
 
 			    auto drivingArray = std::get<0>(m_ownedArrays);
-			    const size_t groupSize = drivingArray->groupSize();
+			    const size_t groupSize = m_size;
 
 			    std::vector<Entity> entities;
 			    entities.reserve(groupSize);
@@ -760,7 +813,7 @@ namespace nexo::ecs {
 						if (!m_isDirty)
 							return;
 						auto drivingArray = std::get<0>(m_group->m_ownedArrays);
-						const size_t groupSize = drivingArray->groupSize();
+						const size_t groupSize = m_group->size();
 
 						// Skip if no entities
 						if (groupSize == 0) {
@@ -822,9 +875,12 @@ namespace nexo::ecs {
 			* @brief Reorders the group entities based on a new order.
 			*
 			* @param newOrder New order of entities.
+			* @throws InternalError if a more restrictive group is nested in this one.
 			*/
 			void reorderGroup(const std::vector<Entity>& newOrder)
 			{
+				if (isNesting())
+					THROW_EXCEPTION(InternalError, "Cannot reorder a group containing a nested group, only the most restrictive group of a family can be sorted");
 				std::apply([&](auto&&... arrays) {
 					((reorderArray(arrays, newOrder)), ...);
 				}, m_ownedArrays);
@@ -840,7 +896,7 @@ namespace nexo::ecs {
 			template<typename ArrayPtr>
 			void reorderArray(ArrayPtr array, const std::vector<Entity>& newOrder) const
 			{
-				size_t groupSize = array->groupSize();
+				const size_t groupSize = m_size;
 				if (newOrder.size() != groupSize)
 					THROW_EXCEPTION(InternalError, "New order size doesn't match group size");
 
@@ -949,6 +1005,8 @@ namespace nexo::ecs {
 		    NonOwnedTuple m_nonOwnedArrays;  ///< Tuple of pointers to non‑owned component arrays.
 		    Signature      m_ownedSignature{}; ///< Signature for owned components.
 		    Signature      m_allSignature{};   ///< Combined signature for all components.
+		    Signature      m_excludedSignature{}; ///< Signature of the excluded components.
+		    std::size_t    m_size = 0;         ///< Size of the group region in the owned arrays.
 			bool m_sortingInvalidated = true;    ///< Flag indicating if sorting is invalidated.
 			SortingOrder m_sortingOrder = SortingOrder::ASCENDING;
    			std::unordered_map<std::string, std::unique_ptr<IPartitionStorage>> m_partitionStorageMap; ///< Map storing partition data by ID.
@@ -35,7 +35,8 @@ namespace nexo::ecs {
      * @brief System that uses component groups for optimized access with enforced permissions
      *
      * @tparam OwnedAccess Owned<> wrapper with component access types
-     * @tparam NonOwnedAccess NonOwned<> wrapper with component access types
+     * @tparam NonOwnedAccess NonOwned<> wrapper with component access types, Exclude<T> entries filter out
+     *                        the entities owning T from the group
      * @tparam SingletonAccessTypes Singleton component access types (ReadSingleton<T> or WriteSingleton<T>)
      */
     template<typename OwnedAccess, typename NonOwnedAccess = NonOwned<>, typename... SingletonAccessTypes>
@@ -46,6 +47,7 @@ namespace nexo::ecs {
 			// Extract component access types
 			using OwnedAccessTypes = typename OwnedAccess::ComponentTypes;
 			using NonOwnedAccessTypes = typename NonOwnedAccess::ComponentTypes;
+			using ExcludedTypes = typename NonOwnedAccess::ExcludedTypes;
 
 			// Extract raw component types for group creation
 			template<typename... T>
@@ -59,20 +61,6 @@ namespace nexo::ecs {
 			using OwnedTypes = typename GetComponentTypes<OwnedAccessTypes>::Types;
 			using NonOwnedTypes = typename GetComponentTypes<NonOwnedAccessTypes>::Types;
 
-			// Helper to unpack tuple types to parameter pack
-			template<typename Tuple, std::size_t... I>
-			auto tupleToTypeList(std::index_sequence<I...>)
-			{
-				return std::tuple<std::tuple_element_t<I, Tuple>...>{};
-			}
-
-			// Function to create a type list from a tuple type
-			template<typename Tuple>
-			auto tupleToTypeList()
-			{
-				return tupleToTypeList<Tuple>(std::make_index_sequence<std::tuple_size_v<Tuple>>{});
-			}
-
 			// Type aliases for the actual group
 			template<typename... T>
 			using ComponentArraysTuple = std::tuple<std::shared_ptr<ComponentArray<T>>...>;
@@ -235,8 +223,9 @@ namespace nexo::ecs {
 					THROW_EXCEPTION(InternalError, "Coordinator is null in GroupSystem constructor");
 
 				m_group = createGroupImpl(
-					tupleToTypeList<OwnedTypes>(),
-					tupleToTypeList<NonOwnedTypes>()
+					std::type_identity<OwnedTypes>{},
+					std::type_identity<NonOwnedTypes>{},
+					std::type_identity<ExcludedTypes>{}
 				);
 
 				this->initializeSingletonComponents();
@@ -318,23 +307,19 @@ namespace nexo::ecs {
 			*
 			* @tparam OT Owned component types
 			* @tparam NOT Non-owned component types
+			* @tparam EX Excluded component types
 			* @return Shared pointer to the created group
 			*/
-			template<typename... OT, typename... NOT>
-			std::shared_ptr<ActualGroupType> createGroupImpl(std::tuple<OT...>, std::tuple<NOT...>)
+			template<typename... OT, typename... NOT, typename... EX>
+			std::shared_ptr<ActualGroupType> createGroupImpl(std::type_identity<std::tuple<OT...>>,
+			                                                 std::type_identity<std::tuple<NOT...>>,
+			                                                 std::type_identity<std::tuple<EX...>>)
 			{
 				if constexpr (sizeof...(OT) > 0) {
-					if constexpr (sizeof...(NOT) > 0) {
-						auto group = coord->registerGroup<OT...>(nexo::ecs::get<NOT...>());
-						if (!group)
-							THROW_EXCEPTION(InternalError, "Group is null in GroupSystem");
-						return std::static_pointer_cast<ActualGroupType>(group);
-					} else {
-						auto group = coord->registerGroup<OT...>(nexo::ecs::get<>());
-						if (!group)
-							THROW_EXCEPTION(InternalError, "Group is null in GroupSystem");
-						return std::static_pointer_cast<ActualGroupType>(group);
-					}
+					auto group = coord->registerGroup<OT...>(nexo::ecs::get<NOT...>(), nexo::ecs::exclude<EX...>());
+					if (!group)
+						THROW_EXCEPTION(InternalError, "Group is null in GroupSystem");
+					return std::static_pointer_cast<ActualGroupType>(group);
 				}
 				return nullptr;
 			}
@@ -17,11 +17,18 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "System.hpp"
+#include "CachedQuery.hpp"
 
 #include <ranges>
 
 namespace nexo::ecs {
 
+    std::shared_ptr<Coordinator> &System::currentWorld()
+    {
+        thread_local std::shared_ptr<Coordinator> world = nullptr;
+        return world;
+    }
+
     void SparseSet::insert(Entity entity)
     {
         if (contains(entity))
@@ -52,12 +59,34 @@ namespace nexo::ecs {
         sparse.erase(entity);
     }
 
-    void SystemManager::entityDestroyed(const Entity entity, const Signature signature) const
+    void SystemManager::registerCachedQuery(const std::shared_ptr<CachedQuery> &query)
+    {
+        m_cachedQueries.emplace_back(query);
+    }
+
+    template<typename Func>
+    void SystemManager::forEachCachedQuery(Func &&func)
+    {
+        bool hasExpired = false;
+        for (const auto &weakQuery : m_cachedQueries) {
+            if (const auto query = weakQuery.lock())
+                func(*query);
+            else
+                hasExpired = true;
+        }
+        if (hasExpired)
+            std::erase_if(m_cachedQueries, [](const auto &weakQuery) { return weakQuery.expired(); });
+    }
+
+    void SystemManager::entityDestroyed(const Entity entity, const Signature signature)
     {
         for (const auto& system : std::ranges::views::values(m_querySystems)) {
             if (const Signature &systemSignature = system->getSignature(); (signature & systemSignature) == systemSignature)
                 system->entities.erase(entity);
         }
+        forEachCachedQuery([&](CachedQuery &query) {
+            query.entityDestroyed(entity, signature);
+        });
     }
 
     void SystemManager::entitySignatureChanged(const Entity entity,
@@ -77,5 +106,8 @@ namespace nexo::ecs {
                 system->entities.erase(entity);
             }
         }
+        forEachCachedQuery([&](CachedQuery &query) {
+            query.entitySignatureChanged(entity, oldSignature, newSignature);
+        });
     }
 }
@@ -21,6 +21,8 @@
 #include <unordered_map>
 #include <typeindex>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "Definitions.hpp"
 #include "Logger.hpp"
@@ -28,6 +30,7 @@
 
 namespace nexo::ecs {
     class Coordinator;
+    class CachedQuery;
 }
 
 namespace nexo::ecs {
@@ -64,6 +67,11 @@ namespace nexo::ecs {
 	         */
 	        bool empty() const { return dense.empty(); }
 
+	        /**
+	         * @brief Remove every entity from the set
+	         */
+	        void clear() { dense.clear(); sparse.clear(); }
+
 	        /**
 	         * @brief Check if an entity exists in the set
 	         *
@@ -122,11 +130,49 @@ namespace nexo::ecs {
     */
     class System {
         public:
+            /**
+             * @brief Binds the system to the current world of the calling thread
+             */
+            System() : coord(currentWorld()) {}
             virtual ~System() = default;
+
             /**
-             * @brief Global coordinator instance shared by all systems
+             * @brief Coordinator of the world this system belongs to
+             *
+             * Captured when the system is constructed, so a system keeps working on its own world
+             * whatever the world bound to the thread updating it.
              */
-            static std::shared_ptr<Coordinator> coord;
+            std::shared_ptr<Coordinator> coord;
+
+            /**
+             * @brief World new systems constructed on the calling thread are bound to
+             *
+             * Each thread has its own current world, so worlds can be built concurrently.
+             * Coordinator::init binds the initialized world to the calling thread.
+             *
+             * @return Reference to the thread's current world, may be null
+             */
+            static std::shared_ptr<Coordinator> &currentWorld();
+    };
+
+    /**
+     * @class WorldScope
+     * @brief RAII helper making a world the current world of the calling thread
+     *
+     * The previously current world is restored when the scope ends.
+     */
+    class WorldScope {
+        public:
+            explicit WorldScope(std::shared_ptr<Coordinator> world)
+                : m_previous(std::exchange(System::currentWorld(), std::move(world))) {}
+
+            ~WorldScope() { System::currentWorld() = std::move(m_previous); }
+
+            WorldScope(const WorldScope &) = delete;
+            WorldScope &operator=(const WorldScope &) = delete;
+
+        private:
+            std::shared_ptr<Coordinator> m_previous;
     };
 
     /**
@@ -212,6 +258,16 @@ namespace nexo::ecs {
                 return system;
             }
 
+            /**
+             * @brief Registers a cached query so it gets notified of entity signature changes
+             *
+             * The manager only keeps a weak reference, the query stops being updated once its
+             * last owner releases it.
+             *
+             * @param query The query to keep up to date
+             */
+            void registerCachedQuery(const std::shared_ptr<CachedQuery> &query);
+
             /**
             * @brief Sets the signature for a system.
             *
@@ -233,7 +289,7 @@ namespace nexo::ecs {
             * @param entity - The ID of the destroyed entity.
             * @param signature - The signature of the entity.
             */
-            void entityDestroyed(Entity entity, Signature signature) const;
+            void entityDestroyed(Entity entity, Signature signature);
 
             /**
             * @brief Updates the systems with an entity when its signature changes.
@@ -259,5 +315,13 @@ namespace nexo::ecs {
 	         * @brief Map of group system type to system instance
 	         */
 	        std::unordered_map<std::type_index, std::shared_ptr<AGroupSystem>> m_groupSystems{};
+
+	        /**
+	         * @brief Cached queries notified on signature changes, expired ones are pruned lazily
+	         */
+	        std::vector<std::weak_ptr<CachedQuery>> m_cachedQueries{};
+
+	        template<typename Func>
+	        void forEachCachedQuery(Func &&func);
     };
 }
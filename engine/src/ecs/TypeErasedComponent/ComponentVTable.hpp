@@ -0,0 +1,291 @@
+//// ComponentVTable.hpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the static per-type component vtable, used to
+//               copy, move, destroy and snapshot components without boxing them
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <memory>
+#include <typeinfo>
+#include <type_traits>
+#include <utility>
+
+namespace nexo::ecs {
+
+    // Check if T has a nested Memento type
+    template<typename T, typename = void>
+    struct has_memento_type : std::false_type {};
+
+    template<typename T>
+    struct has_memento_type<T, std::void_t<typename T::Memento>> : std::true_type {};
+
+    // Check if T has a save() method that returns Memento
+    template<typename T, typename = void>
+    struct has_save_method : std::false_type {};
+
+    template<typename T>
+    struct has_save_method<T,
+        std::void_t<decltype(std::declval<const T&>().save())>>
+        : std::is_same<decltype(std::declval<const T&>().save()), typename T::Memento> {};
+
+    // Check if T::Memento has a restore() method that returns T
+    template<typename T, typename = void>
+    struct has_restore_method : std::false_type {};
+
+    template<typename T>
+    struct has_restore_method<T,
+        std::void_t<decltype(std::declval<T&>().restore(std::declval<const typename T::Memento&>()))>>
+        : std::is_same<decltype(std::declval<T&>().restore(std::declval<const typename T::Memento&>())), void> {};
+
+    // Combined check for full memento pattern support
+    template<typename T>
+    struct supports_memento_pattern :
+        std::conjunction<
+            has_memento_type<T>,
+            has_save_method<T>,
+            has_restore_method<T>
+        > {};
+
+    template<typename T>
+    inline constexpr bool has_memento_type_v = has_memento_type<T>::value;
+
+    template<typename T>
+    inline constexpr bool has_save_method_v = has_save_method<T>::value;
+
+    template<typename T>
+    inline constexpr bool has_restore_method_v = has_restore_method<T>::value;
+
+    template<typename T>
+    inline constexpr bool supports_memento_pattern_v = supports_memento_pattern<T>::value;
+
+
+    /**
+     * @struct ComponentVTable
+     * @brief Static table of lifecycle operations for a component type.
+     *
+     * One instance exists per registered component type. It lets editor and serialization code
+     * copy, move, destroy and snapshot components through raw pointers, without knowing the type
+     * at compile time and without boxing the component into a heap allocated wrapper.
+     *
+     * All construction functions expect uninitialized, suitably aligned storage as destination.
+     */
+    struct ComponentVTable {
+        const std::type_info *typeInfo = nullptr;  ///< RTTI of the component type
+        std::size_t size = 0;                      ///< sizeof(T)
+        std::size_t align = 0;                     ///< alignof(T)
+
+        void (*copyConstruct)(void *dst, const void *src) = nullptr;  ///< Placement copy-construct a T
+        void (*moveConstruct)(void *dst, void *src) = nullptr;        ///< Placement move-construct a T
+        void (*destroy)(void *component) = nullptr;                   ///< Call the destructor of a T
+
+        std::size_t mementoSize = 0;   ///< sizeof(T::Memento), 0 if the memento pattern is not supported
+        std::size_t mementoAlign = 0;  ///< alignof(T::Memento)
+
+        void (*saveMemento)(void *mementoDst, const void *component) = nullptr;    ///< Placement-construct T::Memento from a T
+        void (*restoreMemento)(void *componentDst, const void *memento) = nullptr; ///< Placement-construct a T restored from a memento
+        void (*moveMemento)(void *dst, void *src) = nullptr;                       ///< Placement move-construct a T::Memento
+        void (*destroyMemento)(void *memento) = nullptr;                           ///< Call the destructor of a T::Memento
+
+        [[nodiscard]] bool supportsMemento() const noexcept { return saveMemento != nullptr; }
+    };
+
+    namespace detail {
+        template<typename T>
+        consteval ComponentVTable makeComponentVTable()
+        {
+            ComponentVTable vtable{};
+            vtable.size = sizeof(T);
+            vtable.align = alignof(T);
+            vtable.copyConstruct = [](void *dst, const void *src) {
+                ::new (dst) T(*static_cast<const T *>(src));
+            };
+            vtable.moveConstruct = [](void *dst, void *src) {
+                ::new (dst) T(std::move(*static_cast<T *>(src)));
+            };
+            vtable.destroy = [](void *component) {
+                std::destroy_at(static_cast<T *>(component));
+            };
+
+            if constexpr (supports_memento_pattern_v<T>) {
+                using Memento = typename T::Memento;
+                vtable.mementoSize = sizeof(Memento);
+                vtable.mementoAlign = alignof(Memento);
+                vtable.saveMemento = [](void *mementoDst, const void *component) {
+                    ::new (mementoDst) Memento(static_cast<const T *>(component)->save());
+                };
+                vtable.restoreMemento = [](void *componentDst, const void *memento) {
+                    T *component = ::new (componentDst) T{};
+                    component->restore(*static_cast<const Memento *>(memento));
+                };
+                vtable.moveMemento = [](void *dst, void *src) {
+                    ::new (dst) Memento(std::move(*static_cast<Memento *>(src)));
+                };
+                vtable.destroyMemento = [](void *memento) {
+                    std::destroy_at(static_cast<Memento *>(memento));
+                };
+            }
+            return vtable;
+        }
+
+        template<typename T>
+        inline const ComponentVTable componentVTable = [] {
+            ComponentVTable vtable = makeComponentVTable<T>();
+            vtable.typeInfo = &typeid(T);
+            return vtable;
+        }();
+    }
+
+    /**
+     * @brief Returns the static vtable of a component type.
+     *
+     * @tparam T The component type
+     * @return A reference to the vtable, valid for the whole program lifetime
+     */
+    template<typename T>
+    const ComponentVTable &getComponentVTable()
+    {
+        return detail::componentVTable<std::remove_cvref_t<T>>;
+    }
+
+    /**
+     * @class ComponentMemento
+     * @brief Owning, type-erased snapshot of a component's memento.
+     *
+     * Mementos up to InlineCapacity bytes are stored inline, so taking a snapshot of most
+     * components (e.g. for undo/redo) does not touch the heap beyond what the memento itself owns.
+     */
+    class ComponentMemento {
+        public:
+            static constexpr std::size_t InlineCapacity = 256;
+
+            ComponentMemento() = default;
+
+            /**
+             * @brief Saves the memento of a component
+             *
+             * @param vtable The vtable of the component type, must support the memento pattern
+             * @param component Pointer to a valid component of the vtable's type
+             */
+            ComponentMemento(const ComponentVTable &vtable, const void *component) : m_vtable(&vtable)
+            {
+                if (fitsInline()) {
+                    vtable.saveMemento(m_inline, component);
+                    return;
+                }
+                // The buffer is only handed to the memento once saved, a throwing save releases it
+                const std::align_val_t align{vtable.mementoAlign};
+                auto release = [align](void *ptr) { ::operator delete[](ptr, align); };
+                std::unique_ptr<void, decltype(release)> heap(::operator new[](vtable.mementoSize, align), release);
+                vtable.saveMemento(heap.get(), component);
+                m_heap = heap.release();
+            }
+
+            ~ComponentMemento() { reset(); }
+
+            ComponentMemento(const ComponentMemento &) = delete;
+            ComponentMemento &operator=(const ComponentMemento &) = delete;
+
+            ComponentMemento(ComponentMemento &&other) noexcept { moveFrom(other); }
+
+            ComponentMemento &operator=(ComponentMemento &&other) noexcept
+            {
+                if (this != &other) {
+                    reset();
+                    moveFrom(other);
+                }
+                return *this;
+            }
+
+            [[nodiscard]] bool empty() const noexcept { return m_vtable == nullptr; }
+            [[nodiscard]] const ComponentVTable *vtable() const noexcept { return m_vtable; }
+
+            /**
+             * @brief Restores the saved memento into a temporary component and hands it to func
+             *
+             * The temporary component is destroyed once func returns.
+             *
+             * @param func Callable taking a (const void *component)
+             */
+            template<typename Func>
+            void restore(Func &&func) const
+            {
+                if (empty())
+                    return;
+                alignas(std::max_align_t) std::byte local[InlineCapacity];
+                const std::align_val_t align{m_vtable->align};
+                auto release = [align](void *ptr) { ::operator delete[](ptr, align); };
+                std::unique_ptr<void, decltype(release)> heap(nullptr, release);
+                void *storage = local;
+                if (m_vtable->size > InlineCapacity || m_vtable->align > alignof(std::max_align_t)) {
+                    heap.reset(::operator new[](m_vtable->size, align));
+                    storage = heap.get();
+                }
+                m_vtable->restoreMemento(storage, data());
+                // Declared after the storage so the component is destroyed before it is released
+                struct Guard {
+                    const ComponentVTable *vtable;
+                    void *component;
+                    ~Guard() { vtable->destroy(component); }
+                } guard{m_vtable, storage};
+                func(static_cast<const void *>(storage));
+            }
+
+            void reset() noexcept
+            {
+                if (!m_vtable)
+                    return;
+                m_vtable->destroyMemento(data());
+                if (m_heap)
+                    ::operator delete[](m_heap, std::align_val_t{m_vtable->mementoAlign});
+                m_heap = nullptr;
+                m_vtable = nullptr;
+            }
+
+        private:
+            const ComponentVTable *m_vtable = nullptr;
+            alignas(std::max_align_t) std::byte m_inline[InlineCapacity]{};
+            void *m_heap = nullptr;
+
+            [[nodiscard]] bool fitsInline() const noexcept
+            {
+                return m_vtable->mementoSize <= InlineCapacity && m_vtable->mementoAlign <= alignof(std::max_align_t);
+            }
+
+            [[nodiscard]] void *data() noexcept { return m_heap ? m_heap : static_cast<void *>(m_inline); }
+            [[nodiscard]] const void *data() const noexcept { return m_heap ? m_heap : static_cast<const void *>(m_inline); }
+
+            void moveFrom(ComponentMemento &other) noexcept
+            {
+                m_vtable = other.m_vtable;
+                if (!m_vtable)
+                    return;
+                if (other.m_heap) {
+                    // Heap storage is stolen as is
+                    m_heap = std::exchange(other.m_heap, nullptr);
+                } else {
+                    m_vtable->moveMemento(m_inline, other.m_inline);
+                    m_vtable->destroyMemento(other.m_inline);
+                }
+                other.m_vtable = nullptr;
+            }
+    };
+
+} // namespace nexo::ecs
@@ -22,7 +22,6 @@
 #include "RenderCommand.hpp"
 #include "renderPasses/Masks.hpp"
 #include "renderer/RenderPipeline.hpp"
-#include "renderer/Renderer3D.hpp"
 #include "Passes.hpp"
 
 #include <glad/glad.h>
@@ -40,12 +39,7 @@ namespace nexo::renderer {
        	NxRenderCommand::setClearColor(pipeline.getCameraClearColor());
        	NxRenderCommand::clear();
         renderTarget->clearAttachment<int>(1, -1);
-        NxRenderer3D::get().bindTextures();
-        const std::vector<DrawCommand> &drawCommands = pipeline.getDrawCommands();
-        for (const auto &cmd : drawCommands) {
-            if (cmd.filterMask & F_FORWARD_PASS)
-                cmd.execute();
-        }
+        pipeline.executeDrawCommands(F_FORWARD_PASS);
         renderTarget->unbind();
     }
 }
@@ -43,12 +43,7 @@ namespace nexo::renderer {
         glDrawBuffers(1, singleDrawBuffer);
         renderer::NxRenderCommand::setDepthMask(false);
         renderer::NxRenderCommand::setCulling(false);
-        const auto &drawCommands = pipeline.getDrawCommands();
-        for (const auto &cmd : drawCommands) {
-            if (cmd.filterMask & F_GRID_PASS) {
-                cmd.execute();
-            }
-        }
+        pipeline.executeDrawCommands(F_GRID_PASS);
         renderer::NxRenderCommand::setDepthMask(true);
         renderer::NxRenderCommand::setCulling(true);
         renderer::NxRenderCommand::setCulledFace(CulledFace::BACK);
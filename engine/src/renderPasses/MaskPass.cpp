@@ -17,51 +17,32 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "MaskPass.hpp"
-#include <memory>
+#include <bit>
 #include "DrawCommand.hpp"
 #include "Framebuffer.hpp"
 #include "renderer/RenderPipeline.hpp"
 #include "renderer/RenderCommand.hpp"
-#include "renderer/Renderer3D.hpp"
 #include "Masks.hpp"
 #include "Passes.hpp"
 
 namespace nexo::renderer {
-    MaskPass::MaskPass(unsigned int width, unsigned int height) : RenderPass(Passes::MASK, "Mask pass")
+    MaskPass::MaskPass() : RenderPass(Passes::MASK, "Mask pass")
     {
-        renderer::NxFramebufferSpecs maskFramebufferSpecs;
-        maskFramebufferSpecs.attachments = { renderer::NxFrameBufferTextureFormats::RGBA8, renderer::NxFrameBufferTextureFormats::DEPTH24STENCIL8 };
-        maskFramebufferSpecs.width = width;  // Default size, will be resized as needed
-        maskFramebufferSpecs.height = height;
-        m_mask = renderer::NxFramebuffer::create(maskFramebufferSpecs);
+        writesTransient(OUTPUT, { NxFrameBufferTextureFormats::RGBA8, NxFrameBufferTextureFormats::DEPTH24STENCIL8 });
     }
 
     void MaskPass::execute(RenderPipeline& pipeline)
     {
-        m_mask->bind();
+        const auto mask = pipeline.getTransient(OUTPUT);
+        mask->bind();
         renderer::NxRenderCommand::setClearColor({0.0f, 0.0f, 0.0f, 0.0f});
         renderer::NxRenderCommand::clear();
-
-        //IMPORTANT: Bind textures after binding the framebuffer, since binding can trigger a resize and invalidate the
-        // current texture slots
-        renderer::NxRenderer3D::get().bindTextures();
-        const std::vector<DrawCommand> &drawCommands = pipeline.getDrawCommands();
-        for (const auto &cmd : drawCommands) {
-            if (cmd.filterMask & F_OUTLINE_MASK)
-                cmd.execute();
-        }
-        m_mask->unbind();
-    }
-
-    void MaskPass::resize(unsigned int width, unsigned int height)
-    {
-        if (!m_mask)
-            return;
-        m_mask->resize(width, height);
+        pipeline.executeDrawCommands(F_OUTLINE_MASK);
+        mask->unbind();
     }
 
-    std::shared_ptr<renderer::NxFramebuffer> MaskPass::getOutput() const
+    bool MaskPass::isActive(const RenderPipeline& pipeline) const
     {
-        return m_mask;
+        return !pipeline.getSortedDrawCommands(std::countr_zero(F_OUTLINE_MASK)).empty();
     }
 }
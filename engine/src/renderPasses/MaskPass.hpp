@@ -24,13 +24,14 @@ namespace nexo::renderer {
 
     class MaskPass : public RenderPass {
         public:
-            MaskPass(unsigned int width, unsigned int height);
+            // Transient holding the mask, sized like the render target
+            static constexpr auto OUTPUT = "Outline mask";
+
+            MaskPass();
             ~MaskPass() override = default;
 
             void execute(RenderPipeline& pipeline) override;
-            void resize(unsigned int width, unsigned int height) override;
-            std::shared_ptr<NxFramebuffer> getOutput() const override;
-        private:
-            std::shared_ptr<NxFramebuffer> m_mask;
+            // Culled when no entity is drawn into the mask, e.g. nothing is selected
+            [[nodiscard]] bool isActive(const RenderPipeline& pipeline) const override;
     };
 }
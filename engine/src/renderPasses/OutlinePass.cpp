@@ -31,18 +31,13 @@
 namespace nexo::renderer {
     OutlinePass::OutlinePass() : RenderPass(Passes::OUTLINE, "Outline pass")
     {
-
+        readsTransient(MaskPass::OUTPUT);
     }
 
     void OutlinePass::execute(RenderPipeline& pipeline)
     {
         const auto renderTarget = pipeline.getRenderTarget();
-        std::shared_ptr<NxFramebuffer> maskPass = nullptr;
-        for (auto prereq : prerequisites) {
-            auto p = pipeline.getRenderPass(prereq);
-            if (p->getId() == Passes::MASK)
-                maskPass = p->getOutput();
-        }
+        const auto maskPass = pipeline.getTransient(MaskPass::OUTPUT);
         if (!renderTarget || !maskPass)
             return;
 
@@ -56,11 +51,7 @@ namespace nexo::renderer {
         renderTarget->bindDepthAsTexture(1);   // bound to unit 1
         maskPass->bindDepthAsTexture(2);       // bound to unit 2
 
-        const auto& drawCommands = pipeline.getDrawCommands();
-        for (auto const& cmd : drawCommands) {
-            if (cmd.filterMask & F_OUTLINE_PASS)
-                cmd.execute();
-        }
+        pipeline.executeDrawCommands(F_OUTLINE_PASS);
         constexpr GLenum allBuffers[] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
         glDrawBuffers(2, allBuffers);
         renderTarget->unbind();
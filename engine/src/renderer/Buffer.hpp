@@ -279,6 +279,27 @@ namespace nexo::renderer {
              */
             virtual void setData(void *data, size_t size) = 0;
 
+            /**
+             * @brief Uploads data to a part of the vertex buffer, the rest of the buffer is left untouched.
+             *
+             * @param data Pointer to the data to upload.
+             * @param size The size (in bytes) of the data.
+             * @param offset The offset (in bytes) of the destination inside the buffer.
+             */
+            virtual void setSubData(const void *data, size_t size, size_t offset) = 0;
+
+            /**
+             * @brief Copies a range of a vertex buffer into this one on the GPU.
+             *
+             * The source may be this buffer, in which case the ranges must not overlap.
+             *
+             * @param source The buffer to copy from.
+             * @param sourceOffset Offset (in bytes) of the range inside the source.
+             * @param destinationOffset Offset (in bytes) of the destination inside this buffer.
+             * @param size The size (in bytes) of the range.
+             */
+            virtual void copyFrom(const NxVertexBuffer &source, size_t sourceOffset, size_t destinationOffset, size_t size) = 0;
+
             [[nodiscard]] virtual unsigned int getId() const = 0;
     };
 
@@ -339,6 +360,27 @@ namespace nexo::renderer {
              */
             virtual void setData(unsigned int *data, size_t size) = 0;
 
+            /**
+             * @brief Uploads indices to a part of the index buffer, the count of the buffer is left untouched.
+             *
+             * @param data Pointer to the indices to upload.
+             * @param count The number of indices to upload.
+             * @param offset The index at which the upload starts.
+             */
+            virtual void setSubData(const unsigned int *data, size_t count, size_t offset) = 0;
+
+            /**
+             * @brief Copies a range of an index buffer into this one on the GPU.
+             *
+             * The source may be this buffer, in which case the ranges must not overlap.
+             *
+             * @param source The buffer to copy from.
+             * @param sourceOffset First index of the range inside the source.
+             * @param destinationOffset First index of the destination inside this buffer.
+             * @param count The number of indices to copy.
+             */
+            virtual void copyFrom(const NxIndexBuffer &source, size_t sourceOffset, size_t destinationOffset, size_t count) = 0;
+
             /**
              * @brief Retrieves the number of indices in the index buffer.
              *
@@ -19,36 +19,84 @@
 #include "DrawCommand.hpp"
 #include "RenderCommand.hpp"
 
+#include <bit>
+
 namespace nexo::renderer {
-    void DrawCommand::execute() const
+
+    /**
+     * @brief Quantizes a depth on the given number of bits while keeping the ordering.
+     *
+     * Positive IEEE floats compare like their bit patterns, so the top bits of the pattern give a
+     * logarithmic quantization with more precision close to the camera.
+     */
+    static uint64_t quantizeDepth(const float depth, const unsigned int bits)
     {
-        static unsigned int currentShader = 0;
-        static unsigned int currentVAO    = 0;
+        const float clamped = depth > 0.0f ? depth : 0.0f;
+        return std::bit_cast<uint32_t>(clamped) >> (31 - bits);
+    }
 
-        // Bind shader if changed
-        if (shader && currentShader != shader->getProgramId()) {
-            shader->bind();
-            currentShader = shader->getProgramId();
-        }
+    static uint64_t truncate(const uint64_t value, const unsigned int bits)
+    {
+        return value & ((uint64_t{1} << bits) - 1);
+    }
 
-        // Bind VAO for mesh, or use full-screen quad
-        if (type == CommandType::MESH && vao && currentVAO != vao->getId()) {
-            vao->bind();
-            for (const auto &vbo : vao->getVertexBuffers())
-                vbo->bind();
-            currentVAO = vao->getId();
-        } else if (type == CommandType::FULL_SCREEN) {
-            auto quad = getFullscreenQuad();
-            quad->bind();
-            currentVAO = quad->getId();
+    uint64_t DrawCommand::computeSortKey(const unsigned int passIndex, const float viewDepth) const
+    {
+        const uint64_t shaderId = shader ? shader->getProgramId() : 0;
+        const uint64_t vaoId = type == CommandType::MESH && vao ? vao->getId() : 0;
+
+        uint64_t key = (static_cast<uint64_t>(passIndex) & sortkey::PASS_MASK) << sortkey::PASS_SHIFT;
+        if (isOpaque) {
+            key |= truncate(shaderId, 12) << 45;
+            key |= truncate(materialKey, 16) << 29;
+            key |= truncate(vaoId, 16) << 13;
+            key |= quantizeDepth(viewDepth, 13);
+        } else {
+            constexpr uint64_t maxDepth = (uint64_t{1} << 24) - 1;
+            key |= uint64_t{1} << sortkey::TRANSLUCENT_SHIFT;
+            key |= (maxDepth - quantizeDepth(viewDepth, 24)) << 33;
+            key |= truncate(shaderId, 12) << 21;
+            key |= truncate(materialKey, 12) << 9;
+            key |= truncate(vaoId, 9);
         }
+        return key;
+    }
+
+    bool DrawCommand::canInstanceWith(const DrawCommand &other) const
+    {
+        return isInstanced && other.isInstanced &&
+               type == CommandType::MESH && other.type == CommandType::MESH &&
+               shader == other.shader && vao == other.vao && meshRange == other.meshRange &&
+               materialKey == other.materialKey && isOpaque == other.isOpaque;
+    }
+
+    bool DrawCommand::canMultiDrawWith(const DrawCommand &other) const
+    {
+        return isInstanced && other.isInstanced && meshRange && other.meshRange &&
+               shader == other.shader && vao == other.vao &&
+               materialKey == other.materialKey && isOpaque == other.isOpaque;
+    }
+
+    static void bindState(const DrawCommand &cmd)
+    {
+        // Binds go through the state cache, commands sorted by state only reach the driver on changes.
+        // The VAO holds the vertex buffer bindings, they don't need to be bound again.
+        if (cmd.shader)
+            cmd.shader->bind();
+
+        if (cmd.type == CommandType::MESH && cmd.vao)
+            cmd.vao->bind();
+        else if (cmd.type == CommandType::FULL_SCREEN)
+            getFullscreenQuad()->bind();
 
         // Set uniforms
-        if (shader) {
-            for (auto const& [name, val] : uniforms) {
-                std::visit([&](auto&& v){ shader->setUniform(name, v); }, val);
-            }
-        }
+        if (cmd.shader)
+            cmd.shader->setUniforms(cmd.uniforms);
+    }
+
+    void DrawCommand::execute() const
+    {
+        bindState(*this);
 
         if (type == CommandType::MESH && vao) {
             NxRenderCommand::drawIndexed(vao, vao->getIndexBuffer()->getCount());
@@ -56,4 +104,26 @@ namespace nexo::renderer {
             NxRenderCommand::drawUnIndexed(6);
         }
     }
+
+    void DrawCommand::executeInstanced(const std::shared_ptr<NxVertexBuffer> &instanceBuffer,
+                                       const size_t baseInstance, const size_t instanceCount) const
+    {
+        if (type != CommandType::MESH || !vao || !instanceBuffer)
+            return;
+        bindState(*this);
+        vao->setInstanceBuffer(instanceBuffer);
+        NxRenderCommand::drawIndexedInstanced(vao, instanceCount, baseInstance);
+    }
+
+    void DrawCommand::executeIndirect(const std::shared_ptr<NxVertexBuffer> &instanceBuffer,
+                                      const std::shared_ptr<NxVertexBuffer> &indirectBuffer,
+                                      const size_t firstDraw, const size_t drawCount) const
+    {
+        if (type != CommandType::MESH || !vao || !indirectBuffer)
+            return;
+        bindState(*this);
+        if (isInstanced && instanceBuffer)
+            vao->setInstanceBuffer(instanceBuffer);
+        NxRenderCommand::multiDrawIndexedIndirect(vao, indirectBuffer, firstDraw, drawCount);
+    }
 }
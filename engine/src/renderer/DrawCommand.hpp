@@ -17,8 +17,11 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include "InstanceData.hpp"
+#include "MeshArena.hpp"
+#include "RendererAPI.hpp"
 #include "Shader.hpp"
-#include "UniformCache.hpp"
+#include "UniformBlock.hpp"
 #include "VertexArray.hpp"
 
 namespace nexo::renderer {
@@ -55,16 +58,93 @@ namespace nexo::renderer {
         FULL_SCREEN,
     };
 
+    /**
+     * @brief Layout of the 64-bit draw command sort key, from the most significant bits.
+     *
+     * | pass (6) | translucent (1) | opaque: shader (12) material (16) vao (16) depth (13)          |
+     * |          |                 | translucent: inverted depth (24) shader (12) material (12) vao (9) |
+     *
+     * Opaque commands are grouped by state then drawn front to back, translucent commands are drawn
+     * back to front first and grouped by state only when their depth is equal.
+     */
+    namespace sortkey {
+        constexpr unsigned int PASS_SHIFT = 58;
+        constexpr unsigned int TRANSLUCENT_SHIFT = 57;
+        constexpr uint64_t PASS_MASK = 0x3F;
+    }
+
+    /**
+     * @brief Everything needed to issue one draw, built by the systems and executed by the render pipelines.
+     *
+     * Commands are values kept in storage recycled from frame to frame: the scene list of the render command
+     * system, its per worker arenas and the command list of each camera pipeline. Copying one only bumps the
+     * reference counts of its VAO and shader, and its uniforms live inline unless they outgrow the UniformBlock
+     * capacity, so building and executing the commands of a warmed-up frame does not allocate.
+     */
     struct DrawCommand {
         CommandType type = CommandType::MESH;
 
         std::shared_ptr<NxVertexArray> vao;
         std::shared_ptr<NxShader> shader;
-        std::unordered_map<std::string, UniformValue> uniforms;
+        UniformBlock uniforms;
 
         uint32_t filterMask = 0xFFFFFFFF;
         bool isOpaque = true;
 
+        // Identifies the material for state sorting, commands sharing a material should share the key
+        uint32_t materialKey = 0;
+        // World position used to compute the command depth from the camera
+        glm::vec3 sortPosition{0.0f};
+
+        // Instanced commands use a shader reading NxInstanceData from the per-instance attributes.
+        // Instanced commands sharing shader, VAO and material key must have identical uniforms, they are
+        // merged into a single instanced draw
+        bool isInstanced = false;
+        NxInstanceData instance{};
+
+        // Set for meshes living in a NxMeshArena, the VAO is then the arena's and only this range is drawn
+        std::optional<NxMeshRange> meshRange;
+
+        /**
+         * @brief Builds the sort key of the command for a given pass.
+         *
+         * @param passIndex Index of the pass filter bit, in [0, 63].
+         * @param viewDepth Distance between the camera and the command, negative values are clamped to 0.
+         * @return The 64-bit key described in nexo::renderer::sortkey.
+         */
+        [[nodiscard]] uint64_t computeSortKey(unsigned int passIndex, float viewDepth) const;
+
+        // Whether both commands can be drawn by the same instanced draw call
+        [[nodiscard]] bool canInstanceWith(const DrawCommand &other) const;
+
+        // Whether both commands draw arena meshes that can be submitted by the same multi-draw-indirect call
+        [[nodiscard]] bool canMultiDrawWith(const DrawCommand &other) const;
+
+        /**
+         * @brief Draws this command, binds already in place are skipped by the render command state cache.
+         */
         void execute() const;
+
+        /**
+         * @brief Draws a batch of instances with this command's shader, VAO and uniforms.
+         *
+         * @param instanceBuffer Buffer holding the instance data of the batch.
+         * @param baseInstance Index of the batch's first instance inside the buffer.
+         * @param instanceCount Number of instances of the batch.
+         */
+        void executeInstanced(const std::shared_ptr<NxVertexBuffer> &instanceBuffer,
+                              size_t baseInstance, size_t instanceCount) const;
+
+        /**
+         * @brief Draws arena meshes with one multi-draw-indirect call, using this command's shader and uniforms.
+         *
+         * @param instanceBuffer Buffer holding the instance data, may be null for non-instanced commands.
+         * @param indirectBuffer Buffer holding the NxDrawElementsIndirectCommand of the pass.
+         * @param firstDraw Index of the first indirect command of the call.
+         * @param drawCount Number of indirect commands of the call.
+         */
+        void executeIndirect(const std::shared_ptr<NxVertexBuffer> &instanceBuffer,
+                             const std::shared_ptr<NxVertexBuffer> &indirectBuffer,
+                             size_t firstDraw, size_t drawCount) const;
     };
 }
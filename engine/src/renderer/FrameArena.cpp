@@ -0,0 +1,87 @@
+//// FrameArena ////////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the per frame linear allocator of render data
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "FrameArena.hpp"
+#include "Exception.hpp"
+#include "RendererExceptions.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <optional>
+
+namespace nexo::renderer {
+
+    NxFrameArena::NxFrameArena(const size_t capacity)
+    {
+        addBlock(std::max<size_t>(capacity, 1));
+    }
+
+    void NxFrameArena::addBlock(const size_t size)
+    {
+        m_blocks.push_back({std::make_unique_for_overwrite<std::byte[]>(size), size});
+        m_offset = 0;
+    }
+
+    void *NxFrameArena::allocateBytes(const size_t size, const size_t alignment)
+    {
+        if (!std::has_single_bit(alignment))
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Frame arena alignments must be powers of two");
+
+        // Offset of the allocation inside the last block, if it fits
+        const auto alignedOffset = [&]() -> std::optional<size_t> {
+            const Block &block = m_blocks.back();
+            const auto address = reinterpret_cast<std::uintptr_t>(block.memory.get()) + m_offset;
+            const size_t offset = m_offset + (alignment - address % alignment) % alignment;
+            if (offset + size > block.size)
+                return std::nullopt;
+            return offset;
+        };
+        auto offset = alignedOffset();
+        if (!offset) {
+            // Doubling keeps the number of blocks of a growing frame logarithmic
+            addBlock(std::max(m_blocks.back().size * 2, size + alignment));
+            offset = alignedOffset();
+        }
+        m_offset = *offset + size;
+        m_usedBytes += size;
+        return m_blocks.back().memory.get() + *offset;
+    }
+
+    void NxFrameArena::reset()
+    {
+        if (m_blocks.size() > 1) {
+            const size_t capacity = getCapacity();
+            m_blocks.clear();
+            addBlock(capacity);
+        }
+        m_offset = 0;
+        m_usedBytes = 0;
+    }
+
+    size_t NxFrameArena::getCapacity() const
+    {
+        size_t capacity = 0;
+        for (const auto &block : m_blocks)
+            capacity += block.size;
+        return capacity;
+    }
+
+}
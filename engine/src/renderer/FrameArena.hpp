@@ -0,0 +1,88 @@
+//// FrameArena ////////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the per frame linear allocator of render data
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @class NxFrameArena
+     * @brief Linear allocator for render data that only lives until the end of the frame.
+     *
+     * Allocations bump an offset inside a block, nothing is freed individually: reset() rewinds the
+     * whole arena at the start of the next frame. When a frame needs more than the current capacity a
+     * new block is chained, and the next reset() merges every block into a single one, so a scene of
+     * stable size stops allocating after its first frames.
+     *
+     * Spans returned by allocate() stay valid until the next reset(). The arena is not thread safe.
+     */
+    class NxFrameArena {
+        public:
+            static constexpr size_t DEFAULT_CAPACITY = 256 * 1024;
+
+            explicit NxFrameArena(size_t capacity = DEFAULT_CAPACITY);
+
+            /**
+             * @brief Allocates `count` default initialized elements, valid until the next reset().
+             */
+            template<typename T>
+            [[nodiscard]] std::span<T> allocate(const size_t count)
+            {
+                static_assert(std::is_trivially_destructible_v<T>, "Arena memory is released without running destructors");
+                if (count == 0)
+                    return {};
+                T *elements = static_cast<T *>(allocateBytes(count * sizeof(T), alignof(T)));
+                std::uninitialized_default_construct_n(elements, count);
+                return {elements, count};
+            }
+
+            /**
+             * @brief Allocates raw memory aligned on `alignment`, which must be a power of two.
+             */
+            [[nodiscard]] void *allocateBytes(size_t size, size_t alignment);
+
+            /**
+             * @brief Releases every allocation of the frame, merging the blocks if the arena grew.
+             */
+            void reset();
+
+            [[nodiscard]] size_t getUsedBytes() const { return m_usedBytes; }
+            [[nodiscard]] size_t getCapacity() const;
+
+        private:
+            struct Block {
+                std::unique_ptr<std::byte[]> memory;
+                size_t size;
+            };
+
+            void addBlock(size_t size);
+
+            std::vector<Block> m_blocks;
+            // Offset of the next allocation inside the last block
+            size_t m_offset = 0;
+            size_t m_usedBytes = 0;
+    };
+
+}
@@ -17,7 +17,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <glm/glm.hpp>
 
@@ -118,6 +120,21 @@ namespace nexo::renderer {
         bool swapChainTarget = false;
     };
 
+    /**
+     * @struct NxPixelRegion
+     * @brief Result of an asynchronous readback of an integer attachment.
+     *
+     * Pixels are stored row by row, starting from the bottom row like the framebuffer coordinates.
+     */
+    struct NxPixelRegion {
+        uint64_t requestId = 0;
+        int x = 0;
+        int y = 0;
+        int width = 0;
+        int height = 0;
+        std::vector<int> pixels;
+    };
+
     /**
      * @class NxFramebuffer
      * @brief Abstract class representing a framebuffer in the rendering pipeline.
@@ -227,6 +244,31 @@ namespace nexo::renderer {
                  return result;
             }
 
+            /**
+             * @brief Queues an asynchronous read of a region of an integer attachment.
+             *
+             * Unlike getPixel(), the copy does not wait for the GPU to finish rendering. The result is
+             * retrieved with pollPixelRegion() once the GPU reached the request, usually the next frame.
+             * The region is clamped to the framebuffer.
+             *
+             * @param attachmentIndex The index of the attachment.
+             * @param x X-coordinate of the bottom left corner of the region.
+             * @param y Y-coordinate of the bottom left corner of the region.
+             * @param width Width of the region in pixels.
+             * @param height Height of the region in pixels.
+             * @return The id of the request, or 0 if the region is empty or every readback is still in flight.
+             */
+            virtual uint64_t requestPixelRegion(unsigned int attachmentIndex, int x, int y, int width = 1, int height = 1) = 0;
+
+            /**
+             * @brief Retrieves the oldest completed readback without blocking.
+             *
+             * Requests complete in order, callers should poll until std::nullopt is returned.
+             *
+             * @return The region, or std::nullopt if the oldest request is still in flight.
+             */
+            virtual std::optional<NxPixelRegion> pollPixelRegion() = 0;
+
             virtual void clearAttachmentWrapper(unsigned int attachmentIndex, const void *value, const std::type_info &ti) const = 0;
 
 
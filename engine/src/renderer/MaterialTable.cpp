@@ -0,0 +1,93 @@
+//// MaterialTable /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the GPU material table
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "MaterialTable.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace nexo::renderer {
+
+    NxMaterialTable::NxMaterialTable(const size_t initialCapacity) : m_capacity(std::max<size_t>(initialCapacity, 1))
+    {
+        m_materials.reserve(m_capacity);
+    }
+
+    uint32_t NxMaterialTable::allocate()
+    {
+        m_dirty = true;
+        if (!m_freeIndices.empty()) {
+            const uint32_t index = m_freeIndices.back();
+            m_freeIndices.pop_back();
+            m_materials[index] = {};
+            m_allocated[index] = 1;
+            return index;
+        }
+        m_materials.emplace_back();
+        m_allocated.push_back(1);
+        return static_cast<uint32_t>(m_materials.size() - 1);
+    }
+
+    void NxMaterialTable::release(const uint32_t index)
+    {
+        checkAllocated(index);
+        // The stale entry stays in the buffer until reused, no draw references it anymore
+        m_allocated[index] = 0;
+        m_freeIndices.push_back(index);
+    }
+
+    void NxMaterialTable::set(const uint32_t index, const NxIndexedMaterial &material)
+    {
+        checkAllocated(index);
+        if (m_materials[index] == material)
+            return;
+        m_materials[index] = material;
+        m_dirty = true;
+    }
+
+    const NxIndexedMaterial &NxMaterialTable::get(const uint32_t index) const
+    {
+        checkAllocated(index);
+        return m_materials[index];
+    }
+
+    void NxMaterialTable::upload()
+    {
+        if (!m_dirty)
+            return;
+        if (!m_buffer || m_materials.size() > m_capacity) {
+            while (m_capacity < m_materials.size())
+                m_capacity *= 2;
+            m_buffer = NxShaderStorageBuffer::create(static_cast<unsigned int>(m_capacity * sizeof(NxIndexedMaterial)));
+            m_buffer->bindBase(NX_MATERIALS_BINDING);
+        }
+        if (!m_materials.empty())
+            m_buffer->setData(m_materials.data(), m_materials.size() * sizeof(NxIndexedMaterial));
+        m_dirty = false;
+    }
+
+    void NxMaterialTable::checkAllocated(const uint32_t index) const
+    {
+        if (index >= m_allocated.size() || !m_allocated[index])
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Material index " + std::to_string(index) + " is not allocated");
+    }
+
+}
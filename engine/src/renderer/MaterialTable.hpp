@@ -0,0 +1,111 @@
+//// MaterialTable /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the GPU material table
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "ShaderStorageBuffer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace nexo::renderer {
+
+    /// Storage buffer binding point of the material table, must match the `Materials` block of the shaders
+    constexpr unsigned int NX_MATERIALS_BINDING = 2;
+
+    /**
+     * @brief Material as read by the shaders, mirrors the std430 `Material` struct of the `Materials` block.
+     *
+     * The texture indices come from NxTextureTable, 0 being the white texture.
+     */
+    struct NxIndexedMaterial
+    {
+        glm::vec4 albedoColor = glm::vec4(1.0f);
+        glm::vec4 specularColor = glm::vec4(1.0f);
+        glm::vec3 emissiveColor = glm::vec3(0.0f);
+        float roughness = 0.5f;
+        float metallic = 0.0f;
+        float opacity = 1.0f;
+        int albedoTexIndex = 0;
+        int specularTexIndex = 0;
+        int emissiveTexIndex = 0;
+        int roughnessTexIndex = 0;
+        int metallicTexIndex = 0;
+        int opacityTexIndex = 0;
+
+        bool operator==(const NxIndexedMaterial &other) const = default;
+    };
+    static_assert(sizeof(NxIndexedMaterial) == 80, "NxIndexedMaterial must match the std430 Material struct");
+
+    /**
+     * @class NxMaterialTable
+     * @brief Array of materials kept in a storage buffer, draws only carry the index of their material.
+     *
+     * Entries are written on the CPU side and the buffer is only uploaded when one of them changed,
+     * so materials shared by many draws cost a single integer per draw.
+     */
+    class NxMaterialTable {
+        public:
+            explicit NxMaterialTable(size_t initialCapacity = 64);
+
+            /**
+             * @brief Reserves an entry, initialized with a default material.
+             * @return The index of the entry.
+             */
+            [[nodiscard]] uint32_t allocate();
+
+            /**
+             * @brief Releases an entry, its index is handed out again by the next allocate().
+             * @throw NxInvalidValue If the index is not allocated.
+             */
+            void release(uint32_t index);
+
+            /**
+             * @brief Writes an entry, the table is only marked for upload if the material changed.
+             * @throw NxInvalidValue If the index is not allocated.
+             */
+            void set(uint32_t index, const NxIndexedMaterial &material);
+
+            [[nodiscard]] const NxIndexedMaterial &get(uint32_t index) const;
+
+            /**
+             * @brief Uploads the table if it changed since the last upload, and binds it at `NX_MATERIALS_BINDING`.
+             *
+             * The storage buffer is created on the first upload and recreated when the table outgrows it.
+             */
+            void upload();
+
+            [[nodiscard]] bool isDirty() const { return m_dirty; }
+            [[nodiscard]] size_t size() const { return m_materials.size() - m_freeIndices.size(); }
+
+        private:
+            void checkAllocated(uint32_t index) const;
+
+            std::vector<NxIndexedMaterial> m_materials;
+            std::vector<uint8_t> m_allocated;
+            std::vector<uint32_t> m_freeIndices;
+            std::shared_ptr<NxShaderStorageBuffer> m_buffer;
+            size_t m_capacity;
+            bool m_dirty = true;
+    };
+
+}
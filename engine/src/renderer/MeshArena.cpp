@@ -0,0 +1,203 @@
+//// MeshArena.cpp /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the shared mesh buffer arena
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "MeshArena.hpp"
+#include "RendererExceptions.hpp"
+
+#include <algorithm>
+#include <ranges>
+
+namespace nexo::renderer {
+
+    NxArenaMesh::NxArenaMesh(std::weak_ptr<NxMeshArena> arena, const uint32_t handle)
+        : m_arena(std::move(arena)), m_handle(handle)
+    {
+    }
+
+    NxArenaMesh::~NxArenaMesh()
+    {
+        // The arena may already be gone if the renderer shut down first
+        if (const auto arena = m_arena.lock())
+            arena->remove(m_handle);
+    }
+
+    NxMeshRange NxArenaMesh::getRange() const
+    {
+        const auto arena = m_arena.lock();
+        return arena ? arena->getRange(m_handle) : NxMeshRange{};
+    }
+
+    std::shared_ptr<NxVertexArray> NxArenaMesh::getVertexArray() const
+    {
+        const auto arena = m_arena.lock();
+        return arena ? arena->getVertexArray() : nullptr;
+    }
+
+    NxMeshArena::NxMeshArena(const size_t vertexCapacity, const size_t indexCapacity)
+        : m_vertexAllocator(0), m_indexAllocator(0)
+    {
+        reserve(vertexCapacity, indexCapacity);
+    }
+
+    std::shared_ptr<NxMeshArena> NxMeshArena::create(const size_t vertexCapacity, const size_t indexCapacity)
+    {
+        return std::make_shared<NxMeshArena>(vertexCapacity, indexCapacity);
+    }
+
+    void NxMeshArena::reserve(const size_t vertexCapacity, const size_t indexCapacity)
+    {
+        auto vertexArray = createVertexArray();
+        auto vertexBuffer = createVertexBuffer(static_cast<unsigned int>(vertexCapacity * sizeof(NxVertex)));
+        vertexBuffer->setLayout({
+            {NxShaderDataType::FLOAT3, "aPos"},
+            {NxShaderDataType::FLOAT2, "aTexCoord"},
+            {NxShaderDataType::FLOAT3, "aNormal"},
+            {NxShaderDataType::FLOAT3, "aTangent"},
+            {NxShaderDataType::FLOAT3, "aBiTangent"},
+            {NxShaderDataType::INT, "aEntityID"}
+        });
+        vertexArray->addVertexBuffer(vertexBuffer);
+
+        // Created while the new vertex array is bound so the element buffer binding lands in it
+        auto indexBuffer = createIndexBuffer();
+        indexBuffer->setData(nullptr, indexCapacity);
+        vertexArray->setIndexBuffer(indexBuffer);
+
+        if (m_vertexBuffer)
+            vertexBuffer->copyFrom(*m_vertexBuffer, 0, 0, m_vertexAllocator.capacity() * sizeof(NxVertex));
+        if (m_indexBuffer)
+            indexBuffer->copyFrom(*m_indexBuffer, 0, 0, m_indexAllocator.capacity());
+
+        m_vertexArray = std::move(vertexArray);
+        m_vertexBuffer = std::move(vertexBuffer);
+        m_indexBuffer = std::move(indexBuffer);
+        m_vertexAllocator.grow(vertexCapacity);
+        m_indexAllocator.grow(indexCapacity);
+    }
+
+    bool NxMeshArena::fits(const size_t vertexCount, const size_t indexCount) const
+    {
+        return m_vertexAllocator.largestFreeBlock() >= vertexCount && m_indexAllocator.largestFreeBlock() >= indexCount;
+    }
+
+    std::shared_ptr<NxArenaMesh> NxMeshArena::add(const std::span<const NxVertex> vertices, const std::span<const unsigned int> indices)
+    {
+        if (vertices.empty() || indices.empty())
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Cannot add an empty mesh to the arena");
+
+        if (!fits(vertices.size(), indices.size())) {
+            const bool enoughFreeSpace =
+                m_vertexAllocator.capacity() - m_vertexAllocator.used() >= vertices.size() &&
+                m_indexAllocator.capacity() - m_indexAllocator.used() >= indices.size();
+            if (enoughFreeSpace)
+                defragment();
+            if (!fits(vertices.size(), indices.size()))
+                reserve(std::max(m_vertexAllocator.capacity() * 2, m_vertexAllocator.used() + vertices.size()),
+                        std::max(m_indexAllocator.capacity() * 2, m_indexAllocator.used() + indices.size()));
+        }
+
+        NxMeshRange range;
+        range.baseVertex = static_cast<uint32_t>(*m_vertexAllocator.allocate(vertices.size()));
+        range.vertexCount = static_cast<uint32_t>(vertices.size());
+        range.firstIndex = static_cast<uint32_t>(*m_indexAllocator.allocate(indices.size()));
+        range.indexCount = static_cast<uint32_t>(indices.size());
+        m_vertexBuffer->setSubData(vertices.data(), vertices.size_bytes(), range.baseVertex * sizeof(NxVertex));
+        m_indexBuffer->setSubData(indices.data(), indices.size(), range.firstIndex);
+
+        uint32_t handle;
+        if (!m_freeHandles.empty()) {
+            handle = m_freeHandles.back();
+            m_freeHandles.pop_back();
+            m_meshes[handle] = range;
+        } else {
+            handle = static_cast<uint32_t>(m_meshes.size());
+            m_meshes.emplace_back(range);
+        }
+        return std::make_shared<NxArenaMesh>(weak_from_this(), handle);
+    }
+
+    void NxMeshArena::remove(const uint32_t handle)
+    {
+        if (handle >= m_meshes.size() || !m_meshes[handle])
+            THROW_EXCEPTION(NxOutOfRangeException, handle, m_meshes.size());
+        const NxMeshRange &range = *m_meshes[handle];
+        m_vertexAllocator.free(range.baseVertex, range.vertexCount);
+        m_indexAllocator.free(range.firstIndex, range.indexCount);
+        m_meshes[handle].reset();
+        m_freeHandles.push_back(handle);
+    }
+
+    const NxMeshRange &NxMeshArena::getRange(const uint32_t handle) const
+    {
+        if (handle >= m_meshes.size() || !m_meshes[handle])
+            THROW_EXCEPTION(NxOutOfRangeException, handle, m_meshes.size());
+        return *m_meshes[handle];
+    }
+
+    /**
+     * @brief Moves `count` elements from `source` down to `destination` inside the same buffer.
+     *
+     * GPU copies inside a buffer must not overlap, so when the move distance is shorter than the
+     * range the copy is split in chunks of that distance, walking from the front.
+     */
+    template<typename Buffer>
+    static void moveDown(Buffer &buffer, const size_t source, const size_t destination, const size_t count, const size_t elementSize)
+    {
+        const size_t distance = source - destination;
+        for (size_t copied = 0; copied < count; copied += distance) {
+            const size_t chunk = std::min(distance, count - copied);
+            buffer.copyFrom(buffer, (source + copied) * elementSize, (destination + copied) * elementSize, chunk * elementSize);
+        }
+    }
+
+    void NxMeshArena::defragment()
+    {
+        std::vector<uint32_t> live;
+        for (uint32_t handle = 0; handle < m_meshes.size(); ++handle) {
+            if (m_meshes[handle])
+                live.push_back(handle);
+        }
+
+        std::ranges::sort(live, {}, [this](const uint32_t handle) { return m_meshes[handle]->baseVertex; });
+        size_t vertexCursor = 0;
+        for (const uint32_t handle : live) {
+            NxMeshRange &range = *m_meshes[handle];
+            if (range.baseVertex != vertexCursor)
+                moveDown(*m_vertexBuffer, range.baseVertex, vertexCursor, range.vertexCount, sizeof(NxVertex));
+            range.baseVertex = static_cast<uint32_t>(vertexCursor);
+            vertexCursor += range.vertexCount;
+        }
+
+        // Index buffers copy in indices, not bytes
+        std::ranges::sort(live, {}, [this](const uint32_t handle) { return m_meshes[handle]->firstIndex; });
+        size_t indexCursor = 0;
+        for (const uint32_t handle : live) {
+            NxMeshRange &range = *m_meshes[handle];
+            if (range.firstIndex != indexCursor)
+                moveDown(*m_indexBuffer, range.firstIndex, indexCursor, range.indexCount, 1);
+            range.firstIndex = static_cast<uint32_t>(indexCursor);
+            indexCursor += range.indexCount;
+        }
+
+        m_vertexAllocator.reset(vertexCursor);
+        m_indexAllocator.reset(indexCursor);
+    }
+
+}
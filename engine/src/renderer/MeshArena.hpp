@@ -0,0 +1,133 @@
+//// MeshArena.hpp /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the shared mesh buffer arena
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "Buffer.hpp"
+#include "RangeAllocator.hpp"
+#include "Vertex.hpp"
+#include "VertexArray.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @brief Location of a mesh inside the arena buffers.
+     *
+     * Indices are relative to the mesh, they are drawn with `baseVertex` added to them.
+     */
+    struct NxMeshRange {
+        uint32_t baseVertex = 0;
+        uint32_t vertexCount = 0;
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+
+        bool operator==(const NxMeshRange &) const = default;
+    };
+
+    class NxMeshArena;
+
+    /**
+     * @brief Mesh living in a NxMeshArena, released from the arena when destroyed.
+     *
+     * The range of the mesh can change when the arena grows or is defragmented, it must be queried
+     * when building the draw commands rather than stored.
+     */
+    class NxArenaMesh {
+        public:
+            NxArenaMesh(std::weak_ptr<NxMeshArena> arena, uint32_t handle);
+            ~NxArenaMesh();
+
+            NxArenaMesh(const NxArenaMesh &) = delete;
+            NxArenaMesh &operator=(const NxArenaMesh &) = delete;
+
+            [[nodiscard]] NxMeshRange getRange() const;
+            [[nodiscard]] std::shared_ptr<NxVertexArray> getVertexArray() const;
+
+        private:
+            std::weak_ptr<NxMeshArena> m_arena;
+            uint32_t m_handle;
+    };
+
+    /**
+     * @class NxMeshArena
+     * @brief Large vertex and index buffers shared by many meshes behind a single vertex array.
+     *
+     * Meshes are sub-allocated with a first-fit free list. When an allocation does not fit, the arena
+     * first compacts the live meshes if that frees a large enough block, then doubles its buffers.
+     * Every mesh of the arena can be drawn without rebinding the vertex array, which is what lets the
+     * pipeline submit them with multi-draw-indirect.
+     */
+    class NxMeshArena : public std::enable_shared_from_this<NxMeshArena> {
+        public:
+            NxMeshArena(size_t vertexCapacity, size_t indexCapacity);
+
+            static std::shared_ptr<NxMeshArena> create(size_t vertexCapacity, size_t indexCapacity);
+
+            /**
+             * @brief Uploads a mesh to the arena.
+             *
+             * @param vertices Vertices of the mesh.
+             * @param indices Indices of the mesh, relative to its first vertex.
+             * @return The mesh, released from the arena when the last reference goes away.
+             * @throw NxInvalidValue If the mesh has no vertex or no index.
+             */
+            [[nodiscard]] std::shared_ptr<NxArenaMesh> add(std::span<const NxVertex> vertices, std::span<const unsigned int> indices);
+
+            // Releases the ranges of a mesh, called by NxArenaMesh
+            void remove(uint32_t handle);
+
+            /**
+             * @brief Current range of a mesh.
+             * @throw NxOutOfRangeException If the handle does not reference a live mesh.
+             */
+            [[nodiscard]] const NxMeshRange &getRange(uint32_t handle) const;
+
+            [[nodiscard]] const std::shared_ptr<NxVertexArray> &getVertexArray() const { return m_vertexArray; }
+
+            // Moves every live mesh to the start of the buffers so the free space is a single block
+            void defragment();
+
+            [[nodiscard]] size_t getVertexCapacity() const { return m_vertexAllocator.capacity(); }
+            [[nodiscard]] size_t getIndexCapacity() const { return m_indexAllocator.capacity(); }
+            [[nodiscard]] size_t getMeshCount() const { return m_meshes.size() - m_freeHandles.size(); }
+
+        private:
+            // Recreates the buffers with the given capacities and copies the current content
+            void reserve(size_t vertexCapacity, size_t indexCapacity);
+            [[nodiscard]] bool fits(size_t vertexCount, size_t indexCount) const;
+
+            std::shared_ptr<NxVertexArray> m_vertexArray;
+            std::shared_ptr<NxVertexBuffer> m_vertexBuffer;
+            std::shared_ptr<NxIndexBuffer> m_indexBuffer;
+
+            NxRangeAllocator m_vertexAllocator;
+            NxRangeAllocator m_indexAllocator;
+
+            std::vector<std::optional<NxMeshRange>> m_meshes;
+            std::vector<uint32_t> m_freeHandles;
+    };
+
+}
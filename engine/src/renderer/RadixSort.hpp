@@ -0,0 +1,77 @@
+//// RadixSort.hpp /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the LSD radix sort used on draw command keys
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @brief Sorts items by a 64-bit key with a stable least-significant-digit radix sort.
+     *
+     * The sort works on 8-bit digits and skips every digit that is identical across all the keys,
+     * so keys that only use a few fields cost a few passes. The scratch vector is reused between
+     * calls to avoid reallocating every frame.
+     *
+     * @tparam T Item type, must be copyable.
+     * @tparam KeyFn Callable returning the uint64_t key of an item.
+     * @param items Items to sort in place.
+     * @param scratch Temporary storage, resized as needed.
+     * @param keyOf Key extractor.
+     */
+    template<typename T, typename KeyFn>
+    void radixSort(std::vector<T> &items, std::vector<T> &scratch, KeyFn keyOf)
+    {
+        constexpr unsigned int digitBits = 8;
+        constexpr unsigned int digitCount = sizeof(uint64_t) * 8 / digitBits;
+        constexpr size_t bucketCount = 1 << digitBits;
+
+        if (items.size() < 2)
+            return;
+
+        std::array<std::array<size_t, bucketCount>, digitCount> histograms{};
+        for (const T &item : items) {
+            const uint64_t key = keyOf(item);
+            for (unsigned int digit = 0; digit < digitCount; ++digit)
+                ++histograms[digit][(key >> (digit * digitBits)) & (bucketCount - 1)];
+        }
+
+        scratch.resize(items.size());
+        for (unsigned int digit = 0; digit < digitCount; ++digit) {
+            auto &histogram = histograms[digit];
+            // Every key shares this digit, the pass would not move anything
+            if (histogram[(keyOf(items.front()) >> (digit * digitBits)) & (bucketCount - 1)] == items.size())
+                continue;
+
+            size_t offset = 0;
+            for (size_t &count : histogram) {
+                const size_t bucketSize = count;
+                count = offset;
+                offset += bucketSize;
+            }
+            for (const T &item : items)
+                scratch[histogram[(keyOf(item) >> (digit * digitBits)) & (bucketCount - 1)]++] = item;
+            items.swap(scratch);
+        }
+    }
+
+}
@@ -0,0 +1,110 @@
+//// RangeAllocator.cpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the free-list range allocator
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "RangeAllocator.hpp"
+#include "RendererExceptions.hpp"
+
+#include <algorithm>
+
+namespace nexo::renderer {
+
+    NxRangeAllocator::NxRangeAllocator(const size_t capacity) : m_capacity(capacity)
+    {
+        if (capacity)
+            m_freeBlocks.emplace(0, capacity);
+    }
+
+    std::optional<size_t> NxRangeAllocator::allocate(const size_t size)
+    {
+        if (!size)
+            return std::nullopt;
+        for (auto it = m_freeBlocks.begin(); it != m_freeBlocks.end(); ++it) {
+            const auto [offset, blockSize] = *it;
+            if (blockSize < size)
+                continue;
+            m_freeBlocks.erase(it);
+            if (blockSize > size)
+                m_freeBlocks.emplace(offset + size, blockSize - size);
+            m_used += size;
+            return offset;
+        }
+        return std::nullopt;
+    }
+
+    void NxRangeAllocator::free(size_t offset, size_t size)
+    {
+        if (!size)
+            return;
+        if (offset + size > m_capacity)
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Released range is outside of the allocator");
+
+        auto next = m_freeBlocks.lower_bound(offset);
+        if (next != m_freeBlocks.end() && next->first < offset + size)
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Released range overlaps a free block");
+        if (next != m_freeBlocks.begin()) {
+            const auto previous = std::prev(next);
+            if (previous->first + previous->second > offset)
+                THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Released range overlaps a free block");
+        }
+        m_used -= size;
+
+        // Merge with the following block, then with the previous one
+        if (next != m_freeBlocks.end() && next->first == offset + size) {
+            size += next->second;
+            next = m_freeBlocks.erase(next);
+        }
+        if (next != m_freeBlocks.begin()) {
+            const auto previous = std::prev(next);
+            if (previous->first + previous->second == offset) {
+                previous->second += size;
+                return;
+            }
+        }
+        m_freeBlocks.emplace(offset, size);
+    }
+
+    void NxRangeAllocator::grow(const size_t newCapacity)
+    {
+        if (newCapacity <= m_capacity)
+            return;
+        const size_t added = newCapacity - m_capacity;
+        const size_t oldCapacity = m_capacity;
+        m_capacity = newCapacity;
+        m_used += added;
+        free(oldCapacity, added);
+    }
+
+    void NxRangeAllocator::reset(const size_t used)
+    {
+        m_freeBlocks.clear();
+        m_used = std::min(used, m_capacity);
+        if (m_used < m_capacity)
+            m_freeBlocks.emplace(m_used, m_capacity - m_used);
+    }
+
+    size_t NxRangeAllocator::largestFreeBlock() const
+    {
+        size_t largest = 0;
+        for (const auto &[offset, size] : m_freeBlocks)
+            largest = std::max(largest, size);
+        return largest;
+    }
+
+}
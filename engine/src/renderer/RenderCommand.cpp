@@ -17,6 +17,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "RenderCommand.hpp"
 #include "renderer/RendererExceptions.hpp"
+#include <utility>
 #ifdef NX_GRAPHICS_API_OPENGL
     #include "opengl/OpenGlRendererAPI.hpp"
 #endif
@@ -25,6 +26,8 @@ namespace nexo::renderer {
 
     #ifdef NX_GRAPHICS_API_OPENGL
         NxRendererApi *NxRenderCommand::_rendererApi = new NxOpenGlRendererApi;
+    #else
+        NxRendererApi *NxRenderCommand::_rendererApi = nullptr;
     #endif
 
     void NxRenderCommand::init()
@@ -33,4 +36,9 @@ namespace nexo::renderer {
             THROW_EXCEPTION(NxUnknownGraphicsApi, "UNKNOWN");
         _rendererApi->init();
     }
+
+    std::unique_ptr<NxRendererApi> NxRenderCommand::setRendererApi(std::unique_ptr<NxRendererApi> api)
+    {
+        return std::unique_ptr<NxRendererApi>(std::exchange(_rendererApi, api.release()));
+    }
 }
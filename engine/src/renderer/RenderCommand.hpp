@@ -64,6 +64,18 @@ namespace nexo::renderer {
              */
             static void init();
 
+            /**
+             * @brief Replaces the renderer api the commands are delegated to.
+             *
+             * Mostly used to install an `NxNullRendererApi` in tests and benchmarks running without
+             * a graphics context. The new api still has to be initialized with `init()`, which throws
+             * NxUnknownGraphicsApi while no api is set.
+             *
+             * @param api The api to use from now on.
+             * @return The previously active api, so it can be restored.
+             */
+            static std::unique_ptr<NxRendererApi> setRendererApi(std::unique_ptr<NxRendererApi> api);
+
             /**
              * @brief Sets the viewport dimensions and position.
              *
@@ -128,6 +140,34 @@ namespace nexo::renderer {
                 _rendererApi->drawIndexed(vertexArray, indexCount);
             }
 
+            /**
+             * @brief Draws several instances of indexed geometry.
+             *
+             * @param vertexArray The vertex array to draw, its instance buffer must be attached.
+             * @param instanceCount Number of instances to draw.
+             * @param baseInstance Index of the first instance read from the instance buffer.
+             */
+            static void drawIndexedInstanced(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                             const size_t instanceCount, const size_t baseInstance)
+            {
+                _rendererApi->drawIndexedInstanced(vertexArray, instanceCount, baseInstance);
+            }
+
+            /**
+             * @brief Submits several indexed draws from a buffer of NxDrawElementsIndirectCommand.
+             *
+             * @param vertexArray The vertex array every draw reads from.
+             * @param commands Buffer holding the indirect commands.
+             * @param firstCommand Index of the first command to submit.
+             * @param drawCount Number of commands to submit.
+             */
+            static void multiDrawIndexedIndirect(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                                 const std::shared_ptr<NxVertexBuffer> &commands,
+                                                 const size_t firstCommand, const size_t drawCount)
+            {
+                _rendererApi->multiDrawIndexedIndirect(vertexArray, commands, firstCommand, drawCount);
+            }
+
             static void drawUnIndexed(const size_t verticesCount)
             {
                 _rendererApi->drawUnIndexed(verticesCount);
@@ -231,6 +271,69 @@ namespace nexo::renderer {
                 _rendererApi->setWindingOrder(order);
             }
 
+            static void setBlend(const bool enable)
+            {
+                _rendererApi->setBlend(enable);
+            }
+
+            /**
+             * @brief Sets the source and destination blend factors, skipped when they are already set.
+             */
+            static void setBlendFunc(const unsigned int source, const unsigned int destination)
+            {
+                _rendererApi->setBlendFunc(source, destination);
+            }
+
+            /**
+             * @brief Binds a shader program, skipped when it is already bound. 0 unbinds it.
+             */
+            static void useProgram(const unsigned int id) { _rendererApi->useProgram(id); }
+
+            /**
+             * @brief Binds a vertex array, skipped when it is already bound. 0 unbinds it.
+             */
+            static void bindVertexArray(const unsigned int id) { _rendererApi->bindVertexArray(id); }
+
+            /**
+             * @brief Binds a 2D texture to a texture unit and makes the unit active, redundant calls are skipped.
+             */
+            static void bindTexture(const unsigned int slot, const unsigned int id) { _rendererApi->bindTexture(slot, id); }
+
+            /**
+             * @brief Binds a framebuffer, and covers it with the viewport when its size is given.
+             *
+             * Redundant calls are skipped, 0 binds the default framebuffer.
+             */
+            static void bindFramebuffer(const unsigned int id, const unsigned int width = 0, const unsigned int height = 0)
+            {
+                _rendererApi->bindFramebuffer(id, width, height);
+            }
+
+            /**
+             * @brief Forgets the state bound on the context, the next calls all reach the driver.
+             *
+             * Usage:
+             * - Call it after making another context current, or after code outside the renderer
+             *   (UI backends, raw driver calls) changed the bound state.
+             */
+            static void invalidateState() { _rendererApi->getStateCache().invalidate(); }
+
+            /**
+             * @brief Returns the cache of the bound state, with the number of redundant calls avoided.
+             */
+            static NxStateCache &getStateCache() { return _rendererApi->getStateCache(); }
+
+            /**
+             * @brief Returns the work submitted since the last resetCounters(), see NxRenderCounters.
+             */
+            static NxRenderCounters getCounters() { return _rendererApi->getCounters(); }
+            static void addUploadedBytes(const uint64_t bytes) { _rendererApi->addUploadedBytes(bytes); }
+            static void addDrawnInstances(const uint64_t instances, const uint64_t triangles)
+            {
+                _rendererApi->addDrawnInstances(instances, triangles);
+            }
+            static void resetCounters() { _rendererApi->resetCounters(); }
+
         private:
             /**
             * @brief Static pointer to the active `NxRendererApi` implementation.
@@ -241,7 +344,9 @@ namespace nexo::renderer {
             *
             * Notes:
             * - The `_rendererApi` instance is statically allocated and shared across all
-            *   `NxRenderCommand` methods.
+            *   `NxRenderCommand` methods, it can be replaced with `setRendererApi()`.
+            * - It is never freed, resources released during static destruction still reach
+            *   its state cache.
             * - The application must ensure that `_rendererApi` is initialized via `init()`
             *   before issuing any render commands.
             */
@@ -28,6 +28,18 @@ namespace nexo::renderer {
 
     class RenderPipeline;
 
+    /**
+     * @brief Framebuffer written by a pass and read by later passes of the same frame.
+     *
+     * A width or height of 0 follows the size of the pipeline render target.
+     */
+    struct TransientDesc {
+        std::string name;
+        NxFrameBufferAttachmentsSpecifications attachments;
+        unsigned int width = 0;
+        unsigned int height = 0;
+    };
+
     class RenderPass {
         public:
             explicit RenderPass(const PassId id, std::string  debugName = "") : id(id), name(std::move(debugName)) {}
@@ -47,7 +59,33 @@ namespace nexo::renderer {
             [[nodiscard]] const std::vector<PassId> &getEffects() const { return effects; }
 
             virtual std::shared_ptr<NxFramebuffer> getOutput() const { return nullptr; };
+
+            /**
+             * @brief Whether the pass has work this frame, inactive passes are culled before execution.
+             *
+             * Passes reading a transient no active pass writes are culled as well, so are passes
+             * writing transients that no active pass reads.
+             */
+            [[nodiscard]] virtual bool isActive([[maybe_unused]] const RenderPipeline &pipeline) const { return true; }
+
+            [[nodiscard]] const std::vector<TransientDesc> &getWrittenTransients() const { return m_writtenTransients; }
+            [[nodiscard]] const std::vector<std::string> &getReadTransients() const { return m_readTransients; }
         protected:
+            /**
+             * @brief Declares a transient rendered by this pass, fetched with RenderPipeline::getTransient.
+             *
+             * A pass writing transients is expected to render only into them: it is culled when nothing reads them.
+             */
+            void writesTransient(std::string transientName, NxFrameBufferAttachmentsSpecifications attachments,
+                                 const unsigned int width = 0, const unsigned int height = 0)
+            {
+                m_writtenTransients.push_back({std::move(transientName), std::move(attachments), width, height});
+            }
+
+            // Declares a transient sampled by this pass, it stays alive until the last reader executed
+            void readsTransient(std::string transientName) { m_readTransients.push_back(std::move(transientName)); }
+
+
             bool m_isFinal = false;
             PassId id;
             std::string name;
@@ -56,5 +94,8 @@ namespace nexo::renderer {
             std::vector<PassId> prerequisites;
             // Effects - which passes this one enables
             std::vector<PassId> effects;
+
+            std::vector<TransientDesc> m_writtenTransients;
+            std::vector<std::string> m_readTransients;
     };
 }
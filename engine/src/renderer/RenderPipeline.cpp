@@ -21,6 +21,10 @@
 #include "RenderCommand.hpp"
 #include "RendererExceptions.hpp"
 #include "Renderer3D.hpp"
+#include "RadixSort.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
 #include <functional>
 #include <set>
 #include <utility>
@@ -230,11 +234,161 @@ namespace nexo::renderer {
         if (!m_renderTarget)
             THROW_EXCEPTION(NxPipelineRenderTargetNotSetException);
 
-        for (PassId id : m_plan) {
-            if (passes.contains(id))
-                passes[id]->execute(*this);
-        }
+        if (m_cameraConstants)
+            NxRenderer3D::get().uploadCameraConstants(*m_cameraConstants);
+
+        sortDrawCommands();
+        cullPasses();
+        executeActivePasses();
+        m_sortedDrawCommands.clear();
+        m_filterRanges.fill({0, 0});
         m_drawCommands.clear();
+        m_sharedDrawCommands.clear();
+        m_sharedVisibleIndices.clear();
+    }
+
+    void RenderPipeline::cullPasses()
+    {
+        m_activePasses.clear();
+        for (const PassId id : m_plan) {
+            if (const auto it = passes.find(id); it != passes.end() && it->second->isActive(*this))
+                m_activePasses.push_back(id);
+        }
+
+        const auto writes = [this](const size_t index, const std::string &transient) {
+            const auto &written = passes[m_activePasses[index]]->getWrittenTransients();
+            return std::ranges::find(written, transient, &TransientDesc::name) != written.end();
+        };
+        const auto reads = [this](const size_t index, const std::string &transient) {
+            const auto &read = passes[m_activePasses[index]]->getReadTransients();
+            return std::ranges::find(read, transient) != read.end();
+        };
+
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (size_t i = 0; i < m_activePasses.size(); ++i) {
+                const auto &pass = passes[m_activePasses[i]];
+                const bool starved = std::ranges::any_of(pass->getReadTransients(), [&](const std::string &transient) {
+                    for (size_t writer = 0; writer < i; ++writer) {
+                        if (writes(writer, transient))
+                            return false;
+                    }
+                    return true;
+                });
+                const auto &written = pass->getWrittenTransients();
+                const bool unread = !pass->isFinal() && !written.empty() &&
+                                    std::ranges::none_of(written, [&](const TransientDesc &transient) {
+                                        for (size_t reader = i + 1; reader < m_activePasses.size(); ++reader) {
+                                            if (reads(reader, transient.name))
+                                                return true;
+                                        }
+                                        return false;
+                                    });
+                if (starved || unread) {
+                    m_activePasses.erase(m_activePasses.begin() + static_cast<std::ptrdiff_t>(i));
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    RenderPipeline::LiveTransient *RenderPipeline::findTransient(const std::string &name)
+    {
+        const auto it = std::ranges::find_if(m_transients, [&name](const LiveTransient &transient) {
+            return *transient.name == name;
+        });
+        return it != m_transients.end() ? &*it : nullptr;
+    }
+
+    void RenderPipeline::executeActivePasses()
+    {
+        m_transients.clear();
+        const auto recordUse = [this](const std::string &name, const size_t passIndex) {
+            if (LiveTransient *transient = findTransient(name))
+                transient->lastUse = passIndex;
+            else
+                m_transients.push_back({&name, nullptr, passIndex});
+        };
+        for (size_t i = 0; i < m_activePasses.size(); ++i) {
+            const auto &pass = passes[m_activePasses[i]];
+            for (const auto &transient : pass->getWrittenTransients())
+                recordUse(transient.name, i);
+            for (const auto &transient : pass->getReadTransients())
+                recordUse(transient, i);
+        }
+        const auto &pool = m_transientPool ? m_transientPool : NxTransientPool::getShared();
+
+        auto &profiler = NxRenderProfiler::get();
+        if (m_passStats.size() < m_activePasses.size())
+            m_passStats.resize(m_activePasses.size());
+        m_passStatsCount = m_activePasses.size();
+
+        for (size_t i = 0; i < m_activePasses.size(); ++i) {
+            const auto &pass = passes[m_activePasses[i]];
+            NxPassStats &stats = m_passStats[i];
+            const auto cpuStart = std::chrono::steady_clock::now();
+            const NxRenderCounters countersStart = NxRenderCommand::getCounters();
+            NxGpuTimer *gpuTimer = nullptr;
+            if (profiler.isGpuTimingEnabled()) {
+                auto &timer = m_gpuTimers[m_activePasses[i]];
+                if (!timer)
+                    timer = NxGpuTimer::create();
+                gpuTimer = timer.get();
+                gpuTimer->begin();
+            }
+
+            for (const auto &declaration : pass->getWrittenTransients()) {
+                LiveTransient *transient = findTransient(declaration.name);
+                if (transient->framebuffer)
+                    continue;
+                const glm::vec2 targetSize = m_renderTarget->getSize();
+                m_transientSpecs.width = declaration.width ? declaration.width : static_cast<unsigned int>(targetSize.x);
+                m_transientSpecs.height = declaration.height ? declaration.height : static_cast<unsigned int>(targetSize.y);
+                m_transientSpecs.attachments.attachments.assign(declaration.attachments.attachments.begin(),
+                                                                declaration.attachments.attachments.end());
+                transient->framebuffer = pool->acquire(m_transientSpecs);
+            }
+
+            pass->execute(*this);
+
+            if (gpuTimer)
+                gpuTimer->end();
+            const auto cpuEnd = std::chrono::steady_clock::now();
+            stats.pass.assign(pass->getName());
+            stats.cpuStartMs = std::chrono::duration<double, std::milli>(cpuStart - profiler.getFrameStart()).count();
+            stats.cpuMs = std::chrono::duration<double, std::milli>(cpuEnd - cpuStart).count();
+            stats.gpuMs = gpuTimer ? gpuTimer->getLastResult() : std::nullopt;
+            stats.counters = NxRenderCommand::getCounters() - countersStart;
+
+            // Released transients are handed to the next acquisitions, of this pipeline or of the next camera
+            for (auto &transient : m_transients) {
+                if (transient.lastUse == i && transient.framebuffer) {
+                    pool->release(transient.framebuffer);
+                    transient.framebuffer = nullptr;
+                }
+            }
+        }
+        profiler.recordPipeline(std::span(m_passStats).first(m_passStatsCount));
+    }
+
+    std::span<const NxPassStats> RenderPipeline::getPassStats() const
+    {
+        return std::span(m_passStats).first(m_passStatsCount);
+    }
+
+    void RenderPipeline::setTransientPool(std::shared_ptr<NxTransientPool> pool)
+    {
+        m_transientPool = std::move(pool);
+    }
+
+    std::shared_ptr<NxFramebuffer> RenderPipeline::getTransient(const std::string &name) const
+    {
+        const auto it = std::ranges::find_if(m_transients, [&name](const LiveTransient &transient) {
+            return *transient.name == name;
+        });
+        return it != m_transients.end() ? it->framebuffer : nullptr;
     }
 
     void RenderPipeline::addDrawCommands(const std::vector<DrawCommand>& drawCommands)
@@ -248,11 +402,184 @@ namespace nexo::renderer {
         m_drawCommands.push_back(drawCommand);
     }
 
+    void RenderPipeline::addDrawCommands(std::shared_ptr<const std::vector<DrawCommand>> drawCommands)
+    {
+        if (drawCommands && !drawCommands->empty()) {
+            m_sharedDrawCommands.push_back(std::move(drawCommands));
+            m_sharedVisibleIndices.emplace_back(std::nullopt);
+        }
+    }
+
+    void RenderPipeline::addDrawCommands(std::shared_ptr<const std::vector<DrawCommand>> drawCommands, const std::span<const uint32_t> visibleIndices)
+    {
+        if (!drawCommands || visibleIndices.empty())
+            return;
+        m_sharedDrawCommands.push_back(std::move(drawCommands));
+        m_sharedVisibleIndices.emplace_back(visibleIndices);
+    }
+
     const std::vector<DrawCommand>& RenderPipeline::getDrawCommands() const
     {
         return m_drawCommands;
     }
 
+    const std::vector<std::shared_ptr<const std::vector<DrawCommand>>>& RenderPipeline::getSharedDrawCommands() const
+    {
+        return m_sharedDrawCommands;
+    }
+
+    size_t RenderPipeline::getDrawCommandCount() const
+    {
+        size_t count = m_drawCommands.size();
+        for (size_t i = 0; i < m_sharedDrawCommands.size(); ++i)
+            count += m_sharedVisibleIndices[i] ? m_sharedVisibleIndices[i]->size() : m_sharedDrawCommands[i]->size();
+        return count;
+    }
+
+    void RenderPipeline::sortDrawCommands()
+    {
+        const glm::vec3 cameraPosition = m_cameraConstants ? glm::vec3(m_cameraConstants->cameraPosition) : glm::vec3(0.0f);
+
+        m_sortedDrawCommands.clear();
+        m_sortedDrawCommands.reserve(getDrawCommandCount());
+        const auto pushCommand = [&](const DrawCommand &cmd) {
+            const float depth = glm::length(cmd.sortPosition - cameraPosition);
+            for (uint32_t bits = cmd.filterMask; bits; bits &= bits - 1) {
+                const auto filterBit = static_cast<unsigned int>(std::countr_zero(bits));
+                m_sortedDrawCommands.push_back({cmd.computeSortKey(filterBit, depth), &cmd});
+            }
+        };
+        for (size_t i = 0; i < m_sharedDrawCommands.size(); ++i) {
+            const auto &list = *m_sharedDrawCommands[i];
+            if (const auto &visibleIndices = m_sharedVisibleIndices[i]) {
+                for (const uint32_t index : *visibleIndices)
+                    pushCommand(list[index]);
+            } else {
+                for (const auto &cmd : list)
+                    pushCommand(cmd);
+            }
+        }
+        for (const auto &cmd : m_drawCommands)
+            pushCommand(cmd);
+
+        radixSort(m_sortedDrawCommands, m_sortScratch, [](const SortedDrawCommand &entry) { return entry.key; });
+
+        // The pass index is the most significant field, each filter bit is a contiguous range
+        m_filterRanges.fill({0, 0});
+        size_t begin = 0;
+        while (begin < m_sortedDrawCommands.size()) {
+            const uint64_t filterBit = m_sortedDrawCommands[begin].key >> sortkey::PASS_SHIFT;
+            size_t end = begin;
+            while (end < m_sortedDrawCommands.size() && m_sortedDrawCommands[end].key >> sortkey::PASS_SHIFT == filterBit)
+                ++end;
+            m_filterRanges[filterBit] = {begin, end};
+            begin = end;
+        }
+    }
+
+    std::span<const RenderPipeline::SortedDrawCommand> RenderPipeline::getSortedDrawCommands(const unsigned int filterBit) const
+    {
+        if (filterBit >= FILTER_BITS)
+            return {};
+        const auto &[begin, end] = m_filterRanges[filterBit];
+        return std::span(m_sortedDrawCommands).subspan(begin, end - begin);
+    }
+
+    void RenderPipeline::batchIndirectCommand(const DrawCommand *cmd)
+    {
+        const NxMeshRange &range = *cmd->meshRange;
+        const auto baseInstance = static_cast<uint32_t>(cmd->isInstanced ? m_instanceData.size() : 0);
+        const NxDrawElementsIndirectCommand indirect{
+            range.indexCount, 1, range.firstIndex, static_cast<int32_t>(range.baseVertex), baseInstance
+        };
+
+        if (!cmd->isInstanced) {
+            m_drawBatches.push_back({cmd, 0, 0, m_indirectCommands.size(), 1});
+            m_indirectCommands.push_back(indirect);
+            return;
+        }
+
+        if (!m_drawBatches.empty() && m_drawBatches.back().indirectCount && m_drawBatches.back().command->canMultiDrawWith(*cmd)) {
+            // Same mesh as the previous draw of the batch: one more instance of it
+            if (NxDrawElementsIndirectCommand &last = m_indirectCommands.back();
+                last.firstIndex == range.firstIndex && last.baseVertex == indirect.baseVertex && last.count == range.indexCount)
+                ++last.instanceCount;
+            else {
+                m_indirectCommands.push_back(indirect);
+                ++m_drawBatches.back().indirectCount;
+            }
+        } else {
+            m_drawBatches.push_back({cmd, 0, 0, m_indirectCommands.size(), 1});
+            m_indirectCommands.push_back(indirect);
+        }
+        m_instanceData.push_back(cmd->instance);
+    }
+
+    void RenderPipeline::executeDrawCommands(const uint32_t filterMask)
+    {
+        m_drawBatches.clear();
+        m_instanceData.clear();
+        m_indirectCommands.clear();
+        for (uint32_t bits = filterMask; bits; bits &= bits - 1) {
+            const auto filterBit = static_cast<unsigned int>(std::countr_zero(bits));
+            const uint32_t previousBits = filterMask & ((1u << filterBit) - 1);
+            for (const auto &[key, cmd] : getSortedDrawCommands(filterBit)) {
+                // Already executed with a lower bit of the mask
+                if (cmd->filterMask & previousBits)
+                    continue;
+                if (cmd->meshRange) {
+                    batchIndirectCommand(cmd);
+                    continue;
+                }
+                if (!cmd->isInstanced) {
+                    m_drawBatches.push_back({cmd, 0, 0});
+                    continue;
+                }
+                // The sort keeps commands sharing shader, material and VAO next to each other
+                if (!m_drawBatches.empty() && m_drawBatches.back().instanceCount && m_drawBatches.back().command->canInstanceWith(*cmd))
+                    ++m_drawBatches.back().instanceCount;
+                else
+                    m_drawBatches.push_back({cmd, m_instanceData.size(), 1});
+                m_instanceData.push_back(cmd->instance);
+            }
+        }
+
+        // Each upload lands wherever the ring has room this frame, so the instance indices are
+        // offset by the start of the range before the indirect commands reference them
+        NxStreamedRange instances;
+        if (!m_instanceData.empty())
+            instances = NxRenderer3D::get().uploadInstanceData(m_instanceData);
+        NxStreamedRange indirect;
+        if (!m_indirectCommands.empty()) {
+            for (auto &command : m_indirectCommands)
+                command.baseInstance += static_cast<uint32_t>(instances.first);
+            indirect = NxRenderer3D::get().uploadIndirectCommands(m_indirectCommands);
+        }
+
+        for (const auto &[cmd, baseInstance, instanceCount, firstIndirect, indirectCount] : m_drawBatches) {
+            if (indirectCount) {
+                cmd->executeIndirect(instances.buffer, indirect.buffer, indirect.first + firstIndirect, indirectCount);
+                // The driver expands the indirect commands, their instances are accounted from the CPU copy
+                uint64_t drawnInstances = 0;
+                uint64_t drawnTriangles = 0;
+                for (size_t i = firstIndirect; i < firstIndirect + indirectCount; ++i) {
+                    drawnInstances += m_indirectCommands[i].instanceCount;
+                    drawnTriangles += static_cast<uint64_t>(m_indirectCommands[i].count / 3) * m_indirectCommands[i].instanceCount;
+                }
+                NxRenderCommand::addDrawnInstances(drawnInstances, drawnTriangles);
+            }
+            else if (instanceCount)
+                cmd->executeInstanced(instances.buffer, instances.first + baseInstance, instanceCount);
+            else
+                cmd->execute();
+        }
+    }
+
+    void RenderPipeline::setCameraConstants(const NxCameraConstants& constants)
+    {
+        m_cameraConstants = constants;
+    }
+
     void RenderPipeline::setCameraClearColor(const glm::vec4& clearColor)
     {
         m_cameraClearColor = clearColor;
@@ -19,9 +19,17 @@
 #include "Framebuffer.hpp"
 #include "RenderPass.hpp"
 #include "DrawCommand.hpp"
+#include "CameraConstants.hpp"
+#include "TransientPool.hpp"
+#include "GpuTimer.hpp"
+#include "RenderProfiler.hpp"
+#include <array>
 #include <vector>
 #include <unordered_map>
 #include <memory>
+#include <optional>
+#include <span>
+#include <string>
 
 namespace nexo::renderer {
 
@@ -63,6 +71,15 @@ namespace nexo::renderer {
             // Execute the pipeline
             void execute();
 
+            // Pool the transients are acquired from, NxTransientPool::getShared() when not set
+            void setTransientPool(std::shared_ptr<NxTransientPool> pool);
+
+            // Transient written during this frame, nullptr outside of its lifetime
+            std::shared_ptr<NxFramebuffer> getTransient(const std::string &name) const;
+
+            // Passes of the execution plan that were not culled by the last execute()
+            const std::vector<PassId> &getActivePasses() const { return m_activePasses; }
+
             // Find terminal passes (passes with no effects)
             std::vector<PassId> findTerminalPasses() const;
 
@@ -74,19 +91,118 @@ namespace nexo::renderer {
 
             void addDrawCommands(const std::vector<DrawCommand> &drawCommands);
             void addDrawCommand(const DrawCommand &drawCommand);
+            // Share an immutable list of commands, e.g. the same scene commands between several cameras
+            void addDrawCommands(std::shared_ptr<const std::vector<DrawCommand>> drawCommands);
+            /**
+             * @brief Shares an immutable list of commands of which only the commands at visibleIndices are drawn, e.g. after culling.
+             *
+             * The indices are not copied, they must stay valid until execute() returns, e.g. by allocating
+             * them from the frame arena of NxRenderer3D.
+             */
+            void addDrawCommands(std::shared_ptr<const std::vector<DrawCommand>> drawCommands, std::span<const uint32_t> visibleIndices);
+            // Commands owned by this pipeline, shared lists are not included
             const std::vector<DrawCommand> &getDrawCommands() const;
+            const std::vector<std::shared_ptr<const std::vector<DrawCommand>>> &getSharedDrawCommands() const;
+            size_t getDrawCommandCount() const;
+
+            /**
+             * @brief Sorts the commands of the frame by key and buckets them per pass filter bit.
+             *
+             * Called by execute() before running the passes. A command matching several filter bits gets
+             * one entry per bit, each pass then walks a single contiguous range of the sorted entries.
+             */
+            void sortDrawCommands();
+
+            /**
+             * @brief Executes every command matching the filter mask in sort key order.
+             *
+             * Consecutive instanced commands that can be drawn together are merged into one instanced
+             * draw, their instance data is streamed through NxRenderer3D::uploadInstanceData.
+             */
+            void executeDrawCommands(uint32_t filterMask);
+
+            // Constants uploaded to the camera constants buffer right before the passes execute
+            void setCameraConstants(const NxCameraConstants &constants);
 
             void setCameraClearColor(const glm::vec4 &clearColor);
             const glm::vec4 &getCameraClearColor() const;
 
             void resize(unsigned int width, unsigned int height) const;
 
+            struct SortedDrawCommand {
+                uint64_t key;
+                const DrawCommand *command;
+            };
+
+            // Sorted entries of a filter bit, valid between sortDrawCommands() and the end of execute()
+            std::span<const SortedDrawCommand> getSortedDrawCommands(unsigned int filterBit) const;
+
+            // Cost of the passes executed by the last execute(), in execution order
+            std::span<const NxPassStats> getPassStats() const;
+
         private:
+            static constexpr unsigned int FILTER_BITS = 32;
+
             std::vector<DrawCommand> m_drawCommands;
+            std::vector<SortedDrawCommand> m_sortedDrawCommands;
+            std::vector<SortedDrawCommand> m_sortScratch;
+
+            struct DrawBatch {
+                const DrawCommand *command;
+                size_t baseInstance;
+                // 0 for commands drawn on their own
+                size_t instanceCount;
+                // Range inside m_indirectCommands, only used by commands drawing from the mesh arena
+                size_t firstIndirect = 0;
+                size_t indirectCount = 0;
+            };
+            std::vector<DrawBatch> m_drawBatches;
+            std::vector<NxInstanceData> m_instanceData;
+            std::vector<NxDrawElementsIndirectCommand> m_indirectCommands;
+
+            void batchIndirectCommand(const DrawCommand *cmd);
+            // [begin, end) of each filter bit inside m_sortedDrawCommands
+            std::array<std::pair<size_t, size_t>, FILTER_BITS> m_filterRanges{};
+            std::vector<std::shared_ptr<const std::vector<DrawCommand>>> m_sharedDrawCommands;
+            // Commands of each shared list drawn by this pipeline, every command of the list when not set
+            std::vector<std::optional<std::span<const uint32_t>>> m_sharedVisibleIndices;
+            std::optional<NxCameraConstants> m_cameraConstants;
             glm::vec4 m_cameraClearColor{};
             std::vector<PassId> m_plan{};
             bool m_isDirty = true;
 
+            /**
+             * @brief Keeps the passes of the plan with work this frame.
+             *
+             * Removing a pass can starve the passes reading its transients or leave the passes writing
+             * the transients it read without readers, so the culling repeats until nothing changes.
+             */
+            void cullPasses();
+            // Runs the active passes, acquiring each transient before its first use and releasing it after its last
+            void executeActivePasses();
+
+            struct LiveTransient {
+                // Points into the declarations of the passes, stable for the frame
+                const std::string *name;
+                std::shared_ptr<NxFramebuffer> framebuffer;
+                // Index inside m_activePasses of the last pass using the transient
+                size_t lastUse;
+            };
+            [[nodiscard]] LiveTransient *findTransient(const std::string &name);
+
+            std::vector<PassId> m_activePasses;
+            std::shared_ptr<NxTransientPool> m_transientPool = nullptr;
+            // Transients of the frame, a pipeline only has a handful so they are scanned linearly
+            std::vector<LiveTransient> m_transients;
+            // Reused between acquisitions so requesting a transient does not allocate
+            NxFramebufferSpecs m_transientSpecs;
+
+            // Never shrunk so the pass names keep their storage between frames
+            std::vector<NxPassStats> m_passStats;
+            size_t m_passStatsCount = 0;
+            // Created on the first frame a pass is timed, only while GPU timing is enabled
+            std::unordered_map<PassId, std::shared_ptr<NxGpuTimer>> m_gpuTimers;
+
             // Store all render passes
             std::unordered_map<PassId, std::shared_ptr<RenderPass>> passes;
 
@@ -0,0 +1,158 @@
+//// RenderProfiler.cpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the per pass render profiler
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "RenderProfiler.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+#include <format>
+
+namespace nexo::renderer {
+
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    using Microseconds = std::chrono::duration<double, std::micro>;
+
+    NxRenderProfiler &NxRenderProfiler::get()
+    {
+        static NxRenderProfiler profiler;
+        return profiler;
+    }
+
+    void NxRenderProfiler::beginFrame()
+    {
+        m_frameStart = std::chrono::steady_clock::now();
+        m_frameOpen = true;
+        m_passCount = 0;
+        m_cameras.clear();
+    }
+
+    unsigned int NxRenderProfiler::recordPipeline(const std::span<NxPassStats> passes)
+    {
+        if (!m_frameOpen)
+            return 0;
+
+        const auto camera = static_cast<unsigned int>(m_cameras.size());
+        NxCameraStats &cameraStats = m_cameras.emplace_back();
+        cameraStats.camera = camera;
+        if (m_passes.size() < m_passCount + passes.size())
+            m_passes.resize(m_passCount + passes.size());
+        for (auto &pass : passes) {
+            pass.camera = camera;
+            cameraStats.cpuMs += pass.cpuMs;
+            cameraStats.gpuMs += pass.gpuMs.value_or(0.0);
+            cameraStats.counters += pass.counters;
+            m_passes[m_passCount++] = pass;
+        }
+        return camera;
+    }
+
+    void NxRenderProfiler::endFrame()
+    {
+        if (!m_frameOpen)
+            return;
+        m_frameOpen = false;
+        m_lastFrameCpuMs = Milliseconds(std::chrono::steady_clock::now() - m_frameStart).count();
+
+        // Swapping keeps the storage of both frames, the strings of the next frame are assigned in place
+        std::swap(m_passes, m_lastPasses);
+        std::swap(m_passCount, m_lastPassCount);
+        std::swap(m_cameras, m_lastCameras);
+
+        if (isTracing())
+            writeTrace(Microseconds(m_frameStart - m_traceStart).count());
+    }
+
+    std::span<const NxPassStats> NxRenderProfiler::getPassStats() const
+    {
+        return std::span(m_lastPasses).first(m_lastPassCount);
+    }
+
+    std::span<const NxCameraStats> NxRenderProfiler::getCameraStats() const
+    {
+        return m_lastCameras;
+    }
+
+    void NxRenderProfiler::startTrace(const std::filesystem::path &path)
+    {
+        stopTrace();
+        m_trace.open(path, std::ios::trunc);
+        if (!m_trace)
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Cannot open the trace file " + path.string());
+        m_trace << "[\n";
+        m_traceStart = std::chrono::steady_clock::now();
+        m_firstTraceEvent = true;
+    }
+
+    void NxRenderProfiler::stopTrace()
+    {
+        if (!isTracing())
+            return;
+        m_trace << "\n]\n";
+        m_trace.close();
+    }
+
+    static std::string escapeJson(const std::string_view text)
+    {
+        std::string escaped;
+        escaped.reserve(text.size());
+        for (const char c : text) {
+            switch (c) {
+                case '"': escaped += "\\\""; break;
+                case '\\': escaped += "\\\\"; break;
+                case '\n': escaped += "\\n"; break;
+                case '\t': escaped += "\\t"; break;
+                default:
+                    // JSON strings cannot hold raw control characters
+                    if (static_cast<unsigned char>(c) < 0x20)
+                        escaped += std::format("\\u{:04x}", static_cast<unsigned int>(c));
+                    else
+                        escaped += c;
+            }
+        }
+        return escaped;
+    }
+
+    void NxRenderProfiler::writeTrace(const double frameStartUs)
+    {
+        const auto separator = [this]() {
+            if (!m_firstTraceEvent)
+                m_trace << ",\n";
+            m_firstTraceEvent = false;
+        };
+
+        // Thread 0 holds the frames, each camera gets its own track below it
+        separator();
+        m_trace << std::format(
+            R"({{"name":"Frame","cat":"frame","ph":"X","pid":0,"tid":0,"ts":{:.3f},"dur":{:.3f}}})",
+            frameStartUs, m_lastFrameCpuMs * 1000.0);
+        for (const auto &pass : getPassStats()) {
+            const auto &counters = pass.counters;
+            separator();
+            m_trace << std::format(
+                R"({{"name":"{}","cat":"pass","ph":"X","pid":0,"tid":{},"ts":{:.3f},"dur":{:.3f},"args":{{)"
+                R"("gpuMs":{},"drawCalls":{},"instances":{},"triangles":{},"stateChanges":{},"uploadedBytes":{},"textureBinds":{}}}}})",
+                escapeJson(pass.pass), pass.camera + 1, frameStartUs + pass.cpuStartMs * 1000.0, pass.cpuMs * 1000.0,
+                pass.gpuMs ? std::format("{:.3f}", *pass.gpuMs) : "null", counters.drawCalls, counters.instances,
+                counters.triangles, counters.stateChanges, counters.uploadedBytes, counters.textureBinds);
+        }
+        m_trace.flush();
+    }
+
+}
@@ -0,0 +1,123 @@
+//// RenderProfiler.hpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the per pass render profiler
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "RenderCounters.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @brief Cost of one pass of a pipeline during a frame.
+     */
+    struct NxPassStats {
+        std::string pass;
+        unsigned int camera = 0;      ///< Index of the pipeline in the execution order of the frame
+        double cpuStartMs = 0.0;      ///< Start of the pass, from the beginning of the frame
+        double cpuMs = 0.0;
+        std::optional<double> gpuMs;  ///< Latest GPU measure of the pass, a few frames old
+        NxRenderCounters counters;
+    };
+
+    /**
+     * @brief Cost of all the passes of a camera during a frame.
+     */
+    struct NxCameraStats {
+        unsigned int camera = 0;
+        double cpuMs = 0.0;
+        double gpuMs = 0.0;           ///< Sum of the GPU measures available for the passes
+        NxRenderCounters counters;
+    };
+
+    /**
+     * @class NxRenderProfiler
+     * @brief Collects the per pass statistics of the pipelines executed during a frame.
+     *
+     * The renderer opens and closes the frame, each pipeline records its passes when it executes.
+     * The statistics of the last completed frame are kept until the next one ends, and can be
+     * appended to a trace file in the Chrome trace event format (chrome://tracing, Perfetto).
+     *
+     * GPU timings are opt-in since they need a graphics context, the CPU timings and counters are
+     * always collected. Recording does not allocate once the frame layout is stable.
+     */
+    class NxRenderProfiler {
+        public:
+            static NxRenderProfiler &get();
+
+            void beginFrame();
+            void endFrame();
+
+            /**
+             * @brief Records the passes of a pipeline, ignored outside of beginFrame() / endFrame().
+             *
+             * @return The index of the camera in the frame.
+             */
+            unsigned int recordPipeline(std::span<NxPassStats> passes);
+
+            [[nodiscard]] bool isFrameOpen() const { return m_frameOpen; }
+            [[nodiscard]] std::chrono::steady_clock::time_point getFrameStart() const { return m_frameStart; }
+
+            [[nodiscard]] std::span<const NxPassStats> getPassStats() const;
+            [[nodiscard]] std::span<const NxCameraStats> getCameraStats() const;
+            [[nodiscard]] double getFrameCpuMs() const { return m_lastFrameCpuMs; }
+
+            void setGpuTimingEnabled(const bool enabled) { m_gpuTimingEnabled = enabled; }
+            [[nodiscard]] bool isGpuTimingEnabled() const { return m_gpuTimingEnabled; }
+
+            /**
+             * @brief Starts appending every frame to a trace file, replacing its content.
+             *
+             * Throws:
+             * - NxInvalidValue if the file can't be opened.
+             */
+            void startTrace(const std::filesystem::path &path);
+            void stopTrace();
+            [[nodiscard]] bool isTracing() const { return m_trace.is_open(); }
+
+        private:
+            void writeTrace(double frameStartUs);
+
+            bool m_frameOpen = false;
+            bool m_gpuTimingEnabled = false;
+            std::chrono::steady_clock::time_point m_frameStart;
+
+            // Elements past the counts are kept so their strings keep their storage
+            std::vector<NxPassStats> m_passes;
+            size_t m_passCount = 0;
+            std::vector<NxCameraStats> m_cameras;
+            std::vector<NxPassStats> m_lastPasses;
+            size_t m_lastPassCount = 0;
+            std::vector<NxCameraStats> m_lastCameras;
+            double m_lastFrameCpuMs = 0.0;
+
+            std::ofstream m_trace;
+            std::chrono::steady_clock::time_point m_traceStart;
+            bool m_firstTraceEvent = true;
+    };
+
+}
@@ -19,10 +19,13 @@
 #include "ShaderLibrary.hpp"
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/string_cast.hpp>
-#include <array>
+#include <algorithm>
+#include <cstring>
 
 #include "Renderer3D.hpp"
 #include "RenderCommand.hpp"
+#include "TransientPool.hpp"
+#include "RenderProfiler.hpp"
 #include "Logger.hpp"
 #include "Shader.hpp"
 #include "renderer/RendererExceptions.hpp"
@@ -58,25 +61,16 @@ namespace nexo::renderer {
         unsigned int whiteTextureData = 0xffffffff;
         m_storage->whiteTexture->setData(&whiteTextureData, sizeof(unsigned int));
 
-        // Shader
-        std::array<int, NxRenderer3DStorage::maxTextureSlots> samplers{};
-        for (int i = 0; i < static_cast<int>(NxRenderer3DStorage::maxTextureSlots); ++i)
-            samplers[i] = i;
-
-        const auto phong = ShaderLibrary::getInstance().get("Phong");
-        const auto outlinePulseTransparentFlat = ShaderLibrary::getInstance().get("Outline pulse transparent flat");
-        const auto albedoUnshadedTransparent = ShaderLibrary::getInstance().get("Albedo unshaded transparent");
-        phong->bind();
-        phong->setUniformIntArray(NxShaderUniforms::TEXTURE_SAMPLER, samplers.data(), NxRenderer3DStorage::maxTextureSlots);
-        phong->unbind();
-        outlinePulseTransparentFlat->bind();
-        outlinePulseTransparentFlat->setUniformIntArray(NxShaderUniforms::TEXTURE_SAMPLER, samplers.data(), NxRenderer3DStorage::maxTextureSlots);
-        outlinePulseTransparentFlat->unbind();
-        albedoUnshadedTransparent->bind();
-        albedoUnshadedTransparent->setUniformIntArray(NxShaderUniforms::TEXTURE_SAMPLER, samplers.data(), NxRenderer3DStorage::maxTextureSlots);
-        albedoUnshadedTransparent->unbind();
-
-        m_storage->textureSlots[0] = m_storage->whiteTexture;
+        // Material textures are sampled through the table, bound once per frame
+        m_storage->textureTable = NxTextureTable::create(m_storage->whiteTexture);
+        m_storage->materialTable = std::make_shared<NxMaterialTable>();
+
+        m_storage->sceneLightsBuffer = NxShaderStorageBuffer::create(sizeof(NxSceneLightsData));
+        m_storage->sceneLightsBuffer->bindBase(NX_SCENE_LIGHTS_BINDING);
+        m_storage->cameraConstantsBuffer = NxUniformBuffer::create(sizeof(NxCameraConstants));
+        m_storage->cameraConstantsBuffer->bindBase(NX_CAMERA_CONSTANTS_BINDING);
+        m_storage->instanceRing = NxRingBuffer::create(1024 * sizeof(NxInstanceData));
+        m_storage->indirectRing = NxRingBuffer::create(256 * sizeof(NxDrawElementsIndirectCommand));
 
         LOG(NEXO_DEV, "NxRenderer3D initialized");
     }
@@ -86,23 +80,8 @@ namespace nexo::renderer {
         if (!m_storage)
             THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
         m_storage.reset();
-    }
-
-    void NxRenderer3D::bindTextures() const
-    {
-        for (unsigned int i = 0; i < m_storage->textureSlotIndex; ++i)
-        {
-            m_storage->textureSlots[i]->bind(i);
-        }
-    }
-
-    void NxRenderer3D::unbindTextures() const
-    {
-        for (unsigned int i = 0; i < m_storage->textureSlotIndex; ++i)
-        {
-            m_storage->textureSlots[i]->unbind(i);
-        }
-        m_storage->textureSlotIndex = 1;
+        // The shared pool is a static, its framebuffers must go while the context is still alive
+        NxTransientPool::getShared()->clear();
     }
 
     void NxRenderer3D::beginScene(const glm::mat4 &viewProjection, const glm::vec3 &cameraPos, const std::string &shader)
@@ -116,13 +95,11 @@ namespace nexo::renderer {
         m_storage->currentSceneShader->bind();
         m_storage->vertexArray->bind();
         m_storage->vertexBuffer->bind();
-        m_storage->currentSceneShader->setUniformMatrix("uViewProjection", viewProjection);
         m_storage->cameraPosition = cameraPos;
-        m_storage->currentSceneShader->setUniformFloat3("uCamPos", cameraPos);
+        uploadCameraConstants({viewProjection, glm::vec4(cameraPos, 1.0f)});
         m_storage->indexCount = 0;
-        m_storage->vertexBufferPtr = m_storage->vertexBufferBase.data();
-        m_storage->indexBufferPtr = m_storage->indexBufferBase.data();
-        m_storage->textureSlotIndex = 1;
+        m_storage->batchVertices.clear();
+        m_storage->batchIndices.clear();
         m_renderingScene = true;
     }
 
@@ -133,15 +110,11 @@ namespace nexo::renderer {
         if (!m_renderingScene)
             THROW_EXCEPTION(NxRendererSceneLifeCycleFailure, NxRendererType::RENDERER_3D,
                         "Renderer not rendering a scene, make sure to call beginScene first");
-        const auto vertexDataSize = static_cast<unsigned int>(
-            reinterpret_cast<std::byte*>(m_storage->vertexBufferPtr) -
-            reinterpret_cast<std::byte*>(m_storage->vertexBufferBase.data())
-        );
-
-
-        m_storage->vertexBuffer->setData(m_storage->vertexBufferBase.data(), vertexDataSize);
-
-        m_storage->indexBuffer->setData(m_storage->indexBufferBase.data(), m_storage->indexCount);
+        if (!m_storage->batchVertices.empty())
+            m_storage->vertexBuffer->setData(m_storage->batchVertices.data(),
+                static_cast<unsigned int>(m_storage->batchVertices.size() * sizeof(NxVertex)));
+        if (!m_storage->batchIndices.empty())
+            m_storage->indexBuffer->setData(m_storage->batchIndices.data(), m_storage->indexCount);
 
         flushAndReset();
     }
@@ -149,73 +122,128 @@ namespace nexo::renderer {
     void NxRenderer3D::flush() const
     {
         m_storage->currentSceneShader->bind();
-        for (unsigned int i = 0; i < m_storage->textureSlotIndex; ++i)
-        {
-            m_storage->textureSlots[i]->bind(i);
-        }
         NxRenderCommand::drawIndexed(m_storage->vertexArray, m_storage->indexCount);
         m_storage->stats.drawCalls++;
         m_storage->vertexArray->unbind();
         m_storage->vertexBuffer->unbind();
         m_storage->currentSceneShader->unbind();
-        for (unsigned int i = 0; i < m_storage->textureSlotIndex; ++i)
-        {
-            m_storage->textureSlots[i]->unbind(i);
-        }
     }
 
     void NxRenderer3D::flushAndReset() const
     {
         flush();
         m_storage->indexCount = 0;
-        m_storage->vertexBufferPtr = m_storage->vertexBufferBase.data();
-        m_storage->indexBufferPtr = m_storage->indexBufferBase.data();
-        m_storage->textureSlotIndex = 1;
+        m_storage->batchVertices.clear();
+        m_storage->batchIndices.clear();
     }
 
     int NxRenderer3D::getTextureIndex(const std::shared_ptr<NxTexture2D> &texture) const
     {
-        int textureIndex = 0;
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+
+        return m_storage->textureTable->getIndex(texture);
+    }
+
+    std::shared_ptr<NxMaterialTable> NxRenderer3D::getMaterialTable() const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+
+        return m_storage->materialTable;
+    }
 
-        if (!texture)
-            return textureIndex;
+    NxFrameArena &NxRenderer3D::getFrameArena() const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
 
-        for (unsigned int i = 0; i < m_storage->textureSlotIndex; ++i)
-        {
-            if (*m_storage->textureSlots[i].get() == *texture)
-            {
-                textureIndex = static_cast<int>(i);
-                break;
-            }
-        }
+        return m_storage->frameArena;
+    }
 
-        if (textureIndex == 0)
-        {
-            textureIndex = static_cast<int>(m_storage->textureSlotIndex);
-            m_storage->textureSlots[m_storage->textureSlotIndex] = texture;
-            m_storage->textureSlotIndex++;
-        }
+    void NxRenderer3D::uploadSceneLights(const NxSceneLightsData& lights) const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
 
-        return textureIndex;
+        m_storage->sceneLightsBuffer->setData(const_cast<NxSceneLightsData *>(&lights), sizeof(NxSceneLightsData));
+        m_storage->sceneLightsBuffer->bindBase(NX_SCENE_LIGHTS_BINDING);
     }
 
-    void NxRenderer3D::setMaterialUniforms(const NxIndexedMaterial& material) const
+    void NxRenderer3D::uploadCameraConstants(const NxCameraConstants& constants) const
     {
         if (!m_storage)
             THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
 
-        m_storage->currentSceneShader->setUniformFloat4("uMaterial.albedoColor", material.albedoColor);
-        m_storage->currentSceneShader->setUniformInt("uMaterial.albedoTexIndex", material.albedoTexIndex);
-        m_storage->currentSceneShader->setUniformFloat4("uMaterial.specularColor", material.specularColor);
-        m_storage->currentSceneShader->setUniformInt("uMaterial.specularTexIndex", material.specularTexIndex);
-        m_storage->currentSceneShader->setUniformFloat3("uMaterial.emissiveColor", material.emissiveColor);
-        m_storage->currentSceneShader->setUniformInt("uMaterial.emissiveTexIndex", material.emissiveTexIndex);
-        m_storage->currentSceneShader->setUniformFloat("uMaterial.roughness", material.roughness);
-        m_storage->currentSceneShader->setUniformInt("uMaterial.roughnessTexIndex", material.roughnessTexIndex);
-        m_storage->currentSceneShader->setUniformFloat("uMaterial.metallic", material.metallic);
-        m_storage->currentSceneShader->setUniformInt("uMaterial.metallicTexIndex", material.metallicTexIndex);
-        m_storage->currentSceneShader->setUniformFloat("uMaterial.opacity", material.opacity);
-        m_storage->currentSceneShader->setUniformInt("uMaterial.opacityTexIndex", material.opacityTexIndex);
+        m_storage->cameraConstantsBuffer->setData(&constants, sizeof(NxCameraConstants));
+        m_storage->cameraConstantsBuffer->bindBase(NX_CAMERA_CONSTANTS_BINDING);
+    }
+
+    void NxRenderer3D::beginFrame() const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+
+        m_storage->instanceRing->beginFrame();
+        m_storage->indirectRing->beginFrame();
+        m_storage->frameArena.reset();
+        NxRenderCommand::invalidateState();
+        m_storage->textureTable->bind();
+        NxRenderProfiler::get().beginFrame();
+    }
+
+    void NxRenderer3D::endFrame() const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+
+        m_storage->instanceRing->endFrame();
+        m_storage->indirectRing->endFrame();
+        NxTransientPool::getShared()->endFrame();
+
+        NxRenderProfiler::get().endFrame();
+        m_storage->stats.frameCounters = NxRenderCommand::getCounters();
+        m_storage->stats.redundantStateChangesAvoided = NxRenderCommand::getStateCache().getAvoidedCount();
+        NxRenderCommand::resetCounters();
+    }
+
+    /**
+     * @brief Copies elements to a range of the current frame, aligned on the element size so the range
+     * can be addressed by index.
+     */
+    template<typename T>
+    static NxStreamedRange streamToRing(NxRingBuffer &ring, const std::span<const T> elements)
+    {
+        if (elements.empty())
+            return {ring.getBuffer(), 0};
+        const auto [data, offset] = ring.allocate(elements.size_bytes(), sizeof(T));
+        std::memcpy(data, elements.data(), elements.size_bytes());
+        NxRenderCommand::addUploadedBytes(elements.size_bytes());
+        return {ring.getBuffer(), offset / sizeof(T)};
+    }
+
+    NxStreamedRange NxRenderer3D::uploadInstanceData(const std::span<const NxInstanceData> instances) const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+
+        return streamToRing(*m_storage->instanceRing, instances);
+    }
+
+    NxStreamedRange NxRenderer3D::uploadIndirectCommands(const std::span<const NxDrawElementsIndirectCommand> commands) const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+
+        return streamToRing(*m_storage->indirectRing, commands);
+    }
+
+    std::shared_ptr<NxMeshArena> NxRenderer3D::getMeshArena()
+    {
+        static std::shared_ptr<NxMeshArena> meshArena = nullptr;
+        if (!meshArena)
+            meshArena = NxMeshArena::create(1 << 16, 3 << 16);
+        return meshArena;
     }
 
     void NxRenderer3D::resetStats() const
@@ -224,6 +252,18 @@ namespace nexo::renderer {
             THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
         m_storage->stats.drawCalls = 0;
         m_storage->stats.cubeCount = 0;
+        m_storage->stats.visibleMeshCount = 0;
+        m_storage->stats.culledMeshCount = 0;
+        m_storage->stats.frameCounters = {};
+        m_storage->stats.redundantStateChangesAvoided = 0;
+    }
+
+    void NxRenderer3D::setCullingStats(const unsigned int visibleMeshCount, const unsigned int culledMeshCount) const
+    {
+        if (!m_storage)
+            THROW_EXCEPTION(NxRendererNotInitialized, NxRendererType::RENDERER_3D);
+        m_storage->stats.visibleMeshCount = visibleMeshCount;
+        m_storage->stats.culledMeshCount = culledMeshCount;
     }
 
     NxRenderer3DStats NxRenderer3D::getStats() const
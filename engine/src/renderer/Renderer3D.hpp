@@ -17,42 +17,28 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include "CameraConstants.hpp"
+#include "InstanceData.hpp"
+#include "MaterialTable.hpp"
+#include "FrameArena.hpp"
+#include "MeshArena.hpp"
+#include "RendererAPI.hpp"
+#include "RingBuffer.hpp"
 #include "Shader.hpp"
+#include "SceneLights.hpp"
+#include "ShaderStorageBuffer.hpp"
+#include "UniformBuffer.hpp"
+#include "Vertex.hpp"
 #include "VertexArray.hpp"
 #include "Texture.hpp"
+#include "TextureTable.hpp"
 
-#include <array>
+#include <span>
+#include <vector>
 #include <glm/glm.hpp>
 
 namespace nexo::renderer
 {
-    struct NxVertex
-    {
-        glm::vec3 position;
-        glm::vec2 texCoord;
-        glm::vec3 normal;
-        glm::vec3 tangent;
-        glm::vec3 bitangent;
-
-        int entityID;
-    };
-
-    struct NxIndexedMaterial
-    {
-        glm::vec4 albedoColor = glm::vec4(1.0f);
-        int albedoTexIndex = 0; // Default: 0 (white texture)
-        glm::vec4 specularColor = glm::vec4(1.0f);
-        int specularTexIndex = 0; // Default: 0 (white texture)
-        glm::vec3 emissiveColor = glm::vec3(0.0f);
-        int emissiveTexIndex = 0; // Default: 0 (white texture)
-        float roughness = 0.5f;
-        int roughnessTexIndex = 0; // Default: 0 (white texture)
-        float metallic = 0.0f;
-        int metallicTexIndex = 0; // Default: 0 (white texture)
-        float opacity = 1.0f;
-        int opacityTexIndex = 0; // Default: 0 (white texture)
-    };
-
     struct NxMaterial
     {
         glm::vec4 albedoColor = glm::vec4(1.0f);
@@ -72,16 +58,30 @@ namespace nexo::renderer
         std::string shader;
     };
 
-    //TODO: Add stats for the meshes
     struct NxRenderer3DStats
     {
         unsigned int drawCalls = 0;
         unsigned int cubeCount = 0;
+        // Meshes kept and rejected by frustum culling during the last frame, summed over every camera
+        unsigned int visibleMeshCount = 0;
+        unsigned int culledMeshCount = 0;
+        // Work submitted to the renderer api during the last frame, the per pass split lives in NxRenderProfiler
+        NxRenderCounters frameCounters;
+        // State changes skipped by the render command state cache during the last frame
+        uint64_t redundantStateChangesAvoided = 0;
 
         [[nodiscard]] unsigned int getTotalVertexCount() const { return cubeCount * 8; }
         [[nodiscard]] unsigned int getTotalIndexCount() const { return cubeCount * 36; }
     };
 
+    /**
+     * @brief Elements streamed to a ring buffer during the current frame.
+     */
+    struct NxStreamedRange {
+        std::shared_ptr<NxVertexBuffer> buffer = nullptr;
+        size_t first = 0; ///< Index of the first element in the buffer
+    };
+
     /**
      * @struct NxRenderer3DStorage
      * @brief Holds internal data and resources used by NxRenderer3D.
@@ -91,9 +91,11 @@ namespace nexo::renderer
      * - `vertexArray`, `vertexBuffer`, `indexBuffer`: Buffers for storing cube data.
      * - `whiteTexture`: Default texture used for untextured objects.
      * - `textureShader`: Shader used for rendering.
-     * - `textureSlots`: Array of texture slots for batching textures.
-     * - `vertexBufferBase`, `indexBufferBase`: Base pointers for vertex and index data.
-     * - `vertexBufferPtr`, `indexBufferPtr`: Current pointers for batching vertices and indices.
+     * - `textureTable`: Indices of the material textures sampled by the shaders.
+     * - `materialTable`: Materials of the draws, indexed by `uMaterialIndex`.
+     * - `batchVertices`, `batchIndices`: Vertices and indices batched since the last flush, grown on demand.
+     * - `instanceRing`, `indirectRing`: Persistently mapped rings streaming per-frame instance data and indirect commands.
+     * - `frameArena`: CPU memory of the render data living until the next frame, rewound by `beginFrame`.
      * - `stats`: Rendering statistics.
      */
     struct NxRenderer3DStorage
@@ -101,7 +103,6 @@ namespace nexo::renderer
         const unsigned int maxCubes = 10000;
         const unsigned int maxVertices = maxCubes * 8;
         const unsigned int maxIndices = maxCubes * 36;
-        static constexpr unsigned int maxTextureSlots = 32;
         static constexpr unsigned int maxTransforms = 1024;
 
         glm::vec3 cameraPosition;
@@ -113,13 +114,19 @@ namespace nexo::renderer
         std::shared_ptr<NxTexture2D> whiteTexture;
 
         unsigned int indexCount = 0;
-        std::array<NxVertex, 80000> vertexBufferBase;
-        std::array<unsigned int, 360000> indexBufferBase;
-        NxVertex* vertexBufferPtr = nullptr;
-        unsigned int* indexBufferPtr = nullptr;
+        std::vector<NxVertex> batchVertices;
+        std::vector<unsigned int> batchIndices;
+
+        std::shared_ptr<NxTextureTable> textureTable;
+        std::shared_ptr<NxMaterialTable> materialTable;
+
+        std::shared_ptr<NxShaderStorageBuffer> sceneLightsBuffer;
+        std::shared_ptr<NxUniformBuffer> cameraConstantsBuffer;
 
-        std::array<std::shared_ptr<NxTexture2D>, maxTextureSlots> textureSlots;
-        unsigned int textureSlotIndex = 1;
+        std::shared_ptr<NxRingBuffer> instanceRing;
+        std::shared_ptr<NxRingBuffer> indirectRing;
+
+        NxFrameArena frameArena;
 
         NxRenderer3DStats stats;
     };
@@ -161,14 +168,14 @@ namespace nexo::renderer
         /**
          * @brief Initializes the NxRenderer3D and allocates required resources.
          *
-         * Sets up internal storage, vertex buffers, index buffers, and texture samplers.
+         * Sets up internal storage, vertex buffers, index buffers, and the texture table.
          * Prepares the default white texture and initializes the texture shader.
          *
          * Responsibilities:
          * - Creates and configures vertex and index buffers.
          * - Allocates memory for vertex and index data.
          * - Sets up default white texture for rendering objects without textures.
-         * - Configures the texture shader and binds texture samplers.
+         * - Creates the texture table, with the white texture at index 0.
          *
          * Throws:
          * - Exceptions if buffer allocation or shader creation fails.
@@ -188,9 +195,6 @@ namespace nexo::renderer
          */
         void shutdown();
 
-        void bindTextures() const;
-        void unbindTextures() const;
-
         /**
          * @brief Begins a new 3D rendering scene.
          *
@@ -219,12 +223,20 @@ namespace nexo::renderer
         void endScene() const;
 
         static std::shared_ptr<NxVertexArray> getCubeVAO();
+
         static std::shared_ptr<NxVertexArray> getBillboardVAO();
         static std::shared_ptr<NxVertexArray> getTetrahedronVAO();
         static std::shared_ptr<NxVertexArray> getPyramidVAO();
         static std::shared_ptr<NxVertexArray> getCylinderVAO(unsigned int nbSegment);
         static std::shared_ptr<NxVertexArray> getSphereVAO(unsigned int nbSubdivision);
 
+        /**
+         * @brief Returns the arena holding the geometry of the imported meshes, created on first use.
+         *
+         * Meshes living in the arena share one vertex array and are drawn with multi-draw-indirect.
+         */
+        static std::shared_ptr<NxMeshArena> getMeshArena();
+
         /**
          * @brief Resets rendering statistics.
          *
@@ -245,19 +257,133 @@ namespace nexo::renderer
          */
         [[nodiscard]] NxRenderer3DStats getStats() const;
 
+        /**
+         * @brief Records the frustum culling results of the current frame.
+         *
+         * @param visibleMeshCount Number of meshes drawn, summed over every camera.
+         * @param culledMeshCount Number of meshes rejected, summed over every camera.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         */
+        void setCullingStats(unsigned int visibleMeshCount, unsigned int culledMeshCount) const;
+
         [[nodiscard]] std::shared_ptr<NxShader>& getShader() const { return m_storage->currentSceneShader; };
 
         [[nodiscard]] std::shared_ptr<NxRenderer3DStorage> getInternalStorage() const { return m_storage; };
 
         /**
-         * @brief Returns the texture index for a given texture.
+         * @brief Returns the index shaders sample a texture at.
+         *
+         * Registers the texture in the texture table the first time it is seen, see NxTextureTable.
          *
-         * Searches the texture slots for an existing binding. If not found, assigns a new slot.
+         * @param texture The texture to look up, null textures use the white texture.
+         * @return int The texture index.
          *
-         * @param texture The texture to look up.
-         * @return float The texture index.
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
          */
         [[nodiscard]] int getTextureIndex(const std::shared_ptr<NxTexture2D>& texture) const;
+
+        /**
+         * @brief Returns the table holding the materials of the draws.
+         *
+         * Draws select their entry with the `uMaterialIndex` uniform, the table has to be uploaded
+         * before the pipelines execute once its entries changed.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         */
+        [[nodiscard]] std::shared_ptr<NxMaterialTable> getMaterialTable() const;
+
+        /**
+         * @brief Returns the arena of the render data built for the current frame.
+         *
+         * Allocations stay valid until the next beginFrame(), after every pipeline executed. The arena
+         * must only be used from the render thread.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         */
+        [[nodiscard]] NxFrameArena &getFrameArena() const;
+
+        /**
+         * @brief Uploads the lights of the scene being rendered and binds them for every shader.
+         *
+         * The data is written to a single storage buffer bound at `NX_SCENE_LIGHTS_BINDING`, so it only has
+         * to be uploaded once per scene and frame instead of being set on each draw command.
+         *
+         * @param lights The packed lights of the scene.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         */
+        void uploadSceneLights(const NxSceneLightsData& lights) const;
+
+        /**
+         * @brief Uploads the constants of the camera about to be rendered.
+         *
+         * Every shader declaring the `CameraConstants` block reads them from `NX_CAMERA_CONSTANTS_BINDING`,
+         * so the draw commands do not carry the view projection matrix or the camera position themselves.
+         *
+         * @param constants The constants of the camera.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         */
+        void uploadCameraConstants(const NxCameraConstants& constants) const;
+
+        /**
+         * @brief Starts a new frame on the streaming rings.
+         *
+         * Waits for the GPU to be done with the region reused by this frame, which was submitted
+         * several frames ago and is usually already free. Also rewinds the frame arena, binds the
+         * texture table and invalidates the render command state cache, since UI backends may have
+         * changed the bound state since the last frame.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         */
+        void beginFrame() const;
+
+        /**
+         * @brief Fences the data streamed during the frame and ages the transient render targets.
+         *
+         * Must be called once all the draws of the frame are submitted. The state changes counted by
+         * the render command state cache during the frame are published in the stats.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         */
+        void endFrame() const;
+
+        /**
+         * @brief Streams per-instance data to the instance ring.
+         *
+         * Every call reserves its own range in the region of the current frame, so several cameras can
+         * upload their instances during the same frame. The draws address the range through `first`
+         * as their base instance.
+         *
+         * @param instances The instances of the batches about to be drawn.
+         * @return The instance buffer and the index of the first uploaded instance.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         */
+        [[nodiscard]] NxStreamedRange uploadInstanceData(std::span<const NxInstanceData> instances) const;
+
+        /**
+         * @brief Streams multi-draw-indirect commands to the indirect ring.
+         *
+         * Works the same way as uploadInstanceData, `first` being the index of the first command.
+         *
+         * @param commands The indirect commands of the draws about to be submitted.
+         * @return The indirect buffer and the index of the first uploaded command.
+         *
+         * Throws:
+         * - NxRendererNotInitialized if the renderer is not initialized.
+         */
+        [[nodiscard]] NxStreamedRange uploadIndirectCommands(std::span<const NxDrawElementsIndirectCommand> commands) const;
     private:
         std::shared_ptr<NxRenderer3DStorage> m_storage;
         bool m_renderingScene = false;
@@ -275,16 +401,5 @@ namespace nexo::renderer
         void flushAndReset() const;
 
 
-
-        /**
-         * @brief Sets material-related uniforms in the texture shader.
-         *
-         * Updates uniforms for albedo, specular, emissive, roughness, metallic, and opacity properties.
-         *
-         * @param material The material whose properties are to be set.
-         *
-         * @throws NxRendererNotInitialized if the renderer is not initialized.
-         */
-        void setMaterialUniforms(const NxIndexedMaterial& material) const;
     };
 }
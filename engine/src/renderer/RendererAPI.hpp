@@ -18,9 +18,13 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include <cstdint>
 #include <memory>
 
 #include "VertexArray.hpp"
+#include "Buffer.hpp"
+#include "StateCache.hpp"
+#include "RenderCounters.hpp"
 
 namespace nexo::renderer {
 
@@ -35,6 +39,17 @@ namespace nexo::renderer {
         CCW
     };
 
+    /**
+     * @brief Layout of one command of a multi-draw-indirect buffer, matches `DrawElementsIndirectCommand`.
+     */
+    struct NxDrawElementsIndirectCommand {
+        uint32_t count;
+        uint32_t instanceCount;
+        uint32_t firstIndex;
+        int32_t baseVertex;
+        uint32_t baseInstance;
+    };
+
     /**
     * @class NxRendererApi
     * @brief Abstract interface for low-level rendering API implementations.
@@ -143,6 +158,29 @@ namespace nexo::renderer {
             */
             virtual void drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, size_t count = 0) = 0;
 
+            /**
+            * @brief Issues an instanced draw call for indexed geometry.
+            *
+            * @param vertexArray The vertex array to draw, its instance buffer must be attached.
+            * @param instanceCount Number of instances to draw.
+            * @param baseInstance Index of the first instance read from the instance buffer.
+            * @param count The number of indices to draw. If zero, all indices in the buffer are used.
+            */
+            virtual void drawIndexedInstanced(const std::shared_ptr<NxVertexArray> &vertexArray, size_t instanceCount,
+                                              size_t baseInstance, size_t count = 0) = 0;
+
+            /**
+            * @brief Issues several indexed draws described by a buffer of NxDrawElementsIndirectCommand.
+            *
+            * @param vertexArray The vertex array every draw reads from.
+            * @param commands Buffer holding the indirect commands.
+            * @param firstCommand Index of the first command to submit.
+            * @param drawCount Number of commands to submit.
+            */
+            virtual void multiDrawIndexedIndirect(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                                  const std::shared_ptr<NxVertexBuffer> &commands,
+                                                  size_t firstCommand, size_t drawCount) = 0;
+
             virtual void drawUnIndexed(size_t verticesCount) = 0;
 
             virtual void setStencilTest(bool enable) = 0;
@@ -154,5 +192,82 @@ namespace nexo::renderer {
             virtual void setCulledFace(CulledFace face) = 0;
             virtual void setWindingOrder(WindingOrder order) = 0;
 
+            virtual void setBlend(bool enable) = 0;
+
+            /**
+            * @brief Sets the factors applied to the source and destination colors when blending.
+            *
+            * @param source GL blend factor applied to the incoming color (e.g. GL_SRC_ALPHA).
+            * @param destination GL blend factor applied to the color already in the framebuffer.
+            */
+            virtual void setBlendFunc(unsigned int source, unsigned int destination) = 0;
+
+            /**
+            * @brief Binds a shader program, 0 unbinds the current one.
+            *
+            * The binding entry points skip the call when the object is already bound and can be
+            * used before init(), they only touch object bindings.
+            */
+            virtual void useProgram(unsigned int id) = 0;
+            virtual void bindVertexArray(unsigned int id) = 0;
+
+            /**
+            * @brief Binds a 2D texture to a texture unit, 0 unbinds it.
+            *
+            * The unit is also left as the active one.
+            */
+            virtual void bindTexture(unsigned int slot, unsigned int id) = 0;
+
+            /**
+            * @brief Binds a framebuffer for drawing and reading, 0 binds the default one.
+            *
+            * @param id The framebuffer to bind.
+            * @param width,height When non zero, the viewport is set to cover the framebuffer.
+            */
+            virtual void bindFramebuffer(unsigned int id, unsigned int width = 0, unsigned int height = 0) = 0;
+
+            /**
+            * @brief Returns the cache of the state bound through this api.
+            *
+            * Code issuing raw calls on the context has to keep it up to date, by invalidating it or
+            * forgetting the objects it deletes.
+            */
+            [[nodiscard]] NxStateCache &getStateCache() { return m_stateCache; }
+
+            /**
+            * @brief Returns the work submitted through this api since the last resetCounters().
+            *
+            * The state changes are the calls let through by the state cache.
+            */
+            [[nodiscard]] NxRenderCounters getCounters() const
+            {
+                NxRenderCounters counters = m_counters;
+                counters.stateChanges = m_stateCache.getIssuedCount();
+                return counters;
+            }
+
+            void addUploadedBytes(const uint64_t bytes) { m_counters.uploadedBytes += bytes; }
+
+            /**
+            * @brief Accounts the instances of draws whose parameters live in gpu memory, like indirect draws.
+            */
+            void addDrawnInstances(const uint64_t instances, const uint64_t triangles)
+            {
+                m_counters.instances += instances;
+                m_counters.triangles += triangles;
+            }
+
+            /**
+            * @brief Resets the work counters and the counters of the state cache.
+            */
+            void resetCounters()
+            {
+                m_counters = {};
+                m_stateCache.resetCounters();
+            }
+
+        protected:
+            NxStateCache m_stateCache;
+            NxRenderCounters m_counters;
     };
 }
@@ -0,0 +1,89 @@
+//// RingBuffer ////////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the persistently mapped streaming buffer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "Buffer.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace nexo::renderer {
+
+    /**
+     * @brief Range reserved in a NxRingBuffer for the current frame.
+     *
+     * `data` points to mapped memory written directly by the CPU, `offset` is the position of the
+     * range from the start of the GPU buffer.
+     */
+    struct NxRingAllocation {
+        void *data = nullptr;
+        size_t offset = 0;
+    };
+
+    /**
+     * @class NxRingBuffer
+     * @brief Buffer streaming data rewritten every frame without synchronizing with the GPU.
+     *
+     * The buffer is split in one region per frame in flight and stays mapped for its whole lifetime.
+     * Every frame writes in its own region, and beginFrame() only waits on the fence of the region
+     * it is about to reuse, which was submitted several frames ago and has usually completed.
+     * When a frame needs more than its region, the buffer is recreated twice as large: ranges
+     * already handed out stay valid for the draws using them, but must not be written afterwards.
+     */
+    class NxRingBuffer {
+        public:
+            virtual ~NxRingBuffer() = default;
+
+            /**
+             * @brief Reserves a range in the region of the current frame.
+             *
+             * @param size Size of the range in bytes.
+             * @param alignment Alignment of the offset of the range, it does not need to be a power of two.
+             * @return The reserved range.
+             */
+            virtual NxRingAllocation allocate(size_t size, size_t alignment) = 0;
+
+            /**
+             * @brief Moves to the region of the next frame, waiting for the GPU to be done reading it.
+             */
+            virtual void beginFrame() = 0;
+
+            /**
+             * @brief Fences the region of the current frame once all its draws are submitted.
+             */
+            virtual void endFrame() = 0;
+
+            /**
+             * @brief Gets the GPU buffer backing the ring, it changes when the ring grows.
+             */
+            [[nodiscard]] virtual std::shared_ptr<NxVertexBuffer> getBuffer() const = 0;
+
+            [[nodiscard]] virtual size_t getFrameCapacity() const = 0;
+
+            /**
+             * @brief Creates a ring buffer for the active graphics API.
+             *
+             * @param frameCapacity Initial size in bytes of the region of each frame.
+             * @param frameCount Number of frames the GPU can lag behind the CPU.
+             */
+            static std::shared_ptr<NxRingBuffer> create(size_t frameCapacity, unsigned int frameCount = 3);
+    };
+}
@@ -0,0 +1,80 @@
+//// SceneLights.hpp ///////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the GPU layout of the scene lights buffer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <glm/glm.hpp>
+
+namespace nexo::renderer {
+
+    /// Storage buffer binding point the scene lights are bound to, must match the `SceneLights` block of the shaders
+    constexpr unsigned int NX_SCENE_LIGHTS_BINDING = 0;
+    constexpr unsigned int NX_MAX_POINT_LIGHTS = 10;
+    constexpr unsigned int NX_MAX_SPOT_LIGHTS = 10;
+
+    /*
+    * The structs below mirror the std140 `SceneLights` block declared in the shaders, vec3 members are
+    * widened to vec4 and every struct is padded to a multiple of 16 bytes.
+    */
+
+    struct NxGpuDirectionalLight {
+        glm::vec4 direction{0.0f};
+        glm::vec4 color{0.0f};
+    };
+
+    struct NxGpuPointLight {
+        glm::vec4 position{0.0f};
+        glm::vec4 color{0.0f};
+        float constant = 1.0f;
+        float linear = 0.0f;
+        float quadratic = 0.0f;
+        float padding = 0.0f;
+    };
+
+    struct NxGpuSpotLight {
+        glm::vec4 position{0.0f};
+        glm::vec4 direction{0.0f};
+        glm::vec4 color{0.0f};
+        float cutOff = 0.0f;
+        float outerCutoff = 0.0f;
+        float constant = 1.0f;
+        float linear = 0.0f;
+        float quadratic = 0.0f;
+        float padding[3] = {};
+    };
+
+    struct NxSceneLightsData {
+        glm::vec4 ambientLight{0.0f};
+        NxGpuDirectionalLight dirLight;
+        int pointLightCount = 0;
+        int spotLightCount = 0;
+        int padding[2] = {};
+        std::array<NxGpuPointLight, NX_MAX_POINT_LIGHTS> pointLights;
+        std::array<NxGpuSpotLight, NX_MAX_SPOT_LIGHTS> spotLights;
+    };
+
+    static_assert(sizeof(NxGpuDirectionalLight) == 32);
+    static_assert(sizeof(NxGpuPointLight) == 48);
+    static_assert(sizeof(NxGpuSpotLight) == 80);
+    static_assert(offsetof(NxSceneLightsData, pointLights) == 64);
+    static_assert(offsetof(NxSceneLightsData, spotLights) == 64 + 48 * NX_MAX_POINT_LIGHTS);
+
+}
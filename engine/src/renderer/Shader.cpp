@@ -28,10 +28,11 @@
 
 namespace nexo::renderer {
 
-    std::shared_ptr<NxShader> NxShader::create(const std::string &path)
+    std::shared_ptr<NxShader> NxShader::create(const std::string &path, const std::vector<std::string> &defines,
+                                               const bool deferLinkCheck)
     {
         #ifdef NX_GRAPHICS_API_OPENGL
-            return std::make_shared<NxOpenGlShader>(path);
+            return std::make_shared<NxOpenGlShader>(path, defines, deferLinkCheck);
         #else
             THROW_EXCEPTION(NxUnknownGraphicsApi, "UNKNOWN");
         #endif
@@ -212,6 +213,20 @@ namespace nexo::renderer {
         }, value);
     }
 
+    int NxShader::getSlotLocation(const UniformSlot slot) const
+    {
+        static constexpr int unresolvedLocation = -2;
+
+        if (slot >= m_slotLocations.size())
+            m_slotLocations.resize(static_cast<size_t>(slot) + 1, unresolvedLocation);
+        int &location = m_slotLocations[slot];
+        if (location == unresolvedLocation) {
+            const auto it = m_uniformInfos.find(UniformRegistry::getName(slot));
+            location = it != m_uniformInfos.end() ? it->second.location : -1;
+        }
+        return location;
+    }
+
     bool NxShader::hasUniform(const std::string& name) const
     {
         return m_uniformInfos.contains(name);
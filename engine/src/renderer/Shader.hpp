@@ -26,6 +26,7 @@
 #include "ShaderStorageBuffer.hpp"
 #include "Attributes.hpp"
 #include "UniformCache.hpp"
+#include "UniformBlock.hpp"
 
 namespace nexo::renderer
 {
@@ -111,13 +112,18 @@ namespace nexo::renderer
         * should contain shader stages marked with `#type` directives.
         *
         * @param path The file path to the shader source code.
+        * @param defines Macros defined right after the `#version` line of every stage, used to build variants.
+        * @param deferLinkCheck Returns as soon as the compilation is submitted, finishCompilation() must then be
+        *        called before the shader is used. Creating several shaders this way before finishing any of them
+        *        lets drivers supporting parallel compilation build them concurrently.
         * @return A shared pointer to the created `Shader` instance.
         *
         * Throws:
         * - `NxUnknownGraphicsApi` if no graphics API is supported.
         * - `NxShaderCreationFailed` if shader compilation fails.
         */
-        static std::shared_ptr<NxShader> create(const std::string& path);
+        static std::shared_ptr<NxShader> create(const std::string& path, const std::vector<std::string>& defines = {},
+                                                bool deferLinkCheck = false);
 
         /**
         * @brief Creates a shader program from source code strings.
@@ -154,6 +160,16 @@ namespace nexo::renderer
         */
         virtual void unbind() const = 0;
 
+        /**
+        * @brief Waits for a shader created with `deferLinkCheck`, checks its link status and reflects it.
+        *
+        * Does nothing if the shader is already linked.
+        *
+        * Throws:
+        * - `NxShaderCreationFailed` if the compilation or the link failed.
+        */
+        virtual void finishCompilation() {}
+
         virtual bool setUniformFloat(const std::string& name, float value) const;
         virtual bool setUniformFloat2(const std::string& name, const glm::vec2& values) const;
         virtual bool setUniformFloat3(const std::string& name, const glm::vec3& values) const;
@@ -172,6 +188,23 @@ namespace nexo::renderer
 
         bool setUniform(const std::string& name, UniformValue value) const;
 
+        /**
+        * @brief Uploads every value of a uniform block.
+        *
+        * Slots are mapped to locations once per shader, so no uniform name is looked up here.
+        * Slots that the shader does not declare are skipped.
+        *
+        * Must be implemented by subclasses.
+        */
+        virtual void setUniforms(const UniformBlock& block) const = 0;
+
+        /**
+        * @brief Returns the location of a uniform slot in this shader, or -1 if it is not declared.
+        *
+        * The location is resolved by name on first use and cached afterwards.
+        */
+        int getSlotLocation(UniformSlot slot) const;
+
         void addStorageBuffer(const std::shared_ptr<NxShaderStorageBuffer>& buffer);
         void setStorageBufferData(size_t index, void* data, size_t size);
         virtual void bindStorageBufferBase(unsigned int index, unsigned int bindingPoint) const = 0;
@@ -195,5 +228,6 @@ namespace nexo::renderer
         std::unordered_map<std::string, UniformInfo> m_uniformInfos;
         std::unordered_map<int, AttributeInfo> m_attributeInfos;
         mutable UniformCache m_uniformCache;
+        mutable std::vector<int> m_slotLocations;
     };
 }
@@ -20,11 +20,16 @@
 #include "Logger.hpp"
 #include "Path.hpp"
 
+#include <chrono>
+#include <vector>
+
 namespace nexo::renderer {
 
     ShaderLibrary::ShaderLibrary()
     {
-        // Helper lambda to safely load a shader with proper error handling
+        const auto startTime = std::chrono::steady_clock::now();
+
+        // Helper lambda to safely register a shader with proper error handling
         auto safeLoadShader = [this](const std::string& name, const std::string& relativePath) {
             try {
                 // Resolve the absolute path
@@ -33,29 +38,40 @@ namespace nexo::renderer {
                 // Check if the shader file exists
                 if (!std::filesystem::exists(absPath)) {
                     LOG(NEXO_ERROR, "Shader file not found: {}", absPath.string());
-                    return false;
+                    return NxShaderHandle{};
                 }
-
-                // Try to load the shader
-                load(name, absPath.string());
-                LOG(NEXO_INFO, "Shader '{}' loaded successfully", name);
-                return true;
+                return loadVariants(name, absPath.string());
             } catch (const std::exception& e) {
                 LOG(NEXO_ERROR, "Failed to load shader '{}': {}", name, e.what());
-                return false;
-            } catch (...) {
-                LOG(NEXO_ERROR, "Unknown error loading shader '{}'", name);
-                return false;
+                return NxShaderHandle{};
             }
         };
 
         // Load all required shaders with error handling
-        safeLoadShader("Phong", "../resources/shaders/phong.glsl");
+        const NxShaderHandle phong = safeLoadShader("Phong", "../resources/shaders/phong.glsl");
         safeLoadShader("Outline pulse flat", "../resources/shaders/outline_pulse_flat.glsl");
         safeLoadShader("Outline pulse transparent flat", "../resources/shaders/outline_pulse_transparent_flat.glsl");
-        safeLoadShader("Albedo unshaded transparent", "../resources/shaders/albedo_unshaded_transparent.glsl");
         safeLoadShader("Grid shader", "../resources/shaders/grid_shader.glsl");
         safeLoadShader("Flat color", "../resources/shaders/flat_color.glsl");
+        if (phong.isValid())
+            addAlias("Albedo unshaded transparent", withKeyword(phong, "NX_UNLIT"));
+
+        // Variants drawn by the first frames are submitted together, so the driver can compile them in parallel
+        for (size_t family = 0; family < m_families.size(); ++family) {
+            std::vector<NxShaderKeywordMask> startupVariants = {0};
+            for (const auto &[name, handle] : m_handles) {
+                if (handle.family == family && handle.keywords != 0)
+                    startupVariants.push_back(handle.keywords);
+            }
+            if (const NxShaderKeywordMask instanced = m_families[family]->getKeywordMask("NX_INSTANCED"))
+                startupVariants.push_back(instanced);
+            m_families[family]->prepare(startupVariants);
+        }
+        for (const auto &family : m_families)
+            family->finishCompilation();
+
+        const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime);
+        LOG(NEXO_INFO, "Shader library loaded in {:.1f} ms", elapsed.count());
     }
 
     void ShaderLibrary::add(const std::shared_ptr<NxShader> &shader)
@@ -90,13 +106,53 @@ namespace nexo::renderer {
         return shader;
     }
 
-    std::shared_ptr<NxShader> ShaderLibrary::get(const std::string &name) const
+    NxShaderHandle ShaderLibrary::loadVariants(const std::string &name, const std::string &path)
     {
-        if (!m_shaders.contains(name))
-        {
-            LOG(NEXO_WARN, "ShaderLibrary::get: shader {} not found", name);
-            return nullptr;
+        const NxShaderHandle handle{static_cast<uint32_t>(m_families.size()), 0};
+        m_families.push_back(std::make_unique<NxShaderVariants>(path));
+        m_handles[name] = handle;
+        return handle;
+    }
+
+    void ShaderLibrary::addAlias(const std::string &name, const NxShaderHandle handle)
+    {
+        if (!handle.isValid()) {
+            LOG(NEXO_WARN, "ShaderLibrary::addAlias: invalid handle for shader {}", name);
+            return;
         }
-        return m_shaders.at(name);
+        m_handles[name] = handle;
+    }
+
+    NxShaderHandle ShaderLibrary::resolve(const std::string_view name) const
+    {
+        const auto it = m_handles.find(name);
+        return it != m_handles.end() ? it->second : NxShaderHandle{};
+    }
+
+    NxShaderHandle ShaderLibrary::withKeyword(const NxShaderHandle handle, const std::string_view keyword) const
+    {
+        if (!handle.isValid() || handle.family >= m_families.size())
+            return {};
+        const NxShaderKeywordMask mask = m_families[handle.family]->getKeywordMask(keyword);
+        if (!mask)
+            return {};
+        return {handle.family, handle.keywords | mask};
+    }
+
+    std::shared_ptr<NxShader> ShaderLibrary::get(const NxShaderHandle handle)
+    {
+        if (!handle.isValid() || handle.family >= m_families.size())
+            return nullptr;
+        return m_families[handle.family]->getVariant(handle.keywords);
+    }
+
+    std::shared_ptr<NxShader> ShaderLibrary::get(const std::string &name)
+    {
+        if (const auto it = m_shaders.find(name); it != m_shaders.end())
+            return it->second;
+        if (const NxShaderHandle handle = resolve(name); handle.isValid())
+            return get(handle);
+        LOG(NEXO_WARN, "ShaderLibrary::get: shader {} not found", name);
+        return nullptr;
     }
 }
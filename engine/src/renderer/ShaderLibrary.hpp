@@ -17,8 +17,11 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <memory>
 #include <unordered_map>
+#include <vector>
 #include "Shader.hpp"
+#include "ShaderVariants.hpp"
 
 namespace nexo::renderer {
 
@@ -44,7 +47,45 @@ namespace nexo::renderer {
             std::shared_ptr<NxShader> load(const std::string &path);
             std::shared_ptr<NxShader> load(const std::string &name, const std::string &path);
             std::shared_ptr<NxShader> load(const std::string &name, const std::string &vertexSource, const std::string &fragmentSource);
-            std::shared_ptr<NxShader> get(const std::string &name) const;
+
+            /**
+             * @brief Gets a shader by name, either added directly or resolved to a variant.
+             *
+             * This hashes the name, per frame lookups should go through a handle from resolve() instead.
+             */
+            std::shared_ptr<NxShader> get(const std::string &name);
+
+            /**
+             * @brief Registers a shader source whose keyword permutations are compiled on demand.
+             *
+             * @param name Name the variant without keywords is resolved by.
+             * @param path Path of the source, see NxShaderVariants for the keyword declaration.
+             * @return Handle of the variant without keywords.
+             */
+            NxShaderHandle loadVariants(const std::string &name, const std::string &path);
+
+            /**
+             * @brief Makes a name resolve to a specific variant, e.g. for materials referring to a shader by name.
+             */
+            void addAlias(const std::string &name, NxShaderHandle handle);
+
+            /**
+             * @brief Resolves a name registered with loadVariants() or addAlias().
+             * @return The handle, invalid if the name is unknown.
+             */
+            [[nodiscard]] NxShaderHandle resolve(std::string_view name) const;
+
+            /**
+             * @brief Gets the same variant with one more keyword enabled.
+             * @return The handle, invalid if the shader does not declare the keyword.
+             */
+            [[nodiscard]] NxShaderHandle withKeyword(NxShaderHandle handle, std::string_view keyword) const;
+
+            /**
+             * @brief Gets the program of a variant, compiling it on first use.
+             * @return The shader, or nullptr if the handle is invalid or the variant failed to compile.
+             */
+            std::shared_ptr<NxShader> get(NxShaderHandle handle);
 
             static ShaderLibrary& getInstance()
             {
@@ -61,5 +102,13 @@ namespace nexo::renderer {
                 TransparentStringHasher,
                 std::equal_to<>
             > m_shaders;
+            // Indexed by NxShaderHandle::family
+            std::vector<std::unique_ptr<NxShaderVariants>> m_families;
+            std::unordered_map<
+                std::string,
+                NxShaderHandle,
+                TransparentStringHasher,
+                std::equal_to<>
+            > m_handles;
     };
 }
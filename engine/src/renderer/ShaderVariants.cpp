@@ -0,0 +1,151 @@
+//// ShaderVariants ////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the shader permutations compiled on demand
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "ShaderVariants.hpp"
+#include "Logger.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace nexo::renderer {
+
+    NxShaderVariants::NxShaderVariants(std::string path) : m_path(std::move(path))
+    {
+        std::ifstream in(m_path, std::ios::in | std::ios::binary);
+        if (!in)
+            THROW_EXCEPTION(NxFileNotFoundException, m_path);
+        std::stringstream source;
+        source << in.rdbuf();
+        m_keywords = parseKeywords(source.str(), m_path);
+    }
+
+    std::vector<std::string> NxShaderVariants::parseKeywords(const std::string_view source, const std::string &path)
+    {
+        static constexpr std::string_view keywordsToken = "#keywords";
+
+        std::vector<std::string> keywords;
+        // Only the header of the file is scanned, the stages themselves are plain GLSL
+        const std::string_view header = source.substr(0, source.find("#type"));
+        size_t lineStart = 0;
+        while (lineStart < header.size()) {
+            size_t lineEnd = header.find_first_of("\r\n", lineStart);
+            if (lineEnd == std::string_view::npos)
+                lineEnd = header.size();
+            std::string_view line = header.substr(lineStart, lineEnd - lineStart);
+            lineStart = lineEnd + 1;
+
+            const size_t first = line.find_first_not_of(" \t");
+            if (first == std::string_view::npos || !line.substr(first).starts_with(keywordsToken))
+                continue;
+            std::istringstream words{std::string(line.substr(first + keywordsToken.size()))};
+            std::string keyword;
+            while (words >> keyword) {
+                if (std::ranges::find(keywords, keyword) == keywords.end())
+                    keywords.push_back(keyword);
+            }
+        }
+        if (keywords.size() > NX_MAX_SHADER_KEYWORDS)
+            THROW_EXCEPTION(NxShaderCreationFailed, "RENDERER",
+                            "Too many keywords declared, at most " + std::to_string(NX_MAX_SHADER_KEYWORDS) + " are supported",
+                            path);
+        return keywords;
+    }
+
+    NxShaderKeywordMask NxShaderVariants::getKeywordMask(const std::string_view keyword) const
+    {
+        const auto it = std::ranges::find(m_keywords, keyword);
+        if (it == m_keywords.end())
+            return 0;
+        return NxShaderKeywordMask{1} << static_cast<unsigned int>(it - m_keywords.begin());
+    }
+
+    std::vector<std::string> NxShaderVariants::getDefines(const NxShaderKeywordMask keywords) const
+    {
+        std::vector<std::string> defines;
+        for (size_t bit = 0; bit < m_keywords.size(); ++bit) {
+            if (keywords & (NxShaderKeywordMask{1} << bit))
+                defines.push_back(m_keywords[bit]);
+        }
+        return defines;
+    }
+
+    const std::shared_ptr<NxShader> &NxShaderVariants::getVariant(NxShaderKeywordMask keywords)
+    {
+        if (!m_pendingVariants.empty())
+            finishCompilation();
+        keywords = declaredKeywords(keywords);
+
+        if (const auto it = m_variants.find(keywords); it != m_variants.end())
+            return it->second;
+        std::shared_ptr<NxShader> variant;
+        try {
+            variant = compileVariant(keywords, false);
+        } catch (const std::exception &e) {
+            LOG(NEXO_ERROR, "Failed to compile variant {:#x} of shader {}: {}", keywords, m_path, e.what());
+        }
+        return m_variants.emplace(keywords, std::move(variant)).first->second;
+    }
+
+    void NxShaderVariants::prepare(const std::vector<NxShaderKeywordMask> &variants)
+    {
+        for (NxShaderKeywordMask keywords : variants) {
+            keywords = declaredKeywords(keywords);
+            if (m_variants.contains(keywords))
+                continue;
+            try {
+                m_variants.emplace(keywords, compileVariant(keywords, true));
+                m_pendingVariants.push_back(keywords);
+            } catch (const std::exception &e) {
+                LOG(NEXO_ERROR, "Failed to compile variant {:#x} of shader {}: {}", keywords, m_path, e.what());
+                m_variants.emplace(keywords, nullptr);
+            }
+        }
+    }
+
+    void NxShaderVariants::finishCompilation()
+    {
+        for (const NxShaderKeywordMask keywords : m_pendingVariants) {
+            auto &variant = m_variants.at(keywords);
+            try {
+                variant->finishCompilation();
+            } catch (const std::exception &e) {
+                LOG(NEXO_ERROR, "Failed to compile variant {:#x} of shader {}: {}", keywords, m_path, e.what());
+                variant = nullptr;
+            }
+        }
+        m_pendingVariants.clear();
+    }
+
+    NxShaderKeywordMask NxShaderVariants::declaredKeywords(const NxShaderKeywordMask keywords) const
+    {
+        // Bits of undeclared keywords would compile the same program again
+        if (m_keywords.size() >= NX_MAX_SHADER_KEYWORDS)
+            return keywords;
+        return keywords & ((NxShaderKeywordMask{1} << m_keywords.size()) - 1);
+    }
+
+    std::shared_ptr<NxShader> NxShaderVariants::compileVariant(const NxShaderKeywordMask keywords, const bool deferLinkCheck) const
+    {
+        return NxShader::create(m_path, getDefines(keywords), deferLinkCheck);
+    }
+
+}
@@ -0,0 +1,124 @@
+//// ShaderVariants ////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the shader permutations compiled on demand
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Shader.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /// One bit per keyword, in the order the shader source declares them
+    using NxShaderKeywordMask = uint32_t;
+    constexpr size_t NX_MAX_SHADER_KEYWORDS = std::numeric_limits<NxShaderKeywordMask>::digits;
+
+    /**
+     * @brief Resolved shader variant, cheap to store and to look up every frame.
+     *
+     * Obtained from ShaderLibrary::resolve, it stays valid for the lifetime of the library.
+     */
+    struct NxShaderHandle {
+        static constexpr uint32_t invalidFamily = std::numeric_limits<uint32_t>::max();
+
+        uint32_t family = invalidFamily;
+        NxShaderKeywordMask keywords = 0;
+
+        [[nodiscard]] bool isValid() const { return family != invalidFamily; }
+        bool operator==(const NxShaderHandle &other) const = default;
+    };
+
+    /**
+     * @class NxShaderVariants
+     * @brief Every permutation of one shader source, compiled the first time it is requested.
+     *
+     * The source declares its feature keywords before its first `#type` directive:
+     * @code
+     * #keywords NX_INSTANCED NX_UNLIT
+     * @endcode
+     * A variant is the source compiled with a subset of them defined. Variants are cached by their
+     * keyword mask, and each is also stored in the program binary cache, so a permutation is only
+     * compiled once per machine.
+     */
+    class NxShaderVariants {
+        public:
+            /**
+             * @brief Reads the keywords declared by a shader source file, nothing is compiled yet.
+             *
+             * @throw NxFileNotFoundException If the file cannot be read.
+             * @throw NxShaderCreationFailed If the source declares more than NX_MAX_SHADER_KEYWORDS keywords.
+             */
+            explicit NxShaderVariants(std::string path);
+
+            /**
+             * @brief Parses the `#keywords` directives found before the first `#type` directive.
+             *
+             * @throw NxShaderCreationFailed If more than NX_MAX_SHADER_KEYWORDS keywords are declared.
+             */
+            [[nodiscard]] static std::vector<std::string> parseKeywords(std::string_view source, const std::string &path = "");
+
+            /**
+             * @brief Gets the bit of a keyword, 0 if the source does not declare it.
+             */
+            [[nodiscard]] NxShaderKeywordMask getKeywordMask(std::string_view keyword) const;
+
+            /**
+             * @brief Gets the defines a variant is compiled with, in declaration order.
+             */
+            [[nodiscard]] std::vector<std::string> getDefines(NxShaderKeywordMask keywords) const;
+
+            /**
+             * @brief Gets a variant, compiling it on first use.
+             *
+             * Undeclared bits are ignored. A variant that failed to compile is logged once and stays null.
+             */
+            [[nodiscard]] const std::shared_ptr<NxShader> &getVariant(NxShaderKeywordMask keywords);
+
+            /**
+             * @brief Starts compiling variants without waiting for them, see NxShader::create.
+             *
+             * The variants are finished by the next getVariant() or finishCompilation() call.
+             */
+            void prepare(const std::vector<NxShaderKeywordMask> &variants);
+
+            /**
+             * @brief Waits for the variants started by prepare().
+             */
+            void finishCompilation();
+
+            [[nodiscard]] const std::vector<std::string> &getKeywords() const { return m_keywords; }
+            [[nodiscard]] const std::string &getPath() const { return m_path; }
+
+        private:
+            [[nodiscard]] NxShaderKeywordMask declaredKeywords(NxShaderKeywordMask keywords) const;
+            std::shared_ptr<NxShader> compileVariant(NxShaderKeywordMask keywords, bool deferLinkCheck) const;
+
+            std::string m_path;
+            std::vector<std::string> m_keywords;
+            std::unordered_map<NxShaderKeywordMask, std::shared_ptr<NxShader>> m_variants;
+            std::vector<NxShaderKeywordMask> m_pendingVariants;
+    };
+
+}
@@ -0,0 +1,168 @@
+//// StateCache.cpp ////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the cache of the bound graphics state
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "StateCache.hpp"
+
+namespace nexo::renderer {
+
+    template<typename T>
+    bool NxStateCache::update(std::optional<T> &bound, const T &value)
+    {
+        if (bound && *bound == value) {
+            ++m_avoidedCount;
+            return false;
+        }
+        bound = value;
+        ++m_issuedCount;
+        return true;
+    }
+
+    bool NxStateCache::setProgram(const unsigned int id)
+    {
+        return update(m_program, id);
+    }
+
+    bool NxStateCache::setVertexArray(const unsigned int id)
+    {
+        return update(m_vertexArray, id);
+    }
+
+    bool NxStateCache::setFramebuffer(const unsigned int id)
+    {
+        return update(m_framebuffer, id);
+    }
+
+    bool NxStateCache::setActiveTextureUnit(const unsigned int slot)
+    {
+        return update(m_activeTextureUnit, slot);
+    }
+
+    bool NxStateCache::setTexture(const unsigned int slot, const unsigned int id)
+    {
+        if (slot >= MAX_TEXTURE_UNITS) {
+            ++m_issuedCount;
+            return true;
+        }
+        return update(m_textures[slot], id);
+    }
+
+    bool NxStateCache::setViewport(const unsigned int x, const unsigned int y, const unsigned int width,
+                                   const unsigned int height)
+    {
+        return update(m_viewport, {x, y, width, height});
+    }
+
+    bool NxStateCache::setCapability(const Capability capability, const bool enable)
+    {
+        return update(m_capabilities[static_cast<size_t>(capability)], enable);
+    }
+
+    bool NxStateCache::setBlendFunc(const unsigned int source, const unsigned int destination)
+    {
+        return update(m_blendFunc, {source, destination});
+    }
+
+    bool NxStateCache::setDepthFunc(const unsigned int func)
+    {
+        return update(m_depthFunc, func);
+    }
+
+    bool NxStateCache::setDepthMask(const bool enable)
+    {
+        return update(m_depthMask, enable);
+    }
+
+    bool NxStateCache::setStencilMask(const unsigned int mask)
+    {
+        return update(m_stencilMask, mask);
+    }
+
+    bool NxStateCache::setStencilFunc(const unsigned int func, const int ref, const unsigned int mask)
+    {
+        return update(m_stencilFunc, {func, ref, mask});
+    }
+
+    bool NxStateCache::setStencilOp(const unsigned int sfail, const unsigned int dpfail, const unsigned int dppass)
+    {
+        return update(m_stencilOp, {sfail, dpfail, dppass});
+    }
+
+    bool NxStateCache::setCulledFace(const unsigned int face)
+    {
+        return update(m_culledFace, face);
+    }
+
+    bool NxStateCache::setWindingOrder(const unsigned int order)
+    {
+        return update(m_windingOrder, order);
+    }
+
+    void NxStateCache::forgetProgram(const unsigned int id)
+    {
+        if (m_program == id)
+            m_program.reset();
+    }
+
+    void NxStateCache::forgetVertexArray(const unsigned int id)
+    {
+        if (m_vertexArray == id)
+            m_vertexArray.reset();
+    }
+
+    void NxStateCache::forgetFramebuffer(const unsigned int id)
+    {
+        if (m_framebuffer == id)
+            m_framebuffer.reset();
+    }
+
+    void NxStateCache::forgetTexture(const unsigned int id)
+    {
+        for (auto &texture : m_textures) {
+            if (texture == id)
+                texture.reset();
+        }
+    }
+
+    void NxStateCache::invalidate()
+    {
+        m_program.reset();
+        m_vertexArray.reset();
+        m_framebuffer.reset();
+        m_activeTextureUnit.reset();
+        m_textures.fill(std::nullopt);
+        m_viewport.reset();
+        m_capabilities.fill(std::nullopt);
+        m_blendFunc.reset();
+        m_depthFunc.reset();
+        m_depthMask.reset();
+        m_stencilMask.reset();
+        m_stencilFunc.reset();
+        m_stencilOp.reset();
+        m_culledFace.reset();
+        m_windingOrder.reset();
+    }
+
+    void NxStateCache::resetCounters()
+    {
+        m_avoidedCount = 0;
+        m_issuedCount = 0;
+    }
+
+}
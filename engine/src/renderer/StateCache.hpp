@@ -0,0 +1,131 @@
+//// StateCache.hpp ////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the cache of the bound graphics state
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+
+namespace nexo::renderer {
+
+    /**
+     * @class NxStateCache
+     * @brief Mirror of the pipeline state bound on the graphics context, used to skip redundant calls.
+     *
+     * Every setter records the requested value and returns whether it differs from the bound one, the
+     * backend only talks to the driver when it does. A value that was never set, or forgotten by
+     * invalidate(), is unknown and always reported as changed.
+     *
+     * The cache only knows about the calls going through it: it has to be invalidated whenever the
+     * context changes or when code outside the renderer api may have touched the state.
+     *
+     * Enumerations (depth function, stencil operations, culled face...) are stored as the raw value of
+     * the backend, the cache only compares them.
+     */
+    class NxStateCache {
+        public:
+            /// Number of texture units tracked, binds on higher units are always issued
+            static constexpr unsigned int MAX_TEXTURE_UNITS = 32;
+
+            enum class Capability : uint8_t {
+                BLEND,
+                DEPTH_TEST,
+                STENCIL_TEST,
+                CULL_FACE,
+                COUNT
+            };
+
+            bool setProgram(unsigned int id);
+            bool setVertexArray(unsigned int id);
+            bool setFramebuffer(unsigned int id);
+            bool setActiveTextureUnit(unsigned int slot);
+
+            /**
+             * @brief Records the 2D texture bound to a texture unit.
+             *
+             * @param slot Texture unit of the binding.
+             * @param id Texture bound to the unit, 0 to unbind.
+             * @return true if the texture has to be bound.
+             */
+            bool setTexture(unsigned int slot, unsigned int id);
+
+            bool setViewport(unsigned int x, unsigned int y, unsigned int width, unsigned int height);
+            bool setCapability(Capability capability, bool enable);
+            bool setBlendFunc(unsigned int source, unsigned int destination);
+            bool setDepthFunc(unsigned int func);
+            bool setDepthMask(bool enable);
+            bool setStencilMask(unsigned int mask);
+            bool setStencilFunc(unsigned int func, int ref, unsigned int mask);
+            bool setStencilOp(unsigned int sfail, unsigned int dpfail, unsigned int dppass);
+            bool setCulledFace(unsigned int face);
+            bool setWindingOrder(unsigned int order);
+
+            /**
+             * @brief Forgets the bindings of a deleted object.
+             *
+             * The driver unbinds an object when it is deleted and may hand its name out again, the
+             * cache must not report the new object as already bound.
+             */
+            void forgetProgram(unsigned int id);
+            void forgetVertexArray(unsigned int id);
+            void forgetFramebuffer(unsigned int id);
+            void forgetTexture(unsigned int id);
+
+            /**
+             * @brief Forgets every bound value, the next call of each setter reaches the driver.
+             *
+             * The counters are kept.
+             */
+            void invalidate();
+
+            /// Number of calls skipped since the last resetCounters()
+            [[nodiscard]] uint64_t getAvoidedCount() const { return m_avoidedCount; }
+            /// Number of calls that reached the driver since the last resetCounters()
+            [[nodiscard]] uint64_t getIssuedCount() const { return m_issuedCount; }
+            void resetCounters();
+
+        private:
+            template<typename T>
+            bool update(std::optional<T> &bound, const T &value);
+
+            std::optional<unsigned int> m_program;
+            std::optional<unsigned int> m_vertexArray;
+            std::optional<unsigned int> m_framebuffer;
+            std::optional<unsigned int> m_activeTextureUnit;
+            std::array<std::optional<unsigned int>, MAX_TEXTURE_UNITS> m_textures{};
+
+            std::optional<std::array<unsigned int, 4>> m_viewport;
+            std::array<std::optional<bool>, static_cast<size_t>(Capability::COUNT)> m_capabilities{};
+            std::optional<std::array<unsigned int, 2>> m_blendFunc;
+            std::optional<unsigned int> m_depthFunc;
+            std::optional<bool> m_depthMask;
+            std::optional<unsigned int> m_stencilMask;
+            std::optional<std::tuple<unsigned int, int, unsigned int>> m_stencilFunc;
+            std::optional<std::array<unsigned int, 3>> m_stencilOp;
+            std::optional<unsigned int> m_culledFace;
+            std::optional<unsigned int> m_windingOrder;
+
+            uint64_t m_avoidedCount = 0;
+            uint64_t m_issuedCount = 0;
+    };
+
+}
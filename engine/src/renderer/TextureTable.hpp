@@ -0,0 +1,79 @@
+//// TextureTable //////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the material texture table
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Texture.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace nexo::renderer {
+
+    /// Storage buffer binding point of the bindless texture handles, must match the `TextureTable` block of the shaders
+    constexpr unsigned int NX_TEXTURE_TABLE_BINDING = 1;
+    /// First texture unit of the texture arrays used when bindless textures are not supported
+    constexpr unsigned int NX_TEXTURE_ARRAYS_FIRST_UNIT = 16;
+    /// Number of texture arrays, and so of distinct texture sizes and formats, the fallback path can hold
+    constexpr unsigned int NX_MAX_TEXTURE_ARRAYS = 8;
+
+    /**
+     * @class NxTextureTable
+     * @brief Gives every material texture a stable index the shaders sample through `sampleMaterialTexture`.
+     *
+     * When bindless textures are supported, the index addresses a storage buffer of texture handles and
+     * there is no limit on the number of textures. Otherwise textures are copied in texture arrays grouped
+     * by size and format, and the index packs the array in its high 16 bits and the layer in the low ones.
+     * Either way the table is bound once per frame instead of binding texture slots before every pass.
+     *
+     * Index 0 is always the default texture, returned for null textures.
+     */
+    class NxTextureTable {
+        public:
+            virtual ~NxTextureTable() = default;
+
+            /**
+             * @brief Gets the index of a texture, registering it the first time it is seen.
+             *
+             * The lookup is keyed by texture id so it does not depend on the number of registered textures.
+             * On the fallback path, the texture content is copied at registration, later updates of
+             * the texture are not seen by the shaders.
+             *
+             * @param texture The texture to look up, can be null.
+             * @return The index of the texture, or 0 if it is null or could not be registered.
+             */
+            [[nodiscard]] virtual int getIndex(const std::shared_ptr<NxTexture2D> &texture) = 0;
+
+            /**
+             * @brief Releases the entries of destroyed textures and binds the table for every shader.
+             */
+            virtual void bind() = 0;
+
+            [[nodiscard]] virtual bool isBindless() const = 0;
+
+            [[nodiscard]] virtual size_t getTextureCount() const = 0;
+
+            /**
+             * @brief Creates a texture table for the active graphics API.
+             *
+             * @param defaultTexture Texture registered at index 0.
+             */
+            static std::shared_ptr<NxTextureTable> create(const std::shared_ptr<NxTexture2D> &defaultTexture);
+    };
+}
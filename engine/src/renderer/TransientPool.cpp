@@ -0,0 +1,110 @@
+//// TransientPool /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the pool of transient render targets shared by the pipelines
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "TransientPool.hpp"
+#include "Exception.hpp"
+#include "RendererExceptions.hpp"
+
+#include <algorithm>
+#include <ranges>
+
+namespace nexo::renderer {
+
+    NxTransientPool::NxTransientPool(FramebufferFactory factory) : m_factory(std::move(factory))
+    {
+    }
+
+    bool NxTransientPool::hasSameFormats(const NxFramebufferSpecs &a, const NxFramebufferSpecs &b)
+    {
+        return a.samples == b.samples &&
+               std::ranges::equal(a.attachments.attachments, b.attachments.attachments, {},
+                                  &NxFrameBufferTextureSpecifications::textureFormat,
+                                  &NxFrameBufferTextureSpecifications::textureFormat);
+    }
+
+    bool NxTransientPool::isCompatible(const NxFramebufferSpecs &a, const NxFramebufferSpecs &b)
+    {
+        return a.width == b.width && a.height == b.height && hasSameFormats(a, b);
+    }
+
+    std::shared_ptr<NxFramebuffer> NxTransientPool::acquire(const NxFramebufferSpecs &specs)
+    {
+        Entry *resizable = nullptr;
+        for (auto &entry : m_entries) {
+            if (entry.acquired)
+                continue;
+            if (isCompatible(entry.specs, specs)) {
+                entry.acquired = true;
+                entry.idleFrames = 0;
+                return entry.framebuffer;
+            }
+            // Entries released during this frame may still be wanted at their size by another pipeline
+            if (entry.idleFrames > 0 && hasSameFormats(entry.specs, specs) &&
+                (!resizable || entry.idleFrames > resizable->idleFrames))
+                resizable = &entry;
+        }
+        if (resizable) {
+            resizable->framebuffer->resize(specs.width, specs.height);
+            resizable->specs = specs;
+            resizable->acquired = true;
+            resizable->idleFrames = 0;
+            return resizable->framebuffer;
+        }
+        auto framebuffer = m_factory(specs);
+        m_entries.push_back({framebuffer, specs, true, 0});
+        return framebuffer;
+    }
+
+    void NxTransientPool::release(const std::shared_ptr<NxFramebuffer> &framebuffer)
+    {
+        const auto it = std::ranges::find(m_entries, framebuffer, &Entry::framebuffer);
+        if (it == m_entries.end() || !it->acquired)
+            THROW_EXCEPTION(NxInvalidValue, "RENDERER", "Released a framebuffer the transient pool did not hand out");
+        it->acquired = false;
+    }
+
+    void NxTransientPool::endFrame()
+    {
+        for (auto &entry : m_entries) {
+            if (!entry.acquired)
+                ++entry.idleFrames;
+        }
+        std::erase_if(m_entries, [](const Entry &entry) {
+            return !entry.acquired && entry.idleFrames > MAX_IDLE_FRAMES;
+        });
+    }
+
+    void NxTransientPool::clear()
+    {
+        m_entries.clear();
+    }
+
+    size_t NxTransientPool::getAcquiredCount() const
+    {
+        return static_cast<size_t>(std::ranges::count_if(m_entries, &Entry::acquired));
+    }
+
+    const std::shared_ptr<NxTransientPool> &NxTransientPool::getShared()
+    {
+        static const auto pool = std::make_shared<NxTransientPool>();
+        return pool;
+    }
+
+}
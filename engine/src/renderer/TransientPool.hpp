@@ -0,0 +1,100 @@
+//// TransientPool /////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the pool of transient render targets shared by the pipelines
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Framebuffer.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @class NxTransientPool
+     * @brief Framebuffers that only live between two passes of a pipeline, recycled across passes and pipelines.
+     *
+     * A transient is acquired before the first pass writing it and released after the last pass reading
+     * it, the next acquisition with the same specifications then reuses the same framebuffer. Pipelines
+     * execute one after the other, so transients of different cameras whose lifetimes do not overlap
+     * share their memory. When no free framebuffer has the requested size, one with the same formats
+     * that was not used during the current frame is resized instead of allocating another one, which
+     * keeps a viewport being resized from piling up framebuffers. Framebuffers left idle for a while
+     * are destroyed.
+     */
+    class NxTransientPool {
+        public:
+            using FramebufferFactory = std::function<std::shared_ptr<NxFramebuffer>(const NxFramebufferSpecs &)>;
+
+            /// Frames a framebuffer can stay unused before it is destroyed
+            static constexpr unsigned int MAX_IDLE_FRAMES = 120;
+
+            explicit NxTransientPool(FramebufferFactory factory = &NxFramebuffer::create);
+
+            /**
+             * @brief Gets a free framebuffer matching the specifications.
+             *
+             * A free framebuffer with the same formats but another size is resized if it was not used
+             * during the current frame, a new one is created only when neither is available.
+             */
+            [[nodiscard]] std::shared_ptr<NxFramebuffer> acquire(const NxFramebufferSpecs &specs);
+
+            /**
+             * @brief Gives a framebuffer back to the pool, its content may be overwritten by the next acquisition.
+             */
+            void release(const std::shared_ptr<NxFramebuffer> &framebuffer);
+
+            /**
+             * @brief Destroys the free framebuffers that were not acquired for MAX_IDLE_FRAMES frames.
+             */
+            void endFrame();
+
+            /**
+             * @brief Destroys every framebuffer of the pool.
+             *
+             * Called when the renderer shuts down, the shared pool would otherwise destroy its
+             * framebuffers during static destruction, once the graphics context is gone.
+             */
+            void clear();
+
+            [[nodiscard]] size_t getFramebufferCount() const { return m_entries.size(); }
+            [[nodiscard]] size_t getAcquiredCount() const;
+
+            /**
+             * @brief Pool used by the pipelines that were not given another one.
+             */
+            static const std::shared_ptr<NxTransientPool> &getShared();
+
+        private:
+            struct Entry {
+                std::shared_ptr<NxFramebuffer> framebuffer;
+                NxFramebufferSpecs specs;
+                bool acquired = false;
+                unsigned int idleFrames = 0;
+            };
+
+            static bool hasSameFormats(const NxFramebufferSpecs &a, const NxFramebufferSpecs &b);
+            static bool isCompatible(const NxFramebufferSpecs &a, const NxFramebufferSpecs &b);
+
+            FramebufferFactory m_factory;
+            std::vector<Entry> m_entries;
+    };
+
+}
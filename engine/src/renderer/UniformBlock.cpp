@@ -0,0 +1,232 @@
+//// UniformBlock.cpp //////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the uniform slot registry and uniform block
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "UniformBlock.hpp"
+#include "RendererExceptions.hpp"
+
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace nexo::renderer {
+
+    namespace {
+        struct RegistryStorage {
+            std::mutex mutex;
+            std::unordered_map<std::string, UniformSlot> slots;
+            std::vector<std::string> names;
+        };
+
+        RegistryStorage &registryStorage()
+        {
+            static RegistryStorage storage;
+            return storage;
+        }
+    }
+
+    UniformSlot UniformRegistry::getSlot(const std::string_view name)
+    {
+        auto &storage = registryStorage();
+        std::scoped_lock lock(storage.mutex);
+        std::string key(name);
+        if (const auto it = storage.slots.find(key); it != storage.slots.end())
+            return it->second;
+        if (storage.names.size() > std::numeric_limits<UniformSlot>::max())
+            THROW_EXCEPTION(NxOutOfRangeException, storage.names.size(), std::numeric_limits<UniformSlot>::max());
+        const auto slot = static_cast<UniformSlot>(storage.names.size());
+        storage.names.push_back(key);
+        storage.slots.emplace(std::move(key), slot);
+        return slot;
+    }
+
+    std::string UniformRegistry::getName(const UniformSlot slot)
+    {
+        auto &storage = registryStorage();
+        std::scoped_lock lock(storage.mutex);
+        if (slot >= storage.names.size())
+            THROW_EXCEPTION(NxOutOfRangeException, slot, storage.names.size());
+        return storage.names[slot];
+    }
+
+    std::size_t UniformRegistry::size()
+    {
+        auto &storage = registryStorage();
+        std::scoped_lock lock(storage.mutex);
+        return storage.names.size();
+    }
+
+    std::size_t UniformBlock::indexOf(const UniformSlot slot) const
+    {
+        // Blocks hold a handful of entries, a scan beats any lookup structure
+        const Entry *entries = entryData();
+        for (std::size_t i = 0; i < m_entryCount; ++i) {
+            if (entries[i].slot == slot)
+                return i;
+        }
+        return m_entryCount;
+    }
+
+    void UniformBlock::spill()
+    {
+        m_heapEntries.assign(m_entries.begin(), m_entries.begin() + m_entryCount);
+        m_heapData.assign(m_data.begin(), m_data.begin() + m_dataSize);
+        m_spilled = true;
+    }
+
+    void UniformBlock::releaseRange(const std::uint16_t offset, const std::uint16_t size)
+    {
+        float *values = valueData();
+        std::memmove(values + offset, values + offset + size, (m_dataSize - offset - size) * sizeof(float));
+        Entry *entries = entryData();
+        for (std::size_t i = 0; i < m_entryCount; ++i) {
+            if (entries[i].offset > offset)
+                entries[i].offset -= size;
+        }
+        m_dataSize -= size;
+        if (m_spilled)
+            m_heapData.resize(m_dataSize);
+    }
+
+    float *UniformBlock::allocate(const UniformSlot slot, const UniformType type)
+    {
+        const std::uint16_t size = uniformTypeSize(type);
+        const std::size_t index = indexOf(slot);
+        const bool isNewEntry = index == m_entryCount;
+        if (!isNewEntry) {
+            Entry &existing = entryData()[index];
+            const std::uint16_t previousSize = uniformTypeSize(existing.type);
+            if (size <= previousSize) {
+                existing.type = type;
+                const std::uint16_t offset = existing.offset;
+                if (size < previousSize)
+                    releaseRange(static_cast<std::uint16_t>(offset + size), static_cast<std::uint16_t>(previousSize - size));
+                return valueData() + offset;
+            }
+            // The value grows, its previous range is given back before appending the new one
+            releaseRange(existing.offset, previousSize);
+        }
+
+        constexpr std::size_t maxOffset = std::numeric_limits<std::uint16_t>::max();
+        if (m_dataSize + size > maxOffset)
+            THROW_EXCEPTION(NxOutOfRangeException, m_dataSize + size, maxOffset);
+        if (isNewEntry && m_entryCount == maxOffset)
+            THROW_EXCEPTION(NxOutOfRangeException, m_entryCount, maxOffset);
+        if (!m_spilled && ((isNewEntry && m_entryCount == MAX_ENTRIES) || m_dataSize + size > MAX_VALUES))
+            spill();
+
+        const std::uint16_t offset = m_dataSize;
+        m_dataSize += size;
+        if (m_spilled)
+            m_heapData.resize(m_dataSize);
+        if (isNewEntry) {
+            if (m_spilled)
+                m_heapEntries.push_back({slot, type, offset});
+            else
+                m_entries[m_entryCount] = {slot, type, offset};
+            ++m_entryCount;
+        } else {
+            Entry &entry = entryData()[index];
+            entry.type = type;
+            entry.offset = offset;
+        }
+        return valueData() + offset;
+    }
+
+    void UniformBlock::set(const UniformSlot slot, const float value)
+    {
+        *allocate(slot, UniformType::FLOAT) = value;
+    }
+
+    void UniformBlock::set(const UniformSlot slot, const glm::vec2 &value)
+    {
+        std::memcpy(allocate(slot, UniformType::FLOAT2), &value[0], sizeof(glm::vec2));
+    }
+
+    void UniformBlock::set(const UniformSlot slot, const glm::vec3 &value)
+    {
+        std::memcpy(allocate(slot, UniformType::FLOAT3), &value[0], sizeof(glm::vec3));
+    }
+
+    void UniformBlock::set(const UniformSlot slot, const glm::vec4 &value)
+    {
+        std::memcpy(allocate(slot, UniformType::FLOAT4), &value[0], sizeof(glm::vec4));
+    }
+
+    void UniformBlock::set(const UniformSlot slot, const int value)
+    {
+        *allocate(slot, UniformType::INT) = std::bit_cast<float>(value);
+    }
+
+    void UniformBlock::set(const UniformSlot slot, const bool value)
+    {
+        *allocate(slot, UniformType::BOOL) = std::bit_cast<float>(static_cast<int>(value));
+    }
+
+    void UniformBlock::set(const UniformSlot slot, const glm::mat4 &value)
+    {
+        std::memcpy(allocate(slot, UniformType::MAT4), &value[0][0], sizeof(glm::mat4));
+    }
+
+    void UniformBlock::set(const UniformSlot slot, const UniformValue &value)
+    {
+        std::visit([this, slot](const auto &v) { set(slot, v); }, value);
+    }
+
+    bool UniformBlock::contains(const UniformSlot slot) const
+    {
+        return indexOf(slot) < m_entryCount;
+    }
+
+    std::optional<UniformValue> UniformBlock::get(const UniformSlot slot) const
+    {
+        const std::size_t index = indexOf(slot);
+        if (index >= m_entryCount)
+            return std::nullopt;
+        const Entry &entry = entryData()[index];
+        const float *value = data() + entry.offset;
+        switch (entry.type) {
+            case UniformType::FLOAT: return *value;
+            case UniformType::FLOAT2: return glm::vec2(value[0], value[1]);
+            case UniformType::FLOAT3: return glm::vec3(value[0], value[1], value[2]);
+            case UniformType::FLOAT4: return glm::vec4(value[0], value[1], value[2], value[3]);
+            case UniformType::INT: return std::bit_cast<int>(*value);
+            case UniformType::BOOL: return std::bit_cast<int>(*value) != 0;
+            case UniformType::MAT4: {
+                glm::mat4 matrix;
+                std::memcpy(&matrix[0][0], value, sizeof(glm::mat4));
+                return matrix;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void UniformBlock::clear()
+    {
+        m_entryCount = 0;
+        m_dataSize = 0;
+        // The heap storage keeps its capacity, a block spilling every frame only allocates once
+        m_heapEntries.clear();
+        m_heapData.clear();
+        m_spilled = false;
+    }
+
+}
@@ -0,0 +1,188 @@
+//// UniformBlock.hpp //////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the compact uniform block used by draw commands
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "UniformCache.hpp"
+
+namespace nexo::renderer {
+
+    /**
+    * @brief Process-wide handle of a uniform name.
+    *
+    * Slots are small dense integers handed out by the UniformRegistry. Shaders map them to their
+    * own locations once, so draw commands never have to carry or hash uniform names.
+    */
+    using UniformSlot = std::uint16_t;
+
+    enum class UniformType : std::uint8_t {
+        FLOAT,
+        FLOAT2,
+        FLOAT3,
+        FLOAT4,
+        INT,
+        BOOL,
+        MAT4
+    };
+
+    /**
+    * @brief Returns the number of floats used to store a value of the given type.
+    */
+    constexpr std::uint16_t uniformTypeSize(const UniformType type)
+    {
+        switch (type) {
+            case UniformType::FLOAT2: return 2;
+            case UniformType::FLOAT3: return 3;
+            case UniformType::FLOAT4: return 4;
+            case UniformType::MAT4: return 16;
+            default: return 1;
+        }
+    }
+
+    /**
+    * @class UniformRegistry
+    * @brief Thread-safe registry mapping uniform names to slots.
+    *
+    * Resolving a name takes a lock and a hash lookup, so callers are expected to resolve their
+    * names once (typically in a function-local static) and keep the slot around.
+    */
+    class UniformRegistry {
+        public:
+            /**
+            * @brief Returns the slot of the given uniform name, registering it on first use.
+            * @throws NxOutOfRangeException if every slot is already taken.
+            */
+            static UniformSlot getSlot(std::string_view name);
+
+            /**
+            * @brief Returns the name a slot was registered with.
+            * @throws NxOutOfRangeException if the slot was never handed out.
+            */
+            static std::string getName(UniformSlot slot);
+
+            /**
+            * @brief Returns the number of slots handed out so far.
+            */
+            static std::size_t size();
+    };
+
+    /**
+    * @class UniformBlock
+    * @brief Flat list of (slot, packed value) pairs uploaded by a draw command.
+    *
+    * Values are packed one after another in a float buffer, integers and booleans being bit cast.
+    * Up to MAX_ENTRIES entries and MAX_VALUES floats are stored inline, so building, copying or clearing
+    * a typical block never touches the heap, which keeps draw commands plain records the frame can churn
+    * through without allocating. A block outgrowing that budget spills to heap storage instead of failing,
+    * and goes back to its inline storage once cleared.
+    *
+    * Setting a slot twice overwrites the previous value in place when the new type fits in the previous
+    * one, releasing what it no longer uses. Otherwise the previous range is released and the value is
+    * appended at the end of the buffer. Values therefore always stay packed.
+    */
+    class UniformBlock {
+        public:
+            static constexpr std::size_t MAX_ENTRIES = 8;
+            static constexpr std::size_t MAX_VALUES = 32; ///< Capacity of the data buffer, in floats
+
+            struct Entry {
+                UniformSlot slot;
+                UniformType type;
+                std::uint16_t offset; ///< Offset of the value in the data buffer, in floats
+            };
+
+            void set(UniformSlot slot, float value);
+            void set(UniformSlot slot, const glm::vec2 &value);
+            void set(UniformSlot slot, const glm::vec3 &value);
+            void set(UniformSlot slot, const glm::vec4 &value);
+            void set(UniformSlot slot, int value);
+            void set(UniformSlot slot, bool value);
+            void set(UniformSlot slot, const glm::mat4 &value);
+            void set(UniformSlot slot, const UniformValue &value);
+
+            /**
+            * @brief Convenience overload resolving the name through the registry.
+            *
+            * Prefer the slot overloads on hot paths.
+            */
+            template<typename T>
+            void set(const std::string_view name, const T &value)
+            {
+                set(UniformRegistry::getSlot(name), value);
+            }
+
+            [[nodiscard]] bool contains(UniformSlot slot) const;
+
+            /**
+            * @brief Returns the value stored for a slot, or std::nullopt if the slot is not set.
+            */
+            [[nodiscard]] std::optional<UniformValue> get(UniformSlot slot) const;
+
+            [[nodiscard]] std::span<const Entry> entries() const { return {entryData(), m_entryCount}; }
+            [[nodiscard]] const float *data() const { return m_spilled ? m_heapData.data() : m_data.data(); }
+            [[nodiscard]] std::size_t size() const { return m_entryCount; }
+            [[nodiscard]] bool empty() const { return m_entryCount == 0; }
+
+            /**
+            * @brief Returns the number of floats used by the stored values.
+            */
+            [[nodiscard]] std::size_t dataSize() const { return m_dataSize; }
+
+            /**
+            * @brief Returns true if the block outgrew its inline storage and now lives on the heap.
+            */
+            [[nodiscard]] bool isSpilled() const { return m_spilled; }
+
+            void clear();
+
+        private:
+            /**
+            * @throws NxOutOfRangeException if the block would exceed the 16-bit offsets of its entries.
+            */
+            float *allocate(UniformSlot slot, UniformType type);
+            // Moves the inline entries and values to the heap storage
+            void spill();
+            // Removes a range from the data buffer, shifting the values stored after it
+            void releaseRange(std::uint16_t offset, std::uint16_t size);
+            // Position of the slot in the entries, size() if it is not set
+            [[nodiscard]] std::size_t indexOf(UniformSlot slot) const;
+            [[nodiscard]] const Entry *entryData() const { return m_spilled ? m_heapEntries.data() : m_entries.data(); }
+            [[nodiscard]] Entry *entryData() { return m_spilled ? m_heapEntries.data() : m_entries.data(); }
+            [[nodiscard]] float *valueData() { return m_spilled ? m_heapData.data() : m_data.data(); }
+
+            std::array<Entry, MAX_ENTRIES> m_entries{};
+            std::array<float, MAX_VALUES> m_data{};
+            std::vector<Entry> m_heapEntries;
+            std::vector<float> m_heapData;
+            std::uint16_t m_entryCount = 0;
+            std::uint16_t m_dataSize = 0;
+            bool m_spilled = false;
+    };
+
+}
@@ -111,4 +111,12 @@ namespace nexo::renderer {
             dirty = false;
         }
     }
+
+    void UniformCache::invalidate()
+    {
+        if (m_values.empty())
+            return;
+        m_values.clear();
+        m_dirtyFlags.clear();
+    }
 }
@@ -50,6 +50,10 @@ namespace nexo::renderer {
         std::optional<UniformValue> getValue(const std::string& name) const;
         void clearDirtyFlag(const std::string& name);
         void clearAllDirtyFlags();
+        /**
+        * @brief Forgets every cached value, to be called when uniforms were uploaded without going through the cache.
+        */
+        void invalidate();
 
     private:
         std::unordered_map<std::string, UniformValue> m_values;
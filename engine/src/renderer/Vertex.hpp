@@ -1,4 +1,4 @@
-//// ComponentRestoreFactory.hpp ///////////////////////////////////////////////////////////////
+//// Vertex.hpp ////////////////////////////////////////////////////////////////
 //
 // ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
 // ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
@@ -10,22 +10,28 @@
 // ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
 // ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
 //
+//
 //  Author:      Mehdy MORVAN
-//  Date:        30/04/2025
-//  Description: Header file for the restore component action factory
+//  Date:        18/10/2026
+//  Description: Header file for the vertex format shared by the meshes
 //
 ///////////////////////////////////////////////////////////////////////////////
+
+
 #pragma once
 
-#include "Action.hpp"
-#include "ecs/Definitions.hpp"
-#include <memory>
-#include <any>
-#include <typeindex>
+#include <glm/glm.hpp>
+
+namespace nexo::renderer
+{
+    struct NxVertex
+    {
+        glm::vec3 position;
+        glm::vec2 texCoord;
+        glm::vec3 normal;
+        glm::vec3 tangent;
+        glm::vec3 bitangent;
 
-namespace nexo::editor {
-    class ComponentRestoreFactory {
-        public:
-            static std::unique_ptr<Action> createRestoreComponent(ecs::Entity entity, const std::any& typeIndex);
+        int entityID;
     };
 }
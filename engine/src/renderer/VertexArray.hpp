@@ -47,6 +47,16 @@ namespace nexo::renderer {
             virtual void addVertexBuffer(const std::shared_ptr<NxVertexBuffer> &vertexBuffer) = 0;
             virtual void setIndexBuffer(const std::shared_ptr<NxIndexBuffer> &indexBuffer) = 0;
 
+            /**
+            * @brief Attaches the buffer read by the per-instance attributes.
+            *
+            * The buffer holds tightly packed NxInstanceData, advanced once per instance. Attaching the
+            * buffer already in use is a no-op, so it can be called before every instanced draw.
+            *
+            * @param instanceBuffer The instance buffer to read from.
+            */
+            virtual void setInstanceBuffer(const std::shared_ptr<NxVertexBuffer> &instanceBuffer) = 0;
+
             [[nodiscard]] virtual const std::vector<std::shared_ptr<NxVertexBuffer>> &getVertexBuffers() const = 0;
             [[nodiscard]] virtual const std::shared_ptr<NxIndexBuffer> &getIndexBuffer() const = 0;
 
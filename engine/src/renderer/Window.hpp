@@ -43,6 +43,8 @@ namespace nexo::renderer {
         std::string title;
         bool vsync = true;
         bool isDarkMode = false;
+        // Offscreen context without a visible surface, for machines without a display or a GPU
+        bool headless = false;
 
         ResizeCallback resizeCallback;
         CloseCallback closeCallback;
@@ -97,6 +99,10 @@ namespace nexo::renderer {
             virtual void setVsync(bool enabled) = 0;
             [[nodiscard]] virtual bool isVsync() const = 0;
 
+            // Must be set before init(), a headless window never presents
+            virtual void setHeadless(bool enabled) = 0;
+            [[nodiscard]] virtual bool isHeadless() const = 0;
+
 
             [[nodiscard]] virtual bool isOpen() const = 0;
             virtual void close() = 0;
@@ -0,0 +1,285 @@
+//// NullRendererApi.cpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the null renderer api class
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "NullRendererApi.hpp"
+#include "renderer/RendererExceptions.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace nexo::renderer {
+
+    // The api forwards raw GL enums, the null implementation checks them without including GL
+    static constexpr unsigned int GL_NEVER_VALUE = 0x0200;
+    static constexpr unsigned int GL_ALWAYS_VALUE = 0x0207;
+    static constexpr std::array<unsigned int, 8> STENCIL_OPERATIONS = {
+        0x0000, // GL_ZERO
+        0x1E00, // GL_KEEP
+        0x1E01, // GL_REPLACE
+        0x1E02, // GL_INCR
+        0x1E03, // GL_DECR
+        0x150A, // GL_INVERT
+        0x8507, // GL_INCR_WRAP
+        0x8508, // GL_DECR_WRAP
+    };
+
+    static constexpr std::array<unsigned int, 15> BLEND_FACTORS = {
+        0x0000, // GL_ZERO
+        0x0001, // GL_ONE
+        0x0300, // GL_SRC_COLOR
+        0x0301, // GL_ONE_MINUS_SRC_COLOR
+        0x0302, // GL_SRC_ALPHA
+        0x0303, // GL_ONE_MINUS_SRC_ALPHA
+        0x0304, // GL_DST_ALPHA
+        0x0305, // GL_ONE_MINUS_DST_ALPHA
+        0x0306, // GL_DST_COLOR
+        0x0307, // GL_ONE_MINUS_DST_COLOR
+        0x0308, // GL_SRC_ALPHA_SATURATE
+        0x8001, // GL_CONSTANT_COLOR
+        0x8002, // GL_ONE_MINUS_CONSTANT_COLOR
+        0x8003, // GL_CONSTANT_ALPHA
+        0x8004, // GL_ONE_MINUS_CONSTANT_ALPHA
+    };
+
+    static bool isComparisonFunc(const unsigned int func)
+    {
+        return func >= GL_NEVER_VALUE && func <= GL_ALWAYS_VALUE;
+    }
+
+    static bool isStencilOperation(const unsigned int operation)
+    {
+        return std::ranges::find(STENCIL_OPERATIONS, operation) != STENCIL_OPERATIONS.end();
+    }
+
+    static bool isBlendFactor(const unsigned int factor)
+    {
+        return std::ranges::find(BLEND_FACTORS, factor) != BLEND_FACTORS.end();
+    }
+
+    void NxNullRendererApi::init()
+    {
+        m_stateCache.invalidate();
+        m_initialized = true;
+        LOG(NEXO_DEV, "Null renderer api initialized");
+    }
+
+    void NxNullRendererApi::checkInitialized() const
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "NULL");
+    }
+
+    size_t NxNullRendererApi::checkIndexedDraw(const std::shared_ptr<NxVertexArray> &vertexArray, const size_t indexCount) const
+    {
+        checkInitialized();
+        if (!vertexArray)
+            THROW_EXCEPTION(NxInvalidValue, "NULL", "Vertex array cannot be null");
+        const auto &indexBuffer = vertexArray->getIndexBuffer();
+        if (!indexBuffer)
+            THROW_EXCEPTION(NxInvalidValue, "NULL", "Vertex array has no index buffer");
+        if (indexCount > indexBuffer->getCount())
+            THROW_EXCEPTION(NxInvalidValue, "NULL", std::format("Drawing {} indices from an index buffer of {}",
+                                                                indexCount, indexBuffer->getCount()));
+        return indexCount ? indexCount : indexBuffer->getCount();
+    }
+
+    void NxNullRendererApi::setViewport(const unsigned int x, const unsigned int y, const unsigned int width, const unsigned int height)
+    {
+        checkInitialized();
+        if (!width || !height)
+            THROW_EXCEPTION(NxGraphicsApiViewportResizingFailure, "NULL", false, width, height);
+        if (width > MAX_VIEWPORT_SIZE || height > MAX_VIEWPORT_SIZE)
+            THROW_EXCEPTION(NxGraphicsApiViewportResizingFailure, "NULL", true, width, height);
+        m_stateCache.setViewport(x, y, width, height);
+    }
+
+    void NxNullRendererApi::getMaxViewportSize(unsigned int *width, unsigned int *height)
+    {
+        *width = MAX_VIEWPORT_SIZE;
+        *height = MAX_VIEWPORT_SIZE;
+    }
+
+    void NxNullRendererApi::clear()
+    {
+        checkInitialized();
+    }
+
+    void NxNullRendererApi::setClearColor([[maybe_unused]] const glm::vec4 &color)
+    {
+        checkInitialized();
+    }
+
+    void NxNullRendererApi::setClearDepth(const float depth)
+    {
+        checkInitialized();
+        if (depth < 0.0f || depth > 1.0f)
+            THROW_EXCEPTION(NxInvalidValue, "NULL", std::format("Clear depth {} is outside of [0, 1]", depth));
+    }
+
+    void NxNullRendererApi::setDepthTest(const bool enable)
+    {
+        checkInitialized();
+        m_stateCache.setCapability(NxStateCache::Capability::DEPTH_TEST, enable);
+    }
+
+    void NxNullRendererApi::setDepthFunc(const unsigned int func)
+    {
+        checkInitialized();
+        if (!isComparisonFunc(func))
+            THROW_EXCEPTION(NxInvalidValue, "NULL", std::format("Invalid depth function {:#x}", func));
+        m_stateCache.setDepthFunc(func);
+    }
+
+    void NxNullRendererApi::setDepthMask(const bool enable)
+    {
+        checkInitialized();
+        m_stateCache.setDepthMask(enable);
+    }
+
+    void NxNullRendererApi::drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, const size_t indexCount)
+    {
+        const size_t count = checkIndexedDraw(vertexArray, indexCount);
+        m_counters.drawCalls++;
+        m_counters.instances++;
+        m_counters.triangles += count / 3;
+    }
+
+    void NxNullRendererApi::drawIndexedInstanced(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                                 const size_t instanceCount, [[maybe_unused]] const size_t baseInstance,
+                                                 const size_t indexCount)
+    {
+        const size_t count = checkIndexedDraw(vertexArray, indexCount);
+        m_counters.drawCalls++;
+        m_counters.instances += instanceCount;
+        m_counters.triangles += count / 3 * instanceCount;
+    }
+
+    void NxNullRendererApi::multiDrawIndexedIndirect(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                                     const std::shared_ptr<NxVertexBuffer> &commands,
+                                                     [[maybe_unused]] const size_t firstCommand,
+                                                     [[maybe_unused]] const size_t drawCount)
+    {
+        checkInitialized();
+        if (!vertexArray)
+            THROW_EXCEPTION(NxInvalidValue, "NULL", "Vertex array cannot be null");
+        if (!commands)
+            THROW_EXCEPTION(NxInvalidValue, "NULL", "Indirect command buffer cannot be null");
+        // The instances and triangles live in the command buffer, the caller accounts them with addDrawnInstances
+        m_counters.drawCalls++;
+    }
+
+    void NxNullRendererApi::drawUnIndexed(const size_t verticesCount)
+    {
+        checkInitialized();
+        m_counters.drawCalls++;
+        m_counters.instances++;
+        m_counters.triangles += verticesCount / 3;
+    }
+
+    void NxNullRendererApi::setStencilTest(const bool enable)
+    {
+        checkInitialized();
+        m_stateCache.setCapability(NxStateCache::Capability::STENCIL_TEST, enable);
+    }
+
+    void NxNullRendererApi::setStencilMask(const unsigned int mask)
+    {
+        checkInitialized();
+        m_stateCache.setStencilMask(mask);
+    }
+
+    void NxNullRendererApi::setStencilFunc(const unsigned int func, const int ref, const unsigned int mask)
+    {
+        checkInitialized();
+        if (!isComparisonFunc(func))
+            THROW_EXCEPTION(NxInvalidValue, "NULL", std::format("Invalid stencil function {:#x}", func));
+        m_stateCache.setStencilFunc(func, ref, mask);
+    }
+
+    void NxNullRendererApi::setStencilOp(const unsigned int sfail, const unsigned int dpfail, const unsigned int dppass)
+    {
+        checkInitialized();
+        for (const unsigned int operation : {sfail, dpfail, dppass}) {
+            if (!isStencilOperation(operation))
+                THROW_EXCEPTION(NxInvalidValue, "NULL", std::format("Invalid stencil operation {:#x}", operation));
+        }
+        m_stateCache.setStencilOp(sfail, dpfail, dppass);
+    }
+
+    void NxNullRendererApi::setCulling(const bool enable)
+    {
+        checkInitialized();
+        m_stateCache.setCapability(NxStateCache::Capability::CULL_FACE, enable);
+    }
+
+    void NxNullRendererApi::setCulledFace(const CulledFace face)
+    {
+        checkInitialized();
+        m_stateCache.setCulledFace(static_cast<unsigned int>(face));
+    }
+
+    void NxNullRendererApi::setWindingOrder(const WindingOrder order)
+    {
+        checkInitialized();
+        m_stateCache.setWindingOrder(static_cast<unsigned int>(order));
+    }
+
+    void NxNullRendererApi::setBlend(const bool enable)
+    {
+        checkInitialized();
+        m_stateCache.setCapability(NxStateCache::Capability::BLEND, enable);
+    }
+
+    void NxNullRendererApi::setBlendFunc(const unsigned int source, const unsigned int destination)
+    {
+        checkInitialized();
+        for (const unsigned int factor : {source, destination}) {
+            if (!isBlendFactor(factor))
+                THROW_EXCEPTION(NxInvalidValue, "NULL", std::format("Invalid blend factor {:#x}", factor));
+        }
+        m_stateCache.setBlendFunc(source, destination);
+    }
+
+    void NxNullRendererApi::useProgram(const unsigned int id)
+    {
+        m_stateCache.setProgram(id);
+    }
+
+    void NxNullRendererApi::bindVertexArray(const unsigned int id)
+    {
+        m_stateCache.setVertexArray(id);
+    }
+
+    void NxNullRendererApi::bindTexture(const unsigned int slot, const unsigned int id)
+    {
+        m_stateCache.setActiveTextureUnit(slot);
+        if (m_stateCache.setTexture(slot, id))
+            m_counters.textureBinds++;
+    }
+
+    void NxNullRendererApi::bindFramebuffer(const unsigned int id, const unsigned int width, const unsigned int height)
+    {
+        m_stateCache.setFramebuffer(id);
+        if (width && height)
+            m_stateCache.setViewport(0, 0, width, height);
+    }
+}
@@ -0,0 +1,117 @@
+//// NullRendererApi.hpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the null renderer api class
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "renderer/RendererAPI.hpp"
+
+namespace nexo::renderer {
+
+    /**
+    * @class NxNullRendererApi
+    * @brief Implementation of the RendererApi interface that submits nothing to a GPU.
+    *
+    * Every command is validated the way the OpenGL implementation does, plus the checks the
+    * driver would otherwise perform silently (comparison functions, stencil operations, index
+    * ranges), then only recorded in the state cache and the render counters.
+    *
+    * Install it with `NxRenderCommand::setRendererApi` to run command submission code in tests
+    * and CPU benchmarks on machines without a graphics context. The resources (buffers, textures,
+    * framebuffers, shaders) still belong to the compiled graphics API and need its context.
+    *
+    * It is test-only: the headless application mode keeps the compiled graphics API on an
+    * offscreen context and never installs this api.
+    */
+    class NxNullRendererApi final : public NxRendererApi {
+        public:
+            // Smallest GL_MAX_VIEWPORT_DIMS among the drivers we support
+            static constexpr unsigned int MAX_VIEWPORT_SIZE = 16384;
+
+            /**
+            * @brief Marks the api as initialized, no state is reset besides the cache.
+            */
+            void init() override;
+
+            /**
+            * Throws:
+            * - NxGraphicsApiNotInitialized if the api is not initialized.
+            * - NxGraphicsApiViewportResizingFailure if a dimension is zero or exceeds MAX_VIEWPORT_SIZE.
+            */
+            void setViewport(unsigned int x, unsigned int y, unsigned int width, unsigned int height) override;
+            void getMaxViewportSize(unsigned int *width, unsigned int *height) override;
+
+            void clear() override;
+            void setClearColor(const glm::vec4 &color) override;
+            void setClearDepth(float depth) override;
+
+            void setDepthTest(bool enable) override;
+            /**
+            * Throws:
+            * - NxInvalidValue if `func` is not one of GL_NEVER to GL_ALWAYS.
+            */
+            void setDepthFunc(unsigned int func) override;
+            void setDepthMask(bool enable) override;
+
+            /**
+             * @brief Counts the draw as the OpenGL implementation does.
+             *
+             * Throws:
+             * - NxGraphicsApiNotInitialized if the api is not initialized.
+             * - NxInvalidValue if the `vertexArray` is null, has no index buffer, or if `indexCount`
+             *   exceeds the indices of its index buffer.
+             */
+            void drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, size_t indexCount = 0) override;
+            void drawIndexedInstanced(const std::shared_ptr<NxVertexArray> &vertexArray, size_t instanceCount,
+                                      size_t baseInstance, size_t indexCount = 0) override;
+            void multiDrawIndexedIndirect(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                          const std::shared_ptr<NxVertexBuffer> &commands,
+                                          size_t firstCommand, size_t drawCount) override;
+            void drawUnIndexed(size_t verticesCount) override;
+
+            void setStencilTest(bool enable) override;
+            void setStencilMask(unsigned int mask) override;
+            void setStencilFunc(unsigned int func, int ref, unsigned int mask) override;
+            /**
+            * Throws:
+            * - NxInvalidValue if one of the operations is not a GL stencil operation.
+            */
+            void setStencilOp(unsigned int sfail, unsigned int dpfail, unsigned int dppass) override;
+
+            void setCulling(bool enable) override;
+            void setCulledFace(CulledFace face) override;
+            void setWindingOrder(WindingOrder order) override;
+
+            void setBlend(bool enable) override;
+            /**
+            * Throws:
+            * - NxInvalidValue if one of the factors is not a GL blend factor.
+            */
+            void setBlendFunc(unsigned int source, unsigned int destination) override;
+
+            void useProgram(unsigned int id) override;
+            void bindVertexArray(unsigned int id) override;
+            void bindTexture(unsigned int slot, unsigned int id) override;
+            void bindFramebuffer(unsigned int id, unsigned int width = 0, unsigned int height = 0) override;
+        private:
+            bool m_initialized = false;
+
+            void checkInitialized() const;
+            [[nodiscard]] size_t checkIndexedDraw(const std::shared_ptr<NxVertexArray> &vertexArray, size_t indexCount) const;
+    };
+}
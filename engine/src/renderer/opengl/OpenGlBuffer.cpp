@@ -17,6 +17,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "OpenGlBuffer.hpp"
+#include "renderer/RenderCommand.hpp"
 
 #include <glad/glad.h>
 
@@ -37,6 +38,12 @@ namespace nexo::renderer {
         glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
     }
 
+    NxOpenGlVertexBuffer::NxOpenGlVertexBuffer(const size_t size, const unsigned int storageFlags)
+    {
+        glCreateBuffers(1, &_id);
+        glNamedBufferStorage(_id, static_cast<GLsizeiptr>(size), nullptr, storageFlags);
+    }
+
     NxOpenGlVertexBuffer::~NxOpenGlVertexBuffer()
     {
         glDeleteBuffers(1, &_id);
@@ -56,6 +63,20 @@ namespace nexo::renderer {
     {
         glBindBuffer(GL_ARRAY_BUFFER, _id);
         glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+        NxRenderCommand::addUploadedBytes(size);
+    }
+
+    void NxOpenGlVertexBuffer::setSubData(const void *data, const size_t size, const size_t offset)
+    {
+        glNamedBufferSubData(_id, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+        NxRenderCommand::addUploadedBytes(size);
+    }
+
+    void NxOpenGlVertexBuffer::copyFrom(const NxVertexBuffer &source, const size_t sourceOffset,
+                                        const size_t destinationOffset, const size_t size)
+    {
+        glCopyNamedBufferSubData(source.getId(), _id, static_cast<GLintptr>(sourceOffset),
+                                 static_cast<GLintptr>(destinationOffset), static_cast<GLsizeiptr>(size));
     }
 
 
@@ -85,7 +106,29 @@ namespace nexo::renderer {
     void NxOpenGlIndexBuffer::setData(unsigned int *indices, const size_t count)
     {
         _count = count;
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(unsigned int), indices, GL_STATIC_DRAW);
+        const size_t size = count * sizeof(unsigned int);
+        if (size > _capacity) {
+            // Buffers filled again after their creation are not static
+            glNamedBufferData(_id, static_cast<GLsizeiptr>(size), indices, _capacity ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+            _capacity = size;
+        } else if (size)
+            glNamedBufferSubData(_id, 0, static_cast<GLsizeiptr>(size), indices);
+        NxRenderCommand::addUploadedBytes(size);
+    }
+
+    void NxOpenGlIndexBuffer::setSubData(const unsigned int *indices, const size_t count, const size_t offset)
+    {
+        glNamedBufferSubData(_id, static_cast<GLintptr>(offset * sizeof(unsigned int)),
+                             static_cast<GLsizeiptr>(count * sizeof(unsigned int)), indices);
+        NxRenderCommand::addUploadedBytes(count * sizeof(unsigned int));
+    }
+
+    void NxOpenGlIndexBuffer::copyFrom(const NxIndexBuffer &source, const size_t sourceOffset,
+                                       const size_t destinationOffset, const size_t count)
+    {
+        glCopyNamedBufferSubData(source.getId(), _id, static_cast<GLintptr>(sourceOffset * sizeof(unsigned int)),
+                                 static_cast<GLintptr>(destinationOffset * sizeof(unsigned int)),
+                                 static_cast<GLsizeiptr>(count * sizeof(unsigned int)));
     }
 
     size_t NxOpenGlIndexBuffer::getCount() const
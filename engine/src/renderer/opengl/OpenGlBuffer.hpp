@@ -58,6 +58,21 @@ namespace nexo::renderer {
              */
             explicit NxOpenGlVertexBuffer(unsigned int size);
 
+            /**
+             * @brief Constructs a vertex buffer with immutable storage.
+             *
+             * Used for persistently mapped buffers, whose content is written through the mapping instead
+             * of `setData`.
+             *
+             * @param size The size (in bytes) of the buffer to allocate.
+             * @param storageFlags The flags passed to the storage allocation.
+             *
+             * OpenGL Calls:
+             * - `glCreateBuffers`: Creates a new buffer object.
+             * - `glNamedBufferStorage`: Allocates immutable GPU memory with the given flags.
+             */
+            NxOpenGlVertexBuffer(size_t size, unsigned int storageFlags);
+
             /**
             * @brief Destroys the vertex buffer and releases GPU resources.
             *
@@ -113,6 +128,22 @@ namespace nexo::renderer {
              */
             void setData(void *data, size_t size) override;
 
+            /**
+             * @brief Updates a range of the vertex buffer.
+             *
+             * OpenGL Calls:
+             * - `glNamedBufferSubData`: Updates the range without touching the current bindings.
+             */
+            void setSubData(const void *data, size_t size, size_t offset) override;
+
+            /**
+             * @brief Copies a range of another vertex buffer into this one.
+             *
+             * OpenGL Calls:
+             * - `glCopyNamedBufferSubData`: Copies the range on the GPU.
+             */
+            void copyFrom(const NxVertexBuffer &source, size_t sourceOffset, size_t destinationOffset, size_t size) override;
+
             [[nodiscard]] unsigned int getId() const override { return _id; };
 
         private:
@@ -178,13 +209,30 @@ namespace nexo::renderer {
             * @param count The number of indices to upload.
             *
             * OpenGL Calls:
-            * - `glBufferData`: Allocates GPU memory and uploads the index data.
+            * - `glNamedBufferData`: Allocates GPU memory and uploads the index data, only when the indices do not fit.
+            * - `glNamedBufferSubData`: Uploads the index data into the existing storage otherwise.
             *
             * Notes:
             * - Sets the `_count` member to track the number of indices in the buffer.
             */
             void setData(unsigned int *indices, size_t count) override;
 
+            /**
+            * @brief Updates a range of the index buffer.
+            *
+            * OpenGL Calls:
+            * - `glNamedBufferSubData`: Updates the range without touching the current bindings.
+            */
+            void setSubData(const unsigned int *indices, size_t count, size_t offset) override;
+
+            /**
+            * @brief Copies a range of another index buffer into this one.
+            *
+            * OpenGL Calls:
+            * - `glCopyNamedBufferSubData`: Copies the range on the GPU.
+            */
+            void copyFrom(const NxIndexBuffer &source, size_t sourceOffset, size_t destinationOffset, size_t count) override;
+
             /**
             * @brief Retrieves the number of indices in the buffer.
             *
@@ -201,6 +249,8 @@ namespace nexo::renderer {
         private:
             unsigned int _id{};
             size_t _count = 0;
+            // Allocated size in bytes, setData() only reallocates when the indices do not fit
+            size_t _capacity = 0;
     };
 
 }
@@ -18,7 +18,10 @@
 
 #include "OpenGlFramebuffer.hpp"
 #include "Logger.hpp"
+#include "renderer/RenderCommand.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 #include <glm/gtc/type_ptr.hpp>
 
@@ -78,7 +81,8 @@ namespace nexo::renderer {
     /**
      * @brief Binds an OpenGL texture to the current context.
      *
-     * Activates the specified texture ID for subsequent OpenGL operations.
+     * Activates the specified texture ID for subsequent OpenGL operations. 2D textures go through
+     * the render command state cache, on unit 0.
      *
      * @param multisampled Indicates whether the texture is multisampled.
      * @param id The OpenGL ID of the texture to bind.
@@ -88,7 +92,23 @@ namespace nexo::renderer {
      */
     static void bindTexture(const bool multisampled, const unsigned int id)
     {
-        glBindTexture(textureTarget(multisampled), id);
+        if (multisampled)
+            glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, id);
+        else
+            NxRenderCommand::bindTexture(0, id);
+    }
+
+    /**
+     * @brief Drops the deleted objects of a framebuffer from the render command state cache.
+     */
+    static void forgetObjects(const unsigned int id, const std::vector<unsigned int> &colorAttachments,
+                              const unsigned int depthAttachment)
+    {
+        auto &stateCache = NxRenderCommand::getStateCache();
+        stateCache.forgetFramebuffer(id);
+        for (const unsigned int attachment : colorAttachments)
+            stateCache.forgetTexture(attachment);
+        stateCache.forgetTexture(depthAttachment);
     }
 
     /**
@@ -207,15 +227,23 @@ namespace nexo::renderer {
 
     NxOpenGlFramebuffer::~NxOpenGlFramebuffer()
     {
+        forgetObjects(m_id, m_colorAttachments, m_depthAttachment);
         glDeleteFramebuffers(1, &m_id);
         glDeleteTextures(static_cast<int>(m_colorAttachments.size()), m_colorAttachments.data());
         glDeleteTextures(1, &m_depthAttachment);
+        for (auto &readback : m_pixelReadbacks) {
+            if (readback.fence)
+                glDeleteSync(readback.fence);
+            if (readback.buffer)
+                glDeleteBuffers(1, &readback.buffer);
+        }
     }
 
     void NxOpenGlFramebuffer::invalidate()
     {
         if (m_id)
         {
+            forgetObjects(m_id, m_colorAttachments, m_depthAttachment);
             glDeleteFramebuffers(1, &m_id);
             glDeleteTextures(static_cast<int>(m_colorAttachments.size()), m_colorAttachments.data());
             glDeleteTextures(1, &m_depthAttachment);
@@ -225,7 +253,7 @@ namespace nexo::renderer {
         }
 
         glGenFramebuffers(1, &m_id);
-        glBindFramebuffer(GL_FRAMEBUFFER, m_id);
+        NxRenderCommand::bindFramebuffer(m_id);
 
         const bool multisample = m_specs.samples > 1;
 
@@ -275,7 +303,7 @@ namespace nexo::renderer {
         if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
             THROW_EXCEPTION(NxFramebufferCreationFailed, "OPENGL");
 
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        NxRenderCommand::bindFramebuffer(0);
     }
 
     void NxOpenGlFramebuffer::bind()
@@ -286,8 +314,7 @@ namespace nexo::renderer {
           	toResize = false;
         }
 
-        glBindFramebuffer(GL_FRAMEBUFFER, m_id);
-        glViewport(0, 0, static_cast<int>(m_specs.width), static_cast<int>(m_specs.height));
+        NxRenderCommand::bindFramebuffer(m_id, m_specs.width, m_specs.height);
     }
 
     void NxOpenGlFramebuffer::bindAsTexture(const unsigned int slot, unsigned int attachment)
@@ -296,19 +323,17 @@ namespace nexo::renderer {
             LOG(NEXO_ERROR, "Attachment index {} out of bounds (max: {})", attachment, m_colorAttachments.size() - 1);
             return;
         }
-        glActiveTexture(GL_TEXTURE0 + slot);
-        glBindTexture(GL_TEXTURE_2D, getColorAttachmentId(attachment));
+        NxRenderCommand::bindTexture(slot, getColorAttachmentId(attachment));
     }
 
     void NxOpenGlFramebuffer::bindDepthAsTexture(const unsigned int slot)
     {
-        glActiveTexture(GL_TEXTURE0 + slot);
-        glBindTexture(GL_TEXTURE_2D, m_depthAttachment);
+        NxRenderCommand::bindTexture(slot, m_depthAttachment);
     }
 
     void NxOpenGlFramebuffer::unbind()
     {
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        NxRenderCommand::bindFramebuffer(0);
     }
 
     void NxOpenGlFramebuffer::copy(const std::shared_ptr<NxFramebuffer> source)
@@ -321,8 +346,11 @@ namespace nexo::renderer {
             invalidate();
             toResize = false;
         }
+        // Known cache bypass: the state cache tracks a single binding for both targets, so the read
+        // target is redirected with a raw call. The cache still believes m_id is bound for reading, which
+        // holds again once this function rebinds 0 through the cache on every return path.
+        NxRenderCommand::bindFramebuffer(m_id);
         glBindFramebuffer(GL_READ_FRAMEBUFFER, source->getFramebufferId());
-        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_id);
 
         const unsigned int numAttachments = source->getNbColorAttachments();
         for (unsigned int i = 0; i < numAttachments; i++) {
@@ -360,7 +388,7 @@ namespace nexo::renderer {
                 GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT,
                 GL_NEAREST
             );
-            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            NxRenderCommand::bindFramebuffer(0);
             return;
         }
 
@@ -384,7 +412,7 @@ namespace nexo::renderer {
             );
         }
 
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        NxRenderCommand::bindFramebuffer(0);
     }
 
     unsigned int NxOpenGlFramebuffer::getFramebufferId() const
@@ -418,6 +446,81 @@ namespace nexo::renderer {
             THROW_EXCEPTION(NxFramebufferUnsupportedColorFormat, "OPENGL");
     }
 
+    uint64_t NxOpenGlFramebuffer::requestPixelRegion(const unsigned int attachmentIndex, int x, int y, int width, int height)
+    {
+        if (attachmentIndex >= m_colorAttachments.size())
+            THROW_EXCEPTION(NxFramebufferInvalidIndex, "OPENGL", attachmentIndex);
+
+        // Clamp the region to the framebuffer
+        const int maxX = std::min(x + width, static_cast<int>(m_specs.width));
+        const int maxY = std::min(y + height, static_cast<int>(m_specs.height));
+        x = std::max(x, 0);
+        y = std::max(y, 0);
+        width = maxX - x;
+        height = maxY - y;
+        if (width <= 0 || height <= 0 || m_pendingReadbackCount == PIXEL_READBACK_COUNT)
+            return 0;
+
+        PixelReadback &readback = m_pixelReadbacks[(m_firstPendingReadback + m_pendingReadbackCount) % PIXEL_READBACK_COUNT];
+        const size_t size = static_cast<size_t>(width) * static_cast<size_t>(height) * sizeof(int);
+        if (!readback.buffer)
+            glGenBuffers(1, &readback.buffer);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+        if (readback.capacity < size) {
+            glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_READ);
+            readback.capacity = size;
+        }
+
+        // Known cache bypass: only the read target is switched, with raw calls the state cache never
+        // sees. The previous read binding is restored right after, so the cached binding stays accurate.
+        GLint previousReadFramebuffer = 0;
+        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousReadFramebuffer);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, m_id);
+        glReadBuffer(GL_COLOR_ATTACHMENT0 + attachmentIndex);
+        const GLenum format = framebufferTextureFormatToOpenGlFormat(m_colorAttachmentsSpecs[attachmentIndex].textureFormat);
+        // With a pack buffer bound the last argument is an offset, the call returns without waiting for the GPU
+        glReadPixels(x, y, width, height, format, GL_INT, nullptr);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(previousReadFramebuffer));
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        readback.region = {m_nextReadbackId++, x, y, width, height, {}};
+        ++m_pendingReadbackCount;
+        return readback.region.requestId;
+    }
+
+    std::optional<NxPixelRegion> NxOpenGlFramebuffer::pollPixelRegion()
+    {
+        if (!m_pendingReadbackCount)
+            return std::nullopt;
+
+        PixelReadback &readback = m_pixelReadbacks[m_firstPendingReadback];
+        // The flush guarantees the fence eventually signals even if nothing else is submitted
+        const GLenum status = glClientWaitSync(readback.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if (status == GL_TIMEOUT_EXPIRED)
+            return std::nullopt;
+        glDeleteSync(readback.fence);
+        readback.fence = nullptr;
+        m_firstPendingReadback = (m_firstPendingReadback + 1) % PIXEL_READBACK_COUNT;
+        --m_pendingReadbackCount;
+        if (status == GL_WAIT_FAILED) {
+            LOG(NEXO_WARN, "Pixel readback {} of framebuffer {} failed", readback.region.requestId, m_id);
+            return std::nullopt;
+        }
+
+        NxPixelRegion region = std::move(readback.region);
+        const size_t pixelCount = static_cast<size_t>(region.width) * static_cast<size_t>(region.height);
+        region.pixels.resize(pixelCount);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+        if (const void *data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(pixelCount * sizeof(int)), GL_MAP_READ_BIT)) {
+            std::memcpy(region.pixels.data(), data, pixelCount * sizeof(int));
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        } else
+            std::ranges::fill(region.pixels, -1);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        return region;
+    }
+
     void NxOpenGlFramebuffer::clearAttachmentWrapper(const unsigned int attachmentIndex, const void *value, const std::type_info &ti) const
     {
         // Add more types here when necessary
@@ -23,6 +23,7 @@
 #include <glad/glad.h>
 #include <glm/fwd.hpp>
 #include <glm/glm.hpp>
+#include <array>
 #include <iostream>
 
 namespace nexo::renderer {
@@ -182,6 +183,29 @@ namespace nexo::renderer {
             }
             void getPixelWrapper(unsigned int attachementIndex, int x, int y, void *result, const std::type_info &ti) const override;
 
+            /**
+             * @brief Queues an asynchronous read of a region of an integer attachment.
+             *
+             * The pixels are packed into a pixel buffer of a small ring, and a fence is inserted after the copy.
+             *
+             * OpenGL Operations:
+             * - `glReadPixels` into a `GL_PIXEL_PACK_BUFFER`, which returns without waiting for the GPU.
+             * - `glFenceSync`: Marks the completion of the copy.
+             *
+             * Throws:
+             * - NxFramebufferInvalidIndex if the attachment index is out of bounds.
+             */
+            uint64_t requestPixelRegion(unsigned int attachmentIndex, int x, int y, int width = 1, int height = 1) override;
+
+            /**
+             * @brief Maps the pixel buffer of the oldest readback if its fence is signaled.
+             *
+             * OpenGL Operations:
+             * - `glClientWaitSync` with a zero timeout: Checks the fence without blocking.
+             * - `glMapBufferRange`: Copies the pixels out of the pixel buffer.
+             */
+            std::optional<NxPixelRegion> pollPixelRegion() override;
+
 
             /**
              * @brief Clears the specified attachment with a given value.
@@ -226,5 +250,19 @@ namespace nexo::renderer {
 
             std::vector<unsigned int> m_colorAttachments;
             unsigned int m_depthAttachment = 0;
+
+            struct PixelReadback {
+                unsigned int buffer = 0;
+                size_t capacity = 0;
+                GLsync fence = nullptr;
+                NxPixelRegion region;
+            };
+
+            // Enough slots to request every frame while the GPU runs a couple of frames behind
+            static constexpr size_t PIXEL_READBACK_COUNT = 3;
+            std::array<PixelReadback, PIXEL_READBACK_COUNT> m_pixelReadbacks{};
+            size_t m_firstPendingReadback = 0;
+            size_t m_pendingReadbackCount = 0;
+            uint64_t m_nextReadbackId = 1;
     };
 }
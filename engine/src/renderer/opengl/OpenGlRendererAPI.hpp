@@ -128,6 +128,37 @@ namespace nexo::renderer {
              */
             void drawIndexed(const std::shared_ptr<NxVertexArray> &vertexArray, size_t indexCount = 0) override;
 
+            /**
+             * @brief Draws several instances of indexed geometry with glDrawElementsInstancedBaseInstance.
+             *
+             * @param vertexArray A shared pointer to the `NxVertexArray`, its instance buffer must be attached.
+             * @param instanceCount Number of instances to draw.
+             * @param baseInstance Index of the first instance read from the instance buffer.
+             * @param indexCount The number of indices to draw. If zero, all indices in the buffer are used.
+             *
+             * Throws:
+             * - NxGraphicsApiNotInitialized if OpenGL is not initialized.
+             * - NxInvalidValue if the `vertexArray` is null.
+             */
+            void drawIndexedInstanced(const std::shared_ptr<NxVertexArray> &vertexArray, size_t instanceCount,
+                                      size_t baseInstance, size_t indexCount = 0) override;
+
+            /**
+             * @brief Submits indirect commands with glMultiDrawElementsIndirect.
+             *
+             * @param vertexArray A shared pointer to the `NxVertexArray` every draw reads from.
+             * @param commands Buffer holding the NxDrawElementsIndirectCommand, bound as GL_DRAW_INDIRECT_BUFFER.
+             * @param firstCommand Index of the first command to submit.
+             * @param drawCount Number of commands to submit.
+             *
+             * Throws:
+             * - NxGraphicsApiNotInitialized if OpenGL is not initialized.
+             * - NxInvalidValue if the `vertexArray` or the `commands` buffer is null.
+             */
+            void multiDrawIndexedIndirect(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                          const std::shared_ptr<NxVertexBuffer> &commands,
+                                          size_t firstCommand, size_t drawCount) override;
+
             void drawUnIndexed(size_t verticesCount) override;
 
             void setStencilTest(bool enable) override;
@@ -138,6 +169,14 @@ namespace nexo::renderer {
             void setCulling(bool enable) override;
             void setCulledFace(CulledFace face) override;
             void setWindingOrder(WindingOrder order) override;
+
+            void setBlend(bool enable) override;
+            void setBlendFunc(unsigned int source, unsigned int destination) override;
+
+            void useProgram(unsigned int id) override;
+            void bindVertexArray(unsigned int id) override;
+            void bindTexture(unsigned int slot, unsigned int id) override;
+            void bindFramebuffer(unsigned int id, unsigned int width = 0, unsigned int height = 0) override;
         private:
             bool m_initialized = false;
             unsigned int m_maxWidth = 0;
@@ -28,8 +28,9 @@ namespace nexo::renderer {
 
     void NxOpenGlRendererApi::init()
     {
+        // The state below is set behind the cache, which may still describe a previous context
+        m_stateCache.invalidate();
         glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
         glEnable(GL_DEPTH_TEST);
         glDepthFunc(GL_LESS);
@@ -45,6 +46,8 @@ namespace nexo::renderer {
         m_maxWidth = static_cast<unsigned int>(maxViewportSize[0]);
         m_maxHeight = static_cast<unsigned int>(maxViewportSize[1]);
         m_initialized = true;
+        // Set through the cache, so passes changing the blending are tracked from the start
+        setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
         LOG(NEXO_DEV, "Opengl renderer api initialized");
     }
 
@@ -56,7 +59,8 @@ namespace nexo::renderer {
             THROW_EXCEPTION(NxGraphicsApiViewportResizingFailure, "OPENGL", false, width, height);
         if (width > m_maxWidth || height > m_maxHeight)
             THROW_EXCEPTION(NxGraphicsApiViewportResizingFailure, "OPENGL", true, width, height);
-        glViewport(static_cast<int>(x), static_cast<int>(y), static_cast<int>(width), static_cast<int>(height));
+        if (m_stateCache.setViewport(x, y, width, height))
+            glViewport(static_cast<int>(x), static_cast<int>(y), static_cast<int>(width), static_cast<int>(height));
     }
 
     void NxOpenGlRendererApi::getMaxViewportSize(unsigned int *width, unsigned int *height)
@@ -90,6 +94,8 @@ namespace nexo::renderer {
     {
         if (!m_initialized)
             THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!m_stateCache.setCapability(NxStateCache::Capability::DEPTH_TEST, enable))
+            return;
         if (enable)
             glEnable(GL_DEPTH_TEST);
         else
@@ -100,6 +106,8 @@ namespace nexo::renderer {
     {
         if (!m_initialized)
             THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!m_stateCache.setDepthFunc(func))
+            return;
         glDepthFunc(func);
     }
 
@@ -107,6 +115,8 @@ namespace nexo::renderer {
     {
         if (!m_initialized)
             THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!m_stateCache.setDepthMask(enable))
+            return;
         if (enable)
             glDepthMask(GL_TRUE);
         else
@@ -120,13 +130,54 @@ namespace nexo::renderer {
         if (!vertexArray)
             THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Vertex array cannot be null");
         const size_t count = indexCount ? indexCount : vertexArray->getIndexBuffer()->getCount();
+        m_counters.drawCalls++;
+        m_counters.instances++;
+        m_counters.triangles += count / 3;
         glDrawElements(GL_TRIANGLES, static_cast<int>(count), GL_UNSIGNED_INT, nullptr);
     }
 
+    void NxOpenGlRendererApi::drawIndexedInstanced(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                                   const size_t instanceCount, const size_t baseInstance,
+                                                   const size_t indexCount)
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!vertexArray)
+            THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Vertex array cannot be null");
+        const size_t count = indexCount ? indexCount : vertexArray->getIndexBuffer()->getCount();
+        m_counters.drawCalls++;
+        m_counters.instances += instanceCount;
+        m_counters.triangles += count / 3 * instanceCount;
+        glDrawElementsInstancedBaseInstance(GL_TRIANGLES, static_cast<int>(count), GL_UNSIGNED_INT, nullptr,
+                                            static_cast<int>(instanceCount), static_cast<unsigned int>(baseInstance));
+    }
+
+    void NxOpenGlRendererApi::multiDrawIndexedIndirect(const std::shared_ptr<NxVertexArray> &vertexArray,
+                                                       const std::shared_ptr<NxVertexBuffer> &commands,
+                                                       const size_t firstCommand, const size_t drawCount)
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!vertexArray)
+            THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Vertex array cannot be null");
+        if (!commands)
+            THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Indirect command buffer cannot be null");
+        // The instances and triangles live in the command buffer, the caller accounts them with addDrawnInstances
+        m_counters.drawCalls++;
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commands->getId());
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT,
+                                    reinterpret_cast<const void *>(firstCommand * sizeof(NxDrawElementsIndirectCommand)),
+                                    static_cast<int>(drawCount), 0);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    }
+
     void NxOpenGlRendererApi::drawUnIndexed(size_t verticesCount)
     {
         if (!m_initialized)
             THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        m_counters.drawCalls++;
+        m_counters.instances++;
+        m_counters.triangles += verticesCount / 3;
         glDrawArrays(GL_TRIANGLES, 0, static_cast<int>(verticesCount));
     }
 
@@ -134,6 +185,8 @@ namespace nexo::renderer {
     {
         if (!m_initialized)
             THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!m_stateCache.setCapability(NxStateCache::Capability::STENCIL_TEST, enable))
+            return;
         if (enable)
             glEnable(GL_STENCIL_TEST);
         else
@@ -144,6 +197,8 @@ namespace nexo::renderer {
     {
         if (!m_initialized)
             THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!m_stateCache.setStencilMask(mask))
+            return;
         glStencilMask(mask);
     }
 
@@ -151,6 +206,8 @@ namespace nexo::renderer {
     {
         if (!m_initialized)
             THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!m_stateCache.setStencilFunc(func, ref, mask))
+            return;
         glStencilFunc(func, ref, mask);
     }
 
@@ -158,6 +215,8 @@ namespace nexo::renderer {
     {
         if (!m_initialized)
             THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!m_stateCache.setStencilOp(sfail, dpfail, dppass))
+            return;
         glStencilOp(sfail, dpfail, dppass);
     }
 
@@ -165,6 +224,8 @@ namespace nexo::renderer {
     {
         if (!m_initialized)
             THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!m_stateCache.setCapability(NxStateCache::Capability::CULL_FACE, enable))
+            return;
         if (enable)
             glEnable(GL_CULL_FACE);
         else
@@ -175,6 +236,8 @@ namespace nexo::renderer {
     {
         if (!m_initialized)
             THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!m_stateCache.setCulledFace(static_cast<unsigned int>(face)))
+            return;
         if (face == CulledFace::BACK)
             glCullFace(GL_BACK);
         else if (face == CulledFace::FRONT)
@@ -187,9 +250,64 @@ namespace nexo::renderer {
     {
         if (!m_initialized)
             THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!m_stateCache.setWindingOrder(static_cast<unsigned int>(order)))
+            return;
         if (order == WindingOrder::CCW)
             glFrontFace(GL_CCW);
         else if (order == WindingOrder::CW)
             glFrontFace(GL_CW);
     }
+
+    void NxOpenGlRendererApi::setBlend(const bool enable)
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!m_stateCache.setCapability(NxStateCache::Capability::BLEND, enable))
+            return;
+        if (enable)
+            glEnable(GL_BLEND);
+        else
+            glDisable(GL_BLEND);
+    }
+
+    void NxOpenGlRendererApi::setBlendFunc(const unsigned int source, const unsigned int destination)
+    {
+        if (!m_initialized)
+            THROW_EXCEPTION(NxGraphicsApiNotInitialized, "OPENGL");
+        if (!m_stateCache.setBlendFunc(source, destination))
+            return;
+        glBlendFunc(source, destination);
+    }
+
+    void NxOpenGlRendererApi::useProgram(const unsigned int id)
+    {
+        if (m_stateCache.setProgram(id))
+            glUseProgram(id);
+    }
+
+    void NxOpenGlRendererApi::bindVertexArray(const unsigned int id)
+    {
+        if (m_stateCache.setVertexArray(id))
+            glBindVertexArray(id);
+    }
+
+    void NxOpenGlRendererApi::bindTexture(const unsigned int slot, const unsigned int id)
+    {
+        // glBindTexture targets the active unit, so the unit has to be selected even when the
+        // texture is already bound to leave it active as documented
+        if (m_stateCache.setActiveTextureUnit(slot))
+            glActiveTexture(GL_TEXTURE0 + slot);
+        if (m_stateCache.setTexture(slot, id)) {
+            glBindTexture(GL_TEXTURE_2D, id);
+            m_counters.textureBinds++;
+        }
+    }
+
+    void NxOpenGlRendererApi::bindFramebuffer(const unsigned int id, const unsigned int width, const unsigned int height)
+    {
+        if (m_stateCache.setFramebuffer(id))
+            glBindFramebuffer(GL_FRAMEBUFFER, id);
+        if (width && height && m_stateCache.setViewport(0, 0, width, height))
+            glViewport(0, 0, static_cast<int>(width), static_cast<int>(height));
+    }
 }
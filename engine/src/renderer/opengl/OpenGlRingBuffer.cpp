@@ -0,0 +1,122 @@
+//// OpenGlRingBuffer //////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the opengl persistently mapped streaming buffer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "OpenGlRingBuffer.hpp"
+#include "OpenGlBuffer.hpp"
+#include "Logger.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+#include <algorithm>
+
+namespace nexo::renderer {
+
+    static constexpr GLbitfield sRingMapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    // One second, a fence still pending after that means the GPU is lost
+    static constexpr GLuint64 sFenceTimeout = 1'000'000'000;
+
+    NxOpenGlRingBuffer::NxOpenGlRingBuffer(const size_t frameCapacity, const unsigned int frameCount)
+        : m_fences(frameCount, nullptr)
+    {
+        if (!frameCount)
+            THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Ring buffer needs at least one frame");
+        createStorage(std::max<size_t>(frameCapacity, 1));
+    }
+
+    NxOpenGlRingBuffer::~NxOpenGlRingBuffer()
+    {
+        releaseFences();
+        if (m_buffer)
+            glUnmapNamedBuffer(m_buffer->getId());
+    }
+
+    void NxOpenGlRingBuffer::createStorage(const size_t frameCapacity)
+    {
+        if (m_buffer)
+            glUnmapNamedBuffer(m_buffer->getId());
+        const size_t size = frameCapacity * m_fences.size();
+        m_buffer = std::make_shared<NxOpenGlVertexBuffer>(size, sRingMapFlags);
+        m_mapping = static_cast<std::byte *>(glMapNamedBufferRange(m_buffer->getId(), 0, static_cast<GLsizeiptr>(size), sRingMapFlags));
+        if (!m_mapping)
+            THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Could not map the ring buffer storage");
+        m_frameCapacity = frameCapacity;
+    }
+
+    void NxOpenGlRingBuffer::releaseFences()
+    {
+        for (auto &fence : m_fences) {
+            if (fence)
+                glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+
+    NxRingAllocation NxOpenGlRingBuffer::allocate(const size_t size, const size_t alignment)
+    {
+        const auto alignUp = [alignment](const size_t value) {
+            return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value;
+        };
+        size_t regionStart = m_frameIndex * m_frameCapacity;
+        size_t offset = alignUp(regionStart + m_frameOffset);
+        if (offset + size > regionStart + m_frameCapacity) {
+            // The old buffer stays alive as long as the vertex arrays and draws of this frame use it,
+            // the new one has no pending work so its fences are dropped
+            const size_t frameCapacity = std::max(m_frameCapacity * 2, alignUp(size) + alignment);
+            LOG(NEXO_DEV, "Ring buffer grown from {} to {} bytes per frame", m_frameCapacity, frameCapacity);
+            releaseFences();
+            createStorage(frameCapacity);
+            m_frameOffset = 0;
+            regionStart = m_frameIndex * m_frameCapacity;
+            offset = alignUp(regionStart);
+        }
+        m_frameOffset = offset + size - regionStart;
+        return {m_mapping + offset, offset};
+    }
+
+    void NxOpenGlRingBuffer::beginFrame()
+    {
+        m_frameIndex = (m_frameIndex + 1) % static_cast<unsigned int>(m_fences.size());
+        m_frameOffset = 0;
+        GLsync &fence = m_fences[m_frameIndex];
+        if (!fence)
+            return;
+        GLenum status = glClientWaitSync(fence, 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED) {
+            LOG(NEXO_DEV, "Ring buffer waiting on the GPU for frame region {}", m_frameIndex);
+            status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, sFenceTimeout);
+        }
+        if (status == GL_TIMEOUT_EXPIRED || status == GL_WAIT_FAILED)
+            LOG(NEXO_WARN, "Ring buffer fence of frame region {} did not signal", m_frameIndex);
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    void NxOpenGlRingBuffer::endFrame()
+    {
+        GLsync &fence = m_fences[m_frameIndex];
+        if (fence)
+            glDeleteSync(fence);
+        fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    std::shared_ptr<NxVertexBuffer> NxOpenGlRingBuffer::getBuffer() const
+    {
+        return m_buffer;
+    }
+}
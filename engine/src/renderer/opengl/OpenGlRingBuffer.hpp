@@ -0,0 +1,67 @@
+//// OpenGlRingBuffer //////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the opengl persistently mapped streaming buffer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "renderer/RingBuffer.hpp"
+
+#include <glad/glad.h>
+#include <vector>
+
+namespace nexo::renderer {
+
+    class NxOpenGlVertexBuffer;
+
+    /**
+     * @class NxOpenGlRingBuffer
+     * @brief OpenGL ring buffer, backed by a persistent and coherent mapping.
+     *
+     * OpenGL Operations:
+     * - `glNamedBufferStorage` + `glMapNamedBufferRange` with `GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT`:
+     *   The buffer is mapped once, writes are visible to the GPU without flushing or orphaning.
+     * - `glFenceSync` / `glClientWaitSync`: One fence per region, waited on before the region is reused.
+     */
+    class NxOpenGlRingBuffer final : public NxRingBuffer {
+        public:
+            NxOpenGlRingBuffer(size_t frameCapacity, unsigned int frameCount);
+            ~NxOpenGlRingBuffer() override;
+
+            NxOpenGlRingBuffer(const NxOpenGlRingBuffer &) = delete;
+            NxOpenGlRingBuffer &operator=(const NxOpenGlRingBuffer &) = delete;
+
+            NxRingAllocation allocate(size_t size, size_t alignment) override;
+            void beginFrame() override;
+            void endFrame() override;
+
+            [[nodiscard]] std::shared_ptr<NxVertexBuffer> getBuffer() const override;
+            [[nodiscard]] size_t getFrameCapacity() const override { return m_frameCapacity; }
+
+        private:
+            void createStorage(size_t frameCapacity);
+            void releaseFences();
+
+            std::shared_ptr<NxOpenGlVertexBuffer> m_buffer;
+            std::byte *m_mapping = nullptr;
+            size_t m_frameCapacity = 0;
+            std::vector<GLsync> m_fences;
+            unsigned int m_frameIndex = 0;
+            // Bytes used in the region of the current frame
+            size_t m_frameOffset = 0;
+    };
+}
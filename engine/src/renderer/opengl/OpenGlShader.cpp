@@ -21,14 +21,22 @@
 #include "Logger.hpp"
 #include "Shader.hpp"
 #include "renderer/RendererExceptions.hpp"
+#include "renderer/RenderCommand.hpp"
+#include "OpenGlShaderCache.hpp"
 #include "OpenGlShaderReflection.hpp"
+#include "OpenGlTextureTable.hpp"
 
-#include <array>
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <cstring>
 #include <vector>
 #include <glm/gtc/type_ptr.hpp>
 
 namespace nexo::renderer {
 
+    // GL_KHR_parallel_shader_compile is not part of the generated loader, its entry point is loaded by hand
+    using MaxShaderCompilerThreadsProc = void (APIENTRY *)(GLuint count);
+
     static GLenum shaderTypeFromString(const std::string_view &type)
     {
         if (type == "vertex")
@@ -39,18 +47,37 @@ namespace nexo::renderer {
         return 0;
     }
 
-    NxOpenGlShader::NxOpenGlShader(const std::string &path)
+    NxOpenGlShader::NxOpenGlShader(const std::string &path, const std::vector<std::string> &defines,
+                                   const bool deferLinkCheck)
     {
         const std::string src = readFile(path);
-        const auto shaderSources = preProcess(src, path);
-        compile(shaderSources);
+        auto shaderSources = preProcess(src, path);
+        auto stageDefines = defines;
+        // Material textures have to be sampled the same way the texture table stores them
+        if (NxOpenGlTextureTable::isBindlessSupported())
+            stageDefines.emplace_back("NX_BINDLESS_TEXTURES");
+        for (auto &[type, source] : shaderSources)
+            injectDefines(source, stageDefines);
 
         auto lastSlash = path.find_last_of("/\\");
         lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
         const auto lastDot = path.rfind('.');
         const auto count = lastDot == std::string::npos ? path.size() - lastSlash : lastDot - lastSlash;
         m_name = path.substr(lastSlash, count);
-        setupUniformLocations();
+
+        if (NxOpenGlShaderCache::isSupported()) {
+            // Every variant of a file gets its own record
+            m_cacheVariant = m_name;
+            for (const auto &define : stageDefines)
+                m_cacheVariant += "_" + define;
+            m_cacheKey = NxOpenGlShaderCache::computeKey(shaderSources);
+            if (loadFromCache())
+                return;
+        }
+
+        compile(shaderSources);
+        if (!deferLinkCheck || !isParallelCompileSupported())
+            finishCompilation();
     }
 
     NxOpenGlShader::NxOpenGlShader(std::string name, const std::string_view &vertexSource,
@@ -60,11 +87,12 @@ namespace nexo::renderer {
         preProcessedSource[GL_VERTEX_SHADER] = vertexSource;
         preProcessedSource[GL_FRAGMENT_SHADER] = fragmentSource;
         compile(preProcessedSource);
-        setupUniformLocations();
+        finishCompilation();
     }
 
     NxOpenGlShader::~NxOpenGlShader()
     {
+        NxRenderCommand::getStateCache().forgetProgram(m_id);
         glDeleteProgram(m_id);
     }
 
@@ -107,57 +135,101 @@ namespace nexo::renderer {
         return shaderSources;
     }
 
+    void NxOpenGlShader::injectDefines(std::string &source, const std::vector<std::string> &defines)
+    {
+        if (defines.empty())
+            return;
+        std::string block;
+        for (const auto &define : defines)
+            block += "#define " + define + "\n";
+
+        // #version has to stay the first directive of the stage
+        const size_t version = source.find("#version");
+        if (version == std::string::npos) {
+            source.insert(0, block);
+            return;
+        }
+        const size_t eol = source.find('\n', version);
+        source.insert(eol == std::string::npos ? source.size() : eol + 1, block);
+    }
+
+    bool NxOpenGlShader::isParallelCompileSupported()
+    {
+        static const bool supported = [] {
+            GLint extensionCount = 0;
+            glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+            bool found = false;
+            for (GLint i = 0; i < extensionCount && !found; ++i)
+                found = std::strcmp(reinterpret_cast<const char *>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i))),
+                                    "GL_KHR_parallel_shader_compile") == 0;
+            if (!found)
+                return false;
+            const auto maxShaderCompilerThreads =
+                reinterpret_cast<MaxShaderCompilerThreadsProc>(glfwGetProcAddress("glMaxShaderCompilerThreadsKHR"));
+            if (!maxShaderCompilerThreads)
+                return false;
+            // 0xFFFFFFFF lets the implementation pick the number of threads
+            maxShaderCompilerThreads(0xFFFFFFFF);
+            return true;
+        }();
+        return supported;
+    }
+
     void NxOpenGlShader::compile(const std::unordered_map<GLenum, std::string> &shaderSources)
     {
-        // Vertex and fragment shaders are successfully compiled.
-        // Now time to link them together into a program.
-        // Get a program object.
         if (shaderSources.size() > 2)
             THROW_EXCEPTION(NxShaderCreationFailed, "OPENGL",
                         "Only two shader type (vertex/fragment) are supported for now", "");
-        const GLuint program = glCreateProgram();
-        std::array<GLenum, 2> glShaderIds{};
-        unsigned int shaderIndex = 0;
-        for (const auto &[fst, snd]: shaderSources)
+        m_id = glCreateProgram();
+        if (!m_cacheVariant.empty())
+            glProgramParameteri(m_id, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        for (const auto &[type, src] : shaderSources)
         {
-            const GLenum type = fst;
-            const std::string src = snd;
-            // Create an empty vertex shader handle
             const GLuint shader = glCreateShader(type);
-
-            // Send the vertex shader source code to GL
-            // Note that std::string's .c_str is NULL character terminated.
             const GLchar *source = src.c_str();
             glShaderSource(shader, 1, &source, nullptr);
-
-            // Compile the vertex shader
             glCompileShader(shader);
+            glAttachShader(m_id, shader);
+            m_pendingStages.push_back(shader);
+        }
+        // Statuses are only queried in finishCompilation(), querying them here would wait for the driver
+        glLinkProgram(m_id);
+    }
 
-            GLint isCompiled = 0;
-            glGetShaderiv(shader, GL_COMPILE_STATUS, &isCompiled);
-            if (isCompiled == GL_FALSE)
-            {
-                GLint maxLength = 0;
-                glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
-
-                // The maxLength includes the NULL character
-                std::vector<GLchar> infoLog(maxLength);
-                glGetShaderInfoLog(shader, maxLength, &maxLength, &infoLog[0]);
-
-                // We don't need the shader anymore.
-                glDeleteShader(shader);
-                THROW_EXCEPTION(NxShaderCreationFailed, "OPENGL",
-                                "Opengl failed to compile the shader: " + std::string(infoLog.data()), "");
+    void NxOpenGlShader::finishCompilation()
+    {
+        if (m_pendingStages.empty())
+            return;
+
+        const auto releaseStages = [this] {
+            for (const GLuint stage : m_pendingStages) {
+                glDetachShader(m_id, stage);
+                glDeleteShader(stage);
             }
-            glAttachShader(program, shader);
-            glShaderIds[shaderIndex++] = shader;
-        }
-        m_id = program;
+            m_pendingStages.clear();
+        };
 
-        // Link our program
-        glLinkProgram(m_id);
+        // Compile errors are reported before the link error they cause
+        for (const GLuint stage : m_pendingStages)
+        {
+            GLint isCompiled = 0;
+            glGetShaderiv(stage, GL_COMPILE_STATUS, &isCompiled);
+            if (isCompiled == GL_TRUE)
+                continue;
+            GLint maxLength = 0;
+            glGetShaderiv(stage, GL_INFO_LOG_LENGTH, &maxLength);
+
+            // The maxLength includes the NULL character
+            std::vector<GLchar> infoLog(std::max(maxLength, 1));
+            glGetShaderInfoLog(stage, maxLength, &maxLength, infoLog.data());
+
+            releaseStages();
+            glDeleteProgram(m_id);
+            m_id = 0;
+            THROW_EXCEPTION(NxShaderCreationFailed, "OPENGL",
+                            "Opengl failed to compile the shader: " + std::string(infoLog.data()), "");
+        }
 
-        // Note the different functions here: glGetProgram* instead of glGetShader*.
         GLint isLinked = 0;
         glGetProgramiv(m_id, GL_LINK_STATUS, &isLinked);
         if (isLinked == GL_FALSE)
@@ -166,29 +238,70 @@ namespace nexo::renderer {
             glGetProgramiv(m_id, GL_INFO_LOG_LENGTH, &maxLength);
 
             // The maxLength includes the NULL character
-            std::vector<GLchar> infoLog(maxLength);
-            glGetProgramInfoLog(m_id, maxLength, &maxLength, &infoLog[0]);
+            std::vector<GLchar> infoLog(std::max(maxLength, 1));
+            glGetProgramInfoLog(m_id, maxLength, &maxLength, infoLog.data());
 
-            // We don't need the program anymore.
+            releaseStages();
             glDeleteProgram(m_id);
-            // Don't leak shaders either.
-            for (const auto id: glShaderIds)
-                glDeleteShader(id);
-
+            m_id = 0;
             THROW_EXCEPTION(NxShaderCreationFailed, "OPENGL",
                                 "Opengl failed to compile the shader: " + std::string(infoLog.data()), "");
         }
 
         // Always detach shaders after a successful link.
-        for (const auto id: glShaderIds)
-            glDetachShader(program, id);
+        releaseStages();
+        setupUniformLocations();
+        if (!m_cacheVariant.empty())
+            storeInCache();
+    }
+
+    bool NxOpenGlShader::loadFromCache()
+    {
+        const auto record = NxOpenGlShaderCache::load(m_cacheVariant, m_cacheKey);
+        if (!record)
+            return false;
+
+        const GLuint program = glCreateProgram();
+        glProgramBinary(program, record->binaryFormat, record->binary.data(), static_cast<GLsizei>(record->binary.size()));
+        GLint isLinked = 0;
+        glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+        if (isLinked == GL_FALSE) {
+            // Drivers may reject their own binaries, e.g. after an update that kept the version string
+            LOG(NEXO_WARN, "Cached binary of shader {} was rejected by the driver, compiling it again", m_cacheVariant);
+            glDeleteProgram(program);
+            return false;
+        }
+        m_id = program;
+        m_uniformInfos = record->uniforms;
+        m_attributeInfos = record->attributes;
+        setupRequiredAttributes();
+        LOG(NEXO_DEV, "Shader {} loaded from the program binary cache", m_cacheVariant);
+        return true;
+    }
+
+    void NxOpenGlShader::storeInCache() const
+    {
+        GLint binaryLength = 0;
+        glGetProgramiv(m_id, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+        if (binaryLength <= 0)
+            return;
+        NxShaderCacheRecord record;
+        record.binary.resize(static_cast<size_t>(binaryLength));
+        glGetProgramBinary(m_id, binaryLength, nullptr, &record.binaryFormat, record.binary.data());
+        record.uniforms = m_uniformInfos;
+        record.attributes = m_attributeInfos;
+        NxOpenGlShaderCache::store(m_cacheVariant, m_cacheKey, record);
     }
 
     void NxOpenGlShader::setupUniformLocations()
     {
         m_uniformInfos = ShaderReflection::reflectUniforms(m_id);
         m_attributeInfos = ShaderReflection::reflectAttributes(m_id);
+        setupRequiredAttributes();
+    }
 
+    void NxOpenGlShader::setupRequiredAttributes()
+    {
         static const std::unordered_map<std::string, std::function<void(RequiredAttributes&)>> attributeMappers = {
             {"aPos", [](RequiredAttributes& attrs) { attrs.bitsUnion.flags.position = true; }},
             {"aNormal", [](RequiredAttributes& attrs) { attrs.bitsUnion.flags.normal = true; }},
@@ -207,12 +320,12 @@ namespace nexo::renderer {
 
     void NxOpenGlShader::bind() const
     {
-        glUseProgram(m_id);
+        NxRenderCommand::useProgram(m_id);
     }
 
     void NxOpenGlShader::unbind() const
     {
-        glUseProgram(0);
+        NxRenderCommand::useProgram(0);
     }
 
     int NxOpenGlShader::getUniformLocation(const std::string& name) const {
@@ -463,6 +576,29 @@ namespace nexo::renderer {
         return true;
     }
 
+    void NxOpenGlShader::setUniforms(const UniformBlock &block) const
+    {
+        // Values uploaded here bypass the name-keyed cache, which would otherwise skip legitimate updates
+        m_uniformCache.invalidate();
+
+        const float *data = block.data();
+        for (const auto &entry : block.entries()) {
+            const int location = getSlotLocation(entry.slot);
+            if (location == -1)
+                continue;
+            const float *value = data + entry.offset;
+            switch (entry.type) {
+                case UniformType::FLOAT: glUniform1fv(location, 1, value); break;
+                case UniformType::FLOAT2: glUniform2fv(location, 1, value); break;
+                case UniformType::FLOAT3: glUniform3fv(location, 1, value); break;
+                case UniformType::FLOAT4: glUniform4fv(location, 1, value); break;
+                case UniformType::INT:
+                case UniformType::BOOL: glUniform1i(location, std::bit_cast<int>(*value)); break;
+                case UniformType::MAT4: glUniformMatrix4fv(location, 1, GL_FALSE, value); break;
+            }
+        }
+    }
+
     void NxOpenGlShader::bindStorageBuffer(const unsigned int index) const
     {
     	if (index > m_storageBuffers.size())
@@ -44,12 +44,17 @@ namespace nexo::renderer {
             * contain `#type` directives to separate shader stages.
             *
             * @param path The file path to the shader source code.
+            * @param defines Macros defined right after the `#version` line of every stage.
+            * @param deferLinkCheck Leaves the link status to finishCompilation(), see NxShader::create.
+            *
+            * The linked program is saved in NxOpenGlShaderCache and loaded back on the next runs
+            * as long as the sources and the driver did not change.
             *
             * Throws:
             * - `NxFileNotFoundException` if the file cannot be found.
             * - `NxShaderCreationFailed` if shader compilation fails.
             */
-            explicit NxOpenGlShader(const std::string &path);
+            explicit NxOpenGlShader(const std::string &path, const std::vector<std::string> &defines = {}, bool deferLinkCheck = false);
             NxOpenGlShader(std::string name, const std::string_view &vertexSource, const std::string_view &fragmentSource);
             ~NxOpenGlShader() override;
 
@@ -61,6 +66,13 @@ namespace nexo::renderer {
             void bind() const override;
             void unbind() const override;
 
+            void finishCompilation() override;
+
+            /**
+            * @brief Checks for GL_KHR_parallel_shader_compile and lets the driver use as many threads as it wants.
+            */
+            [[nodiscard]] static bool isParallelCompileSupported();
+
             bool setUniformFloat(const std::string &name, float value) const override;
             bool setUniformFloat2(const std::string &name, const glm::vec2 &values) const override;
             bool setUniformFloat3(const std::string &name, const glm::vec3 &values) const override;
@@ -77,6 +89,8 @@ namespace nexo::renderer {
             bool setUniformInt(NxShaderUniforms uniform, int value) const override;
             bool setUniformIntArray(NxShaderUniforms uniform, const int *values, unsigned int count) const override;
 
+            void setUniforms(const UniformBlock &block) const override;
+
             void bindStorageBuffer(unsigned int index) const override;
             void bindStorageBufferBase(unsigned int index, unsigned int bindingLocation) const override;
             void unbindStorageBuffer(unsigned int index) const override;
@@ -87,10 +101,18 @@ namespace nexo::renderer {
         private:
             std::string m_name;
             unsigned int m_id = 0;
+            // Stages of a program whose link status was not checked yet
+            std::vector<GLuint> m_pendingStages;
+            std::string m_cacheVariant;
+            uint64_t m_cacheKey = 0;
 
             static std::unordered_map<GLenum, std::string> preProcess(const std::string_view &src, const std::string &filePath);
+            static void injectDefines(std::string &source, const std::vector<std::string> &defines);
             void compile(const std::unordered_map<GLenum, std::string> &shaderSources);
+            bool loadFromCache();
+            void storeInCache() const;
             void setupUniformLocations();
+            void setupRequiredAttributes();
             int getUniformLocation(const std::string& name) const;
     };
 
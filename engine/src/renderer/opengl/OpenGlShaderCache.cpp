@@ -0,0 +1,227 @@
+//// OpenGlShaderCache /////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the on-disk cache of linked OpenGL programs
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "OpenGlShaderCache.hpp"
+#include "Logger.hpp"
+#include "Path.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <system_error>
+#include <type_traits>
+
+namespace nexo::renderer {
+
+    // Bumped whenever the layout of a record changes
+    static constexpr uint32_t sRecordVersion = 1;
+    static constexpr std::array<char, 4> sRecordMagic = {'N', 'X', 'S', 'B'};
+
+    std::filesystem::path NxOpenGlShaderCache::s_directory;
+
+    static void hashBytes(uint64_t &hash, const void *data, const size_t size)
+    {
+        // FNV-1a, stable across runs unlike std::hash
+        const auto *bytes = static_cast<const uint8_t *>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ULL;
+        }
+    }
+
+    static void hashString(uint64_t &hash, const char *str)
+    {
+        const std::string_view view = str ? str : "";
+        const auto size = static_cast<uint64_t>(view.size());
+        hashBytes(hash, &size, sizeof(size));
+        hashBytes(hash, view.data(), view.size());
+    }
+
+    template<typename T>
+    static void writeValue(std::ofstream &out, const T &value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    static void writeString(std::ofstream &out, const std::string &str)
+    {
+        writeValue(out, static_cast<uint32_t>(str.size()));
+        out.write(str.data(), static_cast<std::streamsize>(str.size()));
+    }
+
+    template<typename T>
+    static bool readValue(std::ifstream &in, T &value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return static_cast<bool>(in.read(reinterpret_cast<char *>(&value), sizeof(T)));
+    }
+
+    static bool readString(std::ifstream &in, std::string &str)
+    {
+        uint32_t size = 0;
+        if (!readValue(in, size))
+            return false;
+        str.resize(size);
+        return static_cast<bool>(in.read(str.data(), size));
+    }
+
+    bool NxOpenGlShaderCache::isSupported()
+    {
+        GLint formatCount = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+        return formatCount > 0;
+    }
+
+    uint64_t NxOpenGlShaderCache::computeKey(const std::unordered_map<GLenum, std::string> &shaderSources)
+    {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        // The map order is unspecified, stages are hashed in a fixed order
+        std::vector<GLenum> stages;
+        stages.reserve(shaderSources.size());
+        for (const auto &[stage, source] : shaderSources)
+            stages.push_back(stage);
+        std::ranges::sort(stages);
+        for (const GLenum stage : stages) {
+            hashBytes(hash, &stage, sizeof(stage));
+            hashString(hash, shaderSources.at(stage).c_str());
+        }
+        hashString(hash, reinterpret_cast<const char *>(glGetString(GL_VENDOR)));
+        hashString(hash, reinterpret_cast<const char *>(glGetString(GL_RENDERER)));
+        hashString(hash, reinterpret_cast<const char *>(glGetString(GL_VERSION)));
+        return hash;
+    }
+
+    std::optional<NxShaderCacheRecord> NxOpenGlShaderCache::load(const std::string &variant, const uint64_t key)
+    {
+        std::ifstream in(recordPath(variant), std::ios::binary);
+        if (!in)
+            return std::nullopt;
+
+        std::array<char, 4> magic{};
+        uint32_t version = 0;
+        uint64_t recordKey = 0;
+        if (!readValue(in, magic) || magic != sRecordMagic || !readValue(in, version) || version != sRecordVersion)
+            return std::nullopt;
+        if (!readValue(in, recordKey) || recordKey != key)
+            return std::nullopt;
+
+        NxShaderCacheRecord record;
+        uint32_t binarySize = 0;
+        if (!readValue(in, record.binaryFormat) || !readValue(in, binarySize) || binarySize == 0)
+            return std::nullopt;
+        record.binary.resize(binarySize);
+        if (!in.read(reinterpret_cast<char *>(record.binary.data()), binarySize))
+            return std::nullopt;
+
+        uint32_t uniformCount = 0;
+        if (!readValue(in, uniformCount))
+            return std::nullopt;
+        for (uint32_t i = 0; i < uniformCount; ++i) {
+            std::string uniformKey;
+            UniformInfo info;
+            if (!readString(in, uniformKey) || !readString(in, info.name) || !readValue(in, info.location) ||
+                !readValue(in, info.type) || !readValue(in, info.size))
+                return std::nullopt;
+            record.uniforms.emplace(std::move(uniformKey), std::move(info));
+        }
+
+        uint32_t attributeCount = 0;
+        if (!readValue(in, attributeCount))
+            return std::nullopt;
+        for (uint32_t i = 0; i < attributeCount; ++i) {
+            AttributeInfo info;
+            if (!readString(in, info.name) || !readValue(in, info.location) ||
+                !readValue(in, info.type) || !readValue(in, info.size))
+                return std::nullopt;
+            record.attributes.emplace(info.location, std::move(info));
+        }
+        return record;
+    }
+
+    void NxOpenGlShaderCache::store(const std::string &variant, const uint64_t key, const NxShaderCacheRecord &record)
+    {
+        const std::filesystem::path path = recordPath(variant);
+        std::error_code error;
+        std::filesystem::create_directories(path.parent_path(), error);
+        if (error) {
+            LOG(NEXO_WARN, "Cannot create the shader cache directory {}: {}", path.parent_path().string(), error.message());
+            return;
+        }
+
+        // Written aside then renamed, so an interrupted write never leaves a truncated record behind
+        std::filesystem::path tmpPath = path;
+        tmpPath += ".tmp";
+        {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                LOG(NEXO_WARN, "Cannot write the shader cache record {}", tmpPath.string());
+                return;
+            }
+            writeValue(out, sRecordMagic);
+            writeValue(out, sRecordVersion);
+            writeValue(out, key);
+            writeValue(out, record.binaryFormat);
+            writeValue(out, static_cast<uint32_t>(record.binary.size()));
+            out.write(reinterpret_cast<const char *>(record.binary.data()), static_cast<std::streamsize>(record.binary.size()));
+
+            writeValue(out, static_cast<uint32_t>(record.uniforms.size()));
+            for (const auto &[name, info] : record.uniforms) {
+                writeString(out, name);
+                writeString(out, info.name);
+                writeValue(out, info.location);
+                writeValue(out, info.type);
+                writeValue(out, info.size);
+            }
+            writeValue(out, static_cast<uint32_t>(record.attributes.size()));
+            for (const auto &[location, info] : record.attributes) {
+                writeString(out, info.name);
+                writeValue(out, info.location);
+                writeValue(out, info.type);
+                writeValue(out, info.size);
+            }
+            if (!out) {
+                LOG(NEXO_WARN, "Cannot write the shader cache record {}", tmpPath.string());
+                return;
+            }
+        }
+        std::filesystem::rename(tmpPath, path, error);
+        if (error)
+            LOG(NEXO_WARN, "Cannot write the shader cache record {}: {}", path.string(), error.message());
+    }
+
+    void NxOpenGlShaderCache::setDirectory(const std::filesystem::path &directory)
+    {
+        s_directory = directory;
+    }
+
+    const std::filesystem::path &NxOpenGlShaderCache::getDirectory()
+    {
+        if (s_directory.empty())
+            s_directory = Path::resolvePathRelativeToExe("../cache/shaders");
+        return s_directory;
+    }
+
+    std::filesystem::path NxOpenGlShaderCache::recordPath(const std::string &variant)
+    {
+        return getDirectory() / (variant + ".nxprog");
+    }
+
+}
@@ -0,0 +1,89 @@
+//// OpenGlShaderCache /////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the on-disk cache of linked OpenGL programs
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "renderer/Shader.hpp"
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+    * @brief Linked program as stored in the cache, with the reflection made when it was first linked.
+    */
+    struct NxShaderCacheRecord {
+        GLenum binaryFormat = 0;
+        std::vector<uint8_t> binary;
+        std::unordered_map<std::string, UniformInfo> uniforms;
+        std::unordered_map<int, AttributeInfo> attributes;
+    };
+
+    /**
+    * @class NxOpenGlShaderCache
+    * @brief On-disk cache of program binaries, skips compiling, linking and reflecting known programs.
+    *
+    * A record is keyed by a hash of the preprocessed stage sources and by the vendor, renderer and
+    * version strings of the driver: binaries are only valid for the driver that produced them, any
+    * mismatch is treated as a miss and the program is compiled from source again.
+    */
+    class NxOpenGlShaderCache {
+        public:
+            /**
+            * @brief Checks that the driver can save program binaries.
+            */
+            [[nodiscard]] static bool isSupported();
+
+            /**
+            * @brief Hashes the stage sources along with the driver strings of the current context.
+            */
+            [[nodiscard]] static uint64_t computeKey(const std::unordered_map<GLenum, std::string> &shaderSources);
+
+            /**
+            * @brief Reads the record of a program.
+            *
+            * @param variant Name of the program and of its defines, identifies the record file.
+            * @param key Key computed from the sources the program is about to be built from.
+            * @return The record, or nothing if it is missing, unreadable or was built from other sources or by another driver.
+            */
+            [[nodiscard]] static std::optional<NxShaderCacheRecord> load(const std::string &variant, uint64_t key);
+
+            /**
+            * @brief Writes the record of a program, replacing the previous one. Failures are logged and ignored.
+            */
+            static void store(const std::string &variant, uint64_t key, const NxShaderCacheRecord &record);
+
+            /**
+            * @brief Sets the directory of the records, `cache/shaders` next to the executable directory by default.
+            */
+            static void setDirectory(const std::filesystem::path &directory);
+            [[nodiscard]] static const std::filesystem::path &getDirectory();
+
+        private:
+            static std::filesystem::path recordPath(const std::string &variant);
+            static std::filesystem::path s_directory;
+    };
+
+}
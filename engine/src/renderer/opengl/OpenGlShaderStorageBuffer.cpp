@@ -18,6 +18,7 @@
 
 #include <glad/glad.h>
 #include "OpenGlShaderStorageBuffer.hpp"
+#include "renderer/RenderCommand.hpp"
 
 namespace nexo::renderer {
 	NxOpenGlShaderStorageBuffer::NxOpenGlShaderStorageBuffer(const unsigned int size)
@@ -48,5 +49,6 @@ namespace nexo::renderer {
 		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_id);
 		glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, size, data);
 		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+		NxRenderCommand::addUploadedBytes(size);
 	}
 }
@@ -20,6 +20,7 @@
 
 #include <Exception.hpp>
 #include <RendererExceptions.hpp>
+#include "renderer/RenderCommand.hpp"
 
 #include <stb_image.h>
 
@@ -86,6 +87,7 @@ namespace nexo::renderer {
 
     NxOpenGlTexture2D::~NxOpenGlTexture2D()
     {
+        NxRenderCommand::getStateCache().forgetTexture(m_id);
         glDeleteTextures(1, &m_id);
     }
 
@@ -120,10 +122,9 @@ namespace nexo::renderer {
     {
         if (const size_t expectedSize = static_cast<size_t>(m_width) * m_height * (m_dataFormat == GL_RGBA ? 4 : 3); size != expectedSize)
             THROW_EXCEPTION(NxTextureSizeMismatch, "OPENGL", size, expectedSize);
-        glBindTexture(GL_TEXTURE_2D, m_id);
-        // Update the entire texture with new data
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<int>(m_width), static_cast<int>(m_height), m_dataFormat, GL_UNSIGNED_BYTE, data);
-        glBindTexture(GL_TEXTURE_2D, 0);
+        // Update the entire texture with new data, without disturbing the bound textures
+        glTextureSubImage2D(m_id, 0, 0, 0, static_cast<int>(m_width), static_cast<int>(m_height), m_dataFormat, GL_UNSIGNED_BYTE, data);
+        NxRenderCommand::addUploadedBytes(size);
     }
 
     void NxOpenGlTexture2D::ingestDataFromStb(const uint8_t* data, const int width, const int height, const int channels,
@@ -171,25 +172,23 @@ namespace nexo::renderer {
         m_height = height;
 
         glGenTextures(1, &m_id);
-        glBindTexture(GL_TEXTURE_2D, m_id);
+        NxRenderCommand::bindTexture(0, m_id);
         glTexImage2D(GL_TEXTURE_2D, 0, m_internalFormat, glWidth, glHeight, 0, m_dataFormat, GL_UNSIGNED_BYTE, buffer);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-        glBindTexture(GL_TEXTURE_2D, 0);
+        NxRenderCommand::bindTexture(0, 0);
     }
 
     void NxOpenGlTexture2D::bind(const unsigned int slot) const
     {
-        glActiveTexture(GL_TEXTURE0 + slot);
-        glBindTexture(GL_TEXTURE_2D, m_id);
+        NxRenderCommand::bindTexture(slot, m_id);
     }
 
     void NxOpenGlTexture2D::unbind(const unsigned int slot) const
     {
-        glActiveTexture(GL_TEXTURE0 + slot);
-        glBindTexture(GL_TEXTURE_2D, 0);
+        NxRenderCommand::bindTexture(slot, 0);
     }
 
 }
@@ -0,0 +1,247 @@
+//// OpenGlTextureTable ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the OpenGL material texture table
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "OpenGlTextureTable.hpp"
+#include "Logger.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <cstring>
+#include <ranges>
+
+namespace nexo::renderer {
+
+    // GL_ARB_bindless_texture is not part of the generated loader, its entry points are loaded by hand
+    using GetTextureHandleProc = GLuint64 (APIENTRY *)(GLuint texture);
+    using TextureHandleResidencyProc = void (APIENTRY *)(GLuint64 handle);
+
+    static GetTextureHandleProc sGetTextureHandle = nullptr;
+    static TextureHandleResidencyProc sMakeTextureHandleResident = nullptr;
+    static TextureHandleResidencyProc sMakeTextureHandleNonResident = nullptr;
+
+    static constexpr size_t sInitialHandleCapacity = 256;
+    static constexpr GLsizei sInitialArrayLayers = 4;
+    // The layer is packed in the low 16 bits of the index
+    static constexpr GLint sMaxIndexedLayers = 1 << 16;
+
+    bool NxOpenGlTextureTable::isBindlessSupported()
+    {
+        static const bool supported = [] {
+            GLint extensionCount = 0;
+            glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+            bool found = false;
+            for (GLint i = 0; i < extensionCount && !found; ++i)
+                found = std::strcmp(reinterpret_cast<const char *>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i))),
+                                    "GL_ARB_bindless_texture") == 0;
+            if (!found)
+                return false;
+            sGetTextureHandle = reinterpret_cast<GetTextureHandleProc>(glfwGetProcAddress("glGetTextureHandleARB"));
+            sMakeTextureHandleResident = reinterpret_cast<TextureHandleResidencyProc>(glfwGetProcAddress("glMakeTextureHandleResidentARB"));
+            sMakeTextureHandleNonResident = reinterpret_cast<TextureHandleResidencyProc>(glfwGetProcAddress("glMakeTextureHandleNonResidentARB"));
+            return sGetTextureHandle && sMakeTextureHandleResident && sMakeTextureHandleNonResident;
+        }();
+        return supported;
+    }
+
+    NxOpenGlTextureTable::NxOpenGlTextureTable(const std::shared_ptr<NxTexture2D> &defaultTexture)
+    {
+        if (!defaultTexture)
+            THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Texture table needs a default texture");
+        m_bindless = isBindlessSupported();
+        if (m_bindless) {
+            m_handleCapacity = sInitialHandleCapacity;
+            glCreateBuffers(1, &m_handleBuffer);
+            glNamedBufferData(m_handleBuffer, static_cast<GLsizeiptr>(m_handleCapacity * sizeof(GLuint64)), nullptr, GL_DYNAMIC_DRAW);
+        } else {
+            GLint maxLayers = 0;
+            glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+            m_maxArrayLayers = std::min(maxLayers, sMaxIndexedLayers);
+        }
+        registerTexture(defaultTexture);
+        bind();
+        LOG(NEXO_DEV, "Texture table using {}", m_bindless ? "bindless textures" : "texture arrays");
+    }
+
+    NxOpenGlTextureTable::~NxOpenGlTextureTable()
+    {
+        for (const auto &entry : m_entries | std::views::values)
+            if (entry.handle && !entry.texture.expired())
+                sMakeTextureHandleNonResident(entry.handle);
+        if (m_handleBuffer)
+            glDeleteBuffers(1, &m_handleBuffer);
+        for (const auto &array : m_arrays)
+            glDeleteTextures(1, &array.id);
+    }
+
+    int NxOpenGlTextureTable::getIndex(const std::shared_ptr<NxTexture2D> &texture)
+    {
+        if (!texture)
+            return 0;
+        if (const auto it = m_entries.find(texture->getId()); it != m_entries.end()) {
+            // Same control block means the entry still refers to this texture, without locking the weak pointer
+            const auto &registered = it->second.texture;
+            if (!registered.owner_before(texture) && !texture.owner_before(registered))
+                return it->second.index;
+            // The id was reused by a new texture after the registered one was destroyed
+            release(it->second);
+            m_entries.erase(it);
+        }
+        return registerTexture(texture);
+    }
+
+    void NxOpenGlTextureTable::bind()
+    {
+        std::erase_if(m_entries, [this](const auto &item) {
+            if (!item.second.texture.expired())
+                return false;
+            release(item.second);
+            return true;
+        });
+
+        if (m_bindless) {
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, NX_TEXTURE_TABLE_BINDING, m_handleBuffer);
+            return;
+        }
+        for (size_t i = 0; i < m_arrays.size(); ++i)
+            glBindTextureUnit(NX_TEXTURE_ARRAYS_FIRST_UNIT + static_cast<GLuint>(i), m_arrays[i].id);
+    }
+
+    int NxOpenGlTextureTable::registerTexture(const std::shared_ptr<NxTexture2D> &texture)
+    {
+        // Failed registrations are kept with the default index so they are not retried every frame
+        Entry entry{texture};
+        if (m_bindless) {
+            entry.handle = sGetTextureHandle(texture->getId());
+            if (entry.handle) {
+                sMakeTextureHandleResident(entry.handle);
+                entry.index = registerHandle(entry.handle);
+            } else
+                LOG(NEXO_WARN, "Could not get a bindless handle for texture {}, using the default texture", texture->getId());
+        } else
+            entry.index = registerInArray(*texture);
+        m_entries.emplace(texture->getId(), entry);
+        return entry.index;
+    }
+
+    int NxOpenGlTextureTable::registerHandle(const GLuint64 handle)
+    {
+        int index = 0;
+        if (!m_freeIndices.empty()) {
+            index = m_freeIndices.back();
+            m_freeIndices.pop_back();
+            m_handles[static_cast<size_t>(index)] = handle;
+        } else {
+            index = static_cast<int>(m_handles.size());
+            m_handles.push_back(handle);
+        }
+
+        if (m_handles.size() <= m_handleCapacity) {
+            glNamedBufferSubData(m_handleBuffer, static_cast<GLintptr>(index * sizeof(GLuint64)), sizeof(GLuint64), &handle);
+            return index;
+        }
+        // Draws already submitted keep reading the old buffer until they complete
+        m_handleCapacity *= 2;
+        glDeleteBuffers(1, &m_handleBuffer);
+        glCreateBuffers(1, &m_handleBuffer);
+        glNamedBufferData(m_handleBuffer, static_cast<GLsizeiptr>(m_handleCapacity * sizeof(GLuint64)), nullptr, GL_DYNAMIC_DRAW);
+        glNamedBufferSubData(m_handleBuffer, 0, static_cast<GLsizeiptr>(m_handles.size() * sizeof(GLuint64)), m_handles.data());
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, NX_TEXTURE_TABLE_BINDING, m_handleBuffer);
+        return index;
+    }
+
+    int NxOpenGlTextureTable::registerInArray(const NxTexture2D &texture)
+    {
+        const auto width = static_cast<GLsizei>(texture.getWidth());
+        const auto height = static_cast<GLsizei>(texture.getHeight());
+        GLint internalFormat = 0;
+        glGetTextureLevelParameteriv(texture.getId(), 0, GL_TEXTURE_INTERNAL_FORMAT, &internalFormat);
+
+        auto it = std::ranges::find_if(m_arrays, [&](const TextureArray &array) {
+            return array.width == width && array.height == height && array.internalFormat == static_cast<GLenum>(internalFormat);
+        });
+        if (it == m_arrays.end()) {
+            if (m_arrays.size() >= NX_MAX_TEXTURE_ARRAYS) {
+                LOG(NEXO_WARN, "No texture array left for {}x{} textures, using the default texture", width, height);
+                return 0;
+            }
+            TextureArray array{0, width, height, static_cast<GLenum>(internalFormat), 0, 0, {}};
+            growArray(array, std::min(sInitialArrayLayers, m_maxArrayLayers));
+            m_arrays.push_back(std::move(array));
+            it = std::prev(m_arrays.end());
+        }
+        const auto arrayIndex = static_cast<int>(it - m_arrays.begin());
+        TextureArray &array = *it;
+
+        GLsizei layer = 0;
+        if (!array.freeLayers.empty()) {
+            layer = array.freeLayers.back();
+            array.freeLayers.pop_back();
+        } else {
+            if (array.layerCount == array.layerCapacity) {
+                if (array.layerCapacity >= m_maxArrayLayers) {
+                    LOG(NEXO_WARN, "Texture array of {}x{} textures is full, using the default texture", width, height);
+                    return 0;
+                }
+                growArray(array, std::min(array.layerCapacity * 2, m_maxArrayLayers));
+            }
+            layer = array.layerCount++;
+        }
+        glCopyImageSubData(texture.getId(), GL_TEXTURE_2D, 0, 0, 0, 0,
+                           array.id, GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, width, height, 1);
+        glBindTextureUnit(NX_TEXTURE_ARRAYS_FIRST_UNIT + static_cast<GLuint>(arrayIndex), array.id);
+        return arrayIndex << 16 | layer;
+    }
+
+    void NxOpenGlTextureTable::growArray(TextureArray &array, const GLsizei layerCapacity) const
+    {
+        GLuint id = 0;
+        glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &id);
+        glTextureStorage3D(id, 1, array.internalFormat, array.width, array.height, layerCapacity);
+        // Same sampling as NxOpenGlTexture2D
+        glTextureParameteri(id, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(id, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureParameteri(id, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(id, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        if (array.id) {
+            if (array.layerCount)
+                glCopyImageSubData(array.id, GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0,
+                                   id, GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, array.width, array.height, array.layerCount);
+            glDeleteTextures(1, &array.id);
+        }
+        array.id = id;
+        array.layerCapacity = layerCapacity;
+    }
+
+    void NxOpenGlTextureTable::release(const Entry &entry)
+    {
+        // Index 0 is the default texture, also handed out when a registration failed
+        if (!entry.index)
+            return;
+        if (m_bindless) {
+            // Handles of deleted textures are released with them
+            if (!entry.texture.expired())
+                sMakeTextureHandleNonResident(entry.handle);
+            m_freeIndices.push_back(entry.index);
+            return;
+        }
+        m_arrays[static_cast<size_t>(entry.index >> 16)].freeLayers.push_back(entry.index & 0xFFFF);
+    }
+}
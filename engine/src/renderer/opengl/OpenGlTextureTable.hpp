@@ -0,0 +1,97 @@
+//// OpenGlTextureTable ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the OpenGL material texture table
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "renderer/TextureTable.hpp"
+
+#include <glad/glad.h>
+#include <unordered_map>
+#include <vector>
+
+namespace nexo::renderer {
+
+    /**
+     * @class NxOpenGlTextureTable
+     * @brief OpenGL texture table, using `GL_ARB_bindless_texture` when available and texture arrays otherwise.
+     *
+     * OpenGL Operations:
+     * - `glGetTextureHandleARB` + `glMakeTextureHandleResidentARB`: Handles written to a storage buffer bound at
+     *   `NX_TEXTURE_TABLE_BINDING`.
+     * - `glTextureStorage3D` + `glCopyImageSubData`: Fallback arrays, one per size and internal format, bound
+     *   from `NX_TEXTURE_ARRAYS_FIRST_UNIT`.
+     */
+    class NxOpenGlTextureTable final : public NxTextureTable {
+        public:
+            explicit NxOpenGlTextureTable(const std::shared_ptr<NxTexture2D> &defaultTexture);
+            ~NxOpenGlTextureTable() override;
+
+            NxOpenGlTextureTable(const NxOpenGlTextureTable &) = delete;
+            NxOpenGlTextureTable &operator=(const NxOpenGlTextureTable &) = delete;
+
+            [[nodiscard]] int getIndex(const std::shared_ptr<NxTexture2D> &texture) override;
+            void bind() override;
+
+            [[nodiscard]] bool isBindless() const override { return m_bindless; }
+            [[nodiscard]] size_t getTextureCount() const override { return m_entries.size(); }
+
+            /**
+             * @brief Checks for `GL_ARB_bindless_texture` and loads its entry points, the result is cached.
+             *
+             * Shaders are compiled with `NX_BINDLESS_TEXTURES` defined when this returns true, so both
+             * always agree on the path in use. Requires a current context.
+             */
+            static bool isBindlessSupported();
+
+        private:
+            struct Entry {
+                std::weak_ptr<NxTexture2D> texture;
+                int index = 0;
+                GLuint64 handle = 0;
+            };
+
+            struct TextureArray {
+                GLuint id = 0;
+                GLsizei width = 0;
+                GLsizei height = 0;
+                GLenum internalFormat = 0;
+                GLsizei layerCount = 0;
+                GLsizei layerCapacity = 0;
+                std::vector<GLsizei> freeLayers;
+            };
+
+            int registerTexture(const std::shared_ptr<NxTexture2D> &texture);
+            int registerHandle(GLuint64 handle);
+            int registerInArray(const NxTexture2D &texture);
+            void growArray(TextureArray &array, GLsizei layerCapacity) const;
+            void release(const Entry &entry);
+
+            bool m_bindless = false;
+            // Keyed by texture id, entries are checked against the texture since ids are reused after deletion
+            std::unordered_map<unsigned int, Entry> m_entries;
+
+            std::vector<GLuint64> m_handles;
+            std::vector<int> m_freeIndices;
+            GLuint m_handleBuffer = 0;
+            size_t m_handleCapacity = 0;
+
+            std::vector<TextureArray> m_arrays;
+            GLsizei m_maxArrayLayers = 0;
+    };
+}
@@ -19,8 +19,11 @@
 #include "OpenGlVertexArray.hpp"
 #include "Logger.hpp"
 #include "renderer/RendererExceptions.hpp"
+#include "renderer/InstanceData.hpp"
+#include "renderer/RenderCommand.hpp"
 
 #include <glad/glad.h>
+#include <cstddef>
 
 namespace nexo::renderer {
 
@@ -74,19 +77,19 @@ namespace nexo::renderer {
 
     void NxOpenGlVertexArray::bind() const
     {
-        glBindVertexArray(_id);
+        NxRenderCommand::bindVertexArray(_id);
     }
 
     void NxOpenGlVertexArray::unbind() const
     {
-        glBindVertexArray(0);
+        NxRenderCommand::bindVertexArray(0);
     }
 
     void NxOpenGlVertexArray::addVertexBuffer(const std::shared_ptr<NxVertexBuffer> &vertexBuffer)
     {
         if (!vertexBuffer)
             THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Vertex buffer is null");
-        glBindVertexArray(_id);
+        NxRenderCommand::bindVertexArray(_id);
         vertexBuffer->bind();
 
         if (vertexBuffer->getLayout().getElements().empty())
@@ -128,12 +131,39 @@ namespace nexo::renderer {
     {
         if (!indexBuffer)
             THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Index buffer cannot be null");
-        glBindVertexArray(_id);
+        NxRenderCommand::bindVertexArray(_id);
         indexBuffer->bind();
 
         _indexBuffer = indexBuffer;
     }
 
+    void NxOpenGlVertexArray::setInstanceBuffer(const std::shared_ptr<NxVertexBuffer> &instanceBuffer)
+    {
+        if (!instanceBuffer)
+            THROW_EXCEPTION(NxInvalidValue, "OPENGL", "Instance buffer cannot be null");
+        if (_instanceBuffer == instanceBuffer)
+            return;
+        NxRenderCommand::bindVertexArray(_id);
+        instanceBuffer->bind();
+
+        constexpr auto stride = static_cast<int>(sizeof(NxInstanceData));
+        // One location per column of the model matrix
+        for (unsigned int column = 0; column < 4; ++column) {
+            const unsigned int location = NX_INSTANCE_ATTRIBUTE_LOCATION + column;
+            glEnableVertexAttribArray(location);
+            glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, stride,
+                reinterpret_cast<const void *>(offsetof(NxInstanceData, model) + column * sizeof(glm::vec4)));
+            glVertexAttribDivisor(location, 1);
+        }
+        constexpr unsigned int entityIdLocation = NX_INSTANCE_ATTRIBUTE_LOCATION + 4;
+        glEnableVertexAttribArray(entityIdLocation);
+        glVertexAttribIPointer(entityIdLocation, 1, GL_INT, stride,
+            reinterpret_cast<const void *>(offsetof(NxInstanceData, entityId)));
+        glVertexAttribDivisor(entityIdLocation, 1);
+
+        _instanceBuffer = instanceBuffer;
+    }
+
     const std::vector<std::shared_ptr<NxVertexBuffer>> &NxOpenGlVertexArray::getVertexBuffers() const
     {
         return _vertexBuffers;
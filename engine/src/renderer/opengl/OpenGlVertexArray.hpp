@@ -84,6 +84,16 @@ namespace nexo::renderer {
             */
             void setIndexBuffer(const std::shared_ptr<NxIndexBuffer> &indexBuffer) override;
 
+            /**
+            * @brief Attaches the instance buffer to the per-instance attribute locations.
+            *
+            * Configures the attributes starting at NX_INSTANCE_ATTRIBUTE_LOCATION with a divisor of 1.
+            *
+            * @param instanceBuffer The instance buffer to read from.
+            * @throw NxInvalidValue If the instance buffer is null.
+            */
+            void setInstanceBuffer(const std::shared_ptr<NxVertexBuffer> &instanceBuffer) override;
+
             [[nodiscard]] const std::vector<std::shared_ptr<NxVertexBuffer>> &getVertexBuffers() const override;
             [[nodiscard]] const std::shared_ptr<NxIndexBuffer> &getIndexBuffer() const override;
 
@@ -91,6 +101,7 @@ namespace nexo::renderer {
         private:
             std::vector<std::shared_ptr<NxVertexBuffer>> _vertexBuffers;
             std::shared_ptr<NxIndexBuffer> _indexBuffer;
+            std::shared_ptr<NxVertexBuffer> _instanceBuffer;
 
             unsigned int _id{};
     };
@@ -22,6 +22,7 @@
 
 #include "renderer/Renderer.hpp"
 #include "renderer/RendererExceptions.hpp"
+#include "renderer/RenderCommand.hpp"
 #include "Logger.hpp"
 
 #if defined(_WIN32) || defined(_WIN64)
@@ -102,15 +103,31 @@ namespace nexo::renderer {
         });
     }
 
+    void NxOpenGlWindow::createHeadlessWindow()
+    {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+        _openGlWindow = glfwCreateWindow(static_cast<int>(_props.width), static_cast<int>(_props.height), _props.title.c_str(), nullptr, nullptr);
+        if (_openGlWindow)
+            return;
+        LOG(NEXO_WARN, "No EGL offscreen context available, falling back to OSMesa");
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+        _openGlWindow = glfwCreateWindow(static_cast<int>(_props.width), static_cast<int>(_props.height), _props.title.c_str(), nullptr, nullptr);
+    }
+
     void NxOpenGlWindow::init()
     {
+        // The null platform needs no display server, its contexts come from EGL or OSMesa
+        glfwInitHint(GLFW_PLATFORM, _props.headless ? GLFW_PLATFORM_NULL : GLFW_ANY_PLATFORM);
         if (!glfwInit())
             THROW_EXCEPTION(NxGraphicsApiInitFailure, "OPENGL");
         LOG(NEXO_DEV, "Initializing opengl window");
         glfwSetErrorCallback(glfwErrorCallback);
 
 #ifdef __linux__
-        if (glfwGetPlatform() == GLFW_PLATFORM_WAYLAND) {
+        if (_props.headless) {
+            // No window manager to give hints to
+        } else if (glfwGetPlatform() == GLFW_PLATFORM_WAYLAND) {
             glfwWindowHintString(GLFW_WAYLAND_APP_ID, _waylandAppId.c_str());
         } else if (glfwGetPlatform() == GLFW_PLATFORM_X11) {
             glfwWindowHintString(GLFW_X11_CLASS_NAME, _x11ClassName.c_str());
@@ -126,15 +143,20 @@ namespace nexo::renderer {
         glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
         glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
-        _openGlWindow = glfwCreateWindow(static_cast<int>(_props.width), static_cast<int>(_props.height), _props.title.c_str(), nullptr, nullptr);
+        if (_props.headless)
+            createHeadlessWindow();
+        else
+            _openGlWindow = glfwCreateWindow(static_cast<int>(_props.width), static_cast<int>(_props.height), _props.title.c_str(), nullptr, nullptr);
         if (!_openGlWindow)
             THROW_EXCEPTION(NxGraphicsApiWindowInitFailure, "OPENGL");
         glfwMakeContextCurrent(_openGlWindow);
+        // Bindings cached by the render commands belong to the previous context
+        NxRenderCommand::invalidateState();
         glfwSetWindowUserPointer(_openGlWindow, &_props);
         setVsync(true);
         setDarkMode(false);
         setupCallback();
-        LOG(NEXO_DEV, "Opengl window ({}, {}) initialized", _props.width, _props.height);
+        LOG(NEXO_DEV, "Opengl {}window ({}, {}) initialized", _props.headless ? "headless " : "", _props.width, _props.height);
     }
 
     void NxOpenGlWindow::shutdown()
@@ -145,7 +167,8 @@ namespace nexo::renderer {
 
     void NxOpenGlWindow::onUpdate()
     {
-        glfwSwapBuffers(_openGlWindow);
+        if (!_props.headless)
+            glfwSwapBuffers(_openGlWindow);
         glfwPollEvents();
     }
 
@@ -59,7 +59,8 @@ namespace nexo::renderer {
             * callbacks for handling window events like resizing, closing, and input.
             *
             * @throw NxGraphicsApiInitFailure If GLFW initialization fails.
-            * @throw NxGraphicsApiWindowInitFailure If the window creation fails.
+            * @throw NxGraphicsApiWindowInitFailure If the window creation fails, or if no
+            *        offscreen context can be created in headless mode.
             */
             void init() override;
 
@@ -74,7 +75,8 @@ namespace nexo::renderer {
             /**
             * @brief Updates the window's state and processes events.
             *
-            * Swaps the front and back buffers for rendering and polls for window events.
+            * Swaps the front and back buffers for rendering and polls for window events,
+            * a headless window has nothing to present and only polls.
             */
             void onUpdate() override;
 
@@ -102,6 +104,18 @@ namespace nexo::renderer {
             void setVsync(bool enabled) override;
             [[nodiscard]] bool isVsync() const override;
 
+            /**
+            * @brief Requests an offscreen context instead of a window, must be called before `init()`.
+            *
+            * The headless window runs on the GLFW null platform with an EGL surfaceless context,
+            * falling back to OSMesa, so a software rasterizer like llvmpipe can render without a
+            * display server. It has no default framebuffer, everything renders to framebuffers.
+            *
+            * @param enabled True to create an offscreen context.
+            */
+            void setHeadless(const bool enabled) override { _props.headless = enabled; }
+            [[nodiscard]] bool isHeadless() const override { return _props.headless; }
+
 
             [[nodiscard]] bool isOpen() const override { return !glfwWindowShouldClose(_openGlWindow);};
             void close() override { glfwSetWindowShouldClose(_openGlWindow, GLFW_TRUE); };
@@ -130,5 +144,6 @@ namespace nexo::renderer {
             NxWindowProperty _props;
 
             void setupCallback() const;
+            void createHeadlessWindow();
     };
 }
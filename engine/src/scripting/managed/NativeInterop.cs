@@ -43,6 +43,27 @@ namespace Nexo
         public UInt32 PerspectiveCameraTarget;
         public UInt32 PhysicsBodyComponent;
     }
+
+    /// <summary>
+    /// Contiguous view over the native components of a type, in dense order.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public unsafe struct ComponentSpan
+    {
+        public void* Data;
+        public UInt32* Entities;
+        public UInt64 Count;
+        public UInt64 Stride;
+    }
+
+    /// <summary>
+    /// Memory layout of a scripted component in the native ECS.
+    /// </summary>
+    public enum ComponentLayout : UInt32
+    {
+        ArrayOfStructs = 0,
+        StructOfArrays = 1
+    }
     
     /// <summary>
     /// Provides interop functionality for calling native C++ functions from C# using function pointers.
@@ -107,10 +128,22 @@ namespace Nexo
             public delegate bool NxHasComponentDelegate(UInt32 entityId, UInt32 typeId);
             
             [UnmanagedFunctionPointer(CallingConvention.Winapi, CharSet = CharSet.Ansi)]
-            public delegate Int64 NxRegisterComponentDelegate(String name, UInt64 componentSize, Field *fields, UInt64 fieldCount);
+            public delegate Int64 NxRegisterComponentDelegate(String name, UInt64 componentSize, UInt64 componentAlignment, ComponentLayout layout, Field *fields, UInt64 fieldCount);
             
             [UnmanagedFunctionPointer(CallingConvention.Winapi, CharSet = CharSet.Ansi)]
             public delegate ComponentTypeIds NxGetComponentTypeIdsDelegate();
+            
+            [UnmanagedFunctionPointer(CallingConvention.Winapi, CharSet = CharSet.Ansi)]
+            public delegate Int32 NxAddComponentsDelegate(UInt32 *entities, UInt64 entityCount, UInt32 typeId, void *componentsData);
+            
+            [UnmanagedFunctionPointer(CallingConvention.Winapi, CharSet = CharSet.Ansi)]
+            public delegate Int32 NxRemoveComponentsDelegate(UInt32 *entities, UInt64 entityCount, UInt32 typeId);
+            
+            [UnmanagedFunctionPointer(CallingConvention.Winapi, CharSet = CharSet.Ansi)]
+            public delegate ComponentSpan NxGetComponentSpanDelegate(UInt32 typeId);
+            
+            [UnmanagedFunctionPointer(CallingConvention.Winapi, CharSet = CharSet.Ansi)]
+            public delegate ComponentSpan NxGetComponentFieldSpanDelegate(UInt32 typeId, UInt64 fieldIndex);
 
             // Function pointers
             public HelloFromNativeDelegate NxHelloFromNative;
@@ -132,6 +165,10 @@ namespace Nexo
             public NxHasComponentDelegate NxHasComponent;
             public NxRegisterComponentDelegate NxRegisterComponent;
             public NxGetComponentTypeIdsDelegate NxGetComponentTypeIds;
+            public NxAddComponentsDelegate NxAddComponents;
+            public NxRemoveComponentsDelegate NxRemoveComponents;
+            public NxGetComponentSpanDelegate NxGetComponentSpan;
+            public NxGetComponentFieldSpanDelegate NxGetComponentFieldSpan;
         }
 
         private static NativeApiCallbacks s_callbacks;
@@ -450,7 +487,81 @@ namespace Nexo
         }
 
         
-        public static unsafe Int64 RegisterComponent(Type componentType)
+        /// <summary>
+        /// Adds the same component type to several entities in a single native call.
+        /// </summary>
+        /// <param name="entityIds">The entities to add the component to</param>
+        /// <param name="components">One component per entity</param>
+        public static unsafe void AddComponents<T>(ReadOnlySpan<UInt32> entityIds, ReadOnlySpan<T> components) where T : unmanaged
+        {
+            if (!_typeToNativeIdMap.TryGetValue(typeof(T), out var typeId))
+                throw new InvalidOperationException($"Unsupported component type: {typeof(T)}");
+            if (entityIds.Length != components.Length)
+                throw new ArgumentException("There must be one component per entity");
+
+            fixed (UInt32* entities = entityIds)
+            fixed (T* data = components)
+            {
+                if (s_callbacks.NxAddComponents.Invoke(entities, (UInt64)entityIds.Length, typeId, data) < 0)
+                    throw new InvalidOperationException($"Failed to add {typeof(T)} to {entityIds.Length} entities, see the native log");
+            }
+        }
+
+        /// <summary>
+        /// Removes the same component type from several entities in a single native call.
+        /// </summary>
+        /// <param name="entityIds">The entities to remove the component from</param>
+        public static unsafe void RemoveComponents<T>(ReadOnlySpan<UInt32> entityIds) where T : unmanaged
+        {
+            if (!_typeToNativeIdMap.TryGetValue(typeof(T), out var typeId))
+                throw new InvalidOperationException($"Unsupported component type: {typeof(T)}");
+
+            fixed (UInt32* entities = entityIds)
+            {
+                if (s_callbacks.NxRemoveComponents.Invoke(entities, (UInt64)entityIds.Length, typeId) < 0)
+                    throw new InvalidOperationException($"Failed to remove {typeof(T)} from {entityIds.Length} entities, see the native log");
+            }
+        }
+
+        /// <summary>
+        /// Gets all the components of a type registered as an array of structs, as one contiguous block.
+        /// The span is invalidated by any structural change of the component type.
+        /// </summary>
+        /// <param name="entityIds">The entity owning each component</param>
+        public static unsafe Span<T> GetComponents<T>(out ReadOnlySpan<UInt32> entityIds) where T : unmanaged
+        {
+            if (!_typeToNativeIdMap.TryGetValue(typeof(T), out var typeId))
+                throw new InvalidOperationException($"Unsupported component type: {typeof(T)}");
+
+            var span = s_callbacks.NxGetComponentSpan.Invoke(typeId);
+            if (span.Count != 0 && span.Stride != (UInt64)sizeof(T))
+                throw new InvalidOperationException($"Component {typeof(T)} is stored with a stride of {span.Stride} bytes");
+
+            entityIds = new ReadOnlySpan<UInt32>(span.Entities, (Int32)span.Count);
+            return new Span<T>(span.Data, (Int32)span.Count);
+        }
+
+        /// <summary>
+        /// Gets one field of all the components of a type registered as a struct of arrays, as one contiguous block.
+        /// The span is invalidated by any structural change of the component type.
+        /// </summary>
+        /// <param name="fieldIndex">Index of the field in the registered field array</param>
+        /// <param name="entityIds">The entity owning each value</param>
+        public static unsafe Span<TField> GetComponentField<T, TField>(UInt64 fieldIndex, out ReadOnlySpan<UInt32> entityIds)
+            where T : unmanaged where TField : unmanaged
+        {
+            if (!_typeToNativeIdMap.TryGetValue(typeof(T), out var typeId))
+                throw new InvalidOperationException($"Unsupported component type: {typeof(T)}");
+
+            var span = s_callbacks.NxGetComponentFieldSpan.Invoke(typeId, fieldIndex);
+            if (span.Count != 0 && span.Stride != (UInt64)sizeof(TField))
+                throw new InvalidOperationException($"Field {fieldIndex} of {typeof(T)} is {span.Stride} bytes, not {sizeof(TField)}");
+
+            entityIds = new ReadOnlySpan<UInt32>(span.Entities, (Int32)span.Count);
+            return new Span<TField>(span.Data, (Int32)span.Count);
+        }
+
+        public static unsafe Int64 RegisterComponent(Type componentType, ComponentLayout layout = ComponentLayout.ArrayOfStructs)
         {
             var name = componentType.Name;
             FieldArray? fieldArray = null;
@@ -463,7 +574,7 @@ namespace Nexo
                 
                 fieldArray = FieldArray.CreateFieldArrayFromType(componentType);
 
-                var typeId = s_callbacks.NxRegisterComponent.Invoke(name, size, fieldArray.GetPointer(), (UInt64)fieldArray.Count);
+                var typeId = s_callbacks.NxRegisterComponent.Invoke(name, size, 0, layout, fieldArray.GetPointer(), (UInt64)fieldArray.Count);
                 if (typeId < 0)
                 {
                     Logger.Log(LogLevel.Error, $"Failed to register component {name}, returned: {typeId}");
@@ -16,6 +16,7 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <bit>
 #include <iostream>
 
 #include "NativeApi.hpp"
@@ -156,12 +157,17 @@ namespace nexo::scripting {
             return coordinator.entityHasComponent(entity, static_cast<ecs::ComponentType>(componentTypeId));
         }
 
-        Int64 NxRegisterComponent(const char *name, const UInt64 componentSize, const Field *fields, const UInt64 fieldCount)
+        Int64 NxRegisterComponent(const char *name, const UInt64 componentSize, const UInt64 componentAlignment,
+                                  const ComponentLayout layout, const Field *fields, const UInt64 fieldCount)
         {
             if (!name || !fields || fieldCount == 0 || componentSize == 0) {
                 LOG(NEXO_ERROR, "Invalid parameters for component registration");
                 return -1;
             }
+            if (componentAlignment != 0 && !std::has_single_bit(componentAlignment)) {
+                LOG(NEXO_ERROR, "Component {} alignment {} is not a power of two", name, componentAlignment);
+                return -1;
+            }
 
             auto& coordinator = *Application::m_coordinator;
 
@@ -173,8 +179,6 @@ namespace nexo::scripting {
                 LOG(NEXO_DEV, "Registering field {}: {} of type {}", i, static_cast<char*>(fields[i].name), static_cast<UInt64>(fields[i].type));
             }
 
-            const auto componentType = coordinator.registerComponent(componentSize);
-
             std::vector<ecs::Field> fieldVector;
             fieldVector.reserve(fieldCount);
             static_assert(sizeof(ecs::FieldType) == sizeof(FieldType), "FieldType enum size mismatch");
@@ -188,6 +192,10 @@ namespace nexo::scripting {
                 });
             }
 
+            const auto componentType = layout == ComponentLayout::StructOfArrays
+                ? coordinator.registerComponent(componentSize, fieldVector, 1024, componentAlignment)
+                : coordinator.registerComponent(componentSize, 1024, componentAlignment);
+
             coordinator.addComponentDescription(
                 componentType,
                 ecs::ComponentDescription {
@@ -199,6 +207,101 @@ namespace nexo::scripting {
             return componentType;
         }
 
+        Int32 NxAddComponents(const ecs::Entity *entities, const UInt64 entityCount, const UInt32 componentTypeId, const void *componentsData)
+        {
+            if (componentTypeId > ecs::MAX_COMPONENT_TYPE) {
+                LOG(NEXO_ERROR, "NxAddComponents: Maximum component type ID exceeded");
+                return -1;
+            }
+            if (entityCount == 0)
+                return 0;
+            if (entities == nullptr || componentsData == nullptr) {
+                LOG(NEXO_ERROR, "NxAddComponents: entities or componentsData is null");
+                return -1;
+            }
+            // Exceptions must not reach the managed side
+            try {
+                const auto& coordinator = *Application::m_coordinator;
+                coordinator.addComponents({entities, entityCount}, static_cast<ecs::ComponentType>(componentTypeId), componentsData);
+            } catch (const std::exception &e) {
+                LOG(NEXO_ERROR, "NxAddComponents: {}", e.what());
+                return -1;
+            }
+            return 0;
+        }
+
+        Int32 NxRemoveComponents(const ecs::Entity *entities, const UInt64 entityCount, const UInt32 componentTypeId)
+        {
+            if (componentTypeId > ecs::MAX_COMPONENT_TYPE) {
+                LOG(NEXO_ERROR, "NxRemoveComponents: Maximum component type ID exceeded");
+                return -1;
+            }
+            if (entityCount == 0)
+                return 0;
+            if (entities == nullptr) {
+                LOG(NEXO_ERROR, "NxRemoveComponents: entities is null");
+                return -1;
+            }
+            // The coordinator validates the whole batch before removing anything, exceptions must not reach the managed side
+            try {
+                const auto& coordinator = *Application::m_coordinator;
+                coordinator.removeComponents({entities, entityCount}, static_cast<ecs::ComponentType>(componentTypeId));
+            } catch (const std::exception &e) {
+                LOG(NEXO_ERROR, "NxRemoveComponents: {}", e.what());
+                return -1;
+            }
+            return 0;
+        }
+
+        ComponentSpan NxGetComponentSpan(const UInt32 componentTypeId)
+        {
+            if (componentTypeId > ecs::MAX_COMPONENT_TYPE) {
+                LOG(NEXO_ERROR, "NxGetComponentSpan: Maximum component type ID exceeded");
+                return {};
+            }
+            const auto& coordinator = *Application::m_coordinator;
+            const auto componentArray = coordinator.getTypeErasedComponentArray(static_cast<ecs::ComponentType>(componentTypeId));
+            if (!componentArray || componentArray->getLayout() != ecs::ComponentLayout::ArrayOfStructs) {
+                LOG(NEXO_ERROR, "NxGetComponentSpan: component type {} is not a scripted array of structs component", componentTypeId);
+                return {};
+            }
+            const auto data = componentArray->getRawRange(0, componentArray->size());
+            return ComponentSpan {
+                .data = data.data(),
+                .entities = componentArray->entities().data(),
+                .count = componentArray->size(),
+                .stride = componentArray->getStride(),
+            };
+        }
+
+        ComponentSpan NxGetComponentFieldSpan(const UInt32 componentTypeId, const UInt64 fieldIndex)
+        {
+            if (componentTypeId > ecs::MAX_COMPONENT_TYPE) {
+                LOG(NEXO_ERROR, "NxGetComponentFieldSpan: Maximum component type ID exceeded");
+                return {};
+            }
+            const auto& coordinator = *Application::m_coordinator;
+            const auto componentArray = coordinator.getTypeErasedComponentArray(static_cast<ecs::ComponentType>(componentTypeId));
+            if (!componentArray || componentArray->getLayout() != ecs::ComponentLayout::StructOfArrays) {
+                LOG(NEXO_ERROR, "NxGetComponentFieldSpan: component type {} is not a scripted struct of arrays component", componentTypeId);
+                return {};
+            }
+            const auto& descriptions = coordinator.getComponentDescriptions();
+            const auto it = descriptions.find(static_cast<ecs::ComponentType>(componentTypeId));
+            const auto description = it != descriptions.end() ? it->second : nullptr;
+            if (!description || fieldIndex >= description->fields.size()) {
+                LOG(NEXO_ERROR, "NxGetComponentFieldSpan: field {} out of range for component type {}", fieldIndex, componentTypeId);
+                return {};
+            }
+            const auto column = componentArray->getFieldData(fieldIndex);
+            return ComponentSpan {
+                .data = column.data(),
+                .entities = componentArray->entities().data(),
+                .count = column.empty() ? 0 : componentArray->size(),
+                .stride = description->fields[fieldIndex].size,
+            };
+        }
+
         ComponentTypeIds NxGetComponentTypeIds()
         {
             const auto& coordinator = *Application::m_coordinator;
@@ -85,6 +85,26 @@ namespace nexo::scripting {
             UInt32 PhysicsBodyComponent;
         };
 
+        /**
+         * @brief Contiguous view over the components of a type, in dense order
+         *
+         * The i-th element starts at data + i * stride and belongs to entities[i].
+         */
+        struct ComponentSpan {
+            void *data;
+            const ecs::Entity *entities;
+            UInt64 count;
+            UInt64 stride;
+        };
+
+        /**
+         * @brief Memory layout requested when registering a scripted component
+         */
+        enum class ComponentLayout : UInt32 {
+            ArrayOfStructs = 0,
+            StructOfArrays = 1,
+        };
+
         NEXO_RET(void) NxHelloFromNative(void);
         NEXO_RET(Int32) NxAddNumbers(Int32 a, Int32 b);
         NEXO_RET(const char*) NxGetNativeMessage(void);
@@ -97,7 +117,11 @@ namespace nexo::scripting {
         NEXO_RET(void) NxRemoveComponent(ecs::Entity entity, UInt32 componentTypeId);
         NEXO_RET(void) NxDestroyEntity(ecs::Entity entity);
         NEXO_RET(bool) NxHasComponent(ecs::Entity entity, UInt32 componentTypeId);
-        NEXO_RET(Int64) NxRegisterComponent(const char *name, UInt64 componentSize, const Field *fields, UInt64 fieldCount);
+        NEXO_RET(Int64) NxRegisterComponent(const char *name, UInt64 componentSize, UInt64 componentAlignment, ComponentLayout layout, const Field *fields, UInt64 fieldCount);
+        NEXO_RET(Int32) NxAddComponents(const ecs::Entity *entities, UInt64 entityCount, UInt32 componentTypeId, const void *componentsData);
+        NEXO_RET(Int32) NxRemoveComponents(const ecs::Entity *entities, UInt64 entityCount, UInt32 componentTypeId);
+        NEXO_RET(ComponentSpan) NxGetComponentSpan(UInt32 componentTypeId);
+        NEXO_RET(ComponentSpan) NxGetComponentFieldSpan(UInt32 componentTypeId, UInt64 fieldIndex);
         NEXO_RET(ComponentTypeIds) NxGetComponentTypeIds();
 
         NEXO_RET(ecs::Entity) NxCreateTetrahedron(Vector3 position, Vector3 size, Vector3 rotation, Vector4 color);
@@ -133,8 +157,12 @@ namespace nexo::scripting {
         ApiCallback<void(ecs::Entity, UInt32)> NxRemoveComponent{&scripting::NxRemoveComponent};
         ApiCallback<void(ecs::Entity)> NxDestroyEntity{&scripting::NxDestroyEntity};
         ApiCallback<bool(ecs::Entity, UInt32)> NxHasComponent{&scripting::NxHasComponent};
-        ApiCallback<Int64(const char*, UInt64, const Field *, UInt64)> NxRegisterComponent{&scripting::NxRegisterComponent};
+        ApiCallback<Int64(const char*, UInt64, UInt64, ComponentLayout, const Field *, UInt64)> NxRegisterComponent{&scripting::NxRegisterComponent};
         ApiCallback<ComponentTypeIds()> NxGetComponentTypeIds{&scripting::NxGetComponentTypeIds};
+        ApiCallback<Int32(const ecs::Entity *, UInt64, UInt32, const void *)> NxAddComponents{&scripting::NxAddComponents};
+        ApiCallback<Int32(const ecs::Entity *, UInt64, UInt32)> NxRemoveComponents{&scripting::NxRemoveComponents};
+        ApiCallback<ComponentSpan(UInt32)> NxGetComponentSpan{&scripting::NxGetComponentSpan};
+        ApiCallback<ComponentSpan(UInt32, UInt64)> NxGetComponentFieldSpan{&scripting::NxGetComponentFieldSpan};
     };
 
     inline NativeApiCallbacks nativeApiCallbacks;
@@ -37,7 +37,7 @@ namespace nexo::system {
 	* then pushed into the RenderContext (a singleton component).
 	*
 	* @note Component Access Rights:
-	*  - READ access to components::CameraComponent (owned)
+	*  - WRITE access to components::CameraComponent (owned), the render context refers to its pipeline
 	*  - READ access to components::SceneTag (non-owned)
 	*  - READ access to components::TransformComponent (non-owned)
 	*  - WRITE access to components::RenderContext (singleton)
@@ -47,7 +47,7 @@ namespace nexo::system {
 	*/
 	class CameraContextSystem final : public ecs::GroupSystem<
 		ecs::Owned<
-			ecs::Read<components::CameraComponent>>,
+			ecs::Write<components::CameraComponent>>,
         ecs::NonOwned<
         	ecs::Read<components::SceneTag>,
          	ecs::Read<components::TransformComponent>>,
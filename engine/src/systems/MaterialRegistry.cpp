@@ -0,0 +1,147 @@
+//// MaterialRegistry //////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the registry of the materials uploaded to the GPU
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "MaterialRegistry.hpp"
+#include "renderer/Renderer3D.hpp"
+#include "renderer/ShaderLibrary.hpp"
+
+#include <ranges>
+#include <unordered_map>
+
+namespace nexo::system {
+
+	struct MaterialEntry {
+		std::weak_ptr<assets::Material> material;
+		uint32_t index = 0;
+	};
+
+	struct MaterialRegistry {
+		std::shared_ptr<renderer::NxMaterialTable> table;
+		std::unordered_map<const assets::Material *, MaterialEntry> entries;
+	};
+
+	static MaterialRegistry sRegistry;
+
+	// Values the draws used before their material is loaded
+	static renderer::NxIndexedMaterial fallbackMaterial()
+	{
+		renderer::NxIndexedMaterial material;
+		material.albedoColor = glm::vec4(0.0f);
+		material.specularColor = glm::vec4(0.0f);
+		material.roughness = 1.0f;
+		return material;
+	}
+
+	static int textureIndex(const assets::AssetRef<assets::Texture> &textureRef)
+	{
+		const auto textureAsset = textureRef.lock();
+		return textureAsset && textureAsset->isLoaded() ?
+			renderer::NxRenderer3D::get().getTextureIndex(textureAsset->getData()->texture) : 0;
+	}
+
+	static renderer::NxIndexedMaterial packMaterial(const components::Material &material)
+	{
+		renderer::NxIndexedMaterial packed;
+		packed.albedoColor = material.albedoColor;
+		packed.albedoTexIndex = textureIndex(material.albedoTexture);
+		packed.specularColor = material.specularColor;
+		packed.specularTexIndex = textureIndex(material.metallicMap);
+		packed.emissiveColor = material.emissiveColor;
+		packed.emissiveTexIndex = textureIndex(material.emissiveMap);
+		packed.roughness = material.roughness;
+		packed.roughnessTexIndex = textureIndex(material.roughnessMap);
+		packed.metallic = material.metallic;
+		packed.metallicTexIndex = packed.specularTexIndex;
+		packed.opacity = material.opacity;
+		return packed;
+	}
+
+	// The table is recreated with the renderer, the entries of the previous one are dropped
+	static void syncTable()
+	{
+		const auto table = renderer::NxRenderer3D::get().getMaterialTable();
+		if (table == sRegistry.table)
+			return;
+		sRegistry.entries.clear();
+		sRegistry.table = table;
+		const uint32_t fallback = table->allocate();
+		table->set(fallback, fallbackMaterial());
+	}
+
+	uint32_t getMaterialIndex(const std::shared_ptr<assets::Material> &material)
+	{
+		if (!material || !material->isLoaded())
+			return 0;
+		if (!sRegistry.table)
+			syncTable();
+
+		if (const auto it = sRegistry.entries.find(material.get()); it != sRegistry.entries.end()) {
+			const auto &registered = it->second.material;
+			if (!registered.owner_before(material) && !material.owner_before(registered))
+				return it->second.index;
+			// A new material was allocated where a destroyed one lived
+			sRegistry.table->release(it->second.index);
+			sRegistry.entries.erase(it);
+		}
+		const uint32_t index = sRegistry.table->allocate();
+		sRegistry.table->set(index, packMaterial(*material->getData()));
+		sRegistry.entries.emplace(material.get(), MaterialEntry{material, index});
+		return index;
+	}
+
+	renderer::NxShaderHandle getShaderHandle(const std::shared_ptr<assets::Material> &material)
+	{
+		if (!material || !material->isLoaded())
+			return {};
+		auto &data = *material->getData();
+		if (!data.shaderHandle.isValid())
+			data.shaderHandle = renderer::ShaderLibrary::getInstance().resolve(data.shader);
+		return data.shaderHandle;
+	}
+
+	void refreshMaterials()
+	{
+		syncTable();
+		std::erase_if(sRegistry.entries, [](const auto &item) {
+			const auto material = item.second.material.lock();
+			if (!material) {
+				sRegistry.table->release(item.second.index);
+				return true;
+			}
+			if (material->isLoaded())
+				sRegistry.table->set(item.second.index, packMaterial(*material->getData()));
+			return false;
+		});
+	}
+
+	void forEachMaterial(const std::function<void(const std::shared_ptr<assets::Material> &, uint32_t)> &function)
+	{
+		for (const auto &entry : sRegistry.entries | std::views::values) {
+			if (const auto material = entry.material.lock())
+				function(material, entry.index);
+		}
+	}
+
+	void uploadMaterials()
+	{
+		syncTable();
+		sRegistry.table->upload();
+	}
+}
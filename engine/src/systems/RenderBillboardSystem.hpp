@@ -38,6 +38,7 @@ namespace nexo::system {
                    void update();
 
 			private:
-			    static void setupLights(renderer::DrawCommand &cmd, const components::LightContext& lightContext);
+				/// Scene whose "nothing to render" warning was last logged, -1 if none
+				int m_emptyScene = -1;
 	};
 }
@@ -19,6 +19,9 @@
 #include "RenderCommandSystem.hpp"
 #include "Renderer3D.hpp"
 #include "renderer/DrawCommand.hpp"
+#include "RenderUniforms.hpp"
+#include "lights/SceneLightsUpload.hpp"
+#include "MaterialRegistry.hpp"
 #include "components/Editor.hpp"
 #include "components/Light.hpp"
 #include "components/Render3D.hpp"
@@ -28,91 +31,41 @@
 #include "components/StaticMesh.hpp"
 #include "components/Transform.hpp"
 #include "core/event/Input.hpp"
+#include "math/Frustum.hpp"
 #include "math/Projection.hpp"
 #include "math/Vector.hpp"
 #include "renderPasses/Masks.hpp"
 #include "Application.hpp"
 #include "renderer/ShaderLibrary.hpp"
+#include "WorkerPool.hpp"
 
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include <utility>
 #include <glm/gtc/type_ptr.hpp>
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/quaternion.hpp>
 
 namespace nexo::system {
 
-    /**
-    * @brief Sets up the lighting uniforms in the given shader.
-    *
-    * This static helper function binds the provided shader and sets uniforms for ambient, directional,
-    * point, and spot lights based on the current lightContext data. After updating the uniforms, the shader is unbound.
-    *
-    * @param shader Shared pointer to the shader used for rendering.
-    * @param lightContext The light context containing lighting information for the scene.
-    *
-    * @note The light context must contain valid values for:
-    *  - ambientLight
-    *  - directionalLights (and directionalLightCount)
-    *  - pointLights (and pointLightCount)
-    *  - spotLights (and spotLightCount)
-    */
-    void RenderCommandSystem::setupLights(renderer::DrawCommand &cmd, const components::LightContext& lightContext)
-    {
-        cmd.uniforms["uAmbientLight"] = lightContext.ambientLight;
-
-        cmd.uniforms["uNumPointLights"] = static_cast<int>(lightContext.pointLightCount);
-        cmd.uniforms["uNumSpotLights"] = static_cast<int>(lightContext.spotLightCount);
-
-        const auto &directionalLight = lightContext.dirLight;
-        cmd.uniforms["uDirLight.direction"] = directionalLight.direction;
-        cmd.uniforms["uDirLight.color"] = glm::vec4(directionalLight.color, 1.0f);
-
-        const auto &pointLightComponentArray = coord->getComponentArray<components::PointLightComponent>();
-        const auto &transformComponentArray = coord->getComponentArray<components::TransformComponent>();
-        for (unsigned int i = 0; i < lightContext.pointLightCount; ++i)
-        {
-            const auto &pointLight = pointLightComponentArray->get(lightContext.pointLights[i]);
-            const auto &transform = transformComponentArray->get(lightContext.pointLights[i]);
-            cmd.uniforms[std::format("uPointLights[{}].position", i)] = transform.pos;
-            cmd.uniforms[std::format("uPointLights[{}].color", i)] = glm::vec4(pointLight.color, 1.0f);
-            cmd.uniforms[std::format("uPointLights[{}].constant", i)] = pointLight.constant;
-            cmd.uniforms[std::format("uPointLights[{}].linear", i)] = pointLight.linear;
-            cmd.uniforms[std::format("uPointLights[{}].quadratic", i)] = pointLight.quadratic;
-        }
-
-        const auto &spotLightComponentArray = coord->getComponentArray<components::SpotLightComponent>();
-        for (unsigned int i = 0; i < lightContext.spotLightCount; ++i)
-        {
-            const auto &spotLight = spotLightComponentArray->get(lightContext.spotLights[i]);
-            const auto &transform = transformComponentArray->get(lightContext.spotLights[i]);
-            cmd.uniforms[std::format("uSpotLights[{}].position", i)] = transform.pos;
-            cmd.uniforms[std::format("uSpotLights[{}].color", i)] = glm::vec4(spotLight.color, 1.0f);
-            cmd.uniforms[std::format("uSpotLights[{}].constant", i)] = spotLight.constant;
-            cmd.uniforms[std::format("uSpotLights[{}].linear", i)] = spotLight.linear;
-            cmd.uniforms[std::format("uSpotLights[{}].quadratic", i)] = spotLight.quadratic;
-            cmd.uniforms[std::format("uSpotLights[{}].direction", i)] = spotLight.direction;
-            cmd.uniforms[std::format("uSpotLights[{}].cutOff", i)] = spotLight.cutOff;
-            cmd.uniforms[std::format("uSpotLights[{}].outerCutoff", i)] = spotLight.outerCutoff;
-        }
-    }
-
     static renderer::DrawCommand createOutlineDrawCommand(const components::CameraContext &camera)
     {
         renderer::DrawCommand cmd;
         cmd.type = renderer::CommandType::FULL_SCREEN;
         cmd.filterMask = 0;
         cmd.filterMask |= renderer::F_OUTLINE_PASS;
-        cmd.shader = renderer::ShaderLibrary::getInstance().get("Outline pulse flat");
-
-        cmd.uniforms["uViewProjection"] = camera.viewProjectionMatrix;
-        cmd.uniforms["uCamPos"] = camera.cameraPosition;
-
-        cmd.uniforms["uMaskTexture"] = 0;
-        cmd.uniforms["uDepthTexture"] = 1;
-        cmd.uniforms["uDepthMaskTexture"] = 2;
-        cmd.uniforms["uTime"] = static_cast<float>(glfwGetTime());
+        auto &shaderLibrary = renderer::ShaderLibrary::getInstance();
+        static const renderer::NxShaderHandle outlinePulse = shaderLibrary.resolve("Outline pulse flat");
+        cmd.shader = shaderLibrary.get(outlinePulse);
+
+        cmd.uniforms.set(uniforms::maskTexture, 0);
+        cmd.uniforms.set(uniforms::depthTexture, 1);
+        cmd.uniforms.set(uniforms::depthMaskTexture, 2);
+        cmd.uniforms.set(uniforms::time, static_cast<float>(glfwGetTime()));
         const glm::vec2 screenSize = {camera.renderTarget->getSize().x, camera.renderTarget->getSize().y};
-        cmd.uniforms["uScreenSize"] = screenSize;
-        cmd.uniforms["uOutlineWidth"] = 10.0f;
+        cmd.uniforms.set(uniforms::screenSize, screenSize);
+        cmd.uniforms.set(uniforms::outlineWidth, 10.0f);
         return cmd;
     }
 
@@ -122,19 +75,18 @@ namespace nexo::system {
         cmd.type = renderer::CommandType::FULL_SCREEN;
         cmd.filterMask = 0;
         cmd.filterMask |= renderer::F_GRID_PASS;
-        cmd.shader = renderer::ShaderLibrary::getInstance().get("Grid shader");
-
-        cmd.uniforms["uViewProjection"] = camera.viewProjectionMatrix;
-        cmd.uniforms["uCamPos"] = camera.cameraPosition;
+        auto &shaderLibrary = renderer::ShaderLibrary::getInstance();
+        static const renderer::NxShaderHandle grid = shaderLibrary.resolve("Grid shader");
+        cmd.shader = shaderLibrary.get(grid);
 
         const components::RenderContext::GridParams &gridParams = renderContext.gridParams;
-        cmd.uniforms["uGridSize"] = gridParams.gridSize;
-        cmd.uniforms["uGridCellSize"] = gridParams.cellSize;
-        cmd.uniforms["uGridMinPixelsBetweenCells"] = gridParams.minPixelsBetweenCells;
+        cmd.uniforms.set(uniforms::gridSize, gridParams.gridSize);
+        cmd.uniforms.set(uniforms::gridCellSize, gridParams.cellSize);
+        cmd.uniforms.set(uniforms::gridMinPixelsBetweenCells, gridParams.minPixelsBetweenCells);
         constexpr glm::vec4 gridColorThin = {0.5f, 0.55f, 0.7f, 0.6f};
         constexpr glm::vec4 gridColorThick = {0.7f, 0.75f, 0.9f, 0.8f};
-        cmd.uniforms["uGridColorThin"] = gridColorThin;
-        cmd.uniforms["uGridColorThick"] = gridColorThick;
+        cmd.uniforms.set(uniforms::gridColorThin, gridColorThin);
+        cmd.uniforms.set(uniforms::gridColorThick, gridColorThick);
 
 
         const glm::vec2 globalMousePos = event::getMousePosition();
@@ -198,29 +150,47 @@ namespace nexo::system {
             }
         }
 
-        cmd.uniforms["uMouseWorldPos"] = mouseWorldPos;
-        cmd.uniforms["uTime"] = static_cast<float>(glfwGetTime());
+        cmd.uniforms.set(uniforms::mouseWorldPos, mouseWorldPos);
+        cmd.uniforms.set(uniforms::time, static_cast<float>(glfwGetTime()));
         return cmd;
     }
 
+    // Marks entities without bounds or without a command in the per partition culling arrays
+    static constexpr uint32_t noIndex = std::numeric_limits<uint32_t>::max();
+
+    // Arena meshes are looked up every frame since their range moves when the arena is compacted or grown
+    static void setMeshGeometry(renderer::DrawCommand &cmd, const components::StaticMeshComponent &mesh)
+    {
+        if (mesh.arenaMesh) {
+            cmd.vao = mesh.arenaMesh->getVertexArray();
+            cmd.meshRange = mesh.arenaMesh->getRange();
+        } else
+            cmd.vao = mesh.vao;
+    }
+
     static renderer::DrawCommand createSelectedDrawCommand(
         const components::StaticMeshComponent &mesh,
         const std::shared_ptr<assets::Material> &materialAsset,
         const components::TransformComponent &transform)
     {
         renderer::DrawCommand cmd;
-        cmd.vao = mesh.vao;
+        const uint32_t materialIndex = getMaterialIndex(materialAsset);
+        setMeshGeometry(cmd, mesh);
         const bool isOpaque = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->isOpaque : true;
+        auto &shaderLibrary = renderer::ShaderLibrary::getInstance();
+        // Resolved once, the library outlives the systems
+        static const renderer::NxShaderHandle flatColor = shaderLibrary.resolve("Flat color");
+        static const renderer::NxShaderHandle albedoUnshaded = shaderLibrary.resolve("Albedo unshaded transparent");
         if (isOpaque)
-            cmd.shader = renderer::ShaderLibrary::getInstance().get("Flat color");
+            cmd.shader = shaderLibrary.get(flatColor);
         else {
-            cmd.shader = renderer::ShaderLibrary::getInstance().get("Albedo unshaded transparent");
-            cmd.uniforms["uMaterial.albedoColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoColor : glm::vec4(0.0f);
-            const auto albedoTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoTexture.lock() : nullptr;
-            const auto albedoTexture = albedoTextureAsset && albedoTextureAsset->isLoaded() ? albedoTextureAsset->getData()->texture : nullptr;
-            cmd.uniforms["uMaterial.albedoTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(albedoTexture);
+            cmd.shader = shaderLibrary.get(albedoUnshaded);
+            cmd.uniforms.set(uniforms::materialIndex, static_cast<int>(materialIndex));
         }
-        cmd.uniforms["uMatModel"] = transform.worldMatrix;
+        cmd.uniforms.set(uniforms::matModel, transform.worldMatrix);
+        cmd.isOpaque = isOpaque;
+        cmd.materialKey = materialIndex;
+        cmd.sortPosition = glm::vec3(transform.worldMatrix[3]);
         cmd.filterMask = 0;
         cmd.filterMask = renderer::F_OUTLINE_MASK;
         return cmd;
@@ -228,42 +198,110 @@ namespace nexo::system {
 
     static renderer::DrawCommand createDrawCommand(
         const ecs::Entity entity,
-        const std::shared_ptr<renderer::NxShader> &shader,
+        const ResolvedMaterial &material,
         const components::StaticMeshComponent &mesh,
-        const std::shared_ptr<assets::Material> &materialAsset,
         const components::TransformComponent &transform)
     {
         renderer::DrawCommand cmd;
-        cmd.vao = mesh.vao;
-        cmd.shader = shader;
-        cmd.uniforms["uMatModel"] = transform.worldMatrix;
-        cmd.uniforms["uEntityId"] = static_cast<int>(entity);
-
-        cmd.uniforms["uMaterial.albedoColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoColor : glm::vec4(0.0f);
-        const auto albedoTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->albedoTexture.lock() : nullptr;
-        const auto albedoTexture = albedoTextureAsset && albedoTextureAsset->isLoaded() ? albedoTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.albedoTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(albedoTexture);
-
-        cmd.uniforms["uMaterial.specularColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->specularColor : glm::vec4(0.0f);
-        const auto specularTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->metallicMap.lock() : nullptr;
-        const auto specularTexture = specularTextureAsset && specularTextureAsset->isLoaded() ? specularTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.specularTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(specularTexture);
-
-        cmd.uniforms["uMaterial.emissiveColor"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->emissiveColor : glm::vec3(0.0f);
-        const auto emissiveTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->emissiveMap.lock() : nullptr;
-        const auto emissiveTexture = emissiveTextureAsset && emissiveTextureAsset->isLoaded() ? emissiveTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.emissiveTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(emissiveTexture);
-
-        cmd.uniforms["uMaterial.roughness"] = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->roughness : 1.0f;
-        const auto roughnessTextureAsset = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->roughnessMap.lock() : nullptr;
-        const auto roughnessTexture = roughnessTextureAsset && roughnessTextureAsset->isLoaded() ? roughnessTextureAsset->getData()->texture : nullptr;
-        cmd.uniforms["uMaterial.roughnessTexIndex"] = renderer::NxRenderer3D::get().getTextureIndex(roughnessTexture);
+        setMeshGeometry(cmd, mesh);
+        // Entities sharing mesh and material end up in the same instanced draw
+        if (material.instancedShader) {
+            cmd.shader = material.instancedShader;
+            cmd.isInstanced = true;
+            cmd.instance = {transform.worldMatrix, static_cast<int32_t>(entity)};
+        } else {
+            cmd.shader = material.shader;
+            cmd.uniforms.set(uniforms::matModel, transform.worldMatrix);
+            cmd.uniforms.set(uniforms::entityId, static_cast<int>(entity));
+        }
 
+        cmd.uniforms.set(uniforms::materialIndex, static_cast<int>(material.index));
+
+        cmd.isOpaque = material.isOpaque;
+        cmd.materialKey = material.index;
+        cmd.sortPosition = glm::vec3(transform.worldMatrix[3]);
         cmd.filterMask = 0;
         cmd.filterMask |= renderer::F_FORWARD_PASS;
         return cmd;
     }
 
+	RenderCommandSystem::RenderCommandSystem()
+	{
+		m_selectedQuery = coord->registerCachedQuery<
+			components::SelectedTag,
+			components::TransformComponent,
+			components::StaticMeshComponent,
+			components::MaterialComponent,
+			components::SceneTag,
+			ecs::Exclude<components::CameraComponent>>();
+	}
+
+	void RenderCommandSystem::cullPartition(const components::RenderContext &renderContext, const ecs::Partition<unsigned int> &partition)
+	{
+		const auto transformSpan = get<components::TransformComponent>();
+		const auto meshSpan = get<components::StaticMeshComponent>();
+
+		// World bounds are computed once and tested against every camera
+		m_worldBounds.clear();
+		m_boundsIndices.assign(partition.count, noIndex);
+		m_visibleInAnyCamera.assign(partition.count, 1);
+		for (size_t i = partition.startIndex; i < partition.startIndex + partition.count; ++i) {
+		    const auto &localBounds = meshSpan[i].localBounds;
+		    if (!localBounds)
+		        continue;
+		    m_boundsIndices[i - partition.startIndex] = static_cast<uint32_t>(m_worldBounds.size());
+		    m_visibleInAnyCamera[i - partition.startIndex] = 0;
+		    m_worldBounds.push_back(math::transformAabb(*localBounds, transformSpan[i].worldMatrix));
+		}
+
+		const size_t unboundedCount = partition.count - m_worldBounds.size();
+		unsigned int visibleCount = 0;
+		unsigned int culledCount = 0;
+		m_cameraVisibility.resize(renderContext.cameras.size());
+		for (size_t cameraIndex = 0; cameraIndex < renderContext.cameras.size(); ++cameraIndex) {
+		    auto &visible = m_cameraVisibility[cameraIndex];
+		    visible.resize(m_worldBounds.size());
+		    const math::Frustum frustum = math::extractFrustum(renderContext.cameras[cameraIndex].viewProjectionMatrix);
+		    const size_t cameraVisibleCount = math::cullAabbs(frustum, m_worldBounds, visible);
+		    visibleCount += static_cast<unsigned int>(cameraVisibleCount + unboundedCount);
+		    culledCount += static_cast<unsigned int>(m_worldBounds.size() - cameraVisibleCount);
+		}
+		for (size_t local = 0; local < partition.count; ++local) {
+		    const uint32_t boundsIndex = m_boundsIndices[local];
+		    if (boundsIndex == noIndex)
+		        continue;
+		    for (const auto &visible : m_cameraVisibility)
+		        m_visibleInAnyCamera[local] |= visible[boundsIndex];
+		}
+		renderer::NxRenderer3D::get().setCullingStats(visibleCount, culledCount);
+	}
+
+	const ResolvedMaterial &RenderCommandSystem::resolveMaterial(
+		const std::shared_ptr<assets::Material> &material, const uint32_t index)
+	{
+		auto &shaderLibrary = renderer::ShaderLibrary::getInstance();
+		const renderer::NxShaderHandle shaderHandle = getShaderHandle(material);
+		ResolvedMaterial resolved;
+		resolved.material = material;
+		resolved.index = index;
+		resolved.isOpaque = material->getData()->isOpaque;
+		resolved.shader = shaderLibrary.get(shaderHandle);
+		if (resolved.shader)
+			resolved.instancedShader = shaderLibrary.get(shaderLibrary.withKeyword(shaderHandle, "NX_INSTANCED"));
+		return m_resolvedMaterials.insert_or_assign(material.get(), std::move(resolved)).first->second;
+	}
+
+	const ResolvedMaterial *RenderCommandSystem::findResolvedMaterial(
+		const std::shared_ptr<assets::Material> &material) const
+	{
+		const auto it = m_resolvedMaterials.find(material.get());
+		if (it == m_resolvedMaterials.end())
+			return nullptr;
+		// A new material allocated where a destroyed one lived is resolved again
+		const auto &resolved = it->second.material;
+		return !resolved.owner_before(material) && !material.owner_before(resolved) ? &it->second : nullptr;
+	}
+
 	void RenderCommandSystem::update()
 	{
 		auto &renderContext = getSingleton<components::RenderContext>();
@@ -271,6 +309,8 @@ namespace nexo::system {
 			return;
 
 		const auto sceneRendered = static_cast<unsigned int>(renderContext.sceneRendered);
+		uploadSceneLights(*coord, renderContext.sceneLights);
+		refreshMaterials();
 		const SceneType sceneType = renderContext.sceneType;
 
 		const auto scenePartition = m_group->getPartitionView<components::SceneTag, unsigned int>(
@@ -281,50 +321,138 @@ namespace nexo::system {
         const std::string &sceneName = app.getSceneManager().getScene(sceneRendered).getName();
 		if (!partition) {
             LOG_ONCE(NEXO_WARN, "Nothing to render in scene {}, skipping", sceneName);
+            m_emptyScene = renderContext.sceneRendered;
             return;
 		}
-        Logger::resetOnce(NEXO_LOG_ONCE_KEY("Nothing to render in scene {}, skipping", sceneName));
+        // Building the key allocates, it is only reset when the warning could have been logged
+        if (std::exchange(m_emptyScene, -1) == renderContext.sceneRendered)
+            Logger::resetOnce(NEXO_LOG_ONCE_KEY("Nothing to render in scene {}, skipping", sceneName));
 
 		const auto transformSpan = get<components::TransformComponent>();
 		const auto meshSpan = get<components::StaticMeshComponent>();
 		const auto materialSpan = get<components::MaterialComponent>();
 		const std::span<const ecs::Entity> entitySpan = m_group->entities();
 
-        std::vector<renderer::DrawCommand> drawCommands;
-		for (size_t i = partition->startIndex; i < partition->startIndex + partition->count; ++i) {
-		    const ecs::Entity entity = entitySpan[i];
-            if (coord->entityHasComponent<components::CameraComponent>(entity) && sceneType != SceneType::EDITOR)
-                continue;
-            const auto &transform = transformSpan[i];
-            const auto &materialAsset = materialSpan[i].material.lock();
-            std::string shaderStr = materialAsset && materialAsset->isLoaded() ? materialAsset->getData()->shader : "";
-            const auto &mesh = meshSpan[i];
-            auto shader = renderer::ShaderLibrary::getInstance().get(shaderStr);
-            if (!shader)
-                continue;
-            drawCommands.push_back(createDrawCommand(
-                entity,
-                shader,
-                mesh,
-                materialAsset,
-                transform)
-            );
-
-            if (coord->entityHasComponent<components::SelectedTag>(entity))
-                drawCommands.push_back(createSelectedDrawCommand(mesh, materialAsset, transform));
+		cullPartition(renderContext, *partition);
+
+		// Materials are resolved once per frame, the workers then only read them
+		std::erase_if(m_resolvedMaterials, [](const auto &item) { return item.second.material.expired(); });
+		forEachMaterial([this](const std::shared_ptr<assets::Material> &material, const uint32_t index) {
+			if (material->isLoaded())
+				resolveMaterial(material, index);
+		});
+
+		// Commands are only built for entities at least one camera sees, each worker fills its own arena
+		const auto buildCommands = [&](const size_t begin, const size_t end, CommandArena &arena) {
+			arena.commands.clear();
+			arena.entities.clear();
+			arena.pending.clear();
+			for (size_t local = begin; local < end; ++local) {
+				if (!m_visibleInAnyCamera[local])
+					continue;
+				const size_t i = partition->startIndex + local;
+				const auto materialAsset = materialSpan[i].material.lock();
+				if (!materialAsset || !materialAsset->isLoaded())
+					continue;
+				const ResolvedMaterial *material = findResolvedMaterial(materialAsset);
+				if (!material) {
+					arena.pending.push_back(static_cast<uint32_t>(local));
+					continue;
+				}
+				if (!material->shader)
+					continue;
+				arena.entities.push_back(static_cast<uint32_t>(local));
+				arena.commands.push_back(createDrawCommand(entitySpan[i], *material, meshSpan[i], transformSpan[i]));
+			}
+		};
+
+		WorkerPool &workerPool = WorkerPool::getShared();
+		const size_t workerCount = std::clamp<size_t>(partition->count / MIN_ENTITIES_PER_WORKER, 1, workerPool.getThreadCount());
+		m_arenas.resize(workerCount);
+		m_commandIndices.assign(partition->count, noIndex);
+		// The list of the previous frame is reused once every pipeline released it
+		if (!m_frameCommands || m_frameCommands.use_count() > 1)
+			m_frameCommands = std::make_shared<std::vector<renderer::DrawCommand>>();
+		auto &drawCommands = *m_frameCommands;
+		drawCommands.clear();
+
+		// The pool returns once every worker is done and rethrows the first failure, so each phase
+		// completes on the render thread without any per frame synchronization object
+		workerPool.run(workerCount, [&](const size_t worker) {
+			const size_t begin = partition->count * worker / workerCount;
+			const size_t end = partition->count * (worker + 1) / workerCount;
+			buildCommands(begin, end, m_arenas[worker]);
+		});
+
+		// Arenas are concatenated in partition order, the pipelines sort the commands by key anyway.
+		// The list is sized here, before the merge, so a failed allocation surfaces as a normal exception
+		size_t commandCount = 0;
+		for (auto &arena : m_arenas) {
+			arena.offset = commandCount;
+			commandCount += arena.commands.size();
+		}
+		drawCommands.resize(commandCount);
+
+		workerPool.run(workerCount, [&](const size_t worker) {
+			CommandArena &arena = m_arenas[worker];
+			for (size_t command = 0; command < arena.commands.size(); ++command) {
+				drawCommands[arena.offset + command] = std::move(arena.commands[command]);
+				m_commandIndices[arena.entities[command]] = static_cast<uint32_t>(arena.offset + command);
+			}
+		});
+
+		// Materials seen for the first time may compile shaders, they are resolved here and found by the workers next frame
+		for (const auto &arena : m_arenas) {
+			for (const uint32_t local : arena.pending) {
+				const size_t i = partition->startIndex + local;
+				const auto materialAsset = materialSpan[i].material.lock();
+				const ResolvedMaterial *material = findResolvedMaterial(materialAsset);
+				if (!material)
+					material = &resolveMaterial(materialAsset, getMaterialIndex(materialAsset));
+				if (!material->shader)
+					continue;
+				m_commandIndices[local] = static_cast<uint32_t>(drawCommands.size());
+				drawCommands.push_back(createDrawCommand(entitySpan[i], *material, meshSpan[i], transformSpan[i]));
+			}
 		}
 
-		for (auto &camera : renderContext.cameras) {
-            for (auto &cmd : drawCommands) {
-                cmd.uniforms["uViewProjection"] = camera.viewProjectionMatrix;
-                cmd.uniforms["uCamPos"] = camera.cameraPosition;
-                setupLights(cmd, renderContext.sceneLights);
-            }
-            camera.pipeline.addDrawCommands(drawCommands);
+		// Outline masks are drawn in their own pass, their order relative to the forward commands does not matter
+		const size_t firstSelectedCommand = drawCommands.size();
+		for (const ecs::Entity entity : m_selectedQuery->entities()) {
+		    if (coord->getComponent<components::SceneTag>(entity).id != sceneRendered)
+		        continue;
+		    const auto &materialAsset = coord->getComponent<components::MaterialComponent>(entity).material.lock();
+		    drawCommands.push_back(createSelectedDrawCommand(
+		        coord->getComponent<components::StaticMeshComponent>(entity),
+		        materialAsset,
+		        coord->getComponent<components::TransformComponent>(entity))
+		    );
+		}
+		m_selectedQuery->clearChanges();
+
+		// The scene commands do not depend on the camera, they are built once and shared by every pipeline
+		const std::shared_ptr<const std::vector<renderer::DrawCommand>> sharedDrawCommands = m_frameCommands;
+		auto &frameArena = renderer::NxRenderer3D::get().getFrameArena();
+		for (size_t cameraIndex = 0; cameraIndex < renderContext.cameras.size(); ++cameraIndex) {
+		    auto &camera = renderContext.cameras[cameraIndex];
+		    const auto &visible = m_cameraVisibility[cameraIndex];
+		    // Read by the pipeline when it executes, later this frame
+		    const auto visibleCommands = frameArena.allocate<uint32_t>(sharedDrawCommands->size());
+		    size_t visibleCount = 0;
+		    for (size_t local = 0; local < m_commandIndices.size(); ++local) {
+		        const uint32_t boundsIndex = m_boundsIndices[local];
+		        if (m_commandIndices[local] != noIndex && (boundsIndex == noIndex || visible[boundsIndex]))
+		            visibleCommands[visibleCount++] = m_commandIndices[local];
+		    }
+		    for (size_t index = firstSelectedCommand; index < sharedDrawCommands->size(); ++index)
+		        visibleCommands[visibleCount++] = static_cast<uint32_t>(index);
+
+            camera.pipeline->addDrawCommands(sharedDrawCommands, visibleCommands.first(visibleCount));
             if (sceneType == SceneType::EDITOR && renderContext.gridParams.enabled)
-                camera.pipeline.addDrawCommand(createGridDrawCommand(camera, renderContext));
+                camera.pipeline->addDrawCommand(createGridDrawCommand(camera, renderContext));
             if (sceneType == SceneType::EDITOR)
-                camera.pipeline.addDrawCommand(createOutlineDrawCommand(camera));
+                camera.pipeline->addDrawCommand(createOutlineDrawCommand(camera));
 		}
+		uploadMaterials();
 	}
 }
@@ -18,21 +18,35 @@
 #pragma once
 
 #include "Access.hpp"
+#include "CachedQuery.hpp"
 #include "DrawCommand.hpp"
 #include "GroupSystem.hpp"
+#include "components/Camera.hpp"
 #include "components/RenderContext.hpp"
 #include "components/SceneComponents.hpp"
 #include "components/MaterialComponent.hpp"
 #include "components/StaticMesh.hpp"
 #include "components/Transform.hpp"
+#include "math/Frustum.hpp"
+
+#include <unordered_map>
 
 namespace nexo::system {
 
+	/// Everything a draw needs from its material, resolved on the render thread
+	struct ResolvedMaterial {
+		std::weak_ptr<assets::Material> material;
+		std::shared_ptr<renderer::NxShader> shader;
+		std::shared_ptr<renderer::NxShader> instancedShader;
+		uint32_t index = 0;
+		bool isOpaque = true;
+	};
+
 	/**
 	* @brief System responsible for rendering the scene.
 	*
 	* The RenderSystem iterates over the active cameras stored in the RenderContext singleton,
-	* sets up lighting uniforms using the sceneLights data, and then renders entities that have
+	* uploads the sceneLights data to the scene lights buffer, and then renders entities that have
 	* a valid RenderComponent. The system binds each camera's render target, clears the buffers,
 	* and then draws each renderable entity.
 	*
@@ -40,10 +54,14 @@ namespace nexo::system {
 	*  - READ access to components::TransformComponent (owned)
 	*  - READ access to components::RenderComponent (owned)
 	*  - READ access to components::SceneTag (non-owned)
+	*  - Entities with a components::CameraComponent are excluded from the group
 	*  - WRITE access to components::RenderContext (singleton)
 	*
 	* @note The system uses scene partitioning to only render entities belonging to the
 	* currently active scene (identified by RenderContext.sceneRendered).
+	*
+	* @note Large partitions are split between the threads of the shared WorkerPool, each building the commands of its range
+	* without touching the GL context. The commands are only executed later by the pipelines.
 	*/
 	class RenderCommandSystem final : public ecs::GroupSystem<
 		ecs::Owned<
@@ -51,12 +69,58 @@ namespace nexo::system {
 	        ecs::Read<components::StaticMeshComponent>,
 			ecs::Read<components::MaterialComponent>>,
         ecs::NonOwned<
-        	ecs::Read<components::SceneTag>>,
+        	ecs::Read<components::SceneTag>,
+        	ecs::Exclude<components::CameraComponent>>,
     	ecs::WriteSingleton<components::RenderContext>> {
 			public:
+				RenderCommandSystem();
                 void update();
 
 			private:
-			    static void setupLights(renderer::DrawCommand &cmd, const components::LightContext& lightContext);
+				/// Selected renderable entities, tracked incrementally instead of being tested per entity
+				std::shared_ptr<ecs::CachedQuery> m_selectedQuery;
+
+				/**
+				 * @brief Tests the world bounds of the partition entities against the frustum of every camera.
+				 *
+				 * Fills the per camera visibility of the entities with bounds and records the culling stats.
+				 */
+				void cullPartition(const components::RenderContext &renderContext, const ecs::Partition<unsigned int> &partition);
+
+				// Per frame culling data, indexed by the entity position inside the rendered partition
+				std::vector<math::Aabb> m_worldBounds;
+				std::vector<uint32_t> m_boundsIndices;
+				std::vector<uint8_t> m_visibleInAnyCamera;
+				std::vector<uint32_t> m_commandIndices;
+				// Visibility of every entity of m_worldBounds, per camera
+				std::vector<std::vector<uint8_t>> m_cameraVisibility;
+
+				/// Commands built by one worker from a contiguous range of the rendered partition
+				struct CommandArena {
+					std::vector<renderer::DrawCommand> commands;
+					// Partition local index of the entity of each command
+					std::vector<uint32_t> entities;
+					// Entities whose material was first seen this frame, built on the render thread after the workers
+					std::vector<uint32_t> pending;
+					size_t offset = 0;
+				};
+
+				/// Below this many entities per worker, handing the range to the worker pool costs more than it saves
+				static constexpr size_t MIN_ENTITIES_PER_WORKER = 4096;
+
+				/**
+				 * @brief Resolves the index, shaders and blending of a material, compiling its shaders if needed.
+				 *
+				 * Must be called from the render thread, the workers only read the resolved materials.
+				 */
+				const ResolvedMaterial &resolveMaterial(const std::shared_ptr<assets::Material> &material, uint32_t index);
+				[[nodiscard]] const ResolvedMaterial *findResolvedMaterial(const std::shared_ptr<assets::Material> &material) const;
+
+				std::unordered_map<const assets::Material *, ResolvedMaterial> m_resolvedMaterials;
+				std::vector<CommandArena> m_arenas;
+				/// Commands shared with the pipelines, recycled so a frame of stable size does not allocate
+				std::shared_ptr<std::vector<renderer::DrawCommand>> m_frameCommands;
+				/// Scene whose "nothing to render" warning was last logged, -1 if none
+				int m_emptyScene = -1;
 	};
 }
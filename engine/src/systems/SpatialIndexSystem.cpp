@@ -0,0 +1,126 @@
+//// SpatialIndexSystem ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the system maintaining the per scene bounding volume hierarchy
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "SpatialIndexSystem.hpp"
+#include "math/Frustum.hpp"
+#include "WorkerPool.hpp"
+
+#include <algorithm>
+
+namespace nexo::system {
+
+    // Below this many new proxies in a frame incremental insertion is cheaper than a rebuild
+    constexpr size_t rebuildInsertionThreshold = 1024;
+
+    SpatialIndexSystem::SpatialIndexSystem()
+    {
+        m_trackedQuery = coord->registerCachedQuery<
+            components::TransformComponent,
+            components::StaticMeshComponent,
+            components::SceneTag>();
+    }
+
+    void SpatialIndexSystem::removeProxy(const ecs::Entity entity)
+    {
+        const auto it = m_proxies.find(entity);
+        if (it == m_proxies.end())
+            return;
+        m_sceneTrees[it->second.sceneId].destroyProxy(it->second.id);
+        m_proxies.erase(it);
+    }
+
+    void SpatialIndexSystem::update()
+    {
+        for (const ecs::Entity entity : m_trackedQuery->removed())
+            removeProxy(entity);
+        m_trackedQuery->clearChanges();
+    }
+
+    void SpatialIndexSystem::updateScene(const unsigned int sceneId)
+    {
+        update();
+
+        math::AabbTree &tree = m_sceneTrees[sceneId];
+        m_movedProxies.clear();
+        size_t insertedCount = 0;
+        for (const ecs::Entity entity : entities) {
+            const unsigned int entityScene = getComponent<components::SceneTag>(entity).id;
+            auto proxyIt = m_proxies.find(entity);
+            if (proxyIt != m_proxies.end() && proxyIt->second.sceneId != entityScene) {
+                removeProxy(entity);
+                proxyIt = m_proxies.end();
+            }
+            if (entityScene != sceneId)
+                continue;
+
+            const auto &transform = getComponent<components::TransformComponent>(entity);
+            if (proxyIt != m_proxies.end() && proxyIt->second.worldRevision == transform.worldRevision)
+                continue;
+            const auto &localBounds = getComponent<components::StaticMeshComponent>(entity).localBounds;
+            if (!localBounds) {
+                removeProxy(entity);
+                continue;
+            }
+            const math::Aabb worldBounds = math::transformAabb(*localBounds, transform.worldMatrix);
+            if (proxyIt == m_proxies.end()) {
+                m_proxies.emplace(entity, Proxy{sceneId, tree.createProxy(worldBounds, entity), transform.worldRevision});
+                ++insertedCount;
+                continue;
+            }
+            proxyIt->second.worldRevision = transform.worldRevision;
+            m_movedProxies.emplace_back(proxyIt->second.id, worldBounds);
+        }
+
+        if (insertedCount >= rebuildInsertionThreshold && insertedCount * 2 >= tree.getProxyCount()) {
+            // Scene load or large spawn, incremental insertions leave a poor tree
+            for (const auto &[proxy, bounds] : m_movedProxies)
+                tree.setProxyBounds(proxy, bounds);
+            tree.rebuild();
+        } else if (m_movedProxies.size() * 2 >= tree.getProxyCount() && !m_movedProxies.empty()) {
+            // Most of the scene moved, keep the topology and only refit the boxes
+            for (const auto &[proxy, bounds] : m_movedProxies)
+                tree.setProxyBounds(proxy, bounds);
+            tree.refit(static_cast<unsigned int>(WorkerPool::getShared().getThreadCount()));
+        } else {
+            for (const auto &[proxy, bounds] : m_movedProxies)
+                tree.moveProxy(proxy, bounds);
+        }
+    }
+
+    const math::AabbTree *SpatialIndexSystem::getSceneTree(const unsigned int sceneId)
+    {
+        updateScene(sceneId);
+        const auto it = m_sceneTrees.find(sceneId);
+        if (it == m_sceneTrees.end() || it->second.getProxyCount() == 0)
+            return nullptr;
+        return &it->second;
+    }
+
+    std::optional<ecs::Entity> SpatialIndexSystem::raycast(const unsigned int sceneId, const math::Ray &ray)
+    {
+        const math::AabbTree *tree = getSceneTree(sceneId);
+        if (!tree)
+            return std::nullopt;
+        const math::AabbTree::RayHit hit = tree->rayCast(ray);
+        if (hit.proxy == math::AabbTree::NULL_NODE)
+            return std::nullopt;
+        return static_cast<ecs::Entity>(hit.userData);
+    }
+}
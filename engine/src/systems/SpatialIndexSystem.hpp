@@ -0,0 +1,96 @@
+//// SpatialIndexSystem ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Header file for the system maintaining the per scene bounding volume hierarchy
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+
+#include "ecs/CachedQuery.hpp"
+#include "ecs/QuerySystem.hpp"
+#include "components/SceneComponents.hpp"
+#include "components/StaticMesh.hpp"
+#include "components/Transform.hpp"
+#include "math/AabbTree.hpp"
+
+namespace nexo::system {
+
+    /**
+     * @brief System keeping a bounding volume hierarchy of the world bounds of the meshes of every scene.
+     *
+     * The tree of a scene is brought up to date when it is queried, so frames without a consumer only
+     * release the proxies of removed entities. Only the entities whose world revision changed since the
+     * previous query get new bounds. When few of them move the leaves are reinserted, when most of them
+     * do the tree is refit in place across threads. Large insertion batches, such as a scene load,
+     * rebuild the tree with the surface area heuristic.
+     *
+     * @note Component Access Rights:
+     *  - READ access to components::TransformComponent
+     *  - READ access to components::StaticMeshComponent
+     *  - READ access to components::SceneTag
+     */
+    class SpatialIndexSystem final : public ecs::QuerySystem<
+        ecs::Read<components::TransformComponent>,
+        ecs::Read<components::StaticMeshComponent>,
+        ecs::Read<components::SceneTag>> {
+        public:
+            SpatialIndexSystem();
+
+            /**
+             * @brief Releases the proxies of the entities destroyed or stripped of a tracked component.
+             */
+            void update();
+
+            /**
+             * @brief Brings the hierarchy of a scene up to date and returns it, the user data of its proxies are the entities.
+             *
+             * Bounds follow the world matrices, which are only computed for the rendered scene.
+             * @return The tree, or nullptr if no entity of the scene has bounds.
+             */
+            [[nodiscard]] const math::AabbTree *getSceneTree(unsigned int sceneId);
+
+            /**
+             * @brief Finds the closest entity whose world bounds are hit by the ray.
+             */
+            [[nodiscard]] std::optional<ecs::Entity> raycast(unsigned int sceneId, const math::Ray &ray);
+
+        private:
+            struct Proxy {
+                unsigned int sceneId;
+                int32_t id;
+                // World revision of the transform the bounds were computed from
+                uint32_t worldRevision;
+            };
+
+            void removeProxy(ecs::Entity entity);
+
+            /**
+             * @brief Updates the proxies of a scene from the transforms that moved since its last update.
+             */
+            void updateScene(unsigned int sceneId);
+
+            /// Tracks destroyed entities and entities losing one of the components
+            std::shared_ptr<ecs::CachedQuery> m_trackedQuery;
+            std::unordered_map<unsigned int, math::AabbTree> m_sceneTrees;
+            std::unordered_map<ecs::Entity, Proxy> m_proxies;
+
+            // Bounds of the proxies moved since the last update of a scene
+            std::vector<std::pair<int32_t, math::Aabb>> m_movedProxies;
+    };
+}
@@ -53,7 +53,7 @@ namespace nexo::system {
 
             auto& rootTransform = transformComponentArray->get(rootEntity);
             glm::mat4 rootWorldMatrix = calculateLocalMatrix(rootTransform);
-            rootTransform.worldMatrix = rootWorldMatrix;
+            rootTransform.setWorldMatrix(rootWorldMatrix);
             updateChildTransforms(transformComponentArray, rootTransform.children, rootWorldMatrix);
         }
     }
@@ -70,7 +70,7 @@ namespace nexo::system {
             auto& transform = transformComponentArray->get(childEntity);
 
             glm::mat4 localMatrix = calculateLocalMatrix(transform);
-            transform.worldMatrix = parentWorldMatrix * localMatrix;
+            transform.setWorldMatrix(parentWorldMatrix * localMatrix);
 
             if (!transform.children.empty())
                 updateChildTransforms(transformComponentArray, transform.children, transform.worldMatrix);
@@ -17,6 +17,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "TransformMatrixSystem.hpp"
+#include "components/Parent.hpp"
 #include "components/Transform.hpp"
 
 #define GLM_ENABLE_EXPERIMENTAL
@@ -37,7 +38,9 @@ namespace nexo::system {
 				continue;
             auto &transform = getComponent<components::TransformComponent>(entity);
             transform.localMatrix = createTransformMatrix(transform);
-            transform.worldMatrix = transform.localMatrix;
+            // Children get their world matrix from the hierarchy system, writing it here would count as a move every frame
+            if (!coord->entityHasComponent<components::ParentComponent>(entity))
+                transform.setWorldMatrix(transform.localMatrix);
         }
     }
 
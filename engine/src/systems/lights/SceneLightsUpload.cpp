@@ -0,0 +1,71 @@
+//// SceneLightsUpload.cpp /////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Source file for the upload of the scene lights buffer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "SceneLightsUpload.hpp"
+#include "components/Transform.hpp"
+#include "renderer/Renderer3D.hpp"
+
+namespace nexo::system {
+	void uploadSceneLights(ecs::Coordinator &coordinator, components::LightContext &lightContext)
+	{
+		if (lightContext.uploaded)
+			return;
+
+		renderer::NxSceneLightsData data;
+		data.ambientLight = glm::vec4(lightContext.ambientLight, 1.0f);
+		data.dirLight.direction = glm::vec4(lightContext.dirLight.direction, 0.0f);
+		data.dirLight.color = glm::vec4(lightContext.dirLight.color, 1.0f);
+		data.pointLightCount = static_cast<int>(lightContext.pointLightCount);
+		data.spotLightCount = static_cast<int>(lightContext.spotLightCount);
+
+		const auto &pointLightComponentArray = coordinator.getComponentArray<components::PointLightComponent>();
+		const auto &transformComponentArray = coordinator.getComponentArray<components::TransformComponent>();
+		for (unsigned int i = 0; i < lightContext.pointLightCount; ++i)
+		{
+			const auto &pointLight = pointLightComponentArray->get(lightContext.pointLights[i]);
+			const auto &transform = transformComponentArray->get(lightContext.pointLights[i]);
+			auto &gpuLight = data.pointLights[i];
+			gpuLight.position = glm::vec4(transform.pos, 1.0f);
+			gpuLight.color = glm::vec4(pointLight.color, 1.0f);
+			gpuLight.constant = pointLight.constant;
+			gpuLight.linear = pointLight.linear;
+			gpuLight.quadratic = pointLight.quadratic;
+		}
+
+		const auto &spotLightComponentArray = coordinator.getComponentArray<components::SpotLightComponent>();
+		for (unsigned int i = 0; i < lightContext.spotLightCount; ++i)
+		{
+			const auto &spotLight = spotLightComponentArray->get(lightContext.spotLights[i]);
+			const auto &transform = transformComponentArray->get(lightContext.spotLights[i]);
+			auto &gpuLight = data.spotLights[i];
+			gpuLight.position = glm::vec4(transform.pos, 1.0f);
+			gpuLight.direction = glm::vec4(spotLight.direction, 0.0f);
+			gpuLight.color = glm::vec4(spotLight.color, 1.0f);
+			gpuLight.cutOff = spotLight.cutOff;
+			gpuLight.outerCutoff = spotLight.outerCutoff;
+			gpuLight.constant = spotLight.constant;
+			gpuLight.linear = spotLight.linear;
+			gpuLight.quadratic = spotLight.quadratic;
+		}
+
+		renderer::NxRenderer3D::get().uploadSceneLights(data);
+		lightContext.uploaded = true;
+	}
+}
@@ -2,7 +2,10 @@
 #version 430 core
 layout(location = 0) in vec3 aPos;
 
-uniform mat4 uViewProjection;
+layout(std140, binding = 0) uniform CameraConstants {
+    mat4 uViewProjection;
+    vec4 uCamPos;
+};
 uniform mat4 uMatModel;
 
 void main()
@@ -3,7 +3,10 @@
 layout(location = 0) in vec2 aPos;
 layout(location = 1) in vec2 aTexCoord;
 
-uniform mat4 uViewProjection;
+layout(std140, binding = 0) uniform CameraConstants {
+    mat4 uViewProjection;
+    vec4 uCamPos;
+};
 uniform mat4 uMatModel;
 
 out vec2 vTexCoord;
@@ -17,22 +20,57 @@ void main()
 
 #type fragment
 #version 430 core
+#ifdef NX_BINDLESS_TEXTURES
+#extension GL_ARB_bindless_texture : require
+#endif
 layout(location = 0) out vec4 FragColor;
 
 in vec2 vTexCoord;
 
+// Mirrors renderer::NxIndexedMaterial, the draws index the table with uMaterialIndex
 struct Material {
     vec4 albedoColor;
+    vec4 specularColor;
+    vec3 emissiveColor;
+    float roughness;
+    float metallic;
+    float opacity;
     int albedoTexIndex; // Default: 0 (white texture)
+    int specularTexIndex; // Default: 0 (white texture)
+    int emissiveTexIndex; // Default: 0 (white texture)
+    int roughnessTexIndex; // Default: 0 (white texture)
+    int metallicTexIndex; // Default: 0 (white texture)
+    int opacityTexIndex; // Default: 0 (white texture)
+};
+layout(std430, binding = 2) readonly buffer Materials {
+    Material uMaterials[];
 };
-uniform Material uMaterial;
+uniform int uMaterialIndex;
 
-uniform sampler2D uTexture[31];
+// Material textures, indexed through renderer::NxTextureTable
+#ifdef NX_BINDLESS_TEXTURES
+layout(std430, binding = 1) readonly buffer TextureTable {
+    uvec2 uTextureHandles[];
+};
+
+vec4 sampleMaterialTexture(int index, vec2 uv)
+{
+    return texture(sampler2D(uTextureHandles[index]), uv);
+}
+#else
+// One array per texture size and format, the index packs the array and the layer
+layout(binding = 16) uniform sampler2DArray uTextureArrays[8];
+
+vec4 sampleMaterialTexture(int index, vec2 uv)
+{
+    return texture(uTextureArrays[index >> 16], vec3(uv, float(index & 0xFFFF)));
+}
+#endif
 uniform float uTime;
 
 void main()
 {
-    if (texture(uTexture[uMaterial.albedoTexIndex], vTexCoord).a < 0.1)
+    if (sampleMaterialTexture(uMaterials[uMaterialIndex].albedoTexIndex, vTexCoord).a < 0.1)
         discard;
 
     vec4 purpleColor = vec4(0.5, 0.0, 1.0, 1.0);
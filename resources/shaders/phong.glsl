@@ -1,11 +1,25 @@
+// Feature keywords, see renderer::NxShaderVariants
+#keywords NX_INSTANCED NX_UNLIT
 #type vertex
 #version 430 core
 layout(location = 0) in vec3 aPos;
 layout(location = 1) in vec2 aTexCoord;
 layout(location = 2) in vec3 aNormal;
 
-uniform mat4 uViewProjection;
+layout(std140, binding = 0) uniform CameraConstants {
+    mat4 uViewProjection;
+    vec4 uCamPos;
+};
+#ifdef NX_INSTANCED
+// Per-instance data, see renderer::NxInstanceData
+layout(location = 8) in mat4 aInstanceModel;
+layout(location = 12) in int aInstanceEntityId;
+flat out int vEntityId;
+#define MODEL_MATRIX aInstanceModel
+#else
 uniform mat4 uMatModel;
+#define MODEL_MATRIX uMatModel
+#endif
 
 out vec3 vFragPos;
 out vec2 vTexCoord;
@@ -13,32 +27,44 @@ out vec3 vNormal;
 
 void main()
 {
-    vec4 worldPos = uMatModel * vec4(aPos, 1.0);
+    vec4 worldPos = MODEL_MATRIX * vec4(aPos, 1.0);
     vFragPos = worldPos.xyz;
 
     vTexCoord = aTexCoord;
 
-    vNormal = mat3(transpose(inverse(uMatModel))) * aNormal;
+    vNormal = mat3(transpose(inverse(MODEL_MATRIX))) * aNormal;
+#ifdef NX_INSTANCED
+    vEntityId = aInstanceEntityId;
+#endif
 
     gl_Position = uViewProjection * vec4(vFragPos, 1.0);
 }
 
 #type fragment
 #version 430 core
+#ifdef NX_BINDLESS_TEXTURES
+#extension GL_ARB_bindless_texture : require
+#endif
 layout(location = 0) out vec4 FragColor;
 layout(location = 1) out int EntityID;
 
+layout(std140, binding = 0) uniform CameraConstants {
+    mat4 uViewProjection;
+    vec4 uCamPos;
+};
+
 #define MAX_POINT_LIGHTS 10
 #define MAX_SPOT_LIGHTS 10
 
-// Light definitions.
+// Light definitions, laid out as std140 to match renderer::NxSceneLightsData.
+// vec3 members are stored as vec4 to avoid std140 padding surprises.
 struct DirectionalLight {
-    vec3 direction;
+    vec4 direction;
     vec4 color;
 };
 
 struct PointLight {
-    vec3 position;
+    vec4 position;
     vec4 color;
 
     float constant;
@@ -47,8 +73,8 @@ struct PointLight {
 };
 
 struct SpotLight {
-    vec3 position;
-    vec3 direction;
+    vec4 position;
+    vec4 direction;
     vec4 color;
     float cutOff;
     float outerCutoff;
@@ -57,69 +83,96 @@ struct SpotLight {
     float quadratic;
 };
 
+// Uploaded once per scene and frame, see NX_SCENE_LIGHTS_BINDING
+layout(std140, binding = 0) readonly buffer SceneLights {
+    vec4 uAmbientLight;
+    DirectionalLight uDirLight;
+    int uNumPointLights;
+    int uNumSpotLights;
+    PointLight uPointLights[MAX_POINT_LIGHTS];
+    SpotLight uSpotLights[MAX_SPOT_LIGHTS];
+};
+
 in vec3 vFragPos;
 in vec2 vTexCoord;
 in vec3 vNormal;
 
-uniform sampler2D uTexture[32];
+// Material textures, indexed through renderer::NxTextureTable
+#ifdef NX_BINDLESS_TEXTURES
+layout(std430, binding = 1) readonly buffer TextureTable {
+    uvec2 uTextureHandles[];
+};
 
-uniform vec3 uCamPos;
+vec4 sampleMaterialTexture(int index, vec2 uv)
+{
+    return texture(sampler2D(uTextureHandles[index]), uv);
+}
+#else
+// One array per texture size and format, the index packs the array and the layer
+layout(binding = 16) uniform sampler2DArray uTextureArrays[8];
 
-uniform vec3 uAmbientLight;
-uniform DirectionalLight uDirLight;
-uniform PointLight uPointLights[MAX_POINT_LIGHTS];
-uniform int uNumPointLights;
-uniform SpotLight uSpotLights[MAX_SPOT_LIGHTS];
-uniform int uNumSpotLights;
+vec4 sampleMaterialTexture(int index, vec2 uv)
+{
+    return texture(uTextureArrays[index >> 16], vec3(uv, float(index & 0xFFFF)));
+}
+#endif
 
+// Mirrors renderer::NxIndexedMaterial, the draws index the table with uMaterialIndex
 struct Material {
     vec4 albedoColor;
-    int albedoTexIndex; // Default: 0 (white texture)
     vec4 specularColor;
-    int specularTexIndex; // Default: 0 (white texture)
     vec3 emissiveColor;
-    int emissiveTexIndex; // Default: 0 (white texture)
     float roughness;
-    int roughnessTexIndex; // Default: 0 (white texture)
     float metallic;
-    int metallicTexIndex; // Default: 0 (white texture)
     float opacity;
+    int albedoTexIndex; // Default: 0 (white texture)
+    int specularTexIndex; // Default: 0 (white texture)
+    int emissiveTexIndex; // Default: 0 (white texture)
+    int roughnessTexIndex; // Default: 0 (white texture)
+    int metallicTexIndex; // Default: 0 (white texture)
     int opacityTexIndex; // Default: 0 (white texture)
 };
-uniform Material uMaterial;
+layout(std430, binding = 2) readonly buffer Materials {
+    Material uMaterials[];
+};
+uniform int uMaterialIndex;
 
+#ifdef NX_INSTANCED
+flat in int vEntityId;
+#else
 uniform int uEntityId;
+#endif
 
 vec3 CalcDirLight(DirectionalLight light, vec3 normal, vec3 viewDir)
 {
-    vec3 lightDir = normalize(-light.direction);
+    vec3 lightDir = normalize(-light.direction.xyz);
     // diffuse shading
     float diff = max(dot(normal, lightDir), 0.0);
     // specular shading
     vec3 reflectDir = reflect(-lightDir, normal);
-    float shininess = mix(128.0, 2.0, uMaterial.roughness);
+    float shininess = mix(128.0, 2.0, uMaterials[uMaterialIndex].roughness);
     float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess);
     // combine results
-    vec3 diffuse = light.color.rgb * diff * uMaterial.albedoColor.rgb * vec3(texture(uTexture[uMaterial.albedoTexIndex], vTexCoord));
-    vec3 specular = light.color.rgb * spec * uMaterial.specularColor.rgb * vec3(texture(uTexture[uMaterial.specularTexIndex], vTexCoord));
+    vec3 diffuse = light.color.rgb * diff * uMaterials[uMaterialIndex].albedoColor.rgb * vec3(sampleMaterialTexture(uMaterials[uMaterialIndex].albedoTexIndex, vTexCoord));
+    vec3 specular = light.color.rgb * spec * uMaterials[uMaterialIndex].specularColor.rgb * vec3(sampleMaterialTexture(uMaterials[uMaterialIndex].specularTexIndex, vTexCoord));
     return (diffuse + specular);
 }
 
 vec3 CalcPointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
 {
-    vec3 lightDir = normalize(light.position - fragPos);
+    vec3 lightDir = normalize(light.position.xyz - fragPos);
     // diffuse shading
     float diff = max(dot(normal, lightDir), 0.0);
     // specular shading
     vec3 reflectDir = reflect(-lightDir, normal);
-    float shininess = mix(128.0, 2.0, uMaterial.roughness);
+    float shininess = mix(128.0, 2.0, uMaterials[uMaterialIndex].roughness);
     float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess);
     // attenuation
-    float distance = length(light.position - fragPos);
+    float distance = length(light.position.xyz - fragPos);
     float attenuation = 1.0 / (light.constant + light.linear * distance + light.quadratic * (distance * distance));
     // combine results
-    vec3 diffuse = light.color.rgb * diff * uMaterial.albedoColor.rgb * vec3(texture(uTexture[uMaterial.albedoTexIndex], vTexCoord));
-    vec3 specular = light.color.rgb * spec * uMaterial.specularColor.rgb * vec3(texture(uTexture[uMaterial.specularTexIndex], vTexCoord));
+    vec3 diffuse = light.color.rgb * diff * uMaterials[uMaterialIndex].albedoColor.rgb * vec3(sampleMaterialTexture(uMaterials[uMaterialIndex].albedoTexIndex, vTexCoord));
+    vec3 specular = light.color.rgb * spec * uMaterials[uMaterialIndex].specularColor.rgb * vec3(sampleMaterialTexture(uMaterials[uMaterialIndex].specularTexIndex, vTexCoord));
     diffuse *= attenuation;
     specular *= attenuation;
     return (diffuse + specular);
@@ -127,23 +180,23 @@ vec3 CalcPointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
 
 vec3 CalcSpotLight(SpotLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
 {
-    vec3 lightDir = normalize(light.position - fragPos);
+    vec3 lightDir = normalize(light.position.xyz - fragPos);
     // diffuse shading
     float diff = max(dot(normal, lightDir), 0.0);
     // specular shading
     vec3 reflectDir = reflect(-lightDir, normal);
-    float shininess = mix(128.0, 2.0, uMaterial.roughness);
+    float shininess = mix(128.0, 2.0, uMaterials[uMaterialIndex].roughness);
     float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess);
     // attenuation
-    float distance = length(light.position - fragPos);
+    float distance = length(light.position.xyz - fragPos);
     float attenuation = 1.0 / (light.constant + light.linear * distance + light.quadratic * (distance * distance));
     // spotlight intensity
-    float theta = dot(lightDir, normalize(-light.direction));
+    float theta = dot(lightDir, normalize(-light.direction.xyz));
     float epsilon = light.cutOff - light.outerCutoff;
     float intensity = clamp((theta - light.outerCutoff) / epsilon, 0.0, 1.0);
     // combine results
-    vec3 diffuse = light.color.rgb * diff * uMaterial.albedoColor.rgb * vec3(texture(uTexture[uMaterial.albedoTexIndex], vTexCoord));
-    vec3 specular = light.color.rgb * spec * uMaterial.specularColor.rgb * vec3(texture(uTexture[uMaterial.specularTexIndex], vTexCoord));
+    vec3 diffuse = light.color.rgb * diff * uMaterials[uMaterialIndex].albedoColor.rgb * vec3(sampleMaterialTexture(uMaterials[uMaterialIndex].albedoTexIndex, vTexCoord));
+    vec3 specular = light.color.rgb * spec * uMaterials[uMaterialIndex].specularColor.rgb * vec3(sampleMaterialTexture(uMaterials[uMaterialIndex].specularTexIndex, vTexCoord));
     diffuse *= attenuation * intensity;
     specular *= attenuation * intensity;
     return (diffuse + specular);
@@ -151,12 +204,15 @@ vec3 CalcSpotLight(SpotLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
 
 void main()
 {
+    if (sampleMaterialTexture(uMaterials[uMaterialIndex].albedoTexIndex, vTexCoord).a < 0.1)
+        discard;
+#ifdef NX_UNLIT
+    vec3 result = uMaterials[uMaterialIndex].albedoColor.rgb * vec3(sampleMaterialTexture(uMaterials[uMaterialIndex].albedoTexIndex, vTexCoord));
+#else
     vec3 norm = normalize(vNormal);
-    vec3 viewDir = normalize(uCamPos - vFragPos);
+    vec3 viewDir = normalize(uCamPos.xyz - vFragPos);
     vec3 result = vec3(0.0);
-    if (texture(uTexture[uMaterial.albedoTexIndex], vTexCoord).a < 0.1)
-        discard;
-    vec3 ambient = uAmbientLight * uMaterial.albedoColor.rgb * vec3(texture(uTexture[uMaterial.albedoTexIndex], vTexCoord));
+    vec3 ambient = uAmbientLight.rgb * uMaterials[uMaterialIndex].albedoColor.rgb * vec3(sampleMaterialTexture(uMaterials[uMaterialIndex].albedoTexIndex, vTexCoord));
     result += ambient;
 
     result += CalcDirLight(uDirLight, norm, viewDir);
@@ -170,7 +226,12 @@ void main()
     {
         result += CalcSpotLight(uSpotLights[i], norm, vFragPos, viewDir);
     }
+#endif
 
     FragColor = vec4(result, 1.0);
+#ifdef NX_INSTANCED
+    EntityID = vEntityId;
+#else
     EntityID = uEntityId;
+#endif
 }
@@ -0,0 +1,199 @@
+//// AabbTree.test.cpp /////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the dynamic bounding volume hierarchy
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "math/AabbTree.hpp"
+
+namespace nexo::math {
+
+    class AabbTreeTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                std::mt19937 rng(7);
+                std::uniform_real_distribution position(-100.0f, 100.0f);
+                std::uniform_real_distribution size(0.1f, 2.0f);
+                for (uint32_t i = 0; i < 2000; ++i) {
+                    const glm::vec3 min(position(rng), position(rng), position(rng));
+                    boxes.push_back({min, min + glm::vec3(size(rng), size(rng), size(rng))});
+                    proxies.push_back(tree.createProxy(boxes.back(), i));
+                }
+            }
+
+            // Exact overlaps computed without the tree
+            std::vector<uint32_t> bruteForce(const Aabb &query) const
+            {
+                std::vector<uint32_t> result;
+                for (uint32_t i = 0; i < boxes.size(); ++i)
+                    if (overlaps(query, boxes[i]))
+                        result.push_back(i);
+                return result;
+            }
+
+            // Tree results filtered on the exact bounds, since the tree reports fat bounds overlaps
+            std::vector<uint32_t> treeQuery(const Aabb &query) const
+            {
+                std::vector<uint32_t> result;
+                tree.queryAabb(query, [&](const int32_t proxy) {
+                    if (overlaps(query, tree.getBounds(proxy)))
+                        result.push_back(tree.getUserData(proxy));
+                    return true;
+                });
+                std::ranges::sort(result);
+                return result;
+            }
+
+            void expectQueriesMatch() const
+            {
+                for (int i = -100; i < 100; i += 25) {
+                    const auto base = static_cast<float>(i);
+                    const Aabb query{glm::vec3(base), glm::vec3(base + 30.0f)};
+                    EXPECT_EQ(treeQuery(query), bruteForce(query));
+                }
+            }
+
+            AabbTree tree;
+            std::vector<Aabb> boxes;
+            std::vector<int32_t> proxies;
+    };
+
+    TEST_F(AabbTreeTest, AabbQueriesMatchBruteForce)
+    {
+        EXPECT_EQ(tree.getProxyCount(), boxes.size());
+        // Rotations keep the incremental tree close to balanced
+        EXPECT_LT(tree.getHeight(), 32);
+        expectQueriesMatch();
+    }
+
+    TEST_F(AabbTreeTest, MovedAndDestroyedProxiesAreTracked)
+    {
+        for (size_t i = 0; i < boxes.size(); i += 3) {
+            const glm::vec3 offset(5.0f, -3.0f, 1.0f);
+            boxes[i] = {boxes[i].min + offset, boxes[i].max + offset};
+            tree.moveProxy(proxies[i], boxes[i]);
+        }
+        // Destroyed boxes are moved out of the queried range so the brute force ignores them
+        for (size_t i = 1; i < boxes.size(); i += 7) {
+            tree.destroyProxy(proxies[i]);
+            boxes[i] = {glm::vec3(1e6f), glm::vec3(1e6f + 1.0f)};
+        }
+        expectQueriesMatch();
+    }
+
+    TEST_F(AabbTreeTest, RefitAndRebuildKeepProxies)
+    {
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            const glm::vec3 offset(0.0f, 10.0f, 0.0f);
+            boxes[i] = {boxes[i].min + offset, boxes[i].max + offset};
+            tree.setProxyBounds(proxies[i], boxes[i]);
+        }
+        tree.refit(4);
+        expectQueriesMatch();
+
+        tree.rebuild();
+        EXPECT_EQ(tree.getProxyCount(), boxes.size());
+        for (size_t i = 0; i < proxies.size(); ++i)
+            EXPECT_EQ(tree.getUserData(proxies[i]), i);
+        expectQueriesMatch();
+    }
+
+    TEST_F(AabbTreeTest, RayCastReturnsTheClosestHit)
+    {
+        AabbTree small;
+        small.createProxy({glm::vec3(-1.0f, -1.0f, -11.0f), glm::vec3(1.0f, 1.0f, -9.0f)}, 10);
+        small.createProxy({glm::vec3(-1.0f, -1.0f, -6.0f), glm::vec3(1.0f, 1.0f, -4.0f)}, 5);
+        small.createProxy({glm::vec3(5.0f, 5.0f, -6.0f), glm::vec3(6.0f, 6.0f, -4.0f)}, 42);
+
+        const Ray ray{glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f)};
+        const AabbTree::RayHit hit = small.rayCast(ray);
+        EXPECT_EQ(hit.userData, 5);
+        EXPECT_NEAR(hit.distance, 4.0f, 1e-5f);
+
+        // The hit test can reject proxies
+        const AabbTree::RayHit filtered = small.rayCast(ray, [&](const int32_t proxy, const float entry) {
+            return small.getUserData(proxy) == 5 ? -1.0f : entry;
+        });
+        EXPECT_EQ(filtered.userData, 10);
+
+        const Ray miss{glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)};
+        EXPECT_EQ(small.rayCast(miss).proxy, AabbTree::NULL_NODE);
+    }
+
+    TEST_F(AabbTreeTest, BatchQueriesMatchSingleQueries)
+    {
+        std::vector<Sphere> spheres;
+        std::vector<Ray> rays;
+        for (int i = 0; i < 70; ++i) {
+            const auto offset = static_cast<float>(i * 3 - 100);
+            spheres.push_back({glm::vec3(offset, 0.0f, -offset), 15.0f});
+            rays.push_back({glm::vec3(offset, offset * 0.5f, -150.0f), glm::vec3(0.0f, 0.0f, 1.0f)});
+        }
+
+        std::vector<std::vector<int32_t>> batched(spheres.size());
+        tree.querySphereBatch(spheres, [&](const size_t query, const int32_t proxy) { batched[query].push_back(proxy); });
+        for (size_t i = 0; i < spheres.size(); ++i) {
+            std::vector<int32_t> single;
+            tree.querySphere(spheres[i], [&](const int32_t proxy) { single.push_back(proxy); return true; });
+            std::ranges::sort(single);
+            std::ranges::sort(batched[i]);
+            EXPECT_EQ(batched[i], single);
+        }
+
+        std::vector<AabbTree::RayHit> hits(rays.size());
+        tree.rayCastBatch(rays, hits);
+        for (size_t i = 0; i < rays.size(); ++i) {
+            // Closest exact hit found by brute force
+            float closest = std::numeric_limits<float>::max();
+            const glm::vec3 inverseDirection = 1.0f / rays[i].direction;
+            for (const auto &box : boxes)
+                if (const float distance = intersectRayAabb(rays[i].origin, inverseDirection, closest, box); distance >= 0.0f)
+                    closest = std::min(closest, distance);
+            EXPECT_FLOAT_EQ(hits[i].distance, closest);
+        }
+    }
+
+    TEST_F(AabbTreeTest, FrustumQueryFindsVisibleProxies)
+    {
+        const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, 50.0f);
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        const Frustum frustum = extractFrustum(projection * view);
+
+        std::vector<uint32_t> found;
+        tree.queryFrustum(frustum, [&](const int32_t proxy) {
+            if (isAabbVisible(frustum, tree.getBounds(proxy)))
+                found.push_back(tree.getUserData(proxy));
+            return true;
+        });
+        std::ranges::sort(found);
+
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < boxes.size(); ++i)
+            if (isAabbVisible(frustum, boxes[i]))
+                expected.push_back(i);
+        EXPECT_EQ(found, expected);
+        EXPECT_FALSE(expected.empty());
+    }
+
+}
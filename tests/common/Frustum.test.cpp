@@ -0,0 +1,108 @@
+//// Frustum.test.cpp //////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the bounding box and frustum culling utils
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <vector>
+
+#include "math/Frustum.hpp"
+#include "../utils/comparison.hpp"
+
+namespace nexo::math {
+
+    class FrustumTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                // Camera at the origin looking down -Z, near 0.1 and far 100
+                const glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+                const glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+                frustum = extractFrustum(projection * view);
+            }
+
+            static Aabb unitBoxAt(const glm::vec3 &center)
+            {
+                return {center - glm::vec3(0.5f), center + glm::vec3(0.5f)};
+            }
+
+            Frustum frustum;
+    };
+
+    TEST(AabbTest, TransformTranslatesAndScales)
+    {
+        const Aabb box{glm::vec3(-1.0f), glm::vec3(1.0f)};
+        glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(5.0f, 0.0f, -2.0f));
+        transform = glm::scale(transform, glm::vec3(2.0f, 1.0f, 3.0f));
+
+        const Aabb world = transformAabb(box, transform);
+        EXPECT_VEC3_NEAR(world.min, glm::vec3(3.0f, -1.0f, -5.0f), 0.0001f);
+        EXPECT_VEC3_NEAR(world.max, glm::vec3(7.0f, 1.0f, 1.0f), 0.0001f);
+    }
+
+    TEST(AabbTest, TransformRotationEnclosesTheBox)
+    {
+        const Aabb box{glm::vec3(-1.0f), glm::vec3(1.0f)};
+        const glm::mat4 transform = glm::rotate(glm::mat4(1.0f), glm::radians(45.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+        const Aabb world = transformAabb(box, transform);
+        const float halfDiagonal = std::sqrt(2.0f);
+        EXPECT_VEC3_NEAR(world.min, glm::vec3(-halfDiagonal, -1.0f, -halfDiagonal), 0.0001f);
+        EXPECT_VEC3_NEAR(world.max, glm::vec3(halfDiagonal, 1.0f, halfDiagonal), 0.0001f);
+    }
+
+    TEST_F(FrustumTest, BoxesInsideAndOutside)
+    {
+        EXPECT_TRUE(isAabbVisible(frustum, unitBoxAt({0.0f, 0.0f, -10.0f})));
+        EXPECT_FALSE(isAabbVisible(frustum, unitBoxAt({0.0f, 0.0f, 10.0f})));
+        EXPECT_FALSE(isAabbVisible(frustum, unitBoxAt({0.0f, 0.0f, -200.0f})));
+        EXPECT_FALSE(isAabbVisible(frustum, unitBoxAt({50.0f, 0.0f, -10.0f})));
+        EXPECT_FALSE(isAabbVisible(frustum, unitBoxAt({0.0f, -50.0f, -10.0f})));
+    }
+
+    TEST_F(FrustumTest, BoxesCrossingAPlaneAreVisible)
+    {
+        // The side planes pass through x = +-10 at z = -10
+        EXPECT_TRUE(isAabbVisible(frustum, unitBoxAt({10.3f, 0.0f, -10.0f})));
+        EXPECT_TRUE(isAabbVisible(frustum, unitBoxAt({0.0f, 0.0f, -100.2f})));
+        EXPECT_TRUE(isAabbVisible(frustum, Aabb{glm::vec3(-1000.0f), glm::vec3(1000.0f)}));
+    }
+
+    TEST_F(FrustumTest, BatchCullingMatchesSingleTests)
+    {
+        std::vector<Aabb> boxes;
+        for (int x = -30; x <= 30; x += 3)
+            for (int z = -120; z <= 20; z += 7)
+                boxes.push_back(unitBoxAt({static_cast<float>(x), 1.0f, static_cast<float>(z)}));
+
+        std::vector<uint8_t> visible(boxes.size());
+        const size_t visibleCount = cullAabbs(frustum, boxes, visible);
+
+        size_t expectedCount = 0;
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            const bool expected = isAabbVisible(frustum, boxes[i]);
+            EXPECT_EQ(visible[i] != 0, expected) << "box " << i;
+            expectedCount += expected;
+        }
+        EXPECT_EQ(visibleCount, expectedCount);
+        EXPECT_GT(visibleCount, 0);
+        EXPECT_LT(visibleCount, boxes.size());
+    }
+
+}
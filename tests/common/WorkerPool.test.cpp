@@ -0,0 +1,93 @@
+//// WorkerPool.test.cpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the persistent worker thread pool
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <barrier>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "WorkerPool.hpp"
+
+namespace nexo {
+
+    TEST(WorkerPoolTest, TasksRunConcurrentlyOnPersistentThreads)
+    {
+        WorkerPool pool(3);
+        ASSERT_EQ(pool.getThreadCount(), 4u);
+
+        std::vector<std::thread::id> firstIds(pool.getThreadCount());
+        std::vector<std::thread::id> ids(pool.getThreadCount());
+        for (int job = 0; job < 20; ++job) {
+            // Every task waits for the others, this only completes if they all run at the same time
+            std::barrier allStarted(static_cast<std::ptrdiff_t>(pool.getThreadCount()));
+            pool.run(pool.getThreadCount(), [&](const std::size_t index) {
+                allStarted.arrive_and_wait();
+                ids[index] = std::this_thread::get_id();
+            });
+            if (job == 0)
+                firstIds = ids;
+            EXPECT_EQ(ids, firstIds);
+        }
+        EXPECT_EQ(firstIds[0], std::this_thread::get_id());
+    }
+
+    TEST(WorkerPoolTest, SmallerJobsOnlyRunTheirTasks)
+    {
+        WorkerPool pool(3);
+        std::atomic<int> runs = 0;
+        for (std::size_t taskCount = 0; taskCount <= pool.getThreadCount(); ++taskCount) {
+            runs = 0;
+            pool.run(taskCount, [&](std::size_t) { ++runs; });
+            EXPECT_EQ(runs.load(), static_cast<int>(taskCount));
+        }
+    }
+
+    TEST(WorkerPoolTest, ExceptionsAreRethrownOnceEveryTaskIsDone)
+    {
+        WorkerPool pool(3);
+        for (std::size_t failing = 0; failing < pool.getThreadCount(); ++failing) {
+            std::barrier allArrived(static_cast<std::ptrdiff_t>(pool.getThreadCount()));
+            std::atomic<int> finished = 0;
+            const auto task = [&](const std::size_t index) {
+                std::exception_ptr error;
+                try {
+                    if (index == failing)
+                        throw std::runtime_error("task failed");
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                allArrived.arrive_and_wait();
+                if (error)
+                    std::rethrow_exception(error);
+                ++finished;
+            };
+            EXPECT_THROW(pool.run(pool.getThreadCount(), task), std::runtime_error);
+            EXPECT_EQ(finished.load(), static_cast<int>(pool.getThreadCount()) - 1);
+        }
+
+        // The pool stays usable after a failed job
+        std::atomic<int> runs = 0;
+        pool.run(pool.getThreadCount(), [&](std::size_t) { ++runs; });
+        EXPECT_EQ(runs.load(), static_cast<int>(pool.getThreadCount()));
+    }
+
+}
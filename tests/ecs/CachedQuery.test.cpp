@@ -0,0 +1,153 @@
+//// CachedQuery.test.cpp //////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the CachedQuery class
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "CachedQuery.hpp"
+#include "Coordinator.hpp"
+
+namespace nexo::ecs {
+
+    struct CachedQueryLight {
+        float intensity;
+    };
+
+    struct CachedQuerySceneTag {
+        unsigned int id;
+    };
+
+    class CachedQueryTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                coordinator = std::make_shared<Coordinator>();
+                coordinator->init();
+                coordinator->registerComponent<CachedQueryLight>();
+                coordinator->registerComponent<CachedQuerySceneTag>();
+            }
+
+            static bool contains(const std::span<const Entity> entities, const Entity entity)
+            {
+                return std::ranges::find(entities, entity) != entities.end();
+            }
+
+            std::shared_ptr<Coordinator> coordinator;
+    };
+
+    TEST_F(CachedQueryTest, ExistingEntitiesAreReportedAsAdded)
+    {
+        const Entity light = coordinator->createEntity();
+        coordinator->addComponent(light, CachedQueryLight{1.0f});
+        coordinator->addComponent(light, CachedQuerySceneTag{0});
+
+        const auto query = coordinator->registerCachedQuery<CachedQueryLight, CachedQuerySceneTag>();
+        EXPECT_TRUE(query->entities().contains(light));
+        EXPECT_TRUE(query->hasChanges());
+        EXPECT_TRUE(contains(query->added(), light));
+        EXPECT_TRUE(query->removed().empty());
+
+        query->clearChanges();
+        EXPECT_FALSE(query->hasChanges());
+        EXPECT_TRUE(query->entities().contains(light));
+    }
+
+    TEST_F(CachedQueryTest, TracksSignatureChanges)
+    {
+        const auto query = coordinator->registerCachedQuery<CachedQueryLight, CachedQuerySceneTag>();
+
+        const Entity light = coordinator->createEntity();
+        coordinator->addComponent(light, CachedQueryLight{1.0f});
+        EXPECT_FALSE(query->hasChanges());
+
+        coordinator->addComponent(light, CachedQuerySceneTag{0});
+        EXPECT_TRUE(contains(query->added(), light));
+        query->clearChanges();
+
+        coordinator->removeComponent<CachedQueryLight>(light);
+        EXPECT_FALSE(query->entities().contains(light));
+        EXPECT_TRUE(contains(query->removed(), light));
+        EXPECT_TRUE(query->added().empty());
+    }
+
+    TEST_F(CachedQueryTest, ExcludedComponentsAreFilteredOut)
+    {
+        const auto query = coordinator->registerCachedQuery<CachedQueryLight, Exclude<CachedQuerySceneTag>>();
+
+        const Entity light = coordinator->createEntity();
+        coordinator->addComponent(light, CachedQueryLight{1.0f});
+        EXPECT_TRUE(query->entities().contains(light));
+        query->clearChanges();
+
+        coordinator->addComponent(light, CachedQuerySceneTag{0});
+        EXPECT_FALSE(query->entities().contains(light));
+        EXPECT_TRUE(contains(query->removed(), light));
+        query->clearChanges();
+
+        coordinator->removeComponent<CachedQuerySceneTag>(light);
+        EXPECT_TRUE(contains(query->added(), light));
+    }
+
+    TEST_F(CachedQueryTest, DestroyedEntitiesAreReportedAsRemoved)
+    {
+        const auto query = coordinator->registerCachedQuery<CachedQueryLight>();
+        const Entity light = coordinator->createEntity();
+        coordinator->addComponent(light, CachedQueryLight{1.0f});
+        query->clearChanges();
+
+        coordinator->destroyEntity(light);
+        EXPECT_EQ(query->entities().size(), 0);
+        EXPECT_TRUE(contains(query->removed(), light));
+    }
+
+    TEST_F(CachedQueryTest, TransientMatchesAreNotReported)
+    {
+        const auto query = coordinator->registerCachedQuery<CachedQueryLight>();
+        const Entity light = coordinator->createEntity();
+        coordinator->addComponent(light, CachedQueryLight{1.0f});
+        coordinator->destroyEntity(light);
+
+        EXPECT_FALSE(query->hasChanges());
+    }
+
+    TEST_F(CachedQueryTest, RematchedEntityIsReportedBothRemovedAndAdded)
+    {
+        const auto query = coordinator->registerCachedQuery<CachedQueryLight>();
+        const Entity light = coordinator->createEntity();
+        coordinator->addComponent(light, CachedQueryLight{1.0f});
+        query->clearChanges();
+
+        coordinator->removeComponent<CachedQueryLight>(light);
+        coordinator->addComponent(light, CachedQueryLight{2.0f});
+        EXPECT_TRUE(query->entities().contains(light));
+        EXPECT_TRUE(contains(query->removed(), light));
+        EXPECT_TRUE(contains(query->added(), light));
+    }
+
+    TEST_F(CachedQueryTest, ReleasedQueryIsNoLongerUpdated)
+    {
+        auto query = coordinator->registerCachedQuery<CachedQueryLight>();
+        const std::weak_ptr<CachedQuery> weakQuery = query;
+        query.reset();
+        EXPECT_TRUE(weakQuery.expired());
+
+        const Entity light = coordinator->createEntity();
+        EXPECT_NO_THROW(coordinator->addComponent(light, CachedQueryLight{1.0f}));
+    }
+
+}
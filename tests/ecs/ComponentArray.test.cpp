@@ -20,6 +20,10 @@
 #include "ComponentArray.hpp"
 #include "ECSExceptions.hpp"
 
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
 namespace nexo::ecs {
 
     struct TestComponent {
@@ -389,4 +393,152 @@ namespace nexo::ecs {
         EXPECT_EQ(componentArray->get(2).value, 20);
         EXPECT_EQ(componentArray->get(4).value, 40);
     }
+
+    // =========================================================
+    // ============= TYPE ERASED COMPONENT ARRAY ===============
+    // =========================================================
+
+    struct ScriptedParticle {
+        float position[3];
+        int32_t lifetime;
+    };
+
+    static std::vector<Field> scriptedParticleFields()
+    {
+        return {
+            {"Particle", FieldType::Section, 0, 0},
+            {"position", FieldType::Vector3, sizeof(float) * 3, offsetof(ScriptedParticle, position)},
+            {"lifetime", FieldType::Int32, sizeof(int32_t), offsetof(ScriptedParticle, lifetime)},
+        };
+    }
+
+    TEST(TypeErasedComponentArrayTest, ComponentsAreAligned) {
+        TypeErasedComponentArray array(sizeof(int32_t) * 3, 4, 16);
+        EXPECT_EQ(array.getAlignment(), 16);
+        EXPECT_EQ(array.getStride(), 16);
+
+        const int32_t component[3] = {1, 2, 3};
+        for (Entity e = 0; e < 10; ++e)
+            array.insert(e, component);
+        for (Entity e = 0; e < 10; ++e) {
+            const void *raw = array.getRawComponent(e);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(raw) % 16, 0u);
+            EXPECT_EQ(std::memcmp(raw, component, sizeof(component)), 0);
+        }
+
+        // Natural alignment is deduced from the size when none is given
+        const TypeErasedComponentArray natural(12);
+        EXPECT_EQ(natural.getAlignment(), 4);
+        EXPECT_EQ(natural.getStride(), 12);
+
+        EXPECT_THROW(TypeErasedComponentArray(12, 4, 3), std::invalid_argument);
+    }
+
+    TEST(TypeErasedComponentArrayTest, BatchInsertAndRemove) {
+        TypeErasedComponentArray array(sizeof(ScriptedParticle), 2);
+        std::vector<Entity> entities;
+        std::vector<ScriptedParticle> particles;
+        for (Entity e = 0; e < 100; ++e) {
+            entities.push_back(e);
+            particles.push_back({{static_cast<float>(e), 0.0f, 0.0f}, static_cast<int32_t>(e)});
+        }
+
+        array.insertRawBatch(entities, particles.data());
+        ASSERT_EQ(array.size(), 100);
+
+        // Remove the even entities in one go
+        std::vector<Entity> even;
+        for (Entity e = 0; e < 100; e += 2)
+            even.push_back(e);
+        array.removeBatch(even);
+        ASSERT_EQ(array.size(), 50);
+
+        for (Entity e = 0; e < 100; ++e) {
+            EXPECT_EQ(array.hasComponent(e), e % 2 == 1);
+            if (e % 2 == 1) {
+                const auto *particle = static_cast<const ScriptedParticle *>(array.getRawComponent(e));
+                EXPECT_EQ(particle->lifetime, static_cast<int32_t>(e));
+            }
+        }
+        EXPECT_THROW(array.removeBatch(even), ComponentNotFound);
+    }
+
+    TEST(TypeErasedComponentArrayTest, RawRangeFollowsDenseOrder) {
+        TypeErasedComponentArray array(sizeof(ScriptedParticle));
+        for (Entity e = 0; e < 5; ++e) {
+            const ScriptedParticle particle{{0.0f, 0.0f, 0.0f}, static_cast<int32_t>(e * 10)};
+            array.insert(e, &particle);
+        }
+        array.remove(1);
+
+        const auto range = array.getRawRange(1, 3);
+        ASSERT_EQ(range.size(), 3 * array.getStride());
+        for (size_t i = 0; i < 3; ++i) {
+            const auto *particle = reinterpret_cast<const ScriptedParticle *>(range.data() + i * array.getStride());
+            EXPECT_EQ(particle->lifetime, static_cast<int32_t>(array.entities()[i + 1] * 10));
+        }
+        EXPECT_THROW(static_cast<void>(array.getRawRange(2, 4)), OutOfRange);
+        EXPECT_THROW(static_cast<void>(array.getFieldData(0)), InternalError);
+    }
+
+    TEST(TypeErasedComponentArrayTest, StructOfArraysStoresFieldsContiguously) {
+        const auto fields = scriptedParticleFields();
+        TypeErasedComponentArray array(sizeof(ScriptedParticle), fields, 2);
+        EXPECT_EQ(array.getLayout(), ComponentLayout::StructOfArrays);
+
+        for (Entity e = 0; e < 20; ++e) {
+            const ScriptedParticle particle{{static_cast<float>(e), 1.0f, 2.0f}, static_cast<int32_t>(e)};
+            array.insert(e, &particle);
+        }
+        array.remove(3);
+        EXPECT_EQ(array.getRawComponent(4), nullptr);
+        EXPECT_EQ(array.getFieldData(0).size(), 0);
+
+        const auto positions = array.getFieldData(1);
+        const auto lifetimes = array.getFieldData(2);
+        ASSERT_EQ(positions.size(), array.size() * sizeof(float) * 3);
+        ASSERT_EQ(lifetimes.size(), array.size() * sizeof(int32_t));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(lifetimes.data()) % 64, 0u);
+
+        const auto *lifetime = reinterpret_cast<const int32_t *>(lifetimes.data());
+        const auto *position = reinterpret_cast<const float *>(positions.data());
+        for (size_t i = 0; i < array.size(); ++i) {
+            EXPECT_EQ(lifetime[i], static_cast<int32_t>(array.entities()[i]));
+            EXPECT_EQ(position[i * 3], static_cast<float>(array.entities()[i]));
+        }
+
+        // Components can still be read and written whole
+        ScriptedParticle particle{};
+        array.readComponent(7, &particle);
+        EXPECT_EQ(particle.lifetime, 7);
+        EXPECT_FLOAT_EQ(particle.position[2], 2.0f);
+        particle.lifetime = 70;
+        array.writeComponent(7, &particle);
+        array.duplicateComponent(7, 42);
+        ScriptedParticle copy{};
+        array.readComponent(42, &copy);
+        EXPECT_EQ(copy.lifetime, 70);
+    }
+
+    TEST(TypeErasedComponentArrayTest, StructOfArraysKeepsGroupsConsistent) {
+        const auto fields = scriptedParticleFields();
+        TypeErasedComponentArray array(sizeof(ScriptedParticle), fields);
+        for (Entity e = 0; e < 6; ++e) {
+            const ScriptedParticle particle{{static_cast<float>(e), 0.0f, 0.0f}, static_cast<int32_t>(e)};
+            array.insert(e, &particle);
+        }
+        array.addToGroup(4);
+        array.addToGroup(2);
+        array.remove(4);
+
+        const auto *lifetime = reinterpret_cast<const int32_t *>(array.getFieldData(2).data());
+        for (size_t i = 0; i < array.size(); ++i)
+            EXPECT_EQ(lifetime[i], static_cast<int32_t>(array.entities()[i]));
+        EXPECT_EQ(array.entities()[0], 2);
+    }
+
+    TEST(TypeErasedComponentArrayTest, InvalidFieldIsRejected) {
+        const std::vector<Field> fields = {{"tooFar", FieldType::Int64, 8, 12}};
+        EXPECT_THROW(TypeErasedComponentArray(16, fields), std::invalid_argument);
+    }
 }
@@ -19,6 +19,7 @@
 #include "Components.hpp"
 #include "Definitions.hpp"
 #include "ECSExceptions.hpp"
+#include <set>
 #include <string>
 
 namespace nexo::ecs {
@@ -319,6 +320,25 @@ namespace nexo::ecs {
 	    EXPECT_NE(hasher(key1), hasher(key3));
 	}
 
+	TEST_F(GroupKeyTest, GroupKeyNesting) {
+	    GroupKey outer;
+	    outer.ownedSignature.set(0);
+	    outer.nonOwnedSignature.set(1);
+
+	    // Owning more components and excluding one more keeps the group nested
+	    GroupKey inner = outer;
+	    inner.ownedSignature.set(2);
+	    inner.excludedSignature.set(3);
+	    EXPECT_TRUE(inner.isNestedIn(outer));
+	    EXPECT_FALSE(outer.isNestedIn(inner));
+	    EXPECT_FALSE(outer.isNestedIn(outer));
+
+	    // Dropping a required component of the outer group breaks the nesting
+	    GroupKey disjoint = inner;
+	    disjoint.nonOwnedSignature.reset(1);
+	    EXPECT_FALSE(disjoint.isNestedIn(outer));
+	}
+
 	TEST_F(ComponentManagerTest, HasCommonOwnedComponents) {
 	    GroupKey key1, key2, key3;
 
@@ -488,7 +508,7 @@ namespace nexo::ecs {
 		signature.set(getComponentTypeID<TestComponentB>());
 
 		Signature newSignature = signature;
-		signature.set(getComponentTypeID<TestComponentA>(), false);
+		newSignature.set(getComponentTypeID<TestComponentA>(), false);
 
 	    // Remove some entities
 	    for (Entity e = 1; e <= 5; e += 2) {
@@ -613,4 +633,190 @@ namespace nexo::ecs {
 	    EXPECT_EQ(componentManager.getComponentArray<TestComponentC>()->size(), 2);
 	    EXPECT_EQ(componentManager.getComponentArray<TestComponentD>()->size(), 2);
 	}
+
+	// =========================================================
+	// ============ EXCLUDED AND NESTED GROUPS =================
+	// =========================================================
+
+	TEST_F(ComponentManagerTest, GroupFiltersOutExcludedComponents) {
+	    Signature withAB;
+	    withAB.set(getComponentTypeID<TestComponentA>());
+	    componentManager.addComponent<TestComponentA>(1, TestComponentA(1), Signature{}, withAB);
+	    componentManager.addComponent<TestComponentA>(2, TestComponentA(2), Signature{}, withAB);
+	    Signature withA = withAB;
+	    withAB.set(getComponentTypeID<TestComponentB>());
+	    componentManager.addComponent<TestComponentB>(1, TestComponentB(), withA, withAB);
+	    componentManager.addComponent<TestComponentB>(2, TestComponentB(), withA, withAB);
+	    Signature withABC = withAB;
+	    withABC.set(getComponentTypeID<TestComponentC>());
+	    componentManager.addComponent<TestComponentC>(2, TestComponentC("excluded"), withAB, withABC);
+
+	    // Entities already owning the excluded component are skipped at registration
+	    auto group = componentManager.registerGroup<TestComponentA>(get<TestComponentB>(), exclude<TestComponentC>());
+	    ASSERT_EQ(group->size(), 1);
+	    EXPECT_EQ(group->entities()[0], 1);
+
+	    // Adding the excluded component removes the entity from the group
+	    componentManager.addComponent<TestComponentC>(1, TestComponentC("excluded"), withAB, withABC);
+	    EXPECT_EQ(group->size(), 0);
+
+	    // Removing it adds the entity back
+	    componentManager.removeComponent<TestComponentC>(2, withABC, withAB);
+	    ASSERT_EQ(group->size(), 1);
+	    EXPECT_EQ(group->entities()[0], 2);
+
+	    // Same key without exclusion is a different group
+	    auto unfiltered = componentManager.registerGroup<TestComponentA>(get<TestComponentB>());
+	    EXPECT_NE(static_cast<void *>(unfiltered.get()), static_cast<void *>(group.get()));
+	    EXPECT_EQ(unfiltered->size(), 2);
+	}
+
+	TEST_F(ComponentManagerTest, NestedGroupsShareOwnedComponents) {
+	    auto outer = componentManager.registerGroup<TestComponentA>(get<>());
+
+	    Signature signatures[7];
+	    for (Entity e = 1; e <= 6; ++e) {
+	        const Signature previous = signatures[e];
+	        signatures[e].set(getComponentTypeID<TestComponentA>());
+	        componentManager.addComponent<TestComponentA>(e, TestComponentA(static_cast<int>(e)), previous, signatures[e]);
+	        if (e % 2 == 0) {
+	            const Signature withoutB = signatures[e];
+	            signatures[e].set(getComponentTypeID<TestComponentB>());
+	            componentManager.addComponent<TestComponentB>(e, TestComponentB(), withoutB, signatures[e]);
+	        }
+	    }
+
+	    // Owning A and B is more restrictive than owning A only, both groups can coexist
+	    auto inner = componentManager.registerGroup<TestComponentA, TestComponentB>(get<>());
+	    EXPECT_TRUE(outer->isNesting());
+	    EXPECT_FALSE(inner->isNesting());
+
+	    const auto checkNesting = [&](const std::set<Entity>& expectedOuter, const std::set<Entity>& expectedInner) {
+	        const auto outerEntities = outer->entities();
+	        const auto innerEntities = inner->entities();
+	        EXPECT_EQ(std::set<Entity>(outerEntities.begin(), outerEntities.end()), expectedOuter);
+	        EXPECT_EQ(std::set<Entity>(innerEntities.begin(), innerEntities.end()), expectedInner);
+	        // The inner group region is a prefix of the outer group region
+	        ASSERT_LE(innerEntities.size(), outerEntities.size());
+	        for (size_t i = 0; i < innerEntities.size(); ++i)
+	            EXPECT_EQ(innerEntities[i], outerEntities[i]);
+	        // Components stay aligned with their entities
+	        const auto values = outer->get<TestComponentA>();
+	        for (size_t i = 0; i < outerEntities.size(); ++i)
+	            EXPECT_EQ(values[i].value, static_cast<int>(outerEntities[i]));
+	    };
+	    checkNesting({1, 2, 3, 4, 5, 6}, {2, 4, 6});
+
+	    // Joining the inner group keeps the entity in the outer one
+	    Signature previous = signatures[3];
+	    signatures[3].set(getComponentTypeID<TestComponentB>());
+	    componentManager.addComponent<TestComponentB>(3, TestComponentB(), previous, signatures[3]);
+	    checkNesting({1, 2, 3, 4, 5, 6}, {2, 3, 4, 6});
+
+	    // Leaving both groups at once
+	    previous = signatures[4];
+	    signatures[4].reset(getComponentTypeID<TestComponentA>());
+	    componentManager.removeComponent<TestComponentA>(4, previous, signatures[4]);
+	    checkNesting({1, 2, 3, 5, 6}, {2, 3, 6});
+
+	    // Leaving the inner group only
+	    previous = signatures[2];
+	    signatures[2].reset(getComponentTypeID<TestComponentB>());
+	    componentManager.removeComponent<TestComponentB>(2, previous, signatures[2]);
+	    checkNesting({1, 2, 3, 5, 6}, {3, 6});
+
+	    componentManager.entityDestroyed(6, signatures[6]);
+	    checkNesting({1, 2, 3, 5}, {3});
+
+	    // Only the most restrictive group of the family can be reordered
+	    const auto byValue = [](const TestComponentA& a) { return a.value; };
+	    EXPECT_NO_THROW((inner->sortBy<TestComponentA, int>(byValue)));
+	    EXPECT_THROW((outer->sortBy<TestComponentA, int>(byValue)), InternalError);
+	}
+
+	TEST_F(ComponentManagerTest, NestedGroupCanBeRegisteredFirst) {
+	    auto inner = componentManager.registerGroup<TestComponentA, TestComponentB>(get<>());
+	    for (Entity e = 1; e <= 4; ++e) {
+	        Signature signature;
+	        signature.set(getComponentTypeID<TestComponentA>());
+	        componentManager.addComponent<TestComponentA>(e, TestComponentA(static_cast<int>(e)), Signature{}, signature);
+	        if (e >= 3) {
+	            const Signature withoutB = signature;
+	            signature.set(getComponentTypeID<TestComponentB>());
+	            componentManager.addComponent<TestComponentB>(e, TestComponentB(), withoutB, signature);
+	        }
+	    }
+
+	    auto outer = componentManager.registerGroup<TestComponentA>(get<>());
+	    EXPECT_TRUE(outer->isNesting());
+	    ASSERT_EQ(inner->size(), 2);
+	    ASSERT_EQ(outer->size(), 4);
+	    for (size_t i = 0; i < inner->size(); ++i)
+	        EXPECT_EQ(inner->entities()[i], outer->entities()[i]);
+	}
+
+	TEST_F(ComponentManagerTest, ThreeLevelNestingOnlyReordersInnermostGroup) {
+	    auto outer = componentManager.registerGroup<TestComponentA>(get<>());
+	    auto inner = componentManager.registerGroup<TestComponentA, TestComponentB, TestComponentC>(get<>());
+
+	    // Entities own A, every other one B as well and every third one C on top of it
+	    Signature signatures[13];
+	    const auto add = [&]<typename T>(Entity e, T component) {
+	        const Signature previous = signatures[e];
+	        signatures[e].set(getComponentTypeID<T>());
+	        componentManager.addComponent<T>(e, component, previous, signatures[e]);
+	    };
+	    for (Entity e = 1; e <= 12; ++e) {
+	        add(e, TestComponentA(static_cast<int>(12 - e)));
+	        if (e % 2 == 0)
+	            add(e, TestComponentB());
+	        if (e % 6 == 0)
+	            add(e, TestComponentC());
+	    }
+
+	    // Registering the middle group last slots it between the two others
+	    auto middle = componentManager.registerGroup<TestComponentA, TestComponentB>(get<>());
+	    EXPECT_TRUE(outer->isNesting());
+	    EXPECT_TRUE(middle->isNesting());
+	    EXPECT_FALSE(inner->isNesting());
+
+	    const auto checkChain = [&](const std::set<Entity>& expectedInner, const std::set<Entity>& expectedMiddle) {
+	        const auto outerEntities = outer->entities();
+	        const auto middleEntities = middle->entities();
+	        const auto innerEntities = inner->entities();
+	        EXPECT_EQ(std::set<Entity>(middleEntities.begin(), middleEntities.end()), expectedMiddle);
+	        EXPECT_EQ(std::set<Entity>(innerEntities.begin(), innerEntities.end()), expectedInner);
+	        ASSERT_LE(innerEntities.size(), middleEntities.size());
+	        ASSERT_LE(middleEntities.size(), outerEntities.size());
+	        for (size_t i = 0; i < middleEntities.size(); ++i)
+	            EXPECT_EQ(middleEntities[i], outerEntities[i]);
+	        for (size_t i = 0; i < innerEntities.size(); ++i)
+	            EXPECT_EQ(innerEntities[i], middleEntities[i]);
+	        const auto values = outer->get<TestComponentA>();
+	        for (size_t i = 0; i < outerEntities.size(); ++i)
+	            EXPECT_EQ(values[i].value, static_cast<int>(12 - outerEntities[i]));
+	    };
+	    checkChain({6, 12}, {2, 4, 6, 8, 10, 12});
+
+	    // Joining the innermost group moves the entity through every prefix
+	    add(4, TestComponentC());
+	    checkChain({4, 6, 12}, {2, 4, 6, 8, 10, 12});
+
+	    // Leaving the middle group releases the entity from the innermost one first
+	    Signature previous = signatures[6];
+	    signatures[6].reset(getComponentTypeID<TestComponentB>());
+	    componentManager.removeComponent<TestComponentB>(6, previous, signatures[6]);
+	    checkChain({4, 12}, {2, 4, 8, 10, 12});
+
+	    componentManager.entityDestroyed(12, signatures[12]);
+	    checkChain({4}, {2, 4, 8, 10});
+
+	    // Sorting the innermost group keeps every region in place, the containing groups can not be reordered
+	    const auto byValue = [](const TestComponentA& a) { return a.value; };
+	    EXPECT_NO_THROW((inner->sortBy<TestComponentA, int>(byValue)));
+	    EXPECT_THROW((middle->sortBy<TestComponentA, int>(byValue)), InternalError);
+	    EXPECT_THROW((middle->getPartitionView<TestComponentA, int>(byValue)), InternalError);
+	    EXPECT_THROW((outer->sortBy<TestComponentA, int>(byValue)), InternalError);
+	    checkChain({4}, {2, 4, 8, 10});
+	}
 }
@@ -24,6 +24,11 @@
 #include "ecs/Definitions.hpp"
 #include "ecs/System.hpp"
 #include "ecs/Entity.hpp"
+#include "ecs/QuerySystem.hpp"
+
+#include <array>
+#include <stdexcept>
+#include <thread>
 
 namespace nexo::ecs {
     // Mock Component for testing
@@ -36,7 +41,18 @@ namespace nexo::ecs {
     };
 
     struct ComponentB {
-        float data;
+        inline static bool throwOnMove = false;
+        float data = 0.0f;
+
+        ComponentB(const float d = 0.0f) : data(d) {}
+        ComponentB(const ComponentB&) = default;
+        ComponentB(ComponentB&& other) : data(other.data)
+        {
+            if (throwOnMove)
+                throw std::runtime_error("component move failed");
+        }
+        ComponentB& operator=(const ComponentB&) = default;
+        ComponentB& operator=(ComponentB&&) = default;
     };
 
     struct TestSingletonComponent {
@@ -52,14 +68,14 @@ namespace nexo::ecs {
     class CoordinatorTest : public ::testing::Test {
         protected:
         void SetUp() override {
-            coordinator = std::make_unique<Coordinator>();
+            coordinator = std::make_shared<Coordinator>();
             coordinator->init();
 
             coordinator->registerComponent<ComponentA>();
             coordinator->registerComponent<ComponentB>();
         }
 
-        std::unique_ptr<Coordinator> coordinator;
+        std::shared_ptr<Coordinator> coordinator;
     };
 
     TEST_F(CoordinatorTest, Initialization) {
@@ -455,4 +471,258 @@ namespace nexo::ecs {
         types = coordinator->getAllComponentTypes(entity);
         EXPECT_EQ(types.size(), 3);
     }
+
+    struct NamedComponent {
+        struct Memento {
+            std::string name;
+        };
+
+        [[nodiscard]] Memento save() const { return {name}; }
+        void restore(const Memento &memento) { name = memento.name; }
+
+        std::string name;
+    };
+
+    TEST_F(CoordinatorTest, ComponentVTableDescribesType) {
+        coordinator->registerComponent<NamedComponent>();
+
+        const ComponentVTable *vtable = coordinator->getComponentVTable(coordinator->getComponentType<NamedComponent>());
+        ASSERT_NE(vtable, nullptr);
+        EXPECT_EQ(vtable, &getComponentVTable<NamedComponent>());
+        EXPECT_EQ(*vtable->typeInfo, typeid(NamedComponent));
+        EXPECT_EQ(vtable->size, sizeof(NamedComponent));
+        EXPECT_EQ(vtable->align, alignof(NamedComponent));
+        EXPECT_TRUE(vtable->supportsMemento());
+        EXPECT_FALSE(getComponentVTable<ComponentA>().supportsMemento());
+    }
+
+    TEST_F(CoordinatorTest, ForEachComponentVisitsComponentsInPlace) {
+        Entity entity = coordinator->createEntity();
+        coordinator->addComponent(entity, ComponentA{7});
+        coordinator->addComponent(entity, ComponentB{1.5f});
+
+        int visited = 0;
+        coordinator->forEachComponent(entity, [&](const ComponentType type, const ComponentVTable &vtable, void *component) {
+            ++visited;
+            if (type == coordinator->getComponentType<ComponentA>()) {
+                EXPECT_EQ(*vtable.typeInfo, typeid(ComponentA));
+                EXPECT_EQ(component, &coordinator->getComponent<ComponentA>(entity));
+            } else {
+                EXPECT_EQ(*vtable.typeInfo, typeid(ComponentB));
+                EXPECT_EQ(component, &coordinator->getComponent<ComponentB>(entity));
+            }
+        });
+        EXPECT_EQ(visited, 2);
+    }
+
+    TEST_F(CoordinatorTest, ComponentMementoRestoresThroughRawAdd) {
+        coordinator->registerComponent<NamedComponent>();
+        const ComponentType type = coordinator->getComponentType<NamedComponent>();
+
+        Entity source = coordinator->createEntity();
+        coordinator->addComponent(source, NamedComponent{"a name long enough to not fit in the small string buffer"});
+
+        ComponentMemento memento(*coordinator->getComponentVTable(type), &coordinator->getComponent<NamedComponent>(source));
+        coordinator->destroyEntity(source);
+
+        // Moving the memento keeps the saved state alive
+        ComponentMemento moved(std::move(memento));
+        EXPECT_TRUE(memento.empty());
+        ASSERT_FALSE(moved.empty());
+
+        Entity target = coordinator->createEntity();
+        moved.restore([&](const void *component) {
+            coordinator->addComponent(target, type, component);
+        });
+        EXPECT_EQ(coordinator->getComponent<NamedComponent>(target).name,
+                  "a name long enough to not fit in the small string buffer");
+    }
+
+    struct LargeMementoComponent {
+        struct Memento {
+            std::array<std::byte, ComponentMemento::InlineCapacity * 2> data;
+        };
+
+        [[nodiscard]] Memento save() const
+        {
+            if (throwOnSave)
+                throw std::runtime_error("memento save failed");
+            return {};
+        }
+        void restore(const Memento &) {}
+
+        bool throwOnSave = false;
+    };
+
+    TEST_F(CoordinatorTest, ComponentMementoPropagatesAFailedHeapSave) {
+        const ComponentVTable &vtable = getComponentVTable<LargeMementoComponent>();
+        ASSERT_GT(vtable.mementoSize, ComponentMemento::InlineCapacity);
+
+        // The memento is saved out of line, its buffer is released when saving throws
+        const LargeMementoComponent failing{true};
+        EXPECT_THROW(ComponentMemento(vtable, &failing), std::runtime_error);
+
+        const LargeMementoComponent component{};
+        const ComponentMemento memento(vtable, &component);
+        EXPECT_FALSE(memento.empty());
+    }
+
+    class WorldQuerySystem : public QuerySystem<Read<ComponentA>> {};
+
+    TEST_F(CoordinatorTest, SystemsAreBoundToTheirWorld) {
+        auto otherWorld = std::make_shared<Coordinator>();
+        otherWorld->init();
+        otherWorld->registerComponentsFrom(*coordinator);
+        // init() made the other world current, systems registered through a coordinator still bind to it
+        const auto liveSystem = coordinator->registerQuerySystem<WorldQuerySystem>();
+        const auto otherSystem = otherWorld->registerQuerySystem<WorldQuerySystem>();
+        EXPECT_EQ(liveSystem->coord, coordinator);
+        EXPECT_EQ(otherSystem->coord, otherWorld);
+
+        const Entity entity = otherWorld->createEntity();
+        otherWorld->addComponent(entity, ComponentA{1});
+        EXPECT_TRUE(otherSystem->entities.contains(entity));
+        EXPECT_FALSE(liveSystem->entities.contains(entity));
+
+        {
+            const WorldScope scope(liveSystem->coord);
+            EXPECT_EQ(System::currentWorld(), coordinator);
+        }
+        EXPECT_EQ(System::currentWorld(), otherWorld);
+
+        // Systems share the ownership of their world, it outlives every other handle
+        const std::weak_ptr<Coordinator> weakOtherWorld = otherWorld;
+        otherWorld.reset();
+        System::currentWorld().reset();
+        EXPECT_FALSE(weakOtherWorld.expired());
+        EXPECT_TRUE(otherSystem->coord->entityHasComponent<ComponentA>(entity));
+    }
+
+    TEST_F(CoordinatorTest, WorldBuiltOnAnotherThreadCanBeMerged) {
+        const Entity existing = coordinator->createEntity();
+        coordinator->addComponent(existing, ComponentA{-1});
+        const auto query = coordinator->registerCachedQuery<ComponentA, ComponentB>();
+        auto group = coordinator->registerGroup<ComponentA>(get<ComponentB>());
+
+        Coordinator loadingWorld;
+        std::thread loader([&] {
+            loadingWorld.init();
+            loadingWorld.registerComponentsFrom(*coordinator);
+            loadingWorld.setThreadAffinity(std::this_thread::get_id());
+            for (int i = 0; i < 10; ++i) {
+                const Entity entity = loadingWorld.createEntity();
+                loadingWorld.addComponent(entity, ComponentA{i});
+                if (i % 2 == 0)
+                    loadingWorld.addComponent(entity, ComponentB{static_cast<float>(i)});
+            }
+            // Hand the world over to the thread merging it
+            loadingWorld.setThreadAffinity({});
+        });
+        loader.join();
+
+        const auto mapping = coordinator->mergeWorld(loadingWorld);
+        EXPECT_TRUE(loadingWorld.getAllEntitiesWith<ComponentA>().empty());
+
+        const auto merged = coordinator->getAllEntitiesWith<ComponentA>();
+        ASSERT_EQ(merged.size(), 11);
+        for (Entity source = 0; source < mapping.size(); ++source) {
+            const Entity entity = mapping[source];
+            ASSERT_NE(entity, INVALID_ENTITY);
+            EXPECT_NE(entity, existing);
+            const int value = coordinator->getComponent<ComponentA>(entity).value;
+            EXPECT_EQ(coordinator->entityHasComponent<ComponentB>(entity), value % 2 == 0);
+        }
+
+        // Groups and cached queries of the live world see the merged entities
+        EXPECT_EQ(group->size(), 5);
+        EXPECT_EQ(query->added().size(), 5);
+        for (const Entity entity : group->entities())
+            EXPECT_FLOAT_EQ(coordinator->getComponent<ComponentB>(entity).data,
+                            static_cast<float>(coordinator->getComponent<ComponentA>(entity).value));
+    }
+
+    TEST_F(CoordinatorTest, BatchRemovalOfAMissingComponentChangesNothing) {
+        const Entity complete = coordinator->createEntity();
+        coordinator->addComponent(complete, ComponentA{1});
+        coordinator->addComponent(complete, ComponentB{1.0f});
+        const Entity partial = coordinator->createEntity();
+        coordinator->addComponent(partial, ComponentA{2});
+        auto group = coordinator->registerGroup<ComponentA>(get<ComponentB>());
+        ASSERT_EQ(group->size(), 1);
+
+        const std::array entities = {complete, partial};
+        EXPECT_THROW(coordinator->removeComponents(entities, coordinator->getComponentType<ComponentB>()), ComponentNotFound);
+
+        // The check happens before the groups, arrays and signatures are touched
+        EXPECT_TRUE(coordinator->entityHasComponent<ComponentB>(complete));
+        EXPECT_FLOAT_EQ(coordinator->getComponent<ComponentB>(complete).data, 1.0f);
+        EXPECT_EQ(group->size(), 1);
+        EXPECT_EQ(group->entities()[0], complete);
+    }
+
+    TEST_F(CoordinatorTest, BatchRemovalWithADuplicateEntityChangesNothing) {
+        const Entity first = coordinator->createEntity();
+        coordinator->addComponent(first, ComponentA{1});
+        coordinator->addComponent(first, ComponentB{1.0f});
+        const Entity second = coordinator->createEntity();
+        coordinator->addComponent(second, ComponentA{2});
+        coordinator->addComponent(second, ComponentB{2.0f});
+        auto group = coordinator->registerGroup<ComponentA>(get<ComponentB>());
+        ASSERT_EQ(group->size(), 2);
+
+        const std::array entities = {first, second, first};
+        EXPECT_THROW(coordinator->removeComponents(entities, coordinator->getComponentType<ComponentB>()), DuplicateEntity);
+
+        EXPECT_TRUE(coordinator->entityHasComponent<ComponentB>(first));
+        EXPECT_TRUE(coordinator->entityHasComponent<ComponentB>(second));
+        EXPECT_FLOAT_EQ(coordinator->getComponent<ComponentB>(second).data, 2.0f);
+        EXPECT_EQ(group->size(), 2);
+    }
+
+    TEST_F(CoordinatorTest, FailedMergeLeavesTheWorldUnchanged) {
+        const Entity existing = coordinator->createEntity();
+        coordinator->addComponent(existing, ComponentA{-1});
+        auto group = coordinator->registerGroup<ComponentA>(get<>());
+
+        Coordinator loadingWorld;
+        loadingWorld.init();
+        loadingWorld.registerComponentsFrom(*coordinator);
+        for (int i = 0; i < 4; ++i) {
+            const Entity entity = loadingWorld.createEntity();
+            loadingWorld.addComponent(entity, ComponentA{i});
+            loadingWorld.addComponent(entity, ComponentB{static_cast<float>(i)});
+        }
+
+        // ComponentA is moved before moving ComponentB fails
+        ComponentB::throwOnMove = true;
+        EXPECT_THROW(coordinator->mergeWorld(loadingWorld), std::runtime_error);
+        ComponentB::throwOnMove = false;
+
+        EXPECT_EQ(coordinator->getAllEntitiesWith<>(), std::vector<Entity>{existing});
+        ASSERT_EQ(group->size(), 1);
+        EXPECT_EQ(group->entities()[0], existing);
+        // The component arrays hold no leftover of the merge
+        EXPECT_EQ(coordinator->getComponentArray<ComponentA>()->size(), 1);
+        EXPECT_EQ(coordinator->getComponentArray<ComponentB>()->size(), 0);
+        EXPECT_EQ(loadingWorld.getAllEntitiesWith<ComponentB>().size(), 4);
+    }
+
+    TEST_F(CoordinatorTest, HierarchyRevisionIsKeptPerWorld) {
+        Coordinator loadingWorld;
+        loadingWorld.init();
+        loadingWorld.registerComponentsFrom(*coordinator);
+        const uint64_t revision = coordinator->getHierarchyRevision();
+
+        loadingWorld.markHierarchyChanged();
+        EXPECT_EQ(coordinator->getHierarchyRevision(), revision);
+        EXPECT_EQ(loadingWorld.getHierarchyRevision(), 1);
+
+        coordinator->markHierarchyChanged();
+        EXPECT_EQ(coordinator->getHierarchyRevision(), revision + 1);
+
+        // Merged entities bring their parenting into the target world
+        loadingWorld.addComponent(loadingWorld.createEntity(), ComponentA{0});
+        coordinator->mergeWorld(loadingWorld);
+        EXPECT_EQ(coordinator->getHierarchyRevision(), revision + 2);
+    }
 }
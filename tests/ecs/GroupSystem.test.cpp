@@ -85,7 +85,7 @@ namespace nexo::ecs {
             // Initialize coordinator
             coordinator = std::make_shared<Coordinator>();
             coordinator->init();
-            System::coord = coordinator;
+            System::currentWorld() = coordinator;
 
             // Register components
             coordinator->registerComponent<Position>();
@@ -114,7 +114,7 @@ namespace nexo::ecs {
             }
 
             // Reset coordinator
-            System::coord = nullptr;
+            System::currentWorld() = nullptr;
         }
     };
 
@@ -86,7 +86,7 @@ namespace nexo::ecs {
             // Initialize coordinator
             coordinator = std::make_shared<Coordinator>();
             coordinator->init();
-            System::coord = coordinator;
+            System::currentWorld() = coordinator;
 
             // Register components
             coordinator->registerComponent<Position>();
@@ -121,7 +121,7 @@ namespace nexo::ecs {
             }
 
             // Reset coordinator
-            System::coord = nullptr;
+            System::currentWorld() = nullptr;
         }
     };
 
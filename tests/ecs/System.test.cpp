@@ -40,13 +40,13 @@ namespace nexo::ecs {
     class SystemTest : public ::testing::Test {
     protected:
         void SetUp() override {
-            // Initialize the static coordinator
-            System::coord = std::make_shared<MockCoordinator>();
+            // Bind a world to the test thread
+            System::currentWorld() = std::make_shared<MockCoordinator>();
         }
 
         void TearDown() override {
             // Clean up
-            System::coord.reset();
+            System::currentWorld().reset();
         }
 
         SystemManager systemManager;
@@ -54,7 +54,7 @@ namespace nexo::ecs {
 
     // System Base Class Tests
     TEST_F(SystemTest, CoordinatorInitialization) {
-        ASSERT_NE(System::coord, nullptr);
+        ASSERT_NE(System::currentWorld(), nullptr);
     }
 
     // AQuerySystem Tests
@@ -122,7 +122,7 @@ namespace nexo::ecs {
     protected:
         void SetUp() override {
             // Setup code
-            nexo::ecs::System::coord = std::make_shared<nexo::ecs::MockCoordinator>();
+            nexo::ecs::System::currentWorld() = std::make_shared<nexo::ecs::MockCoordinator>();
 
             // Register systems
             querySystem = systemManager.registerQuerySystem<nexo::ecs::MockQuerySystem>();
@@ -135,7 +135,7 @@ namespace nexo::ecs {
         }
 
         void TearDown() override {
-            nexo::ecs::System::coord.reset();
+            nexo::ecs::System::currentWorld().reset();
         }
 
         nexo::ecs::SystemManager systemManager;
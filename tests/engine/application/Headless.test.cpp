@@ -0,0 +1,168 @@
+//// Headless.test.cpp /////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Smoke and allocation tests running the application frame loop headless
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "Application.hpp"
+#include "CameraFactory.hpp"
+#include "EntityFactory3D.hpp"
+#include "components/Camera.hpp"
+#include "components/RenderContext.hpp"
+#include "renderer/Framebuffer.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+namespace {
+    // Allocations made through the global operator new while counting is enabled, on any thread
+    std::atomic<std::size_t> s_allocationCount{0};
+    std::atomic<bool> s_countAllocations{false};
+
+    void *allocate(const std::size_t size, const std::size_t alignment)
+    {
+        if (s_countAllocations.load(std::memory_order_relaxed))
+            s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        const std::size_t rounded = (size + alignment - 1) / alignment * alignment;
+        void *memory = alignment > alignof(std::max_align_t) ? std::aligned_alloc(alignment, rounded)
+                                                             : std::malloc(rounded ? rounded : 1);
+        if (!memory)
+            throw std::bad_alloc();
+        return memory;
+    }
+}
+
+void *operator new(const std::size_t size) { return allocate(size, alignof(std::max_align_t)); }
+void *operator new(const std::size_t size, const std::align_val_t alignment) { return allocate(size, static_cast<std::size_t>(alignment)); }
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void *memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t, std::align_val_t) noexcept { std::free(memory); }
+void *operator new[](const std::size_t size) { return allocate(size, alignof(std::max_align_t)); }
+void *operator new[](const std::size_t size, const std::align_val_t alignment) { return allocate(size, static_cast<std::size_t>(alignment)); }
+void operator delete[](void *memory) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::align_val_t) noexcept { std::free(memory); }
+void operator delete[](void *memory, std::size_t, std::align_val_t) noexcept { std::free(memory); }
+
+namespace nexo {
+
+    namespace {
+        // The application is a process wide singleton, it is initialized once for every test of this file
+        bool initHeadlessApplication()
+        {
+            static const bool initialized = [] {
+                Application &app = Application::getInstance();
+                app.setHeadless(true);
+                try {
+                    app.init();
+                } catch (const renderer::NxGraphicsApiWindowInitFailure &) {
+                    return false;
+                }
+                return true;
+            }();
+            return initialized;
+        }
+
+        // Scene holding a rendered camera looking at a cube
+        unsigned int createTestScene(const std::string &name)
+        {
+            Application &app = Application::getInstance();
+            const unsigned int sceneId = app.getSceneManager().createScene(name);
+            renderer::NxFramebufferSpecs specs;
+            specs.width = 128;
+            specs.height = 128;
+            specs.attachments = {renderer::NxFrameBufferTextureFormats::RGBA8,
+                                 renderer::NxFrameBufferTextureFormats::RED_INTEGER,
+                                 renderer::NxFrameBufferTextureFormats::Depth};
+            const ecs::Entity camera = CameraFactory::createPerspectiveCamera({0.0f, 0.0f, 5.0f}, specs.width, specs.height,
+                                                                              renderer::NxFramebuffer::create(specs));
+            Application::m_coordinator->getComponent<components::CameraComponent>(camera).render = true;
+            app.getSceneManager().getScene(sceneId).addEntity(camera);
+            app.getSceneManager().getScene(sceneId).addEntity(
+                EntityFactory3D::createCube({0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, {0.0f, 0.0f, 0.0f}));
+            return sceneId;
+        }
+    }
+
+    TEST(HeadlessApplicationTest, RunsFramesWithoutADisplay)
+    {
+        if (!initHeadlessApplication())
+            GTEST_SKIP() << "No EGL or OSMesa offscreen context on this machine";
+        Application &app = Application::getInstance();
+        ASSERT_TRUE(app.isHeadless());
+
+        const unsigned int sceneId = createTestScene("Headless smoke test");
+        const Application::SceneInfo sceneInfo{sceneId, RenderingType::FRAMEBUFFER};
+        const int firstFrame = app.getWorldState().stats.frameCount;
+        for (int frame = 0; frame < 3; ++frame) {
+            app.beginFrame();
+            EXPECT_NO_THROW(app.run(sceneInfo));
+            app.endFrame();
+        }
+        EXPECT_EQ(app.getWorldState().stats.frameCount, firstFrame + 3);
+        EXPECT_TRUE(app.isWindowOpen());
+
+        app.getSceneManager().deleteScene(sceneId);
+    }
+
+    TEST(HeadlessApplicationTest, WarmedUpFrameBuildsAndExecutesCommandsWithoutAllocating)
+    {
+        if (!initHeadlessApplication())
+            GTEST_SKIP() << "No EGL or OSMesa offscreen context on this machine";
+        Application &app = Application::getInstance();
+        const unsigned int sceneId = createTestScene("Frame allocations test");
+
+        // A full frame computes the world matrices, compiles the shaders and resolves the materials
+        app.beginFrame();
+        app.run({sceneId, RenderingType::FRAMEBUFFER});
+        app.endFrame();
+
+        auto &renderContext = Application::m_coordinator->getSingletonComponent<components::RenderContext>();
+        const auto cameraContextSystem = app.getCameraContextSystem();
+        const auto renderCommandSystem = app.getRenderCommandSystem();
+        // The first frames grow the recycled storage, the profiler keeps two frames of it
+        std::size_t allocations = 0;
+        for (int frame = 0; frame < 4; ++frame) {
+            app.beginFrame();
+            renderContext.sceneRendered = static_cast<int>(sceneId);
+            cameraContextSystem->update();
+            ASSERT_EQ(renderContext.cameras.size(), 1u);
+
+            s_allocationCount = 0;
+            s_countAllocations = true;
+            renderCommandSystem->update();
+            for (auto &camera : renderContext.cameras)
+                camera.pipeline->execute();
+            s_countAllocations = false;
+            allocations = s_allocationCount;
+
+            renderContext.reset();
+            app.endFrame();
+        }
+        EXPECT_EQ(allocations, 0u);
+
+        app.getSceneManager().deleteScene(sceneId);
+    }
+
+}
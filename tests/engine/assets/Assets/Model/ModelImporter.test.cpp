@@ -208,7 +208,8 @@ TEST_F(ModelImporterTestFixture, ImportCubeModel) {
 
     // A cube should have 8 vertices and 12 triangles (36 indices)
     //EXPECT_EQ(childMesh.vertices.size(), 24); // 24 because each vertex is duplicated for different face normals/UVs
-    EXPECT_EQ(childMesh.vao->getIndexBuffer()->getCount(), 36);  // 6 faces × 2 triangles × 3 vertices
+    ASSERT_NE(childMesh.arenaMesh, nullptr);
+    EXPECT_EQ(childMesh.arenaMesh->getRange().indexCount, 36);  // 6 faces × 2 triangles × 3 vertices
 
     // Check the Material reference
     const auto material = childMesh.material.lock();
@@ -38,6 +38,8 @@ public:
     glm::vec2 getSize() const override { return glm::vec2(0.0f); }
     void resize(unsigned int, unsigned int ) override {}
     void getPixelWrapper(unsigned int, int, int, void *, const std::type_info &) const override {}
+    uint64_t requestPixelRegion(unsigned int, int, int, int, int) override { return 0; }
+    std::optional<nexo::renderer::NxPixelRegion> pollPixelRegion() override { return std::nullopt; }
     void clearAttachmentWrapper(unsigned int, const void *, const std::type_info &) const override {}
     [[nodiscard]] nexo::renderer::NxFramebufferSpecs &getSpecs() override { static nexo::renderer::NxFramebufferSpecs specs; return specs; }
     [[nodiscard]] const nexo::renderer::NxFramebufferSpecs &getSpecs() const override { static nexo::renderer::NxFramebufferSpecs specs; return specs; }
@@ -27,7 +27,7 @@ class PhysicsSystemTest : public ::testing::Test {
 
     void SetUp() override {
         coordinator = std::make_shared<ecs::Coordinator>();
-        ecs::System::coord = coordinator;
+        ecs::System::currentWorld() = coordinator;
         coordinator->init();
         coordinator->registerComponent<components::TransformComponent>();
         coordinator->registerComponent<components::PhysicsBodyComponent>();
@@ -22,8 +22,11 @@
 #include <gmock/gmock.h>
 #include "renderer/Buffer.hpp"
 #include "opengl/OpenGlBuffer.hpp"
+#include "opengl/OpenGlRingBuffer.hpp"
+#include "renderer/MaterialTable.hpp"
 #include "renderer/RendererExceptions.hpp"
 #include <array>
+#include <cstring>
 
 namespace nexo::renderer {
 
@@ -35,6 +38,8 @@ namespace nexo::renderer {
         MOCK_METHOD(void, setLayout, (const NxBufferLayout&), (override));
         MOCK_METHOD(NxBufferLayout, getLayout, (), (const, override));
         MOCK_METHOD(void, setData, (void*, size_t), (override));
+        MOCK_METHOD(void, setSubData, (const void*, size_t, size_t), (override));
+        MOCK_METHOD(void, copyFrom, (const NxVertexBuffer&, size_t, size_t, size_t), (override));
         MOCK_METHOD(unsigned int, getId, (), (const, override));
     };
 
@@ -43,6 +48,8 @@ namespace nexo::renderer {
         MOCK_METHOD(void, bind, (), (const, override));
         MOCK_METHOD(void, unbind, (), (const, override));
         MOCK_METHOD(void, setData, (unsigned int*, size_t), (override));
+        MOCK_METHOD(void, setSubData, (const unsigned int*, size_t, size_t), (override));
+        MOCK_METHOD(void, copyFrom, (const NxIndexBuffer&, size_t, size_t, size_t), (override));
         MOCK_METHOD(size_t, getCount, (), (const, override));
         MOCK_METHOD(unsigned int, getId, (), (const, override));
     };
@@ -350,6 +357,76 @@ namespace nexo::renderer {
         unsigned int indices[] = {0, 1, 2, 2, 3, 0};
         EXPECT_NO_THROW(buffer.setData(indices, 6));
         EXPECT_EQ(buffer.getCount(), 6);
+
+        // Smaller data reuses the storage
+        EXPECT_NO_THROW(buffer.setData(indices, 3));
+        EXPECT_EQ(buffer.getCount(), 3);
+    }
+
+    TEST_F(OpenGLBufferTest, OpenGlRingBufferAllocatesAlignedRangesPerFrame) {
+        NxOpenGlRingBuffer ring(256, 3);
+        const auto buffer = ring.getBuffer();
+        ASSERT_NE(buffer, nullptr);
+
+        ring.beginFrame();
+        const auto first = ring.allocate(10, 1);
+        const auto second = ring.allocate(16, 12);
+        EXPECT_EQ(second.offset % 12, 0);
+        EXPECT_GE(second.offset, first.offset + 10);
+
+        const std::array<unsigned int, 4> values = {1, 2, 3, 4};
+        std::memcpy(second.data, values.data(), sizeof(values));
+        ring.endFrame();
+        glFinish();
+
+        std::array<unsigned int, 4> readBack{};
+        glGetNamedBufferSubData(buffer->getId(), static_cast<GLintptr>(second.offset), sizeof(readBack), readBack.data());
+        EXPECT_EQ(readBack, values);
+
+        // The next frame writes in its own region
+        ring.beginFrame();
+        const auto next = ring.allocate(10, 1);
+        EXPECT_GE(next.offset, 256);
+        ring.endFrame();
+        EXPECT_EQ(ring.getBuffer(), buffer);
+    }
+
+    TEST_F(OpenGLBufferTest, OpenGlRingBufferGrowsWhenAFrameOverflows) {
+        NxOpenGlRingBuffer ring(64, 2);
+        const auto buffer = ring.getBuffer();
+
+        ring.beginFrame();
+        ring.allocate(48, 1);
+        const auto large = ring.allocate(100, 4);
+        EXPECT_GE(ring.getFrameCapacity(), 100);
+        EXPECT_NE(ring.getBuffer(), buffer);
+        EXPECT_EQ(large.offset % 4, 0);
+        EXPECT_LE(large.offset + 100, (ring.getFrameCapacity() * 2));
+        ring.endFrame();
+    }
+
+    TEST_F(OpenGLBufferTest, MaterialTableUploadsOnlyChangedEntries) {
+        NxMaterialTable table(1);
+        const uint32_t index = table.allocate();
+        table.allocate();
+        EXPECT_TRUE(table.isDirty());
+        // Outgrowing the initial capacity recreates the storage buffer
+        EXPECT_NO_THROW(table.upload());
+        EXPECT_FALSE(table.isDirty());
+
+        table.set(index, table.get(index));
+        EXPECT_FALSE(table.isDirty());
+
+        NxIndexedMaterial material;
+        material.metallic = 1.0f;
+        table.set(index, material);
+        EXPECT_TRUE(table.isDirty());
+        table.upload();
+        EXPECT_FALSE(table.isDirty());
+
+        GLint bound = 0;
+        glGetIntegeri_v(GL_SHADER_STORAGE_BUFFER_BINDING, NX_MATERIALS_BINDING, &bound);
+        EXPECT_NE(bound, 0);
     }
     #endif // NX_GRAPHICS_API_OPENGL
 }
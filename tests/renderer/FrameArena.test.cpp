@@ -0,0 +1,77 @@
+//// FrameArena.test ///////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the per frame linear allocator
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+#include <cstdint>
+
+#include "FrameArena.hpp"
+#include "RendererExceptions.hpp"
+
+namespace nexo::renderer {
+
+    TEST(FrameArenaTest, AllocationsAreAlignedAndDisjoint)
+    {
+        NxFrameArena arena(1024);
+        const auto bytes = arena.allocate<uint8_t>(3);
+        const auto doubles = arena.allocate<double>(4);
+        const auto words = arena.allocate<uint32_t>(5);
+
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(doubles.data()) % alignof(double), 0u);
+        EXPECT_GE(reinterpret_cast<const uint8_t *>(doubles.data()), bytes.data() + bytes.size());
+        EXPECT_GE(reinterpret_cast<const uint8_t *>(words.data()), reinterpret_cast<const uint8_t *>(doubles.data() + doubles.size()));
+        EXPECT_EQ(arena.getUsedBytes(), 3 + 4 * sizeof(double) + 5 * sizeof(uint32_t));
+        EXPECT_TRUE(arena.allocate<uint32_t>(0).empty());
+        EXPECT_THROW(static_cast<void>(arena.allocateBytes(8, 3)), NxInvalidValue);
+    }
+
+    TEST(FrameArenaTest, GrowingKeepsEarlierAllocations)
+    {
+        NxFrameArena arena(64);
+        const auto first = arena.allocate<uint32_t>(8);
+        for (size_t i = 0; i < first.size(); ++i)
+            first[i] = static_cast<uint32_t>(i);
+
+        const auto second = arena.allocate<uint32_t>(1000);
+        second[999] = 42;
+        EXPECT_GT(arena.getCapacity(), 64u);
+        for (size_t i = 0; i < first.size(); ++i)
+            EXPECT_EQ(first[i], i);
+        EXPECT_EQ(second[999], 42u);
+    }
+
+    TEST(FrameArenaTest, ResetMergesBlocksSoTheNextFrameFits)
+    {
+        NxFrameArena arena(64);
+        static_cast<void>(arena.allocate<uint32_t>(8));
+        static_cast<void>(arena.allocate<uint32_t>(1000));
+        const size_t capacity = arena.getCapacity();
+
+        arena.reset();
+        EXPECT_EQ(arena.getUsedBytes(), 0u);
+        EXPECT_EQ(arena.getCapacity(), capacity);
+
+        // The same frame now fits in the merged block
+        const auto first = arena.allocate<uint32_t>(8);
+        const auto second = arena.allocate<uint32_t>(1000);
+        EXPECT_EQ(arena.getCapacity(), capacity);
+        EXPECT_EQ(second.data(), first.data() + first.size());
+    }
+
+}
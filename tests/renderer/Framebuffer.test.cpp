@@ -462,4 +462,58 @@ namespace nexo::renderer {
         framebuffer.unbind();
     }
 
+    TEST_F(OpenGLTest, AsyncPixelRegionReadback) {
+        NxFramebufferSpecs specs;
+        specs.width = 100;
+        specs.height = 100;
+        specs.samples = 1;
+        specs.attachments.attachments = { NxFrameBufferTextureFormats::RED_INTEGER };
+
+        NxOpenGlFramebuffer framebuffer(specs);
+        framebuffer.bind();
+        int clearValue = 42;
+        framebuffer.clearAttachmentWrapper(0, &clearValue, typeid(int));
+
+        // The region is clamped to the framebuffer
+        const uint64_t requestId = framebuffer.requestPixelRegion(0, 90, 95, 20, 10);
+        ASSERT_NE(requestId, 0);
+        glFinish();
+        const auto region = framebuffer.pollPixelRegion();
+        ASSERT_TRUE(region.has_value());
+        EXPECT_EQ(region->requestId, requestId);
+        EXPECT_EQ(region->width, 10);
+        EXPECT_EQ(region->height, 5);
+        ASSERT_EQ(region->pixels.size(), 50);
+        for (const int pixel : region->pixels)
+            EXPECT_EQ(pixel, clearValue);
+        EXPECT_FALSE(framebuffer.pollPixelRegion().has_value());
+        framebuffer.unbind();
+    }
+
+    TEST_F(OpenGLTest, AsyncPixelRegionRingIsBounded) {
+        NxFramebufferSpecs specs;
+        specs.width = 100;
+        specs.height = 100;
+        specs.samples = 1;
+        specs.attachments.attachments = { NxFrameBufferTextureFormats::RED_INTEGER };
+
+        NxOpenGlFramebuffer framebuffer(specs);
+        EXPECT_THROW(static_cast<void>(framebuffer.requestPixelRegion(1, 0, 0)), NxFramebufferInvalidIndex);
+        EXPECT_EQ(framebuffer.requestPixelRegion(0, 200, 200), 0);
+
+        // Requests beyond the ring size are refused until the pending ones are polled
+        uint64_t lastRequest = 0;
+        for (int i = 0; i < 3; ++i) {
+            lastRequest = framebuffer.requestPixelRegion(0, i, i);
+            EXPECT_NE(lastRequest, 0);
+        }
+        EXPECT_EQ(framebuffer.requestPixelRegion(0, 10, 10), 0);
+        glFinish();
+        uint64_t polledRequest = 0;
+        while (const auto region = framebuffer.pollPixelRegion())
+            polledRequest = region->requestId;
+        EXPECT_EQ(polledRequest, lastRequest);
+        EXPECT_NE(framebuffer.requestPixelRegion(0, 10, 10), 0);
+    }
+
 }
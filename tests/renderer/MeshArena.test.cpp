@@ -0,0 +1,162 @@
+//// MeshArena.test ////////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the shared mesh arena
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "contexts/opengl.hpp"
+#include "renderer/MeshArena.hpp"
+
+#include <array>
+#include <vector>
+
+namespace nexo::renderer {
+
+    class MeshArenaTest : public OpenGLTest {
+        protected:
+        struct MeshData {
+            std::vector<NxVertex> vertices;
+            std::vector<unsigned int> indices;
+        };
+
+        // Every vertex of the mesh carries the tag, so a mesh read back at the wrong place is noticed
+        static MeshData makeMesh(const size_t vertexCount, const size_t indexCount, const int tag)
+        {
+            MeshData mesh;
+            for (size_t i = 0; i < vertexCount; ++i) {
+                NxVertex vertex{};
+                vertex.position = {static_cast<float>(tag), static_cast<float>(i), 0.0f};
+                vertex.entityID = tag;
+                mesh.vertices.push_back(vertex);
+            }
+            for (size_t i = 0; i < indexCount; ++i)
+                mesh.indices.push_back(static_cast<unsigned int>((i * 7 + tag) % vertexCount));
+            return mesh;
+        }
+
+        static std::shared_ptr<NxArenaMesh> add(NxMeshArena &arena, const MeshData &mesh)
+        {
+            return arena.add(mesh.vertices, mesh.indices);
+        }
+
+        static void expectMeshData(const NxMeshArena &arena, const NxMeshRange &range, const MeshData &mesh)
+        {
+            glFinish();
+            const auto &vertexArray = arena.getVertexArray();
+            std::vector<NxVertex> vertices(range.vertexCount);
+            glGetNamedBufferSubData(vertexArray->getVertexBuffers()[0]->getId(),
+                                    static_cast<GLintptr>(range.baseVertex * sizeof(NxVertex)),
+                                    static_cast<GLsizeiptr>(vertices.size() * sizeof(NxVertex)), vertices.data());
+            ASSERT_EQ(vertices.size(), mesh.vertices.size());
+            for (size_t i = 0; i < vertices.size(); ++i) {
+                EXPECT_EQ(vertices[i].position, mesh.vertices[i].position);
+                EXPECT_EQ(vertices[i].entityID, mesh.vertices[i].entityID);
+            }
+
+            std::vector<unsigned int> indices(range.indexCount);
+            glGetNamedBufferSubData(vertexArray->getIndexBuffer()->getId(),
+                                    static_cast<GLintptr>(range.firstIndex * sizeof(unsigned int)),
+                                    static_cast<GLsizeiptr>(indices.size() * sizeof(unsigned int)), indices.data());
+            EXPECT_EQ(indices, mesh.indices);
+        }
+    };
+
+    TEST_F(MeshArenaTest, DefragmentPacksLiveMeshesAndKeepsTheirData) {
+        const auto arena = NxMeshArena::create(64, 96);
+        const std::array meshes = {makeMesh(4, 6, 1), makeMesh(5, 9, 2), makeMesh(6, 12, 3), makeMesh(3, 3, 4)};
+        const auto first = add(*arena, meshes[0]);
+        auto second = add(*arena, meshes[1]);
+        const auto third = add(*arena, meshes[2]);
+        auto fourth = add(*arena, meshes[3]);
+        const NxMeshRange firstRange = first->getRange();
+        const NxMeshRange thirdRange = third->getRange();
+
+        // Leaves holes before the third mesh and after it
+        second.reset();
+        fourth.reset();
+        EXPECT_EQ(arena->getMeshCount(), 2);
+        EXPECT_EQ(third->getRange(), thirdRange);
+
+        arena->defragment();
+
+        // The first mesh was already packed, the third one slides down into the hole
+        EXPECT_EQ(first->getRange(), firstRange);
+        const NxMeshRange packed = third->getRange();
+        EXPECT_EQ(packed.baseVertex, firstRange.vertexCount);
+        EXPECT_EQ(packed.firstIndex, firstRange.indexCount);
+        EXPECT_EQ(packed.vertexCount, thirdRange.vertexCount);
+        EXPECT_EQ(packed.indexCount, thirdRange.indexCount);
+        expectMeshData(*arena, first->getRange(), meshes[0]);
+        expectMeshData(*arena, packed, meshes[2]);
+
+        // The freed space is a single block again
+        const auto large = add(*arena, makeMesh(64 - 10, 96 - 18, 5));
+        EXPECT_EQ(large->getRange().baseVertex, 10);
+        EXPECT_EQ(arena->getVertexCapacity(), 64);
+    }
+
+    TEST_F(MeshArenaTest, FragmentedArenaCompactsBeforeGrowing) {
+        const auto arena = NxMeshArena::create(16, 24);
+        const std::array meshes = {makeMesh(4, 6, 1), makeMesh(4, 6, 2), makeMesh(4, 6, 3), makeMesh(8, 12, 4)};
+        const auto first = add(*arena, meshes[0]);
+        auto second = add(*arena, meshes[1]);
+        const auto third = add(*arena, meshes[2]);
+        second.reset();
+
+        // Only two blocks of 4 vertices are free, the arena compacts instead of doubling
+        const auto fourth = add(*arena, meshes[3]);
+        EXPECT_EQ(arena->getVertexCapacity(), 16);
+        EXPECT_EQ(arena->getIndexCapacity(), 24);
+        EXPECT_EQ(third->getRange().baseVertex, 4);
+        EXPECT_EQ(fourth->getRange().baseVertex, 8);
+        expectMeshData(*arena, first->getRange(), meshes[0]);
+        expectMeshData(*arena, third->getRange(), meshes[2]);
+        expectMeshData(*arena, fourth->getRange(), meshes[3]);
+    }
+
+    TEST_F(MeshArenaTest, GrowingKeepsExistingRangesValid) {
+        const auto arena = NxMeshArena::create(8, 12);
+        const std::array meshes = {makeMesh(6, 9, 1), makeMesh(6, 9, 2)};
+        const auto first = add(*arena, meshes[0]);
+        const NxMeshRange firstRange = first->getRange();
+        const auto vertexArray = arena->getVertexArray();
+
+        // Not enough free space even once compacted, the buffers are recreated twice as large
+        const auto second = add(*arena, meshes[1]);
+        EXPECT_EQ(arena->getVertexCapacity(), 16);
+        EXPECT_EQ(arena->getIndexCapacity(), 24);
+        EXPECT_NE(arena->getVertexArray(), vertexArray);
+        EXPECT_EQ(first->getVertexArray(), arena->getVertexArray());
+
+        // The existing mesh keeps its range and its data was copied to the new buffers
+        EXPECT_EQ(first->getRange(), firstRange);
+        expectMeshData(*arena, firstRange, meshes[0]);
+        expectMeshData(*arena, second->getRange(), meshes[1]);
+    }
+
+    TEST_F(MeshArenaTest, ReleasedMeshesFreeTheirRange) {
+        const auto arena = NxMeshArena::create(8, 12);
+        auto mesh = add(*arena, makeMesh(8, 12, 1));
+        mesh.reset();
+        EXPECT_EQ(arena->getMeshCount(), 0);
+
+        // The whole arena is reused without growing
+        const auto other = add(*arena, makeMesh(8, 12, 2));
+        EXPECT_EQ(other->getRange(), (NxMeshRange{0, 8, 0, 12}));
+        EXPECT_EQ(arena->getVertexCapacity(), 8);
+    }
+}
@@ -0,0 +1,152 @@
+//// NullRendererApi.test.cpp //////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the null renderer api
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "null/NullRendererApi.hpp"
+#include "RenderCommand.hpp"
+#include "RendererExceptions.hpp"
+
+namespace nexo::renderer {
+
+    class MockIndexBuffer : public NxIndexBuffer {
+        public:
+            MOCK_METHOD(void, bind, (), (const, override));
+            MOCK_METHOD(void, unbind, (), (const, override));
+            MOCK_METHOD(void, setData, (unsigned int *data, size_t size), (override));
+            MOCK_METHOD(void, setSubData, (const unsigned int *data, size_t count, size_t offset), (override));
+            MOCK_METHOD(void, copyFrom, (const NxIndexBuffer &source, size_t sourceOffset, size_t destinationOffset, size_t count), (override));
+            MOCK_METHOD(size_t, getCount, (), (const, override));
+            MOCK_METHOD(unsigned int, getId, (), (const, override));
+    };
+
+    class MockVertexArray : public NxVertexArray {
+        public:
+            MOCK_METHOD(void, bind, (), (const, override));
+            MOCK_METHOD(void, unbind, (), (const, override));
+            MOCK_METHOD(void, addVertexBuffer, (const std::shared_ptr<NxVertexBuffer> &vertexBuffer), (override));
+            MOCK_METHOD(void, setIndexBuffer, (const std::shared_ptr<NxIndexBuffer> &indexBuffer), (override));
+            MOCK_METHOD(void, setInstanceBuffer, (const std::shared_ptr<NxVertexBuffer> &instanceBuffer), (override));
+            MOCK_METHOD(const std::vector<std::shared_ptr<NxVertexBuffer>> &, getVertexBuffers, (), (const, override));
+            MOCK_METHOD(const std::shared_ptr<NxIndexBuffer> &, getIndexBuffer, (), (const, override));
+            MOCK_METHOD(unsigned int, getId, (), (const, override));
+    };
+
+    class NullRendererApiTest : public ::testing::Test {
+        protected:
+            void SetUp() override
+            {
+                indexBuffer = std::make_shared<::testing::NiceMock<MockIndexBuffer>>();
+                ON_CALL(*indexBuffer, getCount()).WillByDefault(::testing::Return(36));
+                vertexArray = std::make_shared<::testing::NiceMock<MockVertexArray>>();
+                ON_CALL(*vertexArray, getIndexBuffer()).WillByDefault(::testing::ReturnRef(indexBufferRef));
+                indexBufferRef = indexBuffer;
+                api.init();
+            }
+
+            NxNullRendererApi api;
+            std::shared_ptr<::testing::NiceMock<MockIndexBuffer>> indexBuffer;
+            std::shared_ptr<NxIndexBuffer> indexBufferRef;
+            std::shared_ptr<::testing::NiceMock<MockVertexArray>> vertexArray;
+    };
+
+    TEST_F(NullRendererApiTest, CommandsRequireInitialization)
+    {
+        NxNullRendererApi uninitialized;
+        EXPECT_THROW(uninitialized.clear(), NxGraphicsApiNotInitialized);
+        EXPECT_THROW(uninitialized.setBlend(true), NxGraphicsApiNotInitialized);
+        EXPECT_THROW(uninitialized.setBlendFunc(0x0302, 0x0303), NxGraphicsApiNotInitialized);
+        EXPECT_THROW(uninitialized.drawIndexed(vertexArray), NxGraphicsApiNotInitialized);
+        EXPECT_NO_THROW(uninitialized.useProgram(1));
+    }
+
+    TEST_F(NullRendererApiTest, DrawsAreCounted)
+    {
+        api.drawIndexed(vertexArray);
+        api.drawIndexedInstanced(vertexArray, 10, 0, 6);
+        api.drawUnIndexed(3);
+
+        const NxRenderCounters counters = api.getCounters();
+        EXPECT_EQ(counters.drawCalls, 3u);
+        EXPECT_EQ(counters.instances, 12u);
+        EXPECT_EQ(counters.triangles, 12u + 20u + 1u);
+
+        api.resetCounters();
+        EXPECT_EQ(api.getCounters().drawCalls, 0u);
+    }
+
+    TEST_F(NullRendererApiTest, InvalidDrawsThrow)
+    {
+        EXPECT_THROW(api.drawIndexed(nullptr), NxInvalidValue);
+        EXPECT_THROW(api.drawIndexed(vertexArray, 37), NxInvalidValue);
+        EXPECT_THROW(api.multiDrawIndexedIndirect(vertexArray, nullptr, 0, 1), NxInvalidValue);
+        indexBufferRef = nullptr;
+        EXPECT_THROW(api.drawIndexed(vertexArray), NxInvalidValue);
+        EXPECT_EQ(api.getCounters().drawCalls, 0u);
+    }
+
+    TEST_F(NullRendererApiTest, InvalidStateThrows)
+    {
+        EXPECT_THROW(api.setViewport(0, 0, 0, 600), NxGraphicsApiViewportResizingFailure);
+        EXPECT_THROW(api.setViewport(0, 0, NxNullRendererApi::MAX_VIEWPORT_SIZE + 1, 600),
+                     NxGraphicsApiViewportResizingFailure);
+        EXPECT_THROW(api.setDepthFunc(0x1E00), NxInvalidValue);
+        EXPECT_THROW(api.setStencilFunc(0, 0, 0xFF), NxInvalidValue);
+        EXPECT_THROW(api.setStencilOp(0x1E00, 0x1E00, 0x0201), NxInvalidValue);
+        EXPECT_THROW(api.setClearDepth(2.0f), NxInvalidValue);
+        EXPECT_THROW(api.setBlendFunc(0x0302, 0x0200), NxInvalidValue);
+
+        EXPECT_NO_THROW(api.setDepthFunc(0x0201));
+        EXPECT_NO_THROW(api.setStencilOp(0x1E00, 0x1E00, 0x1E01));
+        EXPECT_NO_THROW(api.setBlendFunc(0x0302, 0x0303));
+    }
+
+    TEST_F(NullRendererApiTest, RedundantStateIsOnlyCountedOnce)
+    {
+        api.resetCounters();
+        api.setBlend(false);
+        api.setBlend(false);
+        api.setBlendFunc(0x0001, 0x0001);
+        api.setBlendFunc(0x0001, 0x0001);
+        api.useProgram(4);
+        api.useProgram(4);
+        api.bindTexture(2, 7);
+        api.bindTexture(2, 7);
+
+        const NxRenderCounters counters = api.getCounters();
+        EXPECT_EQ(counters.textureBinds, 1u);
+        EXPECT_EQ(counters.stateChanges, 5u);
+        EXPECT_EQ(api.getStateCache().getAvoidedCount(), 5u);
+    }
+
+    TEST_F(NullRendererApiTest, RenderCommandsCanRunWithoutAGraphicsContext)
+    {
+        auto previous = NxRenderCommand::setRendererApi(std::make_unique<NxNullRendererApi>());
+        NxRenderCommand::init();
+        NxRenderCommand::resetCounters();
+        NxRenderCommand::setViewport(0, 0, 800, 600);
+        NxRenderCommand::drawIndexed(vertexArray);
+        EXPECT_EQ(NxRenderCommand::getCounters().drawCalls, 1u);
+        NxRenderCommand::setRendererApi(std::move(previous));
+    }
+
+}
@@ -18,11 +18,44 @@
 #include "gtest/gtest.h"
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <array>
 #include <glm/glm.hpp>
 
 #include "RenderPipeline.hpp"
 #include "RenderPass.hpp"
 #include "Framebuffer.hpp"
+#include "TransientPool.hpp"
+#include "FrameArena.hpp"
+#include "RendererExceptions.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    // Heap allocations are only counted while a test explicitly enables it
+    std::atomic<bool> countAllocations{false};
+    std::atomic<size_t> allocationCount{0};
+}
+
+void *operator new(const std::size_t size)
+{
+    if (countAllocations.load(std::memory_order_relaxed))
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void *memory = std::malloc(size ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
 
 namespace nexo::renderer {
 
@@ -61,6 +94,8 @@ public:
     MOCK_METHOD(void, copy, (const std::shared_ptr<NxFramebuffer> source), (override));
     MOCK_METHOD(unsigned int, getFramebufferId, (), (const, override));
     MOCK_METHOD(void, getPixelWrapper, (unsigned int attachmentIndex, int x, int y, void* result, const std::type_info& ti), (const, override));
+    MOCK_METHOD(uint64_t, requestPixelRegion, (unsigned int attachmentIndex, int x, int y, int width, int height), (override));
+    MOCK_METHOD(std::optional<NxPixelRegion>, pollPixelRegion, (), (override));
     MOCK_METHOD(void, clearAttachmentWrapper, (unsigned int attachmentIndex, const void* value, const std::type_info& ti), (const, override));
     MOCK_METHOD(NxFramebufferSpecs&, getSpecs, (), (override));
     MOCK_METHOD(const NxFramebufferSpecs&, getSpecs, (), (const, override));
@@ -71,6 +106,18 @@ public:
     MOCK_METHOD(bool, hasDepthStencilAttachment, (), (const, override));
 };
 
+// Mock pass declaring transients, active unless told otherwise
+class TransientMockPass : public MockRenderPass {
+public:
+    using MockRenderPass::MockRenderPass;
+    using RenderPass::writesTransient;
+    using RenderPass::readsTransient;
+
+    bool isActive(const RenderPipeline &) const override { return active; }
+
+    bool active = true;
+};
+
 class RenderPipelineTest : public ::testing::Test {
 protected:
     RenderPipeline pipeline;
@@ -299,6 +346,90 @@ TEST_F(RenderPipelineTest, DrawCommandsManagement) {
     EXPECT_TRUE(pipeline.getDrawCommands().empty());
 }
 
+TEST_F(RenderPipelineTest, SharedDrawCommandsAreNotCopied) {
+    const auto shared = std::make_shared<const std::vector<DrawCommand>>(std::vector<DrawCommand>(2));
+    RenderPipeline otherPipeline;
+
+    pipeline.addDrawCommands(shared);
+    otherPipeline.addDrawCommands(shared);
+    pipeline.addDrawCommand(DrawCommand{});
+
+    ASSERT_EQ(pipeline.getSharedDrawCommands().size(), 1);
+    EXPECT_EQ(pipeline.getSharedDrawCommands()[0], shared);
+    EXPECT_EQ(otherPipeline.getSharedDrawCommands()[0], shared);
+    EXPECT_EQ(pipeline.getDrawCommands().size(), 1);
+    EXPECT_EQ(pipeline.getDrawCommandCount(), 3);
+
+    // Empty lists are ignored
+    pipeline.addDrawCommands(std::make_shared<const std::vector<DrawCommand>>());
+    EXPECT_EQ(pipeline.getSharedDrawCommands().size(), 1);
+
+    pipeline.setRenderTarget(createMockFramebuffer());
+    pipeline.execute();
+    EXPECT_EQ(pipeline.getDrawCommandCount(), 0);
+    EXPECT_EQ(shared->size(), 2);
+}
+
+TEST_F(RenderPipelineTest, SharedDrawCommandsHonourVisibleIndices) {
+    std::vector<DrawCommand> commands(3);
+    for (size_t i = 0; i < commands.size(); ++i) {
+        commands[i].filterMask = 1 << 0;
+        commands[i].sortPosition = glm::vec3(0.0f, 0.0f, static_cast<float>(i));
+    }
+    const auto shared = std::make_shared<const std::vector<DrawCommand>>(std::move(commands));
+
+    // The pipeline keeps a view on the indices, they outlive the execution like frame arena memory
+    constexpr std::array<uint32_t, 2> visible = {0, 2};
+    pipeline.addDrawCommands(shared, visible);
+    EXPECT_EQ(pipeline.getDrawCommandCount(), 2);
+
+    // A camera seeing nothing does not keep the list
+    RenderPipeline otherPipeline;
+    otherPipeline.addDrawCommands(shared, {});
+    EXPECT_TRUE(otherPipeline.getSharedDrawCommands().empty());
+
+    pipeline.sortDrawCommands();
+    const auto sorted = pipeline.getSortedDrawCommands(0);
+    ASSERT_EQ(sorted.size(), 2);
+    for (const auto &entry : sorted)
+        EXPECT_NE(entry.command, &(*shared)[1]);
+}
+
+TEST_F(RenderPipelineTest, DrawCommandsAreSortedPerFilterBit) {
+    NxCameraConstants constants;
+    constants.cameraPosition = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    pipeline.setCameraConstants(constants);
+
+    const auto makeCommand = [](const float distance, const bool isOpaque, const uint32_t filterMask) {
+        DrawCommand cmd;
+        cmd.sortPosition = glm::vec3(0.0f, 0.0f, distance);
+        cmd.isOpaque = isOpaque;
+        cmd.filterMask = filterMask;
+        return cmd;
+    };
+    const std::vector commands = {
+        makeCommand(1.0f, false, 1 << 0),
+        makeCommand(10.0f, true, 1 << 0),
+        makeCommand(20.0f, false, 1 << 0 | 1 << 1),
+        makeCommand(2.0f, true, 1 << 0),
+    };
+    pipeline.addDrawCommands(commands);
+    pipeline.sortDrawCommands();
+
+    // Opaque front to back, then translucent back to front
+    const auto forward = pipeline.getSortedDrawCommands(0);
+    ASSERT_EQ(forward.size(), 4);
+    EXPECT_EQ(forward[0].command->sortPosition.z, 2.0f);
+    EXPECT_EQ(forward[1].command->sortPosition.z, 10.0f);
+    EXPECT_EQ(forward[2].command->sortPosition.z, 20.0f);
+    EXPECT_EQ(forward[3].command->sortPosition.z, 1.0f);
+
+    const auto second = pipeline.getSortedDrawCommands(1);
+    ASSERT_EQ(second.size(), 1);
+    EXPECT_EQ(second[0].command->sortPosition.z, 20.0f);
+    EXPECT_TRUE(pipeline.getSortedDrawCommands(2).empty());
+}
+
 TEST_F(RenderPipelineTest, CameraClearColor) {
     glm::vec4 clearColor(0.1f, 0.2f, 0.3f, 1.0f);
 
@@ -460,4 +591,243 @@ TEST_F(RenderPipelineTest, HasPrerequisitesAndEffects) {
     EXPECT_FALSE(pipeline.hasEffects(9999));
 }
 
+TEST_F(RenderPipelineTest, TransientsWithDisjointLifetimesShareAFramebuffer) {
+    unsigned int created = 0;
+    auto pool = std::make_shared<NxTransientPool>([&created](const NxFramebufferSpecs &) {
+        ++created;
+        return std::make_shared<MockFramebuffer>();
+    });
+    auto renderTarget = createMockFramebuffer();
+    EXPECT_CALL(*renderTarget, getSize()).WillRepeatedly(::testing::Return(glm::vec2(800.0f, 600.0f)));
+
+    // A writes "a", B reads "a" and writes "b", C reads "b" and writes "c", D reads "c"
+    std::vector<std::shared_ptr<TransientMockPass>> chain;
+    for (const std::string name : {"A", "B", "C", "D"}) {
+        chain.push_back(std::make_shared<TransientMockPass>(static_cast<PassId>(1000 + chain.size()), name));
+        pipeline.addRenderPass(chain.back());
+    }
+    const std::array<std::string, 3> transients = {"a", "b", "c"};
+    for (size_t i = 0; i < transients.size(); ++i) {
+        chain[i]->writesTransient(transients[i], {NxFrameBufferTextureFormats::RGBA8});
+        chain[i + 1]->readsTransient(transients[i]);
+        pipeline.addPrerequisite(chain[i + 1]->getId(), chain[i]->getId());
+    }
+    pipeline.setFinalOutputPass(chain.back()->getId());
+    pipeline.setRenderTarget(renderTarget);
+    pipeline.setTransientPool(pool);
+
+    std::shared_ptr<NxFramebuffer> a;
+    std::shared_ptr<NxFramebuffer> c;
+    EXPECT_CALL(*chain[0], execute(::testing::_)).WillOnce([&](RenderPipeline &p) { a = p.getTransient("a"); });
+    EXPECT_CALL(*chain[1], execute(::testing::_)).WillOnce([&](RenderPipeline &p) {
+        EXPECT_EQ(p.getTransient("a"), a);
+        EXPECT_NE(p.getTransient("b"), nullptr);
+    });
+    EXPECT_CALL(*chain[2], execute(::testing::_)).WillOnce([&](RenderPipeline &p) {
+        // "a" is no longer read after B, "c" takes its framebuffer
+        EXPECT_EQ(p.getTransient("a"), nullptr);
+        c = p.getTransient("c");
+    });
+    EXPECT_CALL(*chain[3], execute(::testing::_)).Times(1);
+
+    pipeline.execute();
+
+    EXPECT_NE(a, nullptr);
+    EXPECT_EQ(c, a);
+    EXPECT_EQ(created, 2u);
+    EXPECT_EQ(pool->getAcquiredCount(), 0u);
+    EXPECT_EQ(pipeline.getTransient("c"), nullptr);
+}
+
+TEST_F(RenderPipelineTest, PassesWithoutWorkAreCulledWithTheirTransients) {
+    unsigned int created = 0;
+    auto pool = std::make_shared<NxTransientPool>([&created](const NxFramebufferSpecs &) {
+        ++created;
+        return std::make_shared<MockFramebuffer>();
+    });
+    auto renderTarget = createMockFramebuffer();
+    EXPECT_CALL(*renderTarget, getSize()).WillRepeatedly(::testing::Return(glm::vec2(800.0f, 600.0f)));
+
+    auto forward = std::make_shared<TransientMockPass>(2000, "Forward");
+    auto mask = std::make_shared<TransientMockPass>(2001, "Mask");
+    auto outline = std::make_shared<TransientMockPass>(2002, "Outline");
+    mask->writesTransient("Mask", {NxFrameBufferTextureFormats::RGBA8, NxFrameBufferTextureFormats::DEPTH24STENCIL8});
+    outline->readsTransient("Mask");
+    pipeline.addRenderPass(forward);
+    pipeline.addRenderPass(mask);
+    pipeline.addRenderPass(outline);
+    pipeline.addPrerequisite(outline->getId(), forward->getId());
+    pipeline.addPrerequisite(outline->getId(), mask->getId());
+    pipeline.setFinalOutputPass(outline->getId());
+    pipeline.setRenderTarget(renderTarget);
+    pipeline.setTransientPool(pool);
+
+    // Nothing to draw into the mask: the outline reading it is culled as well
+    mask->active = false;
+    EXPECT_CALL(*forward, execute(::testing::_)).Times(2);
+    EXPECT_CALL(*mask, execute(::testing::_)).Times(0);
+    EXPECT_CALL(*outline, execute(::testing::_)).Times(0);
+    pipeline.execute();
+    EXPECT_THAT(pipeline.getActivePasses(), ::testing::ElementsAre(forward->getId()));
+
+    // Nobody reads the mask anymore: the pass writing it is culled
+    mask->active = true;
+    outline->active = false;
+    pipeline.execute();
+    EXPECT_THAT(pipeline.getActivePasses(), ::testing::ElementsAre(forward->getId()));
+    EXPECT_EQ(created, 0u);
+}
+
+// Pass rendering into a transient or sampling it without any mocked call, so it can run in allocation free frames
+class TransientFramePass : public RenderPass {
+public:
+    TransientFramePass(const PassId id, const std::string &name) : RenderPass(id, name) {}
+    using RenderPass::writesTransient;
+    using RenderPass::readsTransient;
+
+    void execute(RenderPipeline &pipeline) override
+    {
+        for (const auto &transient : getReadTransients())
+            missingTransients += pipeline.getTransient(transient) == nullptr;
+        drawnCommands += pipeline.getSortedDrawCommands(0).size();
+    }
+
+    size_t missingTransients = 0;
+    size_t drawnCommands = 0;
+};
+
+TEST_F(RenderPipelineTest, SteadyStateFrameDoesNotAllocate) {
+    auto pool = std::make_shared<NxTransientPool>([](const NxFramebufferSpecs &) {
+        return std::make_shared<MockFramebuffer>();
+    });
+    auto writer = std::make_shared<TransientFramePass>(3000, "Writer");
+    auto reader = std::make_shared<TransientFramePass>(3001, "Reader");
+    writer->writesTransient("Frame", {NxFrameBufferTextureFormats::RGBA8}, 64, 64);
+    reader->readsTransient("Frame");
+    pipeline.addRenderPass(writer);
+    pipeline.addRenderPass(reader);
+    pipeline.addPrerequisite(reader->getId(), writer->getId());
+    pipeline.setFinalOutputPass(reader->getId());
+    pipeline.setRenderTarget(createMockFramebuffer());
+    pipeline.setTransientPool(pool);
+
+    const UniformSlot model = UniformRegistry::getSlot("uAllocationTestModel");
+    const UniformSlot entity = UniformRegistry::getSlot("uAllocationTestEntity");
+    NxFrameArena arena;
+    auto sceneCommands = std::make_shared<std::vector<DrawCommand>>();
+
+    // Mirrors a frame of the render systems: commands rebuilt, culled into the arena and executed
+    const auto renderFrame = [&] {
+        arena.reset();
+        sceneCommands->clear();
+        for (int i = 0; i < 512; ++i) {
+            DrawCommand cmd;
+            cmd.filterMask = 1 << 0;
+            cmd.uniforms.set(model, glm::mat4(1.0f));
+            cmd.uniforms.set(entity, i);
+            cmd.sortPosition = glm::vec3(0.0f, 0.0f, static_cast<float>(i));
+            sceneCommands->push_back(cmd);
+        }
+        const auto visible = arena.allocate<uint32_t>(sceneCommands->size() / 2);
+        for (size_t i = 0; i < visible.size(); ++i)
+            visible[i] = static_cast<uint32_t>(i * 2);
+        pipeline.addDrawCommands(sceneCommands, visible);
+
+        DrawCommand fullscreen;
+        fullscreen.type = CommandType::FULL_SCREEN;
+        fullscreen.filterMask = 1 << 0;
+        fullscreen.uniforms.set(entity, -1);
+        pipeline.addDrawCommand(fullscreen);
+        pipeline.execute();
+    };
+
+    // The first frames size the buffers of the pipeline, the arena and the pool
+    renderFrame();
+    renderFrame();
+
+    allocationCount = 0;
+    countAllocations = true;
+    renderFrame();
+    countAllocations = false;
+
+    EXPECT_EQ(allocationCount.load(), 0u);
+    EXPECT_EQ(reader->missingTransients, 0u);
+    EXPECT_EQ(reader->drawnCommands, 3u * 257u);
+    EXPECT_EQ(pool->getFramebufferCount(), 1u);
+}
+
+TEST(TransientPoolTest, IdleFramebuffersAreEvicted) {
+    NxTransientPool pool([](const NxFramebufferSpecs &) { return std::make_shared<MockFramebuffer>(); });
+    NxFramebufferSpecs small;
+    small.width = 64;
+    small.height = 64;
+    small.attachments = {NxFrameBufferTextureFormats::RGBA8};
+    NxFramebufferSpecs large = small;
+    large.width = 128;
+
+    const auto first = pool.acquire(small);
+    const auto second = pool.acquire(large);
+    EXPECT_NE(first, second);
+    pool.release(first);
+    EXPECT_EQ(pool.acquire(small), first);
+    EXPECT_THROW(pool.release(std::make_shared<MockFramebuffer>()), NxInvalidValue);
+
+    pool.release(first);
+    pool.release(second);
+    for (unsigned int frame = 0; frame < NxTransientPool::MAX_IDLE_FRAMES; ++frame) {
+        if (frame % 2 == 0) {
+            pool.release(pool.acquire(small));
+        }
+        pool.endFrame();
+    }
+    EXPECT_EQ(pool.getFramebufferCount(), 2u);
+    pool.endFrame();
+    EXPECT_EQ(pool.getFramebufferCount(), 1u);
+    EXPECT_EQ(pool.acquire(small), first);
+}
+
+TEST(TransientPoolTest, IdleFramebuffersAreResizedInsteadOfDuplicated) {
+    std::vector<std::shared_ptr<MockFramebuffer>> created;
+    NxTransientPool pool([&created](const NxFramebufferSpecs &) {
+        return created.emplace_back(std::make_shared<MockFramebuffer>());
+    });
+    NxFramebufferSpecs specs;
+    specs.width = 64;
+    specs.height = 64;
+    specs.attachments = {NxFrameBufferTextureFormats::RGBA8, NxFrameBufferTextureFormats::DEPTH24STENCIL8};
+
+    pool.release(pool.acquire(specs));
+    pool.endFrame();
+
+    // A viewport being resized asks for a new size every frame, the idle framebuffer follows it
+    for (unsigned int size = 65; size < 70; ++size) {
+        NxFramebufferSpecs resized = specs;
+        resized.width = size;
+        EXPECT_CALL(*created.front(), resize(size, 64u)).Times(1);
+        const auto framebuffer = pool.acquire(resized);
+        EXPECT_EQ(framebuffer, created.front());
+        pool.release(framebuffer);
+        pool.endFrame();
+    }
+    EXPECT_EQ(pool.getFramebufferCount(), 1u);
+
+    // Another format is never resized into
+    NxFramebufferSpecs otherFormat = specs;
+    otherFormat.attachments = {NxFrameBufferTextureFormats::RGBA16};
+    EXPECT_NE(pool.acquire(otherFormat), created.front());
+
+    // Framebuffers released during the frame keep their size for the pipelines rendering after
+    NxFramebufferSpecs current = specs;
+    current.width = 69;
+    const auto first = pool.acquire(current);
+    pool.release(first);
+    NxFramebufferSpecs other = specs;
+    other.width = 32;
+    EXPECT_NE(pool.acquire(other), first);
+    EXPECT_EQ(pool.getFramebufferCount(), 3u);
+
+    pool.clear();
+    EXPECT_EQ(pool.getFramebufferCount(), 0u);
+}
+
 } // namespace nexo::renderer
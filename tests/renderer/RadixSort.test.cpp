@@ -0,0 +1,71 @@
+//// RadixSort.test.cpp ////////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the draw command radix sort
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+
+#include "renderer/RadixSort.hpp"
+
+namespace nexo::renderer {
+
+    struct RadixSortItem {
+        uint64_t key;
+        int order;
+    };
+
+    TEST(RadixSortTest, SortsLikeStableSort)
+    {
+        std::mt19937_64 rng(42);
+        std::vector<RadixSortItem> items;
+        for (int i = 0; i < 1000; ++i)
+            items.push_back({rng() % 64 << 40 | rng() % 4, i});
+
+        auto expected = items;
+        std::ranges::stable_sort(expected, {}, &RadixSortItem::key);
+
+        std::vector<RadixSortItem> scratch;
+        radixSort(items, scratch, [](const RadixSortItem &item) { return item.key; });
+        for (size_t i = 0; i < items.size(); ++i) {
+            EXPECT_EQ(items[i].key, expected[i].key);
+            EXPECT_EQ(items[i].order, expected[i].order);
+        }
+    }
+
+    TEST(RadixSortTest, HandlesTrivialInputs)
+    {
+        std::vector<RadixSortItem> scratch;
+        std::vector<RadixSortItem> empty;
+        radixSort(empty, scratch, [](const RadixSortItem &item) { return item.key; });
+        EXPECT_TRUE(empty.empty());
+
+        std::vector<RadixSortItem> sameKeys = {{7, 0}, {7, 1}, {7, 2}};
+        radixSort(sameKeys, scratch, [](const RadixSortItem &item) { return item.key; });
+        EXPECT_EQ(sameKeys[0].order, 0);
+        EXPECT_EQ(sameKeys[2].order, 2);
+
+        std::vector<RadixSortItem> fullRange = {{~uint64_t{0}, 0}, {0, 1}, {uint64_t{1} << 63, 2}};
+        radixSort(fullRange, scratch, [](const RadixSortItem &item) { return item.key; });
+        EXPECT_EQ(fullRange[0].order, 1);
+        EXPECT_EQ(fullRange[1].order, 2);
+        EXPECT_EQ(fullRange[2].order, 0);
+    }
+
+}
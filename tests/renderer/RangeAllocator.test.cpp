@@ -0,0 +1,95 @@
+//// RangeAllocator.test.cpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the range allocator backing the mesh arena
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include "renderer/RangeAllocator.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+namespace nexo::renderer {
+
+    TEST(RangeAllocatorTest, AllocatesFirstFit)
+    {
+        NxRangeAllocator allocator(100);
+        EXPECT_EQ(allocator.allocate(10), 0);
+        EXPECT_EQ(allocator.allocate(20), 10);
+        EXPECT_EQ(allocator.used(), 30);
+        EXPECT_EQ(allocator.largestFreeBlock(), 70);
+        EXPECT_EQ(allocator.allocate(71), std::nullopt);
+    }
+
+    TEST(RangeAllocatorTest, ReusesAndCoalescesFreedRanges)
+    {
+        NxRangeAllocator allocator(100);
+        const auto a = allocator.allocate(10);
+        const auto b = allocator.allocate(10);
+        const auto c = allocator.allocate(10);
+        ASSERT_TRUE(a && b && c);
+
+        allocator.free(*a, 10);
+        allocator.free(*c, 10);
+        // [0, 10) and [20, 100) are free
+        EXPECT_EQ(allocator.freeBlockCount(), 2);
+        EXPECT_EQ(allocator.allocate(5), 0);
+        allocator.free(0, 5);
+
+        allocator.free(*b, 10);
+        EXPECT_EQ(allocator.freeBlockCount(), 1);
+        EXPECT_EQ(allocator.largestFreeBlock(), 100);
+        EXPECT_EQ(allocator.used(), 0);
+    }
+
+    TEST(RangeAllocatorTest, GrowAppendsFreeSpace)
+    {
+        NxRangeAllocator allocator(10);
+        EXPECT_EQ(allocator.allocate(8), 0);
+        EXPECT_EQ(allocator.allocate(8), std::nullopt);
+
+        allocator.grow(20);
+        EXPECT_EQ(allocator.capacity(), 20);
+        // The 2 units left at the end merge with the new space
+        EXPECT_EQ(allocator.freeBlockCount(), 1);
+        EXPECT_EQ(allocator.allocate(8), 8);
+    }
+
+    TEST(RangeAllocatorTest, ResetKeepsOnlyTheCompactedPrefix)
+    {
+        NxRangeAllocator allocator(50);
+        ASSERT_TRUE(allocator.allocate(10));
+        ASSERT_TRUE(allocator.allocate(10));
+        allocator.free(0, 10);
+
+        allocator.reset(10);
+        EXPECT_EQ(allocator.used(), 10);
+        EXPECT_EQ(allocator.freeBlockCount(), 1);
+        EXPECT_EQ(allocator.allocate(40), 10);
+    }
+
+    TEST(RangeAllocatorTest, InvalidFreeThrows)
+    {
+        NxRangeAllocator allocator(20);
+        ASSERT_TRUE(allocator.allocate(10));
+        EXPECT_THROW(allocator.free(15, 10), NxInvalidValue);
+        EXPECT_THROW(allocator.free(12, 2), NxInvalidValue);
+        allocator.free(0, 10);
+        EXPECT_THROW(allocator.free(0, 10), NxInvalidValue);
+    }
+
+}
@@ -0,0 +1,161 @@
+//// RenderProfiler.test.cpp ///////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the render profiler
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "RenderProfiler.hpp"
+#include "RendererExceptions.hpp"
+
+namespace nexo::renderer {
+
+    static NxPassStats makePass(const std::string &name, const double cpuMs, const uint64_t drawCalls)
+    {
+        NxPassStats stats;
+        stats.pass = name;
+        stats.cpuMs = cpuMs;
+        stats.counters.drawCalls = drawCalls;
+        stats.counters.triangles = drawCalls * 12;
+        return stats;
+    }
+
+    TEST(RenderProfilerTest, CountersDifferenceIsTheWorkInBetween)
+    {
+        NxRenderCounters before{.drawCalls = 2, .instances = 4, .uploadedBytes = 64};
+        NxRenderCounters after = before;
+        after += NxRenderCounters{.drawCalls = 3, .instances = 5, .textureBinds = 1};
+
+        const NxRenderCounters difference = after - before;
+        EXPECT_EQ(difference.drawCalls, 3u);
+        EXPECT_EQ(difference.instances, 5u);
+        EXPECT_EQ(difference.uploadedBytes, 0u);
+        EXPECT_EQ(difference.textureBinds, 1u);
+    }
+
+    TEST(RenderProfilerTest, PipelinesOutsideOfAFrameAreIgnored)
+    {
+        auto &profiler = NxRenderProfiler::get();
+        profiler.endFrame();
+        std::array passes = {makePass("Forward", 1.0, 1)};
+        EXPECT_FALSE(profiler.isFrameOpen());
+        EXPECT_EQ(profiler.recordPipeline(passes), 0u);
+        EXPECT_EQ(passes[0].camera, 0u);
+    }
+
+    TEST(RenderProfilerTest, PassesAreGroupedPerCamera)
+    {
+        auto &profiler = NxRenderProfiler::get();
+        profiler.beginFrame();
+        std::array mainCamera = {makePass("Forward", 1.0, 4), makePass("Outline", 0.5, 1)};
+        std::array secondCamera = {makePass("Forward", 2.0, 3)};
+        EXPECT_EQ(profiler.recordPipeline(mainCamera), 0u);
+        EXPECT_EQ(profiler.recordPipeline(secondCamera), 1u);
+        profiler.endFrame();
+
+        const auto passes = profiler.getPassStats();
+        ASSERT_EQ(passes.size(), 3u);
+        EXPECT_EQ(passes[1].pass, "Outline");
+        EXPECT_EQ(passes[1].camera, 0u);
+        EXPECT_EQ(passes[2].camera, 1u);
+
+        const auto cameras = profiler.getCameraStats();
+        ASSERT_EQ(cameras.size(), 2u);
+        EXPECT_DOUBLE_EQ(cameras[0].cpuMs, 1.5);
+        EXPECT_EQ(cameras[0].counters.drawCalls, 5u);
+        EXPECT_EQ(cameras[0].counters.triangles, 60u);
+        EXPECT_EQ(cameras[1].counters.drawCalls, 3u);
+        EXPECT_GE(profiler.getFrameCpuMs(), 0.0);
+
+        // An empty frame replaces the statistics instead of accumulating
+        profiler.beginFrame();
+        profiler.endFrame();
+        EXPECT_TRUE(profiler.getPassStats().empty());
+        EXPECT_TRUE(profiler.getCameraStats().empty());
+    }
+
+    TEST(RenderProfilerTest, TraceContainsEveryPassOfTheRecordedFrames)
+    {
+        const auto path = std::filesystem::temp_directory_path() / "nexo_render_profiler_trace.json";
+        auto &profiler = NxRenderProfiler::get();
+        profiler.startTrace(path);
+        EXPECT_TRUE(profiler.isTracing());
+        for (int frame = 0; frame < 2; ++frame) {
+            profiler.beginFrame();
+            std::array passes = {makePass("Shadow \"cascade\"", 0.25, 2)};
+            passes[0].gpuMs = 0.5;
+            profiler.recordPipeline(passes);
+            profiler.endFrame();
+        }
+        profiler.stopTrace();
+        EXPECT_FALSE(profiler.isTracing());
+
+        std::ifstream file(path);
+        std::stringstream content;
+        content << file.rdbuf();
+        const std::string trace = content.str();
+        std::filesystem::remove(path);
+
+        EXPECT_EQ(trace.front(), '[');
+        EXPECT_EQ(trace[trace.find_last_not_of('\n')], ']');
+        size_t passEvents = 0;
+        for (size_t pos = trace.find(R"("name":"Shadow \"cascade\"")"); pos != std::string::npos;
+             pos = trace.find(R"("name":"Shadow \"cascade\"")", pos + 1))
+            ++passEvents;
+        EXPECT_EQ(passEvents, 2u);
+        EXPECT_NE(trace.find(R"("gpuMs":0.500)"), std::string::npos);
+        EXPECT_NE(trace.find(R"("drawCalls":2)"), std::string::npos);
+    }
+
+    TEST(RenderProfilerTest, TraceEscapesControlCharacters)
+    {
+        const auto path = std::filesystem::temp_directory_path() / "nexo_render_profiler_escaped_trace.json";
+        auto &profiler = NxRenderProfiler::get();
+        profiler.startTrace(path);
+        profiler.beginFrame();
+        std::array passes = {makePass("Line\nTab\tBell\aUnit\x1f\\", 0.25, 1)};
+        profiler.recordPipeline(passes);
+        profiler.endFrame();
+        profiler.stopTrace();
+
+        std::ifstream file(path);
+        std::stringstream content;
+        content << file.rdbuf();
+        const std::string trace = content.str();
+        std::filesystem::remove(path);
+
+        EXPECT_NE(trace.find(R"("name":"Line\nTab\tBell\u0007Unit\u001f\\")"), std::string::npos);
+        // Events are only separated by line breaks, no other control character may reach the file
+        EXPECT_TRUE(std::ranges::none_of(trace, [](const char c) {
+            return static_cast<unsigned char>(c) < 0x20 && c != '\n';
+        }));
+    }
+
+    TEST(RenderProfilerTest, UnwritableTraceThrows)
+    {
+        EXPECT_THROW(NxRenderProfiler::get().startTrace("/nonexistent/directory/trace.json"), NxInvalidValue);
+        EXPECT_FALSE(NxRenderProfiler::get().isTracing());
+    }
+
+}
@@ -107,6 +107,30 @@ namespace nexo::renderer {
         EXPECT_NEAR(depthValue, 1.0f, 0.01f);
     }
 
+    TEST_F(OpenGLTest, BlendFuncGoesThroughTheStateCache) {
+        NxOpenGlRendererApi rendererApi;
+        EXPECT_THROW(rendererApi.setBlendFunc(GL_ONE, GL_ONE), NxGraphicsApiNotInitialized);
+        rendererApi.init();
+
+        GLint source = 0;
+        GLint destination = 0;
+        glGetIntegerv(GL_BLEND_SRC_RGB, &source);
+        glGetIntegerv(GL_BLEND_DST_RGB, &destination);
+        EXPECT_EQ(source, GL_SRC_ALPHA);
+        EXPECT_EQ(destination, GL_ONE_MINUS_SRC_ALPHA);
+
+        // The default set by init is cached, setting it again is skipped
+        const uint64_t avoided = rendererApi.getStateCache().getAvoidedCount();
+        rendererApi.setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        EXPECT_EQ(rendererApi.getStateCache().getAvoidedCount(), avoided + 1);
+
+        rendererApi.setBlendFunc(GL_ONE, GL_ONE);
+        glGetIntegerv(GL_BLEND_SRC_RGB, &source);
+        glGetIntegerv(GL_BLEND_DST_RGB, &destination);
+        EXPECT_EQ(source, GL_ONE);
+        EXPECT_EQ(destination, GL_ONE);
+    }
+
     TEST_F(OpenGLTest, ExceptionOnUninitializedAPI) {
         NxOpenGlRendererApi rendererApi;
 
@@ -117,10 +141,12 @@ namespace nexo::renderer {
 
         auto vertexArray = std::make_shared<NxOpenGlVertexArray>();
         EXPECT_THROW(rendererApi.drawIndexed(vertexArray), NxGraphicsApiNotInitialized);
+        EXPECT_THROW(rendererApi.drawIndexedInstanced(vertexArray, 2, 0), NxGraphicsApiNotInitialized);
 
         // Validate exception is thrown when passing a null vertex array
         rendererApi.init();
         EXPECT_THROW(rendererApi.drawIndexed(nullptr), NxInvalidValue);
+        EXPECT_THROW(rendererApi.drawIndexedInstanced(nullptr, 2, 0), NxInvalidValue);
     }
 
 }
@@ -22,16 +22,39 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <fstream>
 #include <sstream>
+#include <filesystem>
+#include <memory>
 
 #include "../utils/comparison.hpp"
 #include "contexts/opengl.hpp"
 #include "opengl/OpenGlShader.hpp"
+#include "opengl/OpenGlShaderCache.hpp"
 #include "renderer/RendererExceptions.hpp"
 
 namespace nexo::renderer {
 
     class ShaderTest : public OpenGLTest {
         protected:
+            const std::filesystem::path cacheDirectory = std::filesystem::temp_directory_path() / "nexo_shader_cache_test";
+            std::filesystem::path previousCacheDirectory;
+
+            void SetUp() override
+            {
+                OpenGLTest::SetUp();
+                // Records of the test shaders must not leak into the cache of the engine, nor into other runs
+                std::filesystem::remove_all(cacheDirectory);
+                previousCacheDirectory = NxOpenGlShaderCache::getDirectory();
+                NxOpenGlShaderCache::setDirectory(cacheDirectory);
+            }
+
+            void TearDown() override
+            {
+                // Later tests of the binary compile through the cache directory they expect
+                NxOpenGlShaderCache::setDirectory(previousCacheDirectory);
+                std::filesystem::remove_all(cacheDirectory);
+                OpenGLTest::TearDown();
+            }
+
             std::string vertexShaderSource = R"(
                 #version 450 core
                 layout(location = 0) in vec3 aPosition;
@@ -116,6 +139,96 @@ namespace nexo::renderer {
         deleteTemporaryShaderFile();
     }
 
+    TEST_F(ShaderTest, LinkedProgramIsReloadedFromTheBinaryCache)
+    {
+        if (!NxOpenGlShaderCache::isSupported())
+            GTEST_SKIP() << "The driver cannot save program binaries";
+        createTemporaryShaderFile(R"(
+            #type vertex
+            #version 450 core
+            layout(location = 0) in vec3 aPos;
+            uniform mat4 uModel;
+            void main() {
+                gl_Position = uModel * vec4(aPos, 1.0);
+            }
+            #type fragment
+            #version 450 core
+            out vec4 color;
+            uniform vec4 uColor;
+            void main() {
+                color = uColor;
+            }
+        )");
+
+        const NxOpenGlShader compiled(temporaryShaderFilePath);
+        ASSERT_FALSE(std::filesystem::is_empty(cacheDirectory));
+
+        // Same sources: the program and its reflection come from the record
+        const NxOpenGlShader cached(temporaryShaderFilePath);
+        EXPECT_TRUE(cached.hasUniform("uModel"));
+        EXPECT_TRUE(cached.hasUniform("uColor"));
+        EXPECT_TRUE(cached.hasAttribute(0));
+        cached.bind();
+        EXPECT_TRUE(cached.setUniformFloat4("uColor", glm::vec4(1.0f)));
+        cached.unbind();
+
+        deleteTemporaryShaderFile();
+    }
+
+    TEST_F(ShaderTest, EditedSourceIsCompiledAgain)
+    {
+        createTemporaryShaderFile(R"(
+            #type vertex
+            #version 450 core
+            void main() { gl_Position = vec4(0.0); }
+            #type fragment
+            #version 450 core
+            out vec4 color;
+            void main() { color = vec4(1.0); }
+        )");
+        const NxOpenGlShader first(temporaryShaderFilePath);
+        EXPECT_FALSE(first.hasUniform("uColor"));
+
+        createTemporaryShaderFile(R"(
+            #type vertex
+            #version 450 core
+            void main() { gl_Position = vec4(0.0); }
+            #type fragment
+            #version 450 core
+            out vec4 color;
+            uniform vec4 uColor;
+            void main() { color = uColor; }
+        )");
+        const NxOpenGlShader edited(temporaryShaderFilePath);
+        EXPECT_TRUE(edited.hasUniform("uColor"));
+
+        deleteTemporaryShaderFile();
+    }
+
+    TEST_F(ShaderTest, DeferredLinkIsCheckedByFinishCompilation)
+    {
+        createTemporaryShaderFile(R"(
+            #type vertex
+            #version 450 core
+            void main() { gl_Position = vec4(0.0); }
+            #type fragment
+            #version 450 core
+            out vec4 color;
+            void main() { color = undeclared; }
+        )");
+        std::unique_ptr<NxOpenGlShader> shader;
+        // Without parallel compile support the check happens in the constructor
+        try {
+            shader = std::make_unique<NxOpenGlShader>(temporaryShaderFilePath, std::vector<std::string>{}, true);
+        } catch (const NxShaderCreationFailed &) {
+            EXPECT_FALSE(NxOpenGlShader::isParallelCompileSupported());
+        }
+        if (shader)
+            EXPECT_THROW(shader->finishCompilation(), NxShaderCreationFailed);
+
+        deleteTemporaryShaderFile();
+    }
+
     TEST_F(ShaderTest, InvalidShaderFile)
     {
         EXPECT_THROW(NxOpenGlShader("non_existing_file.glsl"), NxFileNotFoundException);
@@ -0,0 +1,75 @@
+//// ShaderVariants.test ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the shader permutations
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+
+#include "renderer/ShaderVariants.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+namespace nexo::renderer {
+
+    TEST(ShaderVariantsTest, ParsesKeywordsDeclaredBeforeTheStages)
+    {
+        const auto keywords = NxShaderVariants::parseKeywords(
+            "// Feature keywords\n"
+            "#keywords NX_INSTANCED NX_UNLIT\n"
+            "  #keywords NX_SKINNED NX_UNLIT\n"
+            "#type vertex\n"
+            "#keywords NX_IGNORED\n"
+        );
+        EXPECT_EQ(keywords, (std::vector<std::string>{"NX_INSTANCED", "NX_UNLIT", "NX_SKINNED"}));
+        EXPECT_TRUE(NxShaderVariants::parseKeywords("#type vertex\n#version 430 core\n").empty());
+    }
+
+    TEST(ShaderVariantsTest, RejectsTooManyKeywords)
+    {
+        std::string source = "#keywords";
+        for (size_t i = 0; i <= NX_MAX_SHADER_KEYWORDS; ++i)
+            source += " NX_KEYWORD_" + std::to_string(i);
+        EXPECT_THROW(static_cast<void>(NxShaderVariants::parseKeywords(source)), NxShaderCreationFailed);
+    }
+
+    TEST(ShaderVariantsTest, MapsKeywordsToMaskBitsAndDefines)
+    {
+        const std::string path = "test_shader_variants.glsl";
+        {
+            std::ofstream file(path);
+            file << "#keywords NX_INSTANCED NX_UNLIT\n#type vertex\n#version 430 core\nvoid main() {}\n";
+        }
+        const NxShaderVariants variants(path);
+        std::remove(path.c_str());
+
+        EXPECT_EQ(variants.getKeywordMask("NX_INSTANCED"), 0b01);
+        EXPECT_EQ(variants.getKeywordMask("NX_UNLIT"), 0b10);
+        EXPECT_EQ(variants.getKeywordMask("NX_UNKNOWN"), 0);
+        EXPECT_TRUE(variants.getDefines(0).empty());
+        EXPECT_EQ(variants.getDefines(0b11), (std::vector<std::string>{"NX_INSTANCED", "NX_UNLIT"}));
+        // Undeclared bits have no define
+        EXPECT_EQ(variants.getDefines(0b110), std::vector<std::string>{"NX_UNLIT"});
+    }
+
+    TEST(ShaderVariantsTest, MissingSourceThrows)
+    {
+        EXPECT_THROW(NxShaderVariants("non_existing_variants.glsl"), NxFileNotFoundException);
+    }
+
+}
@@ -0,0 +1,101 @@
+//// StateCache.test.cpp ///////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the cache of the bound graphics state
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <gtest/gtest.h>
+
+#include "StateCache.hpp"
+
+namespace nexo::renderer {
+
+    TEST(StateCacheTest, RedundantChangesAreSkippedAndCounted)
+    {
+        NxStateCache cache;
+        EXPECT_TRUE(cache.setProgram(3));
+        EXPECT_FALSE(cache.setProgram(3));
+        EXPECT_TRUE(cache.setProgram(4));
+        EXPECT_TRUE(cache.setCapability(NxStateCache::Capability::DEPTH_TEST, true));
+        EXPECT_FALSE(cache.setCapability(NxStateCache::Capability::DEPTH_TEST, true));
+        EXPECT_TRUE(cache.setCapability(NxStateCache::Capability::BLEND, true));
+        EXPECT_TRUE(cache.setStencilFunc(1, 0, 0xFF));
+        EXPECT_FALSE(cache.setStencilFunc(1, 0, 0xFF));
+        EXPECT_TRUE(cache.setStencilFunc(1, 1, 0xFF));
+        EXPECT_TRUE(cache.setViewport(0, 0, 800, 600));
+        EXPECT_FALSE(cache.setViewport(0, 0, 800, 600));
+
+        EXPECT_EQ(cache.getIssuedCount(), 7u);
+        EXPECT_EQ(cache.getAvoidedCount(), 4u);
+        cache.resetCounters();
+        EXPECT_EQ(cache.getIssuedCount(), 0u);
+        EXPECT_EQ(cache.getAvoidedCount(), 0u);
+    }
+
+    TEST(StateCacheTest, TexturesAreTrackedPerUnit)
+    {
+        NxStateCache cache;
+        EXPECT_TRUE(cache.setTexture(0, 7));
+        EXPECT_TRUE(cache.setTexture(1, 7));
+        EXPECT_FALSE(cache.setTexture(0, 7));
+        EXPECT_TRUE(cache.setTexture(1, 0));
+
+        // Units past the tracked ones are never skipped
+        EXPECT_TRUE(cache.setTexture(NxStateCache::MAX_TEXTURE_UNITS, 7));
+        EXPECT_TRUE(cache.setTexture(NxStateCache::MAX_TEXTURE_UNITS, 7));
+    }
+
+    TEST(StateCacheTest, InvalidateForgetsEveryValue)
+    {
+        NxStateCache cache;
+        cache.setProgram(3);
+        cache.setVertexArray(5);
+        cache.setFramebuffer(2);
+        cache.setTexture(4, 9);
+        cache.setDepthMask(false);
+        cache.invalidate();
+
+        EXPECT_TRUE(cache.setProgram(3));
+        EXPECT_TRUE(cache.setVertexArray(5));
+        EXPECT_TRUE(cache.setFramebuffer(2));
+        EXPECT_TRUE(cache.setTexture(4, 9));
+        EXPECT_TRUE(cache.setDepthMask(false));
+        EXPECT_EQ(cache.getIssuedCount(), 10u);
+    }
+
+    TEST(StateCacheTest, DeletedObjectsAreForgotten)
+    {
+        NxStateCache cache;
+        cache.setProgram(3);
+        cache.setFramebuffer(2);
+        cache.setTexture(0, 9);
+        cache.setTexture(5, 9);
+        cache.setTexture(6, 8);
+
+        // The driver may reuse the names of deleted objects
+        cache.forgetProgram(3);
+        cache.forgetFramebuffer(1);
+        cache.forgetTexture(9);
+        EXPECT_TRUE(cache.setProgram(3));
+        EXPECT_FALSE(cache.setFramebuffer(2));
+        EXPECT_TRUE(cache.setTexture(0, 9));
+        EXPECT_TRUE(cache.setTexture(5, 9));
+        EXPECT_FALSE(cache.setTexture(6, 8));
+    }
+
+}
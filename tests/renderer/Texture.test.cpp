@@ -22,6 +22,7 @@
 #include <RendererExceptions.hpp>
 
 #include "opengl/OpenGlTexture2D.hpp"
+#include "opengl/OpenGlTextureTable.hpp"
 #include "renderer/Texture.hpp"
 #include "contexts/opengl.hpp"
 #include "flattenedAssets/testLogo.hpp"
@@ -144,4 +145,41 @@ namespace nexo::renderer {
         EXPECT_FALSE(texture1 == texture2); // Different textures
         EXPECT_TRUE(texture1 == texture1); // Same texture
     }
+
+    TEST_F(OpenGlTexture2DTest, TextureTableReturnsStableIndices) {
+        const auto white = std::make_shared<NxOpenGlTexture2D>(1, 1);
+        const auto albedo = std::make_shared<NxOpenGlTexture2D>(64, 64);
+        const auto roughness = std::make_shared<NxOpenGlTexture2D>(64, 64);
+        NxOpenGlTextureTable table(white);
+
+        EXPECT_EQ(table.getIndex(nullptr), 0);
+        EXPECT_EQ(table.getIndex(white), 0);
+
+        const int albedoIndex = table.getIndex(albedo);
+        const int roughnessIndex = table.getIndex(roughness);
+        EXPECT_NE(albedoIndex, 0);
+        EXPECT_NE(roughnessIndex, 0);
+        EXPECT_NE(albedoIndex, roughnessIndex);
+        EXPECT_EQ(table.getIndex(albedo), albedoIndex);
+        EXPECT_EQ(table.getTextureCount(), 3);
+        if (!table.isBindless()) {
+            // Same size and format share an array
+            EXPECT_EQ(albedoIndex >> 16, roughnessIndex >> 16);
+        }
+    }
+
+    TEST_F(OpenGlTexture2DTest, TextureTableReleasesDestroyedTextures) {
+        const auto white = std::make_shared<NxOpenGlTexture2D>(1, 1);
+        NxOpenGlTextureTable table(white);
+
+        auto texture = std::make_shared<NxOpenGlTexture2D>(32, 32);
+        const int index = table.getIndex(texture);
+        texture.reset();
+        table.bind();
+        EXPECT_EQ(table.getTextureCount(), 1);
+
+        // The freed index is handed to the next texture
+        const auto other = std::make_shared<NxOpenGlTexture2D>(32, 32);
+        EXPECT_EQ(table.getIndex(other), index);
+    }
 }
@@ -0,0 +1,174 @@
+//// UniformBlock.test.cpp /////////////////////////////////////////////////////
+//
+// ⢀⢀⢀⣤⣤⣤⡀⢀⢀⢀⢀⢀⢀⢠⣤⡄⢀⢀⢀⢀⣠⣤⣤⣤⣤⣤⣤⣤⣤⣤⡀⢀⢀⢀⢠⣤⣄⢀⢀⢀⢀⢀⢀⢀⣤⣤⢀⢀⢀⢀⢀⢀⢀⢀⣀⣄⢀⢀⢠⣄⣀⢀⢀⢀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⣿⣷⡀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡟⡛⡛⡛⡛⡛⡛⡛⢁⢀⢀⢀⢀⢻⣿⣦⢀⢀⢀⢀⢠⣾⡿⢃⢀⢀⢀⢀⢀⣠⣾⣿⢿⡟⢀⢀⡙⢿⢿⣿⣦⡀⢀⢀⢀⢀
+// ⢀⢀⢀⣿⣿⡛⣿⣷⡀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡙⣿⡷⢀⢀⣰⣿⡟⢁⢀⢀⢀⢀⢀⣾⣿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⣿⡆⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⡈⢿⣷⡄⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣇⣀⣀⣀⣀⣀⣀⣀⢀⢀⢀⢀⢀⢀⢀⡈⢀⢀⣼⣿⢏⢀⢀⢀⢀⢀⢀⣼⣿⡏⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⡘⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⡈⢿⣿⡄⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⣿⢿⢿⢿⢿⢿⢿⢿⢇⢀⢀⢀⢀⢀⢀⢀⢠⣾⣿⣧⡀⢀⢀⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⡈⢿⣿⢀⢀⢸⣿⡇⢀⢀⢀⢀⣿⣿⡇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣰⣿⡟⡛⣿⣷⡄⢀⢀⢀⢀⢀⢿⣿⣇⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣿⣿⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⡈⢿⢀⢀⢸⣿⡇⢀⢀⢀⢀⡛⡟⢁⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⡟⢀⢀⡈⢿⣿⣄⢀⢀⢀⢀⡘⣿⣿⣄⢀⢀⢀⢀⢀⢀⢀⢀⢀⣼⣿⢏⢀⢀⢀
+// ⢀⢀⢀⣿⣿⢀⢀⢀⢀⢀⢀⢀⢀⢸⣿⡇⢀⢀⢀⢀⢀⣀⣀⣀⣀⣀⣀⣀⣀⣀⡀⢀⢀⢀⣠⣾⡿⢃⢀⢀⢀⢀⢀⢻⣿⣧⡀⢀⢀⢀⡈⢻⣿⣷⣦⣄⢀⢀⣠⣤⣶⣿⡿⢋⢀⢀⢀⢀
+// ⢀⢀⢀⢿⢿⢀⢀⢀⢀⢀⢀⢀⢀⢸⢿⢃⢀⢀⢀⢀⢻⢿⢿⢿⢿⢿⢿⢿⢿⢿⢃⢀⢀⢀⢿⡟⢁⢀⢀⢀⢀⢀⢀⢀⡙⢿⡗⢀⢀⢀⢀⢀⡈⡉⡛⡛⢀⢀⢹⡛⢋⢁⢀⢀⢀⢀⢀⢀
+//
+//
+//  Author:      Mehdy MORVAN
+//  Date:        18/10/2026
+//  Description: Test file for the uniform registry and uniform block
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+
+#include "renderer/UniformBlock.hpp"
+#include "renderer/RendererExceptions.hpp"
+
+namespace nexo::renderer {
+
+    TEST(UniformRegistryTest, SameNameResolvesToSameSlot)
+    {
+        const UniformSlot first = UniformRegistry::getSlot("uUniformBlockTestA");
+        const UniformSlot second = UniformRegistry::getSlot("uUniformBlockTestB");
+
+        EXPECT_NE(first, second);
+        EXPECT_EQ(UniformRegistry::getSlot("uUniformBlockTestA"), first);
+        EXPECT_EQ(UniformRegistry::getName(second), "uUniformBlockTestB");
+        EXPECT_GE(UniformRegistry::size(), 2u);
+    }
+
+    TEST(UniformRegistryTest, UnknownSlotThrows)
+    {
+        EXPECT_THROW(UniformRegistry::getName(static_cast<UniformSlot>(UniformRegistry::size())), NxOutOfRangeException);
+    }
+
+    TEST(UniformBlockTest, StoresPackedValues)
+    {
+        const UniformSlot model = UniformRegistry::getSlot("uUniformBlockTestModel");
+        const UniformSlot color = UniformRegistry::getSlot("uUniformBlockTestColor");
+        const UniformSlot index = UniformRegistry::getSlot("uUniformBlockTestIndex");
+
+        UniformBlock block;
+        glm::mat4 matrix(2.0f);
+        block.set(model, glm::mat4(1.0f));
+        block.set(color, glm::vec4(0.1f, 0.2f, 0.3f, 0.4f));
+        block.set(index, 7);
+
+        ASSERT_EQ(block.size(), 3u);
+        EXPECT_EQ(block.entries()[0].type, UniformType::MAT4);
+        EXPECT_EQ(block.entries()[1].offset, 16);
+        EXPECT_EQ(block.entries()[2].offset, 20);
+        EXPECT_EQ(std::get<glm::mat4>(*block.get(model)), glm::mat4(1.0f));
+        EXPECT_EQ(std::get<glm::vec4>(*block.get(color)), glm::vec4(0.1f, 0.2f, 0.3f, 0.4f));
+        EXPECT_EQ(std::get<int>(*block.get(index)), 7);
+    }
+
+    TEST(UniformBlockTest, SettingASlotAgainOverwritesIt)
+    {
+        const UniformSlot time = UniformRegistry::getSlot("uUniformBlockTestTime");
+
+        UniformBlock block;
+        block.set(time, 1.0f);
+        block.set(time, 2.0f);
+        ASSERT_EQ(block.size(), 1u);
+        EXPECT_FLOAT_EQ(std::get<float>(*block.get(time)), 2.0f);
+
+        // Changing the type keeps a single entry
+        block.set(time, true);
+        ASSERT_EQ(block.size(), 1u);
+        EXPECT_TRUE(std::get<bool>(*block.get(time)));
+    }
+
+    TEST(UniformBlockTest, NameOverloadAndVariantMatchSlots)
+    {
+        UniformBlock block;
+        block.set("uUniformBlockTestPosition", glm::vec3(1.0f, 2.0f, 3.0f));
+        block.set(UniformRegistry::getSlot("uUniformBlockTestScale"), UniformValue(glm::vec2(4.0f, 5.0f)));
+
+        const UniformSlot position = UniformRegistry::getSlot("uUniformBlockTestPosition");
+        const UniformSlot scale = UniformRegistry::getSlot("uUniformBlockTestScale");
+        EXPECT_TRUE(block.contains(position));
+        EXPECT_EQ(std::get<glm::vec3>(*block.get(position)), glm::vec3(1.0f, 2.0f, 3.0f));
+        EXPECT_EQ(std::get<glm::vec2>(*block.get(scale)), glm::vec2(4.0f, 5.0f));
+        EXPECT_FALSE(block.get(UniformRegistry::getSlot("uUniformBlockTestUnset")).has_value());
+
+        block.clear();
+        EXPECT_TRUE(block.empty());
+        EXPECT_FALSE(block.contains(position));
+    }
+
+    TEST(UniformBlockTest, EntriesBeyondTheInlineBudgetSpillToTheHeap)
+    {
+        UniformBlock block;
+        std::vector<UniformSlot> slots;
+        for (std::size_t i = 0; i <= UniformBlock::MAX_ENTRIES; ++i) {
+            slots.push_back(UniformRegistry::getSlot("uUniformBlockTestSpill" + std::to_string(i)));
+            EXPECT_FALSE(block.isSpilled());
+            block.set(slots.back(), static_cast<int>(i));
+        }
+
+        EXPECT_TRUE(block.isSpilled());
+        EXPECT_EQ(block.size(), UniformBlock::MAX_ENTRIES + 1);
+        for (std::size_t i = 0; i < slots.size(); ++i)
+            EXPECT_EQ(std::get<int>(*block.get(slots[i])), static_cast<int>(i));
+
+        block.clear();
+        EXPECT_FALSE(block.isSpilled());
+        block.set(slots.front(), 1.0f);
+        EXPECT_EQ(std::get<float>(*block.get(slots.front())), 1.0f);
+    }
+
+    TEST(UniformBlockTest, ValuesBeyondTheInlineBudgetSpillToTheHeap)
+    {
+        const UniformSlot model = UniformRegistry::getSlot("uUniformBlockTestSpillModel");
+        const UniformSlot view = UniformRegistry::getSlot("uUniformBlockTestSpillView");
+        const UniformSlot projection = UniformRegistry::getSlot("uUniformBlockTestSpillProjection");
+        UniformBlock block;
+        block.set(model, glm::mat4(1.0f));
+        block.set(view, glm::mat4(2.0f));
+        EXPECT_FALSE(block.isSpilled());
+        block.set(projection, glm::mat4(3.0f));
+
+        EXPECT_TRUE(block.isSpilled());
+        EXPECT_EQ(block.dataSize(), 48u);
+        EXPECT_EQ(std::get<glm::mat4>(*block.get(model)), glm::mat4(1.0f));
+        EXPECT_EQ(std::get<glm::mat4>(*block.get(view)), glm::mat4(2.0f));
+        EXPECT_EQ(std::get<glm::mat4>(*block.get(projection)), glm::mat4(3.0f));
+
+        const UniformBlock copy = block;
+        EXPECT_EQ(std::get<glm::mat4>(*copy.get(projection)), glm::mat4(3.0f));
+    }
+
+    TEST(UniformBlockTest, GrowingATypeReleasesItsPreviousRange)
+    {
+        const UniformSlot grown = UniformRegistry::getSlot("uUniformBlockTestGrown");
+        const UniformSlot after = UniformRegistry::getSlot("uUniformBlockTestAfterGrown");
+
+        UniformBlock block;
+        block.set(grown, 1.0f);
+        block.set(after, glm::vec4(1.0f, 2.0f, 3.0f, 4.0f));
+        block.set(grown, glm::vec2(1.0f, 2.0f));
+        block.set(grown, glm::vec3(1.0f, 2.0f, 3.0f));
+        block.set(grown, glm::vec4(1.0f));
+        block.set(grown, glm::mat4(5.0f));
+
+        // Without releasing the previous ranges the block would have spilled
+        EXPECT_FALSE(block.isSpilled());
+        EXPECT_EQ(block.dataSize(), 20u);
+        EXPECT_EQ(std::get<glm::mat4>(*block.get(grown)), glm::mat4(5.0f));
+        EXPECT_EQ(std::get<glm::vec4>(*block.get(after)), glm::vec4(1.0f, 2.0f, 3.0f, 4.0f));
+
+        // The type can keep growing and shrinking without the buffer drifting
+        for (int i = 0; i < 8; ++i) {
+            block.set(grown, i);
+            block.set(after, glm::mat4(static_cast<float>(i)));
+            block.set(after, 0.0f);
+            block.set(grown, glm::mat4(static_cast<float>(i)));
+        }
+        EXPECT_FALSE(block.isSpilled());
+        EXPECT_EQ(std::get<glm::mat4>(*block.get(grown)), glm::mat4(7.0f));
+        EXPECT_EQ(std::get<float>(*block.get(after)), 0.0f);
+    }
+
+}
@@ -25,6 +25,7 @@
 #include "opengl/OpenGlBuffer.hpp"
 #include "contexts/opengl.hpp"
 #include "RendererExceptions.hpp"
+#include "InstanceData.hpp"
 
 namespace nexo::renderer {
 
@@ -200,4 +201,21 @@ namespace nexo::renderer {
             NxInvalidValue
         );
     }
+
+    TEST_F(OpenGLTest, SetInstanceBuffer)
+    {
+        auto vertexArray = std::make_shared<NxOpenGlVertexArray>();
+        auto instanceBuffer = std::make_shared<NxOpenGlVertexBuffer>(static_cast<unsigned int>(4 * sizeof(NxInstanceData)));
+
+        EXPECT_THROW(vertexArray->setInstanceBuffer(nullptr), NxInvalidValue);
+        EXPECT_NO_THROW(vertexArray->setInstanceBuffer(instanceBuffer));
+
+        vertexArray->bind();
+        GLint divisor = 0;
+        glGetVertexAttribiv(NX_INSTANCE_ATTRIBUTE_LOCATION, GL_VERTEX_ATTRIB_ARRAY_DIVISOR, &divisor);
+        EXPECT_EQ(divisor, 1);
+        GLint entityIdEnabled = 0;
+        glGetVertexAttribiv(NX_INSTANCE_ATTRIBUTE_LOCATION + 4, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &entityIdEnabled);
+        EXPECT_EQ(entityIdEnabled, GL_TRUE);
+    }
 }
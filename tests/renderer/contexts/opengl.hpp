@@ -23,6 +23,7 @@
 #include <gtest/gtest.h>
 
 #include "renderer/Buffer.hpp"
+#include "renderer/RenderCommand.hpp"
 
 namespace nexo::renderer {
 
@@ -62,6 +63,9 @@ namespace nexo::renderer {
                 glfwTerminate();
                 GTEST_FAIL() << "OpenGL 4.5 is required. Failing OpenGL tests.";
             }
+
+            // Every test runs on a new context, the bindings cached on the previous one are stale
+            NxRenderCommand::invalidateState();
         }
 
         void TearDown() override {
@@ -79,6 +83,8 @@ namespace nexo::renderer {
         MOCK_METHOD(void, setLayout, (const NxBufferLayout &layout), (override));
         MOCK_METHOD(NxBufferLayout, getLayout, (), (const, override));
         MOCK_METHOD(void, setData, (void *data, size_t size), (override));
+        MOCK_METHOD(void, setSubData, (const void *data, size_t size, size_t offset), (override));
+        MOCK_METHOD(void, copyFrom, (const NxVertexBuffer &source, size_t sourceOffset, size_t destinationOffset, size_t size), (override));
         MOCK_METHOD(unsigned int, getId, (), (const, override));
     };
 
@@ -87,6 +93,8 @@ namespace nexo::renderer {
         MOCK_METHOD(void, bind, (), (const, override));
         MOCK_METHOD(void, unbind, (), (const, override));
         MOCK_METHOD(void, setData, (unsigned int *data, size_t size), (override));
+        MOCK_METHOD(void, setSubData, (const unsigned int *data, size_t count, size_t offset), (override));
+        MOCK_METHOD(void, copyFrom, (const NxIndexBuffer &source, size_t sourceOffset, size_t destinationOffset, size_t count), (override));
         MOCK_METHOD(size_t, getCount, (), (const, override));
         MOCK_METHOD(unsigned int, getId, (), (const, override));
     };